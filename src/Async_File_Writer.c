@@ -0,0 +1,782 @@
+/**
+ * @file Async_File_Writer.c
+ *
+ * @brief A file writer, that writes the data in a background thread.
+ *
+ * The data will be copied in a ring of large buffers. A full buffer will be given to the writer thread, which writes
+ * all full buffers with one writev() call (on systems without writev() with write() calls). In the meantime the
+ * calling thread can fill the next buffer. So the calculation and the I/O overlap. Only when all buffers are full, the
+ * calling thread needs to wait.
+ *
+ * A compressed file will be compressed with zlib in the writer thread: the full buffers go through deflate() and only
+ * the compressed bytes will be written.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Async_File_Writer.h"
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    #include <sys/uio.h>
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+#ifdef HAVE_ZLIB
+    #include <zlib.h>
+#endif /* HAVE_ZLIB */
+
+
+
+// Windows needs the binary mode to avoid the conversion of '\n' to "\r\n"
+#ifdef O_BINARY
+    #ifndef OPEN_FLAGS
+    #define OPEN_FLAGS (O_WRONLY | O_CREAT | O_TRUNC | O_BINARY)
+    #else
+    #error "The macro \"OPEN_FLAGS\" is already defined !"
+    #endif /* OPEN_FLAGS */
+#else
+    #ifndef OPEN_FLAGS
+    #define OPEN_FLAGS (O_WRONLY | O_CREAT | O_TRUNC)
+    #else
+    #error "The macro \"OPEN_FLAGS\" is already defined !"
+    #endif /* OPEN_FLAGS */
+#endif /* O_BINARY */
+
+/**
+ * @brief zlib compression level of the output. The fastest level, because the writer thread should not become slower
+ * than the calculation, that fills the buffers.
+ */
+#ifndef OUTPUT_COMPRESSION_LEVEL
+#define OUTPUT_COMPRESSION_LEVEL 1
+#else
+#error "The macro \"OUTPUT_COMPRESSION_LEVEL\" is already defined !"
+#endif /* OUTPUT_COMPRESSION_LEVEL */
+
+#ifdef HAVE_ZLIB
+/**
+ * @brief State of the gzip compression. Only the writer thread uses this object.
+ */
+struct Output_Compressor
+{
+    z_stream stream;                                            ///< zlib stream with the gzip header and trailer
+    unsigned char output [ASYNC_FILE_WRITER_BUFFER_SIZE];       ///< Buffer for the compressed bytes
+};
+#endif /* HAVE_ZLIB */
+
+
+
+/**
+ * @brief The function of the writer thread: Write the full buffers until the stop flag is set and all buffers are
+ * written.
+ *
+ * After a write error the buffers will be released without writing them. So the calling thread cannot be blocked.
+ *
+ * @param[in] object Async_File_Writer object (as void*)
+ *
+ * @return Always NULL
+ */
+static void*
+Writer_Thread_Function
+(
+        void* object
+);
+
+/**
+ * @brief Write full buffers of the ring to the file.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] first_buffer Index of the first buffer
+ * @param[in] number_of_buffers Number of buffers (The ring can wrap around)
+ *
+ * @return 0, if all data was written; otherwise the errno value of the failed call
+ */
+static int
+Write_Buffers
+(
+        const struct Async_File_Writer* const object,
+        const size_t first_buffer,
+        const size_t number_of_buffers
+);
+
+// Necessary for the compression and for systems without writev()
+#if defined(HAVE_ZLIB) || ! (defined(__unix__) && defined(_POSIX_C_SOURCE))
+/**
+ * @brief Write bytes to the file. Partial writes will be continued, until all bytes were written.
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] file_descriptor File descriptor of the output file
+ * @param[in] data Data
+ * @param[in] data_length Number of bytes
+ *
+ * @return 0, if all data was written; otherwise the errno value of the failed call
+ */
+static int
+Write_Bytes
+(
+        const int file_descriptor,
+        const char* const data,
+        const size_t data_length
+);
+#endif /* defined(HAVE_ZLIB) || ! (defined(__unix__) && defined(_POSIX_C_SOURCE)) */
+
+#ifdef HAVE_ZLIB
+/**
+ * @brief Compress full buffers of the ring and write the compressed bytes to the file.
+ *
+ * With finish_stream the remaining compressed data and the gzip trailer will be written. (Without buffers)
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->compressor != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] first_buffer Index of the first buffer
+ * @param[in] number_of_buffers Number of buffers (The ring can wrap around)
+ * @param[in] finish_stream Finish the gzip stream ?
+ *
+ * @return 0, if all data was written; otherwise the errno value of the failed call
+ */
+static int
+Compress_Buffers
+(
+        const struct Async_File_Writer* const object,
+        const size_t first_buffer,
+        const size_t number_of_buffers,
+        const _Bool finish_stream
+);
+#endif /* HAVE_ZLIB */
+
+/**
+ * @brief Give the current buffer to the writer thread and wait, if necessary, until the next buffer is free.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] wait_for_free_buffer Wait for the next free buffer ? (Not necessary at the end of the writing)
+ */
+static void
+Submit_Current_Buffer
+(
+        struct Async_File_Writer* const object,
+        const _Bool wait_for_free_buffer
+);
+
+/**
+ * @brief Check, whether the writer thread reported a write error. If yes, the program will be stopped with the same
+ * message like a failed synchronous write.
+ *
+ * Asserts:
+ *      object != NULL
+ *      No write error occurred
+ *
+ * @param[in] object Async_File_Writer object
+ */
+static void
+Check_Write_Error
+(
+        struct Async_File_Writer* const object
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Async_File_Writer object. The file will be created (or truncated) and the writer thread starts.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      The file can be opened
+ *      The thread can be created
+ *      If compress_output is true: The program was built with zlib
+ *
+ * @param[in] file_name Name of the output file
+ * @param[in] preallocation_size Number of bytes, that will be preallocated with posix_fallocate() (0: No
+ *      preallocation; the compressed file will never be preallocated)
+ * @param[in] compress_output Write a gzip compressed file ?
+ *
+ * @return Address to the new dynamic Async_File_Writer object
+ */
+extern struct Async_File_Writer*
+AsyncFileWriter_CreateObject
+(
+        const char* const file_name,
+        const uint_fast64_t preallocation_size,
+        const _Bool compress_output
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+#ifndef HAVE_ZLIB
+    ASSERT_FMSG(! compress_output, "Cannot compress the file \"%s\": The program was built without zlib !", file_name);
+#endif /* HAVE_ZLIB */
+
+    struct Async_File_Writer* new_object = (struct Async_File_Writer*) CALLOC(1, sizeof (struct Async_File_Writer));
+    ASSERT_ALLOC(new_object, "Cannot create a new Async_File_Writer object !", sizeof (struct Async_File_Writer));
+
+    new_object->file_name = file_name;
+    new_object->file_descriptor = open(file_name, OPEN_FLAGS, 0644);
+    ASSERT_FMSG(new_object->file_descriptor != -1, "Cannot open/create the file: \"%s\" (%s) !", file_name,
+            strerror(errno));
+
+#ifdef HAVE_ZLIB
+    if (compress_output)
+    {
+        new_object->compressor = (struct Output_Compressor*) MALLOC(sizeof (struct Output_Compressor));
+        ASSERT_ALLOC(new_object->compressor, "Cannot create the compressor for the Async_File_Writer object !",
+                sizeof (struct Output_Compressor));
+        memset(&(new_object->compressor->stream), '\0', sizeof (z_stream));
+        // 15 + 16: Maximum window size with a gzip header and trailer
+        const int init_result = deflateInit2(&(new_object->compressor->stream), OUTPUT_COMPRESSION_LEVEL, Z_DEFLATED,
+                15 + 16, 8, Z_DEFAULT_STRATEGY);
+        ASSERT_FMSG(init_result == Z_OK, "Cannot initialize the gzip compression for the file \"%s\" (zlib error %d) !",
+                file_name, init_result);
+    }
+#endif /* HAVE_ZLIB */
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    // The size of the compressed file is unknown; so a preallocation is not useful
+    if (preallocation_size > 0 && new_object->compressor == NULL)
+    {
+        const int fallocate_result = posix_fallocate(new_object->file_descriptor, 0, (off_t) preallocation_size);
+        // Not every file system supports the preallocation; this is not an error, only the optimization is not available
+        ASSERT_FMSG(fallocate_result == 0 || fallocate_result == EINVAL || fallocate_result == EOPNOTSUPP,
+                "Cannot preallocate %" PRIuFAST64 " bytes for the file \"%s\": %s", preallocation_size, file_name,
+                strerror(fallocate_result));
+        new_object->preallocated_bytes = (fallocate_result == 0) ? preallocation_size : 0;
+    }
+#else
+    (void) preallocation_size;
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+    for (size_t i = 0; i < ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS; ++ i)
+    {
+        new_object->buffers [i] = (char*) MALLOC(ASYNC_FILE_WRITER_BUFFER_SIZE * sizeof (char));
+        ASSERT_ALLOC(new_object->buffers [i], "Cannot create a buffer for the Async_File_Writer object !",
+                ASYNC_FILE_WRITER_BUFFER_SIZE * sizeof (char));
+    }
+
+    int pthread_result = pthread_mutex_init(&(new_object->mutex), NULL);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create a mutex: %s", strerror(pthread_result));
+    pthread_result = pthread_cond_init(&(new_object->buffer_full), NULL);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create a condition variable: %s", strerror(pthread_result));
+    pthread_result = pthread_cond_init(&(new_object->buffer_free), NULL);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create a condition variable: %s", strerror(pthread_result));
+
+    pthread_result = pthread_create(&(new_object->writer_thread), NULL, Writer_Thread_Function, new_object);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create the writer thread for the file \"%s\": %s", file_name,
+            strerror(pthread_result));
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write all pending data, stop the writer thread, close the file and delete the Async_File_Writer object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      No write error occurred
+ *
+ * @param[in] object Async_File_Writer object
+ */
+extern void
+AsyncFileWriter_DeleteObject
+(
+        struct Async_File_Writer* object
+)
+{
+    ASSERT_MSG(object != NULL, "Async_File_Writer is NULL !");
+
+    if (object->used_bytes [object->fill_index] > 0)
+    {
+        Submit_Current_Buffer(object, false);
+    }
+
+    pthread_mutex_lock(&(object->mutex));
+    object->stop = true;
+    pthread_cond_signal(&(object->buffer_full));
+    pthread_mutex_unlock(&(object->mutex));
+
+    const int join_result = pthread_join(object->writer_thread, NULL);
+    ASSERT_FMSG(join_result == 0, "Cannot join the writer thread of the file \"%s\": %s", object->file_name,
+            strerror(join_result));
+    Check_Write_Error(object);
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    // Remove the unused part of the preallocated memory
+    if (object->preallocated_bytes > object->written_bytes)
+    {
+        ASSERT_FMSG(ftruncate(object->file_descriptor, (off_t) object->written_bytes) == 0,
+                "Error while writing in the file \"%s\": %s", object->file_name, strerror(errno));
+    }
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+    ASSERT_FMSG(close(object->file_descriptor) == 0, "Error while writing in the file \"%s\": %s", object->file_name,
+            strerror(errno));
+    object->file_descriptor = -1;
+
+    pthread_cond_destroy(&(object->buffer_free));
+    pthread_cond_destroy(&(object->buffer_full));
+    pthread_mutex_destroy(&(object->mutex));
+
+    for (size_t i = 0; i < ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS; ++ i)
+    {
+        FREE_AND_SET_TO_NULL(object->buffers [i]);
+    }
+#ifdef HAVE_ZLIB
+    if (object->compressor != NULL)
+    {
+        deflateEnd(&(object->compressor->stream));
+        FREE_AND_SET_TO_NULL(object->compressor);
+    }
+#endif /* HAVE_ZLIB */
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append data to the file. The data will be copied; so the memory can be reused after the call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      No write error occurred
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] data Data
+ * @param[in] data_length Number of bytes
+ */
+extern void
+AsyncFileWriter_Write
+(
+        struct Async_File_Writer* const restrict object,
+        const void* const restrict data,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "Async_File_Writer is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+
+    Check_Write_Error(object);
+
+    const char* remaining_data = (const char*) data;
+    size_t remaining_length = data_length;
+    while (remaining_length > 0)
+    {
+        const size_t free_bytes = ASYNC_FILE_WRITER_BUFFER_SIZE - object->used_bytes [object->fill_index];
+        const size_t copy_length = (remaining_length < free_bytes) ? remaining_length : free_bytes;
+
+        memcpy(object->buffers [object->fill_index] + object->used_bytes [object->fill_index], remaining_data,
+                copy_length);
+        object->used_bytes [object->fill_index] += copy_length;
+        remaining_data += copy_length;
+        remaining_length -= copy_length;
+
+        if (object->used_bytes [object->fill_index] == ASYNC_FILE_WRITER_BUFFER_SIZE)
+        {
+            Submit_Current_Buffer(object, true);
+        }
+    }
+    object->written_bytes += data_length;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the full memory usage in bytes.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+AsyncFileWriter_GetAllocatedMemSize
+(
+        const struct Async_File_Writer* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Async_File_Writer is NULL !");
+
+    size_t result = sizeof (struct Async_File_Writer) + ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS *
+            ASYNC_FILE_WRITER_BUFFER_SIZE;
+#ifdef HAVE_ZLIB
+    if (object->compressor != NULL)
+    {
+        result += sizeof (struct Output_Compressor);
+    }
+#endif /* HAVE_ZLIB */
+
+    return result;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief The function of the writer thread: Write the full buffers until the stop flag is set and all buffers are
+ * written.
+ *
+ * After a write error the buffers will be released without writing them. So the calling thread cannot be blocked.
+ *
+ * @param[in] object Async_File_Writer object (as void*)
+ *
+ * @return Always NULL
+ */
+static void*
+Writer_Thread_Function
+(
+        void* object
+)
+{
+    struct Async_File_Writer* const writer = (struct Async_File_Writer*) object;
+
+    pthread_mutex_lock(&(writer->mutex));
+    while (true)
+    {
+        while (writer->full_buffers == 0 && ! writer->stop)
+        {
+            pthread_cond_wait(&(writer->buffer_full), &(writer->mutex));
+        }
+        if (writer->full_buffers == 0)
+        {
+            // Stop flag set and all buffers written
+            break;
+        }
+
+        // All buffers, that are full at this time, will be written without a locked mutex
+        const size_t first_buffer       = writer->write_index;
+        const size_t number_of_buffers  = writer->full_buffers;
+        const _Bool error_occurred      = writer->error_number != 0;
+        pthread_mutex_unlock(&(writer->mutex));
+
+        const int write_result = (error_occurred) ? 0 : Write_Buffers(writer, first_buffer, number_of_buffers);
+
+        pthread_mutex_lock(&(writer->mutex));
+        if (write_result != 0)
+        {
+            writer->error_number = write_result;
+        }
+        writer->write_index = (first_buffer + number_of_buffers) % ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS;
+        writer->full_buffers -= number_of_buffers;
+        pthread_cond_signal(&(writer->buffer_free));
+    }
+    const _Bool error_occurred = writer->error_number != 0;
+    pthread_mutex_unlock(&(writer->mutex));
+
+#ifdef HAVE_ZLIB
+    // The rest of the compressed data and the gzip trailer
+    if (writer->compressor != NULL && ! error_occurred)
+    {
+        const int write_result = Compress_Buffers(writer, 0, 0, true);
+        pthread_mutex_lock(&(writer->mutex));
+        writer->error_number = write_result;
+        pthread_mutex_unlock(&(writer->mutex));
+    }
+#else
+    (void) error_occurred;
+#endif /* HAVE_ZLIB */
+
+    return NULL;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write full buffers of the ring to the file.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] first_buffer Index of the first buffer
+ * @param[in] number_of_buffers Number of buffers (The ring can wrap around)
+ *
+ * @return 0, if all data was written; otherwise the errno value of the failed call
+ */
+static int
+Write_Buffers
+(
+        const struct Async_File_Writer* const object,
+        const size_t first_buffer,
+        const size_t number_of_buffers
+)
+{
+    ASSERT_MSG(object != NULL, "Async_File_Writer is NULL !");
+
+#ifdef HAVE_ZLIB
+    if (object->compressor != NULL)
+    {
+        return Compress_Buffers(object, first_buffer, number_of_buffers, false);
+    }
+#endif /* HAVE_ZLIB */
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    struct iovec io_vectors [ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS];
+    for (size_t i = 0; i < number_of_buffers; ++ i)
+    {
+        const size_t buffer_index = (first_buffer + i) % ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS;
+        io_vectors [i].iov_base = object->buffers [buffer_index];
+        io_vectors [i].iov_len  = object->used_bytes [buffer_index];
+    }
+
+    // writev() can write less bytes than requested; then the rest needs to be written with the next call
+    struct iovec* next_vector = io_vectors;
+    size_t remaining_vectors = number_of_buffers;
+    while (remaining_vectors > 0)
+    {
+        const ssize_t written_bytes = writev(object->file_descriptor, next_vector, (int) remaining_vectors);
+        if (written_bytes == -1)
+        {
+            if (errno == EINTR) { continue; }
+            return errno;
+        }
+
+        size_t bytes_to_skip = (size_t) written_bytes;
+        while (remaining_vectors > 0 && bytes_to_skip >= next_vector->iov_len)
+        {
+            bytes_to_skip -= next_vector->iov_len;
+            ++ next_vector;
+            -- remaining_vectors;
+        }
+        if (remaining_vectors > 0)
+        {
+            next_vector->iov_base = (char*) next_vector->iov_base + bytes_to_skip;
+            next_vector->iov_len -= bytes_to_skip;
+        }
+    }
+#else
+    // Fallback without writev(): One write() call per buffer
+    for (size_t i = 0; i < number_of_buffers; ++ i)
+    {
+        const size_t buffer_index = (first_buffer + i) % ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS;
+        const int write_result = Write_Bytes(object->file_descriptor, object->buffers [buffer_index],
+                object->used_bytes [buffer_index]);
+        if (write_result != 0) { return write_result; }
+    }
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+// Necessary for the compression and for systems without writev()
+#if defined(HAVE_ZLIB) || ! (defined(__unix__) && defined(_POSIX_C_SOURCE))
+/**
+ * @brief Write bytes to the file. Partial writes will be continued, until all bytes were written.
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] file_descriptor File descriptor of the output file
+ * @param[in] data Data
+ * @param[in] data_length Number of bytes
+ *
+ * @return 0, if all data was written; otherwise the errno value of the failed call
+ */
+static int
+Write_Bytes
+(
+        const int file_descriptor,
+        const char* const data,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+
+    const char* next_byte = data;
+    size_t remaining_bytes = data_length;
+
+    while (remaining_bytes > 0)
+    {
+        const int written_bytes = (int) write(file_descriptor, next_byte, (unsigned int) remaining_bytes);
+        if (written_bytes == -1)
+        {
+            if (errno == EINTR) { continue; }
+            return errno;
+        }
+        next_byte += written_bytes;
+        remaining_bytes -= (size_t) written_bytes;
+    }
+
+    return 0;
+}
+#endif /* defined(HAVE_ZLIB) || ! (defined(__unix__) && defined(_POSIX_C_SOURCE)) */
+
+//---------------------------------------------------------------------------------------------------------------------
+
+#ifdef HAVE_ZLIB
+/**
+ * @brief Compress full buffers of the ring and write the compressed bytes to the file.
+ *
+ * With finish_stream the remaining compressed data and the gzip trailer will be written. (Without buffers)
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->compressor != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] first_buffer Index of the first buffer
+ * @param[in] number_of_buffers Number of buffers (The ring can wrap around)
+ * @param[in] finish_stream Finish the gzip stream ?
+ *
+ * @return 0, if all data was written; otherwise the errno value of the failed call
+ */
+static int
+Compress_Buffers
+(
+        const struct Async_File_Writer* const object,
+        const size_t first_buffer,
+        const size_t number_of_buffers,
+        const _Bool finish_stream
+)
+{
+    ASSERT_MSG(object != NULL, "Async_File_Writer is NULL !");
+    ASSERT_MSG(object->compressor != NULL, "Output_Compressor is NULL !");
+
+    struct Output_Compressor* const compressor = object->compressor;
+    z_stream* const stream = &(compressor->stream);
+
+    // One round per buffer; the finishing uses one round without input
+    const size_t number_of_rounds = (finish_stream) ? 1 : number_of_buffers;
+    for (size_t i = 0; i < number_of_rounds; ++ i)
+    {
+        if (finish_stream)
+        {
+            stream->next_in = Z_NULL;
+            stream->avail_in = 0;
+        }
+        else
+        {
+            // The buffers are never larger than ASYNC_FILE_WRITER_BUFFER_SIZE; so the size fits in an uInt
+            const size_t buffer_index = (first_buffer + i) % ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS;
+            stream->next_in = (unsigned char*) object->buffers [buffer_index];
+            stream->avail_in = (uInt) object->used_bytes [buffer_index];
+        }
+
+        // deflate() needs to be called, until the output buffer is not completely filled
+        do
+        {
+            stream->next_out = compressor->output;
+            stream->avail_out = (uInt) sizeof (compressor->output);
+
+            const int deflate_result = deflate(stream, (finish_stream) ? Z_FINISH : Z_NO_FLUSH);
+            ASSERT_FMSG(deflate_result != Z_STREAM_ERROR, "gzip compression error in the file \"%s\" !",
+                    object->file_name);
+
+            const size_t compressed_bytes = sizeof (compressor->output) - (size_t) stream->avail_out;
+            if (compressed_bytes > 0)
+            {
+                const int write_result = Write_Bytes(object->file_descriptor, (const char*) compressor->output,
+                        compressed_bytes);
+                if (write_result != 0) { return write_result; }
+            }
+        } while (stream->avail_out == 0);
+    }
+
+    return 0;
+}
+#endif /* HAVE_ZLIB */
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Give the current buffer to the writer thread and wait, if necessary, until the next buffer is free.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] wait_for_free_buffer Wait for the next free buffer ? (Not necessary at the end of the writing)
+ */
+static void
+Submit_Current_Buffer
+(
+        struct Async_File_Writer* const object,
+        const _Bool wait_for_free_buffer
+)
+{
+    ASSERT_MSG(object != NULL, "Async_File_Writer is NULL !");
+
+    pthread_mutex_lock(&(object->mutex));
+    ++ object->full_buffers;
+    pthread_cond_signal(&(object->buffer_full));
+
+    object->fill_index = (object->fill_index + 1) % ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS;
+    if (wait_for_free_buffer)
+    {
+        // The next buffer is the oldest buffer in the ring; it is free, when not all buffers are full
+        while (object->full_buffers == ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS)
+        {
+            pthread_cond_wait(&(object->buffer_free), &(object->mutex));
+        }
+    }
+    pthread_mutex_unlock(&(object->mutex));
+
+    if (wait_for_free_buffer)
+    {
+        object->used_bytes [object->fill_index] = 0;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the writer thread reported a write error. If yes, the program will be stopped with the same
+ * message like a failed synchronous write.
+ *
+ * Asserts:
+ *      object != NULL
+ *      No write error occurred
+ *
+ * @param[in] object Async_File_Writer object
+ */
+static void
+Check_Write_Error
+(
+        struct Async_File_Writer* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Async_File_Writer is NULL !");
+
+    pthread_mutex_lock(&(object->mutex));
+    const int error_number = object->error_number;
+    pthread_mutex_unlock(&(object->mutex));
+
+    ASSERT_FMSG(error_number == 0, "Error while writing in the file \"%s\": %s", object->file_name,
+            strerror(error_number));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef OPEN_FLAGS
+#undef OPEN_FLAGS
+#endif /* OPEN_FLAGS */
+
+#ifdef OUTPUT_COMPRESSION_LEVEL
+#undef OUTPUT_COMPRESSION_LEVEL
+#endif /* OUTPUT_COMPRESSION_LEVEL */
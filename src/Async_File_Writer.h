@@ -0,0 +1,193 @@
+/**
+ * @file Async_File_Writer.h
+ *
+ * @brief A file writer, that writes the data in a background thread.
+ *
+ * The data will be copied in a ring of large buffers. A full buffer will be given to the writer thread, which writes
+ * all full buffers with one writev() call (on systems without writev() with write() calls). In the meantime the
+ * calling thread can fill the next buffer. So the calculation and the I/O overlap. Only when all buffers are full, the
+ * calling thread needs to wait.
+ *
+ * Write errors in the writer thread will be saved and reported (with ASSERT_FMSG) in the calling thread at the next
+ * AsyncFileWriter_Write() or AsyncFileWriter_DeleteObject() call.
+ *
+ * Optional the file can be preallocated with posix_fallocate(). At the end the file will be truncated to the number of
+ * written bytes.
+ *
+ * Optional the data can be gzip compressed (needs zlib at build time; HAVE_ZLIB). The compression runs also in the
+ * writer thread; so the calling thread does not need more time for a compressed file.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef ASYNC_FILE_WRITER_H
+#define ASYNC_FILE_WRITER_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "Error_Handling/_Generics.h"
+
+
+
+/**
+ * @brief Size of one buffer in the ring in bytes.
+ */
+#ifndef ASYNC_FILE_WRITER_BUFFER_SIZE
+#define ASYNC_FILE_WRITER_BUFFER_SIZE 1048576
+#else
+#error "The macro \"ASYNC_FILE_WRITER_BUFFER_SIZE\" is already defined !"
+#endif /* ASYNC_FILE_WRITER_BUFFER_SIZE */
+
+/**
+ * @brief Number of buffers in the ring.
+ */
+#ifndef ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS
+#define ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS 4
+#else
+#error "The macro \"ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS\" is already defined !"
+#endif /* ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS */
+
+/**
+ * @brief Check, whether the macro values are valid.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(ASYNC_FILE_WRITER_BUFFER_SIZE > 0, "The marco \"ASYNC_FILE_WRITER_BUFFER_SIZE\" is zero !");
+// With two buffers one buffer can be filled while the other one will be written
+_Static_assert(ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS >= 2,
+        "The marco \"ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS\" needs to be at least 2 !");
+
+IS_TYPE(ASYNC_FILE_WRITER_BUFFER_SIZE, int)
+IS_TYPE(ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//=====================================================================================================================
+
+/**
+ * @brief State of the gzip compression. Only the writer thread uses this object. (Defined in Async_File_Writer.c)
+ */
+struct Output_Compressor;
+
+/**
+ * @brief The Async_File_Writer object.
+ *
+ * The ring: The calling thread fills the buffer "fill_index". The writer thread writes the buffers beginning with
+ * "write_index". "full_buffers" is the number of buffers, that are ready for writing. All fields below the mutex are
+ * shared between the two threads and only accessible with a locked mutex.
+ */
+struct Async_File_Writer
+{
+    int file_descriptor;                                        ///< File descriptor of the output file
+    const char* file_name;                                      ///< Name of the output file (for error messages)
+    uint_fast64_t preallocated_bytes;                           ///< Preallocated size of the file (0: No preallocation)
+    struct Output_Compressor* compressor;                       ///< gzip compression (NULL: Uncompressed file)
+
+    char* buffers [ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS];        ///< Ring of buffers
+    size_t used_bytes [ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS];    ///< Used bytes in the specific buffer
+    size_t fill_index;                                          ///< Buffer, that will be filled by the calling thread
+
+    pthread_t writer_thread;                                    ///< Thread, that writes the full buffers
+    pthread_mutex_t mutex;                                      ///< Mutex for the shared fields
+    pthread_cond_t buffer_full;                                 ///< Signal: A buffer is ready for writing
+    pthread_cond_t buffer_free;                                 ///< Signal: A buffer was written
+
+    size_t write_index;                                         ///< Next buffer, that will be written (shared)
+    size_t full_buffers;                                        ///< Number of buffers, that are ready (shared)
+    _Bool stop;                                                 ///< No more data will be given (shared)
+    int error_number;                                           ///< errno of a write error; 0: no error (shared)
+
+    uint_fast64_t written_bytes;                                ///< Number of bytes, that were given to the writer
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Create a new Async_File_Writer object. The file will be created (or truncated) and the writer thread starts.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      The file can be opened
+ *      The thread can be created
+ *      If compress_output is true: The program was built with zlib
+ *
+ * @param[in] file_name Name of the output file
+ * @param[in] preallocation_size Number of bytes, that will be preallocated with posix_fallocate() (0: No
+ *      preallocation; the compressed file will never be preallocated)
+ * @param[in] compress_output Write a gzip compressed file ?
+ *
+ * @return Address to the new dynamic Async_File_Writer object
+ */
+extern struct Async_File_Writer*
+AsyncFileWriter_CreateObject
+(
+        const char* const file_name,
+        const uint_fast64_t preallocation_size,
+        const _Bool compress_output
+);
+
+/**
+ * @brief Write all pending data, stop the writer thread, close the file and delete the Async_File_Writer object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      No write error occurred
+ *
+ * @param[in] object Async_File_Writer object
+ */
+extern void
+AsyncFileWriter_DeleteObject
+(
+        struct Async_File_Writer* object
+);
+
+/**
+ * @brief Append data to the file. The data will be copied; so the memory can be reused after the call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      No write error occurred
+ *
+ * @param[in] object Async_File_Writer object
+ * @param[in] data Data
+ * @param[in] data_length Number of bytes
+ */
+extern void
+AsyncFileWriter_Write
+(
+        struct Async_File_Writer* const restrict object,
+        const void* const restrict data,
+        const size_t data_length
+);
+
+/**
+ * @brief Determine the full memory usage in bytes.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Async_File_Writer object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+AsyncFileWriter_GetAllocatedMemSize
+(
+        const struct Async_File_Writer* const object
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ASYNC_FILE_WRITER_H */
@@ -20,6 +20,7 @@
 #include "Defines.h"
 #include "Misc.h"
 #include "Error_Handling/Dynamic_Memory.h"
+#include "Result_Export.h"
 
 
 
@@ -110,6 +111,96 @@ const char* const GLOBAL_ADDITIONAL_PROGRAM_DESCRIPTION =
 #error "The macro \"GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT\" is already defined !"
 #endif /* GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT */
 
+#ifndef GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT
+#define GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT "json"
+#else
+#error "The macro \"GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT */
+
+#ifndef GLOBAL_CLI_BINARY_TO_JSON_DEFAULT
+#define GLOBAL_CLI_BINARY_TO_JSON_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_BINARY_TO_JSON_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_BINARY_TO_JSON_DEFAULT */
+
+#ifndef GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT
+#define GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT 0
+#else
+#error "The macro \"GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT */
+
+#ifndef GLOBAL_CLI_COUNTS_ONLY_DEFAULT
+#define GLOBAL_CLI_COUNTS_ONLY_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_COUNTS_ONLY_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_COUNTS_ONLY_DEFAULT */
+
+#ifndef GLOBAL_CLI_READER_THREADS_DEFAULT
+#define GLOBAL_CLI_READER_THREADS_DEFAULT 1
+#else
+#error "The macro \"GLOBAL_CLI_READER_THREADS_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_READER_THREADS_DEFAULT */
+
+#ifndef GLOBAL_CLI_CJSON_PARSER_DEFAULT
+#define GLOBAL_CLI_CJSON_PARSER_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_CJSON_PARSER_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_CJSON_PARSER_DEFAULT */
+
+#ifndef GLOBAL_CLI_BATCH_FILE_DEFAULT
+#define GLOBAL_CLI_BATCH_FILE_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_BATCH_FILE_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_BATCH_FILE_DEFAULT */
+
+#ifndef GLOBAL_CLI_COMPILE_CORPUS_DEFAULT
+#define GLOBAL_CLI_COMPILE_CORPUS_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_COMPILE_CORPUS_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_COMPILE_CORPUS_DEFAULT */
+
+#ifndef GLOBAL_CLI_APPEND_CORPUS_DEFAULT
+#define GLOBAL_CLI_APPEND_CORPUS_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_APPEND_CORPUS_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_APPEND_CORPUS_DEFAULT */
+
+#ifndef GLOBAL_CLI_COMPACT_CORPUS_DEFAULT
+#define GLOBAL_CLI_COMPACT_CORPUS_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_COMPACT_CORPUS_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_COMPACT_CORPUS_DEFAULT */
+
+#ifndef GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT
+#define GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT */
+
+#ifndef GLOBAL_CLI_STOP_WORD_FILE_DEFAULT
+#define GLOBAL_CLI_STOP_WORD_FILE_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_STOP_WORD_FILE_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_STOP_WORD_FILE_DEFAULT */
+
+#ifndef GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT
+#define GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT 0.0f
+#else
+#error "The macro \"GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT */
+
+#ifndef GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT
+#define GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT */
+
+#ifndef GLOBAL_CLI_MATCH_ON_DEFAULT
+#define GLOBAL_CLI_MATCH_ON_DEFAULT "tokens"
+#else
+#error "The macro \"GLOBAL_CLI_MATCH_ON_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_MATCH_ON_DEFAULT */
+
 #ifndef GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT
 #define GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT (float) NAN
 #else
@@ -128,6 +219,23 @@ _Bool GLOBAL_CLI_SHOW_TOO_LONG_TOKENS           = GLOBAL_CLI_SHOW_TOO_LONG_TOKEN
 _Bool GLOBAL_CLI_NO_PART_MATCHES                = GLOBAL_CLI_NO_PART_MATCHES_DEFAULT;
 _Bool GLOBAL_CLI_NO_FULL_MATCHES                = GLOBAL_CLI_NO_FULL_MATCHES_DEFAULT;
 _Bool GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN    = GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT;
+const char* GLOBAL_CLI_OUTPUT_FORMAT            = GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT;
+const char* GLOBAL_CLI_BINARY_TO_JSON           = GLOBAL_CLI_BINARY_TO_JSON_DEFAULT;
+int GLOBAL_CLI_PREALLOCATE_OUTPUT               = GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT;
+_Bool GLOBAL_CLI_COUNTS_ONLY                    = GLOBAL_CLI_COUNTS_ONLY_DEFAULT;
+int GLOBAL_CLI_READER_THREADS                   = GLOBAL_CLI_READER_THREADS_DEFAULT;
+_Bool GLOBAL_CLI_CJSON_PARSER                   = GLOBAL_CLI_CJSON_PARSER_DEFAULT;
+_Bool GLOBAL_CLI_COMPRESS_OUTPUT                = GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT;
+const char* GLOBAL_CLI_BATCH_FILE               = GLOBAL_CLI_BATCH_FILE_DEFAULT;
+const char* GLOBAL_CLI_COMPILE_CORPUS           = GLOBAL_CLI_COMPILE_CORPUS_DEFAULT;
+const char* GLOBAL_CLI_APPEND_CORPUS            = GLOBAL_CLI_APPEND_CORPUS_DEFAULT;
+const char* GLOBAL_CLI_COMPACT_CORPUS           = GLOBAL_CLI_COMPACT_CORPUS_DEFAULT;
+const char* GLOBAL_CLI_STOP_WORD_FILE           = GLOBAL_CLI_STOP_WORD_FILE_DEFAULT;
+const char* GLOBAL_CLI_STOP_WORD_FILES [GLOBAL_CLI_MAX_STOP_WORD_FILES];
+size_t GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES     = 0;
+float GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY         = GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT;
+_Bool GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY     = GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT;
+const char* GLOBAL_CLI_MATCH_ON                 = GLOBAL_CLI_MATCH_ON_DEFAULT;
 float GLOBAL_ABORT_PROCESS_PERCENT              = GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT;
 
 
@@ -158,6 +266,11 @@ void Check_CLI_Parameter_Logical_Consistency (void)
         FPRINTF_FFLUSH(stderr, "\nInput file 1 and the output file are the same files (%s) !\n", GLOBAL_CLI_INPUT_FILE);
         EXIT(1);
     }
+    // In the batch mode the job list contains the second input files and the output files
+    if (GLOBAL_CLI_BATCH_FILE != NULL)
+    {
+        return;
+    }
     if (length_input_file_2 == length_output_file &&
             strncmp(GLOBAL_CLI_INPUT_FILE2, GLOBAL_CLI_OUTPUT_FILE, length_input_file_2) == 0)
     {
@@ -272,6 +385,463 @@ void Check_CLI_Parameter_CLI_OUTPUT_FILE (void)
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Test function for the CLI parameter, that is used as output format.
+ */
+void Check_CLI_Parameter_CLI_OUTPUT_FORMAT (void)
+{
+    if (ResultExport_StringToOutputFormat(GLOBAL_CLI_OUTPUT_FORMAT) == OUTPUT_FORMAT_INVALID)
+    {
+        FPRINTF_FFLUSH (stderr, "Invalid output format \"%s\" ! Valid formats: json, ndjson, tsv, binary\n",
+                (GLOBAL_CLI_OUTPUT_FORMAT != NULL) ? GLOBAL_CLI_OUTPUT_FORMAT : "(null)");
+        EXIT(1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that is used as preallocation size (in MiB) of the output file.
+ */
+void Check_CLI_Parameter_CLI_PREALLOCATE_OUTPUT (void)
+{
+    if (GLOBAL_CLI_PREALLOCATE_OUTPUT < 0)
+    {
+        FPRINTF_FFLUSH (stderr, "Invalid preallocation size %d MiB ! The size cannot be negative.\n",
+                GLOBAL_CLI_PREALLOCATE_OUTPUT);
+        EXIT(1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that enables the gzip compression of the output file. (Only possible,
+ * if the program was built with zlib)
+ */
+void Check_CLI_Parameter_CLI_COMPRESS_OUTPUT (void)
+{
+#ifndef HAVE_ZLIB
+    if (GLOBAL_CLI_COMPRESS_OUTPUT)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Cannot compress the output file ! The program was built without zlib.\n");
+        EXIT(1);
+    }
+#endif /* HAVE_ZLIB */
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that enables the count only mode. (Only the JSON and the NDJSON format
+ * can hold the counters)
+ */
+void Check_CLI_Parameter_CLI_COUNTS_ONLY (void)
+{
+    const enum Output_Format output_format = ResultExport_StringToOutputFormat(GLOBAL_CLI_OUTPUT_FORMAT);
+
+    if (GLOBAL_CLI_COUNTS_ONLY && output_format != OUTPUT_FORMAT_JSON && output_format != OUTPUT_FORMAT_NDJSON)
+    {
+        FPRINTF_FFLUSH (stderr, "The count only mode needs the output format json or ndjson ! Got: \"%s\"\n",
+                (GLOBAL_CLI_OUTPUT_FORMAT != NULL) ? GLOBAL_CLI_OUTPUT_FORMAT : "(null)");
+        EXIT(1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that is used as number of reader threads.
+ */
+void Check_CLI_Parameter_CLI_READER_THREADS (void)
+{
+    if (GLOBAL_CLI_READER_THREADS < 1)
+    {
+        FPRINTF_FFLUSH (stderr, "Invalid number of reader threads %d ! At least one thread is necessary.\n",
+                GLOBAL_CLI_READER_THREADS);
+        EXIT(1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that is used as binary result file name for the conversion to JSON.
+ */
+void Check_CLI_Parameter_CLI_BINARY_TO_JSON (void)
+{
+    if (GLOBAL_CLI_BINARY_TO_JSON == NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid binary file name ! The binary file name is NULL !\n");
+        EXIT(1);
+    }
+    if (IS_STRING_LENGTH_ZERO(GLOBAL_CLI_BINARY_TO_JSON))
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid binary file name ! The binary file name length is zero !\n");
+        EXIT(1);
+    }
+
+    // Testweise die Eingabedatei oeffnen
+    FILE* input_file = fopen (GLOBAL_CLI_BINARY_TO_JSON, "rb");
+
+    if (input_file == NULL)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot open the binary file \"%s\" !\n", GLOBAL_CLI_BINARY_TO_JSON);
+        EXIT(1);
+    }
+
+    if (fclose (input_file) == EOF)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot close the binary file \"%s\" !\n", GLOBAL_CLI_BINARY_TO_JSON);
+        EXIT(1);
+    }
+    input_file = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that is used as job list file of the batch mode. (The job list replaces
+ * the second input file and the output file)
+ */
+void Check_CLI_Parameter_CLI_BATCH_FILE (void)
+{
+    if (GLOBAL_CLI_BATCH_FILE == NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid job list file name ! The job list file name is NULL !\n");
+        EXIT(1);
+    }
+    if (IS_STRING_LENGTH_ZERO(GLOBAL_CLI_BATCH_FILE))
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid job list file name ! The job list file name length is zero !\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_INPUT_FILE2 != NULL || GLOBAL_CLI_OUTPUT_FILE != NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "The job list contains the second input files and the output files ! The "
+                "options [-j / --input2] and [-o / --output] cannot be used with [-b / --batch].\n");
+        EXIT(1);
+    }
+
+    // Testweise die Job-Liste oeffnen
+    FILE* batch_file = fopen (GLOBAL_CLI_BATCH_FILE, "r");
+
+    if (batch_file == NULL)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot open the job list file \"%s\" !\n", GLOBAL_CLI_BATCH_FILE);
+        EXIT(1);
+    }
+
+    if (fclose (batch_file) == EOF)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot close the job list file \"%s\" !\n", GLOBAL_CLI_BATCH_FILE);
+        EXIT(1);
+    }
+    batch_file = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that is used as name of the compiled corpus file.
+ */
+void Check_CLI_Parameter_CLI_COMPILE_CORPUS (void)
+{
+    if (GLOBAL_CLI_COMPILE_CORPUS == NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid corpus file name ! The corpus file name is NULL !\n");
+        EXIT(1);
+    }
+    if (IS_STRING_LENGTH_ZERO(GLOBAL_CLI_COMPILE_CORPUS))
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid corpus file name ! The corpus file name length is zero !\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_INPUT_FILE2 != NULL || GLOBAL_CLI_OUTPUT_FILE != NULL || GLOBAL_CLI_BATCH_FILE != NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "The compilation of a corpus file needs only the first input file ! The "
+                "options [-j / --input2], [-o / --output] and [-b / --batch] cannot be used with [--compile_corpus].\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES > 0)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "A compiled corpus contains all tokens except the built-in stop words ! "
+                "Own stop words will be removed, when the corpus will be used. [--stop_words] cannot be used with "
+                "[--compile_corpus].\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "A compiled corpus contains all tokens ! The document frequencies will be "
+                "determined, when the corpus will be used. [--max_df] cannot be used with [--compile_corpus].\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_INPUT_FILE != NULL && strcmp(GLOBAL_CLI_INPUT_FILE, GLOBAL_CLI_COMPILE_CORPUS) == 0)
+    {
+        FPRINTF_FFLUSH (stderr, "The input file and the corpus file are the same files (%s) !\n",
+                GLOBAL_CLI_COMPILE_CORPUS);
+        EXIT(1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that is used as name of the compiled corpus file, that will be extended
+ * with the first input file.
+ */
+void Check_CLI_Parameter_CLI_APPEND_CORPUS (void)
+{
+    if (GLOBAL_CLI_APPEND_CORPUS == NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid corpus file name ! The corpus file name is NULL !\n");
+        EXIT(1);
+    }
+    if (IS_STRING_LENGTH_ZERO(GLOBAL_CLI_APPEND_CORPUS))
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid corpus file name ! The corpus file name length is zero !\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_INPUT_FILE2 != NULL || GLOBAL_CLI_OUTPUT_FILE != NULL || GLOBAL_CLI_BATCH_FILE != NULL ||
+            GLOBAL_CLI_COMPILE_CORPUS != NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "The append to a corpus file needs only the first input file ! The "
+                "options [-j / --input2], [-o / --output], [-b / --batch] and [--compile_corpus] cannot be used with "
+                "[--append_corpus].\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES > 0)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "A compiled corpus contains all tokens except the built-in stop words ! "
+                "Own stop words will be removed, when the corpus will be used. [--stop_words] cannot be used with "
+                "[--append_corpus].\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "A compiled corpus contains all tokens ! The document frequencies will be "
+                "determined, when the corpus will be used. [--max_df] cannot be used with [--append_corpus].\n");
+        EXIT(1);
+    }
+    if (GLOBAL_CLI_INPUT_FILE != NULL && strcmp(GLOBAL_CLI_INPUT_FILE, GLOBAL_CLI_APPEND_CORPUS) == 0)
+    {
+        FPRINTF_FFLUSH (stderr, "The input file and the corpus file are the same files (%s) !\n",
+                GLOBAL_CLI_APPEND_CORPUS);
+        EXIT(1);
+    }
+
+    // Testweise die Korpusdatei oeffnen
+    FILE* corpus_file = fopen (GLOBAL_CLI_APPEND_CORPUS, "rb");
+
+    if (corpus_file == NULL)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot open the corpus file \"%s\" !\n", GLOBAL_CLI_APPEND_CORPUS);
+        EXIT(1);
+    }
+
+    if (fclose (corpus_file) == EOF)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot close the corpus file \"%s\" !\n", GLOBAL_CLI_APPEND_CORPUS);
+        EXIT(1);
+    }
+    corpus_file = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that is used as name of the compiled corpus file, that will be
+ * compacted.
+ */
+void Check_CLI_Parameter_CLI_COMPACT_CORPUS (void)
+{
+    if (GLOBAL_CLI_COMPACT_CORPUS == NULL)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid corpus file name ! The corpus file name is NULL !\n");
+        EXIT(1);
+    }
+    if (IS_STRING_LENGTH_ZERO(GLOBAL_CLI_COMPACT_CORPUS))
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid corpus file name ! The corpus file name length is zero !\n");
+        EXIT(1);
+    }
+
+    // Testweise die Korpusdatei oeffnen
+    FILE* corpus_file = fopen (GLOBAL_CLI_COMPACT_CORPUS, "rb");
+
+    if (corpus_file == NULL)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot open the corpus file \"%s\" !\n", GLOBAL_CLI_COMPACT_CORPUS);
+        EXIT(1);
+    }
+
+    if (fclose (corpus_file) == EOF)
+    {
+        FPRINTF_FFLUSH (stderr, "Cannot close the corpus file \"%s\" !\n", GLOBAL_CLI_COMPACT_CORPUS);
+        EXIT(1);
+    }
+    corpus_file = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Save the file name of a parsed [--stop_words] option in the list of stop word files. (argparse callback; the
+ * option can be used several times)
+ *
+ * @param[in] self argparse object
+ * @param[in] option Parsed option (The value points to the file name)
+ *
+ * @return Always 0
+ */
+int Add_CLI_Parameter_CLI_STOP_WORD_FILE (struct argparse* self, const struct argparse_option* option)
+{
+    (void) self;
+
+    if (GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES >= GLOBAL_CLI_MAX_STOP_WORD_FILES)
+    {
+        FPRINTF_FFLUSH (stderr, "Too many stop word files ! Max. %d files can be used.\n",
+                GLOBAL_CLI_MAX_STOP_WORD_FILES);
+        EXIT(1);
+    }
+    GLOBAL_CLI_STOP_WORD_FILES [GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES ++] = *(const char**) option->value;
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that are used as stop word file names.
+ */
+void Check_CLI_Parameter_CLI_STOP_WORD_FILES (void)
+{
+    for (size_t i = 0; i < GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES; ++ i)
+    {
+        if (GLOBAL_CLI_STOP_WORD_FILES [i] == NULL || IS_STRING_LENGTH_ZERO(GLOBAL_CLI_STOP_WORD_FILES [i]))
+        {
+            FPRINTF_FFLUSH_NO_VA_ARGS (stderr, "Invalid stop word file name ! The file name length is zero !\n");
+            EXIT(1);
+        }
+
+        // Testweise die Stoppwortdatei oeffnen
+        FILE* stop_word_file = fopen (GLOBAL_CLI_STOP_WORD_FILES [i], "r");
+
+        if (stop_word_file == NULL)
+        {
+            FPRINTF_FFLUSH (stderr, "Cannot open the stop word file \"%s\" !\n", GLOBAL_CLI_STOP_WORD_FILES [i]);
+            EXIT(1);
+        }
+
+        if (fclose (stop_word_file) == EOF)
+        {
+            FPRINTF_FFLUSH (stderr, "Cannot close the stop word file \"%s\" !\n", GLOBAL_CLI_STOP_WORD_FILES [i]);
+            EXIT(1);
+        }
+        stop_word_file = NULL;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Enable the dynamic stop words, when the [--max_df] option was parsed. (argparse callback)
+ *
+ * @param[in] self argparse object
+ * @param[in] option Parsed option
+ *
+ * @return Always 0
+ */
+int Set_CLI_Parameter_CLI_MAX_DOCUMENT_FREQUENCY (struct argparse* self, const struct argparse_option* option)
+{
+    (void) self;
+    (void) option;
+
+    GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY = true;
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the max. document frequency of a token, that is not a stop word.
+ */
+void Check_CLI_Parameter_CLI_MAX_DOCUMENT_FREQUENCY (void)
+{
+    // Without [--max_df] no dynamic stop words will be used
+    // A NaN default value cannot be used: The release build uses -ffast-math, that removes the isnan() checks
+    if (! GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY)
+    {
+        return;
+    }
+    // The negated range check rejects also +/-Inf (and NaN in builds without -ffast-math)
+    if (! (GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY > 0.0f && GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY <= 1.0f))
+    {
+        FPRINTF_FFLUSH (stderr, "Max. document frequency (%f) is not in the range (0, 1] !\n",
+                GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY);
+        EXIT(1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the CLI parameter, that selects the JSON array for the matching.
+ */
+void Check_CLI_Parameter_CLI_MATCH_ON (void)
+{
+    if (GLOBAL_CLI_MATCH_ON == NULL || (strcmp(GLOBAL_CLI_MATCH_ON, "tokens") != 0 &&
+            strcmp(GLOBAL_CLI_MATCH_ON, "lemma") != 0))
+    {
+        FPRINTF_FFLUSH (stderr, "Invalid match on value \"%s\" ! Valid values: tokens, lemma\n",
+                (GLOBAL_CLI_MATCH_ON != NULL) ? GLOBAL_CLI_MATCH_ON : "(null)");
+        EXIT(1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the JSON array for the matching from the CLI parameter. (Only valid after
+ * Check_CLI_Parameter_CLI_MATCH_ON())
+ *
+ * @return JSON_TOKEN_ARRAY_LEMMA for "lemma", otherwise JSON_TOKEN_ARRAY_TOKENS
+ */
+enum JSON_Token_Array Get_CLI_Parameter_CLI_MATCH_ON (void)
+{
+    return (GLOBAL_CLI_MATCH_ON != NULL && strcmp(GLOBAL_CLI_MATCH_ON, "lemma") == 0) ?
+            JSON_TOKEN_ARRAY_LEMMA : JSON_TOKEN_ARRAY_TOKENS;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Test function for the abort percent value.
  */
@@ -320,6 +890,22 @@ extern void Set_CLI_Parameter_To_Default_Values (void)
     GLOBAL_CLI_NO_PART_MATCHES              = GLOBAL_CLI_NO_PART_MATCHES_DEFAULT;
     GLOBAL_CLI_NO_FULL_MATCHES              = GLOBAL_CLI_NO_FULL_MATCHES_DEFAULT;
     GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN  = GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT;
+    GLOBAL_CLI_OUTPUT_FORMAT                = GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT;
+    GLOBAL_CLI_BINARY_TO_JSON               = GLOBAL_CLI_BINARY_TO_JSON_DEFAULT;
+    GLOBAL_CLI_PREALLOCATE_OUTPUT           = GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT;
+    GLOBAL_CLI_COUNTS_ONLY                  = GLOBAL_CLI_COUNTS_ONLY_DEFAULT;
+    GLOBAL_CLI_READER_THREADS               = GLOBAL_CLI_READER_THREADS_DEFAULT;
+    GLOBAL_CLI_CJSON_PARSER                 = GLOBAL_CLI_CJSON_PARSER_DEFAULT;
+    GLOBAL_CLI_COMPRESS_OUTPUT              = GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT;
+    GLOBAL_CLI_BATCH_FILE                   = GLOBAL_CLI_BATCH_FILE_DEFAULT;
+    GLOBAL_CLI_COMPILE_CORPUS               = GLOBAL_CLI_COMPILE_CORPUS_DEFAULT;
+    GLOBAL_CLI_APPEND_CORPUS                = GLOBAL_CLI_APPEND_CORPUS_DEFAULT;
+    GLOBAL_CLI_COMPACT_CORPUS               = GLOBAL_CLI_COMPACT_CORPUS_DEFAULT;
+    GLOBAL_CLI_STOP_WORD_FILE               = GLOBAL_CLI_STOP_WORD_FILE_DEFAULT;
+    GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES    = 0;
+    GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY       = GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT;
+    GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY   = GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT;
+    GLOBAL_CLI_MATCH_ON                     = GLOBAL_CLI_MATCH_ON_DEFAULT;
     GLOBAL_ABORT_PROCESS_PERCENT            = GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT;
 
     return;
@@ -372,6 +958,64 @@ extern void Set_CLI_Parameter_To_Default_Values (void)
 #undef GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT
 #endif /* GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT */
 
+#ifdef GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT
+#undef GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT
+#endif /* GLOBAL_CLI_OUTPUT_FORMAT_DEFAULT */
+
+#ifdef GLOBAL_CLI_BINARY_TO_JSON_DEFAULT
+#undef GLOBAL_CLI_BINARY_TO_JSON_DEFAULT
+#endif /* GLOBAL_CLI_BINARY_TO_JSON_DEFAULT */
+
+#ifdef GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT
+#undef GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT
+#endif /* GLOBAL_CLI_PREALLOCATE_OUTPUT_DEFAULT */
+
+#ifdef GLOBAL_CLI_COUNTS_ONLY_DEFAULT
+#undef GLOBAL_CLI_COUNTS_ONLY_DEFAULT
+#endif /* GLOBAL_CLI_COUNTS_ONLY_DEFAULT */
+
+#ifdef GLOBAL_CLI_READER_THREADS_DEFAULT
+#undef GLOBAL_CLI_READER_THREADS_DEFAULT
+#endif /* GLOBAL_CLI_READER_THREADS_DEFAULT */
+
+#ifdef GLOBAL_CLI_CJSON_PARSER_DEFAULT
+#undef GLOBAL_CLI_CJSON_PARSER_DEFAULT
+#endif /* GLOBAL_CLI_CJSON_PARSER_DEFAULT */
+
+#ifdef GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT
+#undef GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT
+#endif /* GLOBAL_CLI_COMPRESS_OUTPUT_DEFAULT */
+
+#ifdef GLOBAL_CLI_BATCH_FILE_DEFAULT
+#undef GLOBAL_CLI_BATCH_FILE_DEFAULT
+#endif /* GLOBAL_CLI_BATCH_FILE_DEFAULT */
+
+#ifdef GLOBAL_CLI_COMPILE_CORPUS_DEFAULT
+#undef GLOBAL_CLI_COMPILE_CORPUS_DEFAULT
+#endif /* GLOBAL_CLI_COMPILE_CORPUS_DEFAULT */
+
+#ifdef GLOBAL_CLI_APPEND_CORPUS_DEFAULT
+#undef GLOBAL_CLI_APPEND_CORPUS_DEFAULT
+#endif /* GLOBAL_CLI_APPEND_CORPUS_DEFAULT */
+
+#ifdef GLOBAL_CLI_COMPACT_CORPUS_DEFAULT
+#undef GLOBAL_CLI_COMPACT_CORPUS_DEFAULT
+#endif /* GLOBAL_CLI_COMPACT_CORPUS_DEFAULT */
+#ifdef GLOBAL_CLI_STOP_WORD_FILE_DEFAULT
+#undef GLOBAL_CLI_STOP_WORD_FILE_DEFAULT
+#endif /* GLOBAL_CLI_STOP_WORD_FILE_DEFAULT */
+#ifdef GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT
+#undef GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT
+#endif /* GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY_DEFAULT */
+
+#ifdef GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT
+#undef GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT
+#endif /* GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY_DEFAULT */
+
+#ifdef GLOBAL_CLI_MATCH_ON_DEFAULT
+#undef GLOBAL_CLI_MATCH_ON_DEFAULT
+#endif /* GLOBAL_CLI_MATCH_ON_DEFAULT */
+
 #ifdef GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT
 #undef GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT
 #endif /* GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT */
@@ -19,6 +19,10 @@ extern "C"
 
 
 
+#include <stddef.h>
+#include "argparse.h"
+#include "File_Reader.h"
+
 
 
 extern const char* const GLOBAL_USAGES []; ///< Description of the CLI interface usage
@@ -55,6 +59,86 @@ extern _Bool GLOBAL_CLI_NO_FULL_MATCHES; ///< Do not show full matches in the re
  */
 extern _Bool GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN;
 
+extern const char* GLOBAL_CLI_OUTPUT_FORMAT; ///< Output format (json, ndjson, tsv, binary)
+
+extern const char* GLOBAL_CLI_BINARY_TO_JSON; ///< Binary result file, that should be converted to JSON
+
+extern int GLOBAL_CLI_PREALLOCATE_OUTPUT; ///< Preallocation size of the output file in MiB (0: No preallocation)
+
+/**
+ * @brief Count only mode: Only the match counters will be determined and exported; no intersection results.
+ */
+extern _Bool GLOBAL_CLI_COUNTS_ONLY;
+
+extern int GLOBAL_CLI_READER_THREADS; ///< Number of threads, that parse one input file
+
+/**
+ * @brief Parse the JSON files with the validating cJSON parser instead of the streaming scanner ?
+ */
+extern _Bool GLOBAL_CLI_CJSON_PARSER;
+
+extern _Bool GLOBAL_CLI_COMPRESS_OUTPUT; ///< Write a gzip compressed output file ?
+
+/**
+ * @brief Job list of the batch mode: Every line contains a second input file and the output file. The first input file
+ * will be read only once for all jobs.
+ */
+extern const char* GLOBAL_CLI_BATCH_FILE;
+
+/**
+ * @brief Name of the compiled corpus file: The first input file will be encoded and written in this file; no
+ * intersection will be calculated. A compiled corpus file can be used later as first input file.
+ */
+extern const char* GLOBAL_CLI_COMPILE_CORPUS;
+
+/**
+ * @brief Name of an existing compiled corpus file: The first input file will be encoded and appended as new segment to
+ * this file; no intersection will be calculated.
+ */
+extern const char* GLOBAL_CLI_APPEND_CORPUS;
+
+/**
+ * @brief Name of an existing compiled corpus file, that will be rewritten with only one segment. No input file is
+ * necessary.
+ */
+extern const char* GLOBAL_CLI_COMPACT_CORPUS;
+
+/**
+ * @brief Max. number of [--stop_words] options.
+ */
+#ifndef GLOBAL_CLI_MAX_STOP_WORD_FILES
+#define GLOBAL_CLI_MAX_STOP_WORD_FILES 32
+#else
+#error "The macro \"GLOBAL_CLI_MAX_STOP_WORD_FILES\" is already defined !"
+#endif /* GLOBAL_CLI_MAX_STOP_WORD_FILES */
+
+/**
+ * @brief Last parsed stop word file name. (The argparse target; all names are in GLOBAL_CLI_STOP_WORD_FILES)
+ */
+extern const char* GLOBAL_CLI_STOP_WORD_FILE;
+
+/**
+ * @brief Files with additional stop words (one word per line). The tokens in these lists will be removed, when the input
+ * files will be encoded; so they are never part of an intersection.
+ */
+extern const char* GLOBAL_CLI_STOP_WORD_FILES [GLOBAL_CLI_MAX_STOP_WORD_FILES];
+extern size_t GLOBAL_CLI_NUMBER_OF_STOP_WORD_FILES; ///< Number of files in GLOBAL_CLI_STOP_WORD_FILES
+
+/**
+ * @brief Max. document frequency (fraction of the data sets of the first input file) of a token, that is not a stop
+ * word. More frequent tokens will be removed from both input files. (Only used, if
+ * GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY is true)
+ */
+extern float GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY;
+
+extern _Bool GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY; ///< Was [--max_df] given ? (Use dynamic stop words ?)
+
+/**
+ * @brief Which JSON array will be mapped and matched (tokens, lemma) ? The char offsets belong always to the surface
+ * tokens.
+ */
+extern const char* GLOBAL_CLI_MATCH_ON;
+
 /**
  * @brief On which percent in the calculation should be aborted ? This is for development and debugging purposes useful
  * to limit the calculation process.
@@ -85,6 +169,105 @@ extern void Check_CLI_Parameter_CLI_INPUT_FILE2 (void);
  */
 extern void Check_CLI_Parameter_CLI_OUTPUT_FILE (void);
 
+/**
+ * @brief Test function for the CLI parameter, that is used as output format.
+ */
+extern void Check_CLI_Parameter_CLI_OUTPUT_FORMAT (void);
+
+/**
+ * @brief Test function for the CLI parameter, that is used as preallocation size (in MiB) of the output file.
+ */
+extern void Check_CLI_Parameter_CLI_PREALLOCATE_OUTPUT (void);
+
+/**
+ * @brief Test function for the CLI parameter, that enables the gzip compression of the output file. (Only possible,
+ * if the program was built with zlib)
+ */
+extern void Check_CLI_Parameter_CLI_COMPRESS_OUTPUT (void);
+
+/**
+ * @brief Test function for the CLI parameter, that enables the count only mode. (Only the JSON and the NDJSON format
+ * can hold the counters)
+ */
+extern void Check_CLI_Parameter_CLI_COUNTS_ONLY (void);
+
+/**
+ * @brief Test function for the CLI parameter, that is used as number of reader threads.
+ */
+extern void Check_CLI_Parameter_CLI_READER_THREADS (void);
+
+/**
+ * @brief Test function for the CLI parameter, that is used as binary result file name for the conversion to JSON.
+ */
+extern void Check_CLI_Parameter_CLI_BINARY_TO_JSON (void);
+
+/**
+ * @brief Test function for the CLI parameter, that is used as job list file of the batch mode. (The job list replaces
+ * the second input file and the output file)
+ */
+extern void Check_CLI_Parameter_CLI_BATCH_FILE (void);
+
+/**
+ * @brief Test function for the CLI parameter, that is used as name of the compiled corpus file.
+ */
+extern void Check_CLI_Parameter_CLI_COMPILE_CORPUS (void);
+
+/**
+ * @brief Test function for the CLI parameter, that is used as name of the compiled corpus file, that will be extended
+ * with the first input file.
+ */
+extern void Check_CLI_Parameter_CLI_APPEND_CORPUS (void);
+
+/**
+ * @brief Test function for the CLI parameter, that is used as name of the compiled corpus file, that will be
+ * compacted.
+ */
+extern void Check_CLI_Parameter_CLI_COMPACT_CORPUS (void);
+
+/**
+ * @brief Save the file name of a parsed [--stop_words] option in the list of stop word files. (argparse callback; the
+ * option can be used several times)
+ *
+ * @param[in] self argparse object
+ * @param[in] option Parsed option (The value points to the file name)
+ *
+ * @return Always 0
+ */
+extern int Add_CLI_Parameter_CLI_STOP_WORD_FILE (struct argparse* self, const struct argparse_option* option);
+
+/**
+ * @brief Test function for the CLI parameter, that are used as stop word file names.
+ */
+extern void Check_CLI_Parameter_CLI_STOP_WORD_FILES (void);
+
+/**
+ * @brief Enable the dynamic stop words, when the [--max_df] option was parsed. (argparse callback)
+ *
+ * @param[in] self argparse object
+ * @param[in] option Parsed option
+ *
+ * @return Always 0
+ */
+extern int Set_CLI_Parameter_CLI_MAX_DOCUMENT_FREQUENCY (struct argparse* self, const struct argparse_option* option);
+
+/**
+ * @brief Test function for the max. document frequency of a token, that is not a stop word.
+ */
+extern void Check_CLI_Parameter_CLI_MAX_DOCUMENT_FREQUENCY (void);
+
+/**
+ * @brief Test function for the CLI parameter, that selects the JSON array for the matching.
+ */
+extern void Check_CLI_Parameter_CLI_MATCH_ON (void);
+
+/**
+ * @brief Determine the JSON array for the matching from the CLI parameter. (Only valid after
+ * Check_CLI_Parameter_CLI_MATCH_ON())
+ *
+ * @return JSON_TOKEN_ARRAY_LEMMA for "lemma", otherwise JSON_TOKEN_ARRAY_TOKENS
+ */
+extern enum JSON_Token_Array Get_CLI_Parameter_CLI_MATCH_ON (void);
+
 /**
  * @brief Test function for the abort percent value.
  */
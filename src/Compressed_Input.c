@@ -0,0 +1,912 @@
+/**
+ * @file Compressed_Input.c
+ *
+ * @brief Line by line reading of a gzip or zstd compressed input file. The decompression runs in a helper thread.
+ *
+ * The compressed file content (e.g. a Mapped_File) will be decompressed in a ring of blocks. The helper thread fills
+ * the blocks, while the calling thread parses the lines of the previous blocks. So the decompression and the parsing
+ * overlap and the decompressed file is never in the memory (or on the disk) as a whole.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Compressed_Input.h"
+#include <string.h>
+#include <limits.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+
+#ifdef HAVE_ZLIB
+    #include <zlib.h>
+#endif /* HAVE_ZLIB */
+#ifdef HAVE_ZSTD
+    #include <zstd.h>
+#endif /* HAVE_ZSTD */
+
+
+
+/**
+ * @brief Max. number of compressed bytes, that will be given to the decompression library with one call. (zlib counts
+ * the input with an unsigned int)
+ */
+#ifndef MAX_INPUT_CHUNK_SIZE
+#define MAX_INPUT_CHUNK_SIZE (1024 * 1024 * 1024)
+#else
+#error "The macro \"MAX_INPUT_CHUNK_SIZE\" is already defined !"
+#endif /* MAX_INPUT_CHUNK_SIZE */
+
+/**
+ * @brief State of the decompression library. Only the decompression thread uses this object.
+ */
+struct Decompression_State
+{
+    enum Compression_Format format;             ///< Compression format
+    const unsigned char* compressed_data;       ///< Compressed file content
+    uint_fast64_t compressed_size;              ///< Size of the compressed file content
+    uint_fast64_t input_position;               ///< Number of compressed bytes, that were consumed
+
+#ifdef HAVE_ZLIB
+    z_stream gzip_stream;                       ///< zlib stream (gzip header detection enabled)
+#endif /* HAVE_ZLIB */
+#ifdef HAVE_ZSTD
+    ZSTD_DStream* zstd_stream;                  ///< zstd stream
+    size_t last_zstd_result;                    ///< Result of the last ZSTD_decompressStream() call (0: frame end)
+#endif /* HAVE_ZSTD */
+
+    _Bool finished;                             ///< All data was decompressed
+    const char* error_message;                  ///< Error of the decompression library (NULL: no error)
+};
+
+/**
+ * @brief The function of the decompression thread: Fill the blocks of the ring, until all data was decompressed or
+ * the reader stops early.
+ *
+ * @param[in] object Compressed_Input object (as void*)
+ *
+ * @return Always NULL
+ */
+static void*
+Decompression_Thread_Function
+(
+        void* object
+);
+
+/**
+ * @brief Initialize the decompression library for the format of the input.
+ *
+ * Asserts:
+ *      state != NULL
+ *      object != NULL
+ *      The library can be initialized
+ *
+ * @param[out] state Decompression_State object
+ * @param[in] object Compressed_Input object
+ */
+static void
+Init_Decompression_State
+(
+        struct Decompression_State* const restrict state,
+        const struct Compressed_Input* const restrict object
+);
+
+/**
+ * @brief Release the resources of the decompression library.
+ *
+ * Asserts:
+ *      state != NULL
+ *
+ * @param[in] state Decompression_State object
+ */
+static void
+Free_Decompression_State
+(
+        struct Decompression_State* const state
+);
+
+/**
+ * @brief Decompress data in the given memory, until the memory is full, all data was decompressed or an error
+ * occurred.
+ *
+ * Asserts:
+ *      state != NULL
+ *      output != NULL
+ *
+ * @param[in] state Decompression_State object
+ * @param[out] output Memory for the decompressed data
+ * @param[in] output_length Size of the memory
+ *
+ * @return Number of decompressed bytes
+ */
+static size_t
+Decompress_Into
+(
+        struct Decompression_State* const restrict state,
+        char* const restrict output,
+        const size_t output_length
+);
+
+/**
+ * @brief Wait, until the next block is ready for reading, and use it as read block.
+ *
+ * Asserts:
+ *      object != NULL
+ *      No decompression error occurred
+ *
+ * @param[in] object Compressed_Input object
+ *
+ * @return true, if a block is available; false at the end of the decompressed data
+ */
+static _Bool
+Wait_For_Read_Block
+(
+        struct Compressed_Input* const object
+);
+
+/**
+ * @brief Give the completely read block back to the decompression thread.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Compressed_Input object
+ */
+static void
+Release_Read_Block
+(
+        struct Compressed_Input* const object
+);
+
+/**
+ * @brief Determine the end of the last complete line in a block. (Position behind the last newline char)
+ *
+ * @param[in] block Begin of the block
+ * @param[in] length Number of bytes in the block
+ *
+ * @return Position behind the last newline char; 0, if the block contains no newline char
+ */
+static size_t
+Find_End_Of_Last_Line
+(
+        const char* const block,
+        const size_t length
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Detect the compression format with the magic bytes at the begin of the data.
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] data Begin of the file content
+ * @param[in] size Size of the file content
+ *
+ * @return Detected compression format (COMPRESSION_NONE, if the magic bytes are unknown)
+ */
+extern enum Compression_Format
+CompressedInput_DetectFormat
+(
+        const char* const data,
+        const uint_fast64_t size
+)
+{
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+
+    const unsigned char* const bytes = (const unsigned char*) data;
+
+    // RFC 1952: ID1, ID2 and the compression method (8: deflate)
+    if (size >= 3 && bytes [0] == 0x1F && bytes [1] == 0x8B && bytes [2] == 0x08)
+    {
+        return COMPRESSION_GZIP;
+    }
+    // RFC 8878: Magic number 0xFD2FB528 in little endian
+    if (size >= 4 && bytes [0] == 0x28 && bytes [1] == 0xB5 && bytes [2] == 0x2F && bytes [3] == 0xFD)
+    {
+        return COMPRESSION_ZSTD;
+    }
+
+    return COMPRESSION_NONE;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Compressed_Input object and start the decompression thread.
+ *
+ * The compressed data needs to be available until the object will be deleted.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      file_name != NULL
+ *      The format is not COMPRESSION_NONE and was enabled at build time
+ *      The thread can be created
+ *
+ * @param[in] input_file Compressed file content
+ * @param[in] format Compression format (See CompressedInput_DetectFormat())
+ * @param[in] file_name Name of the input file (for error messages)
+ *
+ * @return Address to the new dynamic Compressed_Input object
+ */
+extern struct Compressed_Input*
+CompressedInput_CreateObject
+(
+        const struct Mapped_File* const restrict input_file,
+        const enum Compression_Format format,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(input_file != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_FMSG(format != COMPRESSION_NONE, "The file \"%s\" is not compressed !", file_name);
+#ifndef HAVE_ZLIB
+    ASSERT_FMSG(format != COMPRESSION_GZIP, "The file \"%s\" is gzip compressed, but the program was built without "
+            "zlib !", file_name);
+#endif /* HAVE_ZLIB */
+#ifndef HAVE_ZSTD
+    ASSERT_FMSG(format != COMPRESSION_ZSTD, "The file \"%s\" is zstd compressed, but the program was built without "
+            "libzstd !", file_name);
+#endif /* HAVE_ZSTD */
+
+    struct Compressed_Input* new_object = (struct Compressed_Input*) CALLOC(1, sizeof (struct Compressed_Input));
+    ASSERT_ALLOC(new_object, "Cannot create a new Compressed_Input object !", sizeof (struct Compressed_Input));
+
+    new_object->file_name       = file_name;
+    new_object->compressed_data = (const unsigned char*) input_file->data;
+    new_object->compressed_size = input_file->size;
+    new_object->format          = format;
+
+    for (size_t i = 0; i < COMPRESSED_INPUT_NUMBER_OF_BLOCKS; ++ i)
+    {
+        new_object->blocks [i] = (char*) MALLOC(COMPRESSED_INPUT_BLOCK_SIZE * sizeof (char));
+        ASSERT_ALLOC(new_object->blocks [i], "Cannot create a block for the Compressed_Input object !",
+                COMPRESSED_INPUT_BLOCK_SIZE * sizeof (char));
+        new_object->allocated_bytes [i] = COMPRESSED_INPUT_BLOCK_SIZE;
+    }
+
+    int pthread_result = pthread_mutex_init(&(new_object->mutex), NULL);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create a mutex: %s", strerror(pthread_result));
+    pthread_result = pthread_cond_init(&(new_object->block_full), NULL);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create a condition variable: %s", strerror(pthread_result));
+    pthread_result = pthread_cond_init(&(new_object->block_free), NULL);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create a condition variable: %s", strerror(pthread_result));
+
+    pthread_result = pthread_create(&(new_object->decompression_thread), NULL, Decompression_Thread_Function,
+            new_object);
+    ASSERT_FMSG(pthread_result == 0, "Cannot create the decompression thread for the file \"%s\": %s", file_name,
+            strerror(pthread_result));
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Stop the decompression thread and delete the Compressed_Input object. Not read data will be discarded.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Compressed_Input object
+ */
+extern void
+CompressedInput_DeleteObject
+(
+        struct Compressed_Input* object
+)
+{
+    ASSERT_MSG(object != NULL, "Compressed_Input is NULL !");
+
+    pthread_mutex_lock(&(object->mutex));
+    object->stop = true;
+    pthread_cond_signal(&(object->block_free));
+    pthread_mutex_unlock(&(object->mutex));
+
+    const int join_result = pthread_join(object->decompression_thread, NULL);
+    ASSERT_FMSG(join_result == 0, "Cannot join the decompression thread of the file \"%s\": %s", object->file_name,
+            strerror(join_result));
+
+    pthread_cond_destroy(&(object->block_free));
+    pthread_cond_destroy(&(object->block_full));
+    pthread_mutex_destroy(&(object->mutex));
+
+    for (size_t i = 0; i < COMPRESSED_INPUT_NUMBER_OF_BLOCKS; ++ i)
+    {
+        FREE_AND_SET_TO_NULL(object->blocks [i]);
+    }
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the next decompressed line. The calling thread waits, until the line is available.
+ *
+ * The newline char is not part of the line. The last line of the file does not need a newline char (like in
+ * MappedFile_NextLine()). The line view is valid until the next call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      line != NULL
+ *      No decompression error occurred
+ *
+ * @param[in] object Compressed_Input object
+ * @param[out] line View of the next line
+ *
+ * @return true, if a line was found; false at the end of the decompressed data
+ */
+extern _Bool
+CompressedInput_NextLine
+(
+        struct Compressed_Input* const restrict object,
+        struct Line_View* const restrict line
+)
+{
+    ASSERT_MSG(object != NULL, "Compressed_Input is NULL !");
+    ASSERT_MSG(line != NULL, "Line view is NULL !");
+
+    while (true)
+    {
+        if (object->read_block_available)
+        {
+            const char* const block = object->blocks [object->read_index];
+            const size_t used_bytes = object->used_bytes [object->read_index];
+
+            if (object->read_position < used_bytes)
+            {
+                const char* const line_begin = block + object->read_position;
+                const size_t bytes_left = used_bytes - object->read_position;
+                const char* const line_end = (const char*) memchr(line_begin, '\n', bytes_left);
+
+                line->data = line_begin;
+                if (line_end != NULL)
+                {
+                    line->length = (size_t) (line_end - line_begin);
+                    object->read_position += line->length + 1;
+                }
+                else
+                {
+                    // Only possible in the last block: the last line has no newline char
+                    line->length = bytes_left;
+                    object->read_position = used_bytes;
+                }
+
+                return true;
+            }
+
+            // All lines of the block were read; the previous line view is not used anymore
+            Release_Read_Block(object);
+        }
+
+        if (! Wait_For_Read_Block(object))
+        {
+            line->data = NULL;
+            line->length = 0;
+            return false;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the begin of the decompressed data without reading a line. (E.g. for the detection of the file type)
+ *
+ * The calling thread waits, until the first block is available.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      size != NULL
+ *      No decompression error occurred
+ *
+ * @param[in] object Compressed_Input object
+ * @param[out] data Begin of the decompressed data (not null terminated)
+ * @param[out] size Number of available bytes (0: The decompressed data is empty)
+ */
+extern void
+CompressedInput_PeekBegin
+(
+        struct Compressed_Input* const restrict object,
+        const char** const restrict data,
+        size_t* const restrict size
+)
+{
+    ASSERT_MSG(object != NULL, "Compressed_Input is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(size != NULL, "Size is NULL !");
+
+    if (! object->read_block_available && ! Wait_For_Read_Block(object))
+    {
+        *data = object->blocks [object->read_index];
+        *size = 0;
+        return;
+    }
+
+    *data = object->blocks [object->read_index] + object->read_position;
+    *size = object->used_bytes [object->read_index] - object->read_position;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Position in the compressed data, that belongs to the current read position. (For process information)
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Compressed_Input object
+ *
+ * @return Number of compressed bytes, that were decompressed for the lines until now
+ */
+extern uint_fast64_t
+CompressedInput_GetInputPosition
+(
+        const struct Compressed_Input* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Compressed_Input is NULL !");
+
+    return object->read_input_position;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Name of a compression format.
+ *
+ * @param[in] format Compression format
+ *
+ * @return Name as constant C string
+ */
+extern const char*
+CompressedInput_FormatToString
+(
+        const enum Compression_Format format
+)
+{
+    switch (format)
+    {
+    case COMPRESSION_NONE:
+        return "none";
+    case COMPRESSION_GZIP:
+        return "gzip";
+    case COMPRESSION_ZSTD:
+        return "zstd";
+    default:
+        break;
+    }
+
+    return "unknown";
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief The function of the decompression thread: Fill the blocks of the ring, until all data was decompressed or
+ * the reader stops early.
+ *
+ * @param[in] object Compressed_Input object (as void*)
+ *
+ * @return Always NULL
+ */
+static void*
+Decompression_Thread_Function
+(
+        void* object
+)
+{
+    struct Compressed_Input* const input = (struct Compressed_Input*) object;
+
+    struct Decompression_State state;
+    Init_Decompression_State(&state, input);
+
+    size_t fill_index           = 0;
+    size_t previous_index       = 0;
+    // The begin of the incomplete last line of the previous block
+    size_t carry_begin          = 0;
+    size_t carry_length         = 0;
+
+    while (! state.finished && state.error_message == NULL)
+    {
+        // Wait for a free block
+        pthread_mutex_lock(&(input->mutex));
+        while (input->full_blocks == COMPRESSED_INPUT_NUMBER_OF_BLOCKS && ! input->stop)
+        {
+            pthread_cond_wait(&(input->block_free), &(input->mutex));
+        }
+        const _Bool stop = input->stop;
+        pthread_mutex_unlock(&(input->mutex));
+        if (stop) { break; }
+
+        // The block is free; only this thread uses it until it will be given to the reader
+        if (carry_length >= input->allocated_bytes [fill_index])
+        {
+            const size_t new_size = carry_length * 2;
+            char* tmp_ptr = (char*) REALLOC(input->blocks [fill_index], new_size * sizeof (char));
+            ASSERT_ALLOC(tmp_ptr, "Cannot increase a block of the Compressed_Input object !", new_size * sizeof (char));
+            input->blocks [fill_index] = tmp_ptr;
+            input->allocated_bytes [fill_index] = new_size;
+        }
+        // The reader does not use the bytes behind the complete lines of the previous block
+        memcpy(input->blocks [fill_index], input->blocks [previous_index] + carry_begin, carry_length);
+
+        size_t filled_bytes     = carry_length;
+        size_t complete_lines   = 0;
+        while (true)
+        {
+            filled_bytes += Decompress_Into(&state, input->blocks [fill_index] + filled_bytes,
+                    input->allocated_bytes [fill_index] - filled_bytes);
+            if (state.finished || state.error_message != NULL) { break; }
+
+            // A full block will be given to the reader with all complete lines
+            complete_lines = Find_End_Of_Last_Line(input->blocks [fill_index], filled_bytes);
+            if (complete_lines > 0) { break; }
+
+            // The line is longer than the block
+            const size_t new_size = input->allocated_bytes [fill_index] * 2;
+            char* tmp_ptr = (char*) REALLOC(input->blocks [fill_index], new_size * sizeof (char));
+            ASSERT_ALLOC(tmp_ptr, "Cannot increase a block of the Compressed_Input object !", new_size * sizeof (char));
+            input->blocks [fill_index] = tmp_ptr;
+            input->allocated_bytes [fill_index] = new_size;
+        }
+        if (state.finished)
+        {
+            complete_lines = filled_bytes;
+        }
+
+        pthread_mutex_lock(&(input->mutex));
+        if (state.error_message != NULL)
+        {
+            input->error_message    = state.error_message;
+            input->error_position   = state.input_position;
+            input->end_of_data      = true;
+        }
+        else
+        {
+            input->used_bytes [fill_index]      = complete_lines;
+            input->input_position [fill_index]  = state.input_position;
+            input->end_of_data                  = state.finished;
+            ++ input->full_blocks;
+        }
+        pthread_cond_signal(&(input->block_full));
+        pthread_mutex_unlock(&(input->mutex));
+
+        carry_begin     = complete_lines;
+        carry_length    = filled_bytes - complete_lines;
+        previous_index  = fill_index;
+        fill_index      = (fill_index + 1) % COMPRESSED_INPUT_NUMBER_OF_BLOCKS;
+    }
+
+    Free_Decompression_State(&state);
+
+    return NULL;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Initialize the decompression library for the format of the input.
+ *
+ * Asserts:
+ *      state != NULL
+ *      object != NULL
+ *      The library can be initialized
+ *
+ * @param[out] state Decompression_State object
+ * @param[in] object Compressed_Input object
+ */
+static void
+Init_Decompression_State
+(
+        struct Decompression_State* const restrict state,
+        const struct Compressed_Input* const restrict object
+)
+{
+    ASSERT_MSG(state != NULL, "Decompression_State is NULL !");
+    ASSERT_MSG(object != NULL, "Compressed_Input is NULL !");
+
+    memset(state, '\0', sizeof (struct Decompression_State));
+    state->format           = object->format;
+    state->compressed_data  = object->compressed_data;
+    state->compressed_size  = object->compressed_size;
+
+#ifdef HAVE_ZLIB
+    if (state->format == COMPRESSION_GZIP)
+    {
+        // 15: max. window size; + 16: gzip header and trailer expected
+        const int init_result = inflateInit2(&(state->gzip_stream), 15 + 16);
+        ASSERT_FMSG(init_result == Z_OK, "Cannot initialize zlib for the file \"%s\" (Error code: %d) !",
+                object->file_name, init_result);
+    }
+#endif /* HAVE_ZLIB */
+#ifdef HAVE_ZSTD
+    if (state->format == COMPRESSION_ZSTD)
+    {
+        state->zstd_stream = ZSTD_createDStream();
+        ASSERT_FMSG(state->zstd_stream != NULL, "Cannot initialize libzstd for the file \"%s\" !", object->file_name);
+        const size_t init_result = ZSTD_initDStream(state->zstd_stream);
+        ASSERT_FMSG(! ZSTD_isError(init_result), "Cannot initialize libzstd for the file \"%s\": %s !",
+                object->file_name, ZSTD_getErrorName(init_result));
+        // Before the first call a frame is expected
+        state->last_zstd_result = 1;
+    }
+#endif /* HAVE_ZSTD */
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Release the resources of the decompression library.
+ *
+ * Asserts:
+ *      state != NULL
+ *
+ * @param[in] state Decompression_State object
+ */
+static void
+Free_Decompression_State
+(
+        struct Decompression_State* const state
+)
+{
+    ASSERT_MSG(state != NULL, "Decompression_State is NULL !");
+
+#ifdef HAVE_ZLIB
+    if (state->format == COMPRESSION_GZIP)
+    {
+        inflateEnd(&(state->gzip_stream));
+    }
+#endif /* HAVE_ZLIB */
+#ifdef HAVE_ZSTD
+    if (state->format == COMPRESSION_ZSTD)
+    {
+        ZSTD_freeDStream(state->zstd_stream);
+        state->zstd_stream = NULL;
+    }
+#endif /* HAVE_ZSTD */
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Decompress data in the given memory, until the memory is full, all data was decompressed or an error
+ * occurred.
+ *
+ * Asserts:
+ *      state != NULL
+ *      output != NULL
+ *
+ * @param[in] state Decompression_State object
+ * @param[out] output Memory for the decompressed data
+ * @param[in] output_length Size of the memory
+ *
+ * @return Number of decompressed bytes
+ */
+static size_t
+Decompress_Into
+(
+        struct Decompression_State* const restrict state,
+        char* const restrict output,
+        const size_t output_length
+)
+{
+    ASSERT_MSG(state != NULL, "Decompression_State is NULL !");
+    ASSERT_MSG(output != NULL, "Output is NULL !");
+
+    size_t decompressed_bytes = 0;
+
+#ifdef HAVE_ZLIB
+    if (state->format == COMPRESSION_GZIP)
+    {
+        z_stream* const stream = &(state->gzip_stream);
+        const uInt output_chunk = (uInt) ((output_length > UINT_MAX) ? UINT_MAX : output_length);
+        stream->next_out    = (Bytef*) output;
+        stream->avail_out   = output_chunk;
+
+        while (stream->avail_out > 0)
+        {
+            // The whole input is in the memory; so the input will be given in large chunks
+            if (stream->avail_in == 0)
+            {
+                const uint_fast64_t bytes_left = state->compressed_size - state->input_position;
+                stream->next_in     = (z_const Bytef*) (state->compressed_data + state->input_position);
+                stream->avail_in    = (uInt) ((bytes_left > MAX_INPUT_CHUNK_SIZE) ? MAX_INPUT_CHUNK_SIZE : bytes_left);
+            }
+
+            const uInt avail_in_before = stream->avail_in;
+            const int inflate_result = inflate(stream, Z_NO_FLUSH);
+            state->input_position += (uint_fast64_t) (avail_in_before - stream->avail_in);
+
+            if (inflate_result == Z_STREAM_END)
+            {
+                // gzip files can contain several members (e.g. created with "cat a.gz b.gz"); other data behind a
+                // member will be ignored like gzip does
+                const uint_fast64_t bytes_left = state->compressed_size - state->input_position;
+                if (CompressedInput_DetectFormat((const char*) (state->compressed_data + state->input_position),
+                        bytes_left) != COMPRESSION_GZIP)
+                {
+                    state->finished = true;
+                    break;
+                }
+                inflateReset(stream);
+            }
+            else if (inflate_result == Z_BUF_ERROR && state->input_position == state->compressed_size)
+            {
+                state->error_message = "The compressed data ends unexpectedly";
+                break;
+            }
+            else if (inflate_result != Z_OK && inflate_result != Z_BUF_ERROR)
+            {
+                state->error_message = (stream->msg != NULL) ? stream->msg : "Invalid gzip data";
+                break;
+            }
+        }
+        decompressed_bytes = (size_t) (output_chunk - stream->avail_out);
+    }
+#endif /* HAVE_ZLIB */
+#ifdef HAVE_ZSTD
+    if (state->format == COMPRESSION_ZSTD)
+    {
+        ZSTD_outBuffer output_buffer = { output, output_length, 0 };
+
+        while (output_buffer.pos < output_buffer.size)
+        {
+            const uint_fast64_t bytes_left = state->compressed_size - state->input_position;
+            // All frames were decompressed and flushed
+            if (bytes_left == 0 && state->last_zstd_result == 0)
+            {
+                state->finished = true;
+                break;
+            }
+
+            ZSTD_inBuffer input_buffer = { state->compressed_data + state->input_position,
+                    (size_t) ((bytes_left > MAX_INPUT_CHUNK_SIZE) ? MAX_INPUT_CHUNK_SIZE : bytes_left), 0 };
+            const size_t output_before = output_buffer.pos;
+
+            const size_t zstd_result = ZSTD_decompressStream(state->zstd_stream, &output_buffer, &input_buffer);
+            state->input_position += (uint_fast64_t) input_buffer.pos;
+            if (ZSTD_isError(zstd_result))
+            {
+                state->error_message = ZSTD_getErrorName(zstd_result);
+                break;
+            }
+            state->last_zstd_result = zstd_result;
+
+            // No input left and no progress: The last frame is incomplete
+            if (bytes_left == 0 && output_buffer.pos == output_before)
+            {
+                state->error_message = "The compressed data ends unexpectedly";
+                break;
+            }
+        }
+        decompressed_bytes = output_buffer.pos;
+    }
+#endif /* HAVE_ZSTD */
+
+#if ! defined(HAVE_ZLIB) && ! defined(HAVE_ZSTD)
+    (void) output;
+    (void) output_length;
+    state->error_message = "No decompression library available";
+#endif /* ! defined(HAVE_ZLIB) && ! defined(HAVE_ZSTD) */
+
+    return decompressed_bytes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Wait, until the next block is ready for reading, and use it as read block.
+ *
+ * Asserts:
+ *      object != NULL
+ *      No decompression error occurred
+ *
+ * @param[in] object Compressed_Input object
+ *
+ * @return true, if a block is available; false at the end of the decompressed data
+ */
+static _Bool
+Wait_For_Read_Block
+(
+        struct Compressed_Input* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Compressed_Input is NULL !");
+
+    pthread_mutex_lock(&(object->mutex));
+    while (object->full_blocks == 0 && ! object->end_of_data)
+    {
+        pthread_cond_wait(&(object->block_full), &(object->mutex));
+    }
+    const size_t full_blocks            = object->full_blocks;
+    const char* const error_message     = object->error_message;
+    const uint_fast64_t error_position  = object->error_position;
+    pthread_mutex_unlock(&(object->mutex));
+
+    ASSERT_FMSG(error_message == NULL, "Cannot decompress the file \"%s\" (%s) near the compressed byte %" PRIuFAST64
+            " !", object->file_name, error_message, error_position);
+
+    if (full_blocks == 0) { return false; }
+
+    object->read_block_available    = true;
+    object->read_position           = 0;
+    object->read_input_position     = object->input_position [object->read_index];
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Give the completely read block back to the decompression thread.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Compressed_Input object
+ */
+static void
+Release_Read_Block
+(
+        struct Compressed_Input* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Compressed_Input is NULL !");
+
+    object->decompressed_bytes += (uint_fast64_t) object->used_bytes [object->read_index];
+    object->read_block_available = false;
+    object->read_index = (object->read_index + 1) % COMPRESSED_INPUT_NUMBER_OF_BLOCKS;
+
+    pthread_mutex_lock(&(object->mutex));
+    -- object->full_blocks;
+    pthread_cond_signal(&(object->block_free));
+    pthread_mutex_unlock(&(object->mutex));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the end of the last complete line in a block. (Position behind the last newline char)
+ *
+ * @param[in] block Begin of the block
+ * @param[in] length Number of bytes in the block
+ *
+ * @return Position behind the last newline char; 0, if the block contains no newline char
+ */
+static size_t
+Find_End_Of_Last_Line
+(
+        const char* const block,
+        const size_t length
+)
+{
+    for (size_t i = length; i > 0; -- i)
+    {
+        if (block [i - 1] == '\n')
+        {
+            return i;
+        }
+    }
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef MAX_INPUT_CHUNK_SIZE
+#undef MAX_INPUT_CHUNK_SIZE
+#endif /* MAX_INPUT_CHUNK_SIZE */
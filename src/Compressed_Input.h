@@ -0,0 +1,260 @@
+/**
+ * @file Compressed_Input.h
+ *
+ * @brief Line by line reading of a gzip or zstd compressed input file. The decompression runs in a helper thread.
+ *
+ * The compressed file content (e.g. a Mapped_File) will be decompressed in a ring of blocks. The helper thread fills
+ * the blocks, while the calling thread parses the lines of the previous blocks. So the decompression and the parsing
+ * overlap and the decompressed file is never in the memory (or on the disk) as a whole.
+ *
+ * Every block contains only complete lines: the begin of a line, that does not fit in a block, will be moved in the
+ * next block. A block grows, if one line is longer than the block. So the line views point always in one block and
+ * they are valid until the next CompressedInput_NextLine() call.
+ *
+ * The supported formats depend on the build: gzip needs zlib (HAVE_ZLIB), zstd needs libzstd (HAVE_ZSTD). The
+ * Makefile sets the macros, if the headers are available. The format will be detected with the magic bytes.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef COMPRESSED_INPUT_H
+#define COMPRESSED_INPUT_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "Mapped_File.h"
+#include "Error_Handling/_Generics.h"
+
+
+
+/**
+ * @brief Initial size of one block in the ring in bytes.
+ */
+#ifndef COMPRESSED_INPUT_BLOCK_SIZE
+#define COMPRESSED_INPUT_BLOCK_SIZE 1048576
+#else
+#error "The macro \"COMPRESSED_INPUT_BLOCK_SIZE\" is already defined !"
+#endif /* COMPRESSED_INPUT_BLOCK_SIZE */
+
+/**
+ * @brief Number of blocks in the ring.
+ */
+#ifndef COMPRESSED_INPUT_NUMBER_OF_BLOCKS
+#define COMPRESSED_INPUT_NUMBER_OF_BLOCKS 4
+#else
+#error "The macro \"COMPRESSED_INPUT_NUMBER_OF_BLOCKS\" is already defined !"
+#endif /* COMPRESSED_INPUT_NUMBER_OF_BLOCKS */
+
+/**
+ * @brief Check, whether the macro values are valid.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(COMPRESSED_INPUT_BLOCK_SIZE > 0, "The marco \"COMPRESSED_INPUT_BLOCK_SIZE\" is zero !");
+// With two blocks one block can be filled while the other one will be parsed
+_Static_assert(COMPRESSED_INPUT_NUMBER_OF_BLOCKS >= 2,
+        "The marco \"COMPRESSED_INPUT_NUMBER_OF_BLOCKS\" needs to be at least 2 !");
+
+IS_TYPE(COMPRESSED_INPUT_BLOCK_SIZE, int)
+IS_TYPE(COMPRESSED_INPUT_NUMBER_OF_BLOCKS, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//=====================================================================================================================
+
+/**
+ * @brief Compression formats, that can be detected.
+ */
+enum Compression_Format
+{
+    COMPRESSION_NONE = 0,       ///< Not compressed (or unknown format)
+    COMPRESSION_GZIP,           ///< gzip (also several concatenated gzip members)
+    COMPRESSION_ZSTD            ///< Zstandard (also several concatenated frames)
+};
+
+/**
+ * @brief The Compressed_Input object.
+ *
+ * The ring: The helper thread fills the blocks beginning with "fill_index". The calling thread reads the lines of the
+ * block "read_index". "full_blocks" is the number of blocks, that are ready for reading. All fields below the mutex
+ * are shared between the two threads and only accessible with a locked mutex.
+ */
+struct Compressed_Input
+{
+    const char* file_name;                                          ///< Name of the input file (for error messages)
+    const unsigned char* compressed_data;                           ///< Compressed file content
+    uint_fast64_t compressed_size;                                  ///< Size of the compressed file content
+    enum Compression_Format format;                                 ///< Compression format
+
+    char* blocks [COMPRESSED_INPUT_NUMBER_OF_BLOCKS];               ///< Ring of blocks with decompressed lines
+    size_t allocated_bytes [COMPRESSED_INPUT_NUMBER_OF_BLOCKS];     ///< Allocated size of the specific block
+    size_t used_bytes [COMPRESSED_INPUT_NUMBER_OF_BLOCKS];          ///< Bytes with complete lines in the block
+    /// Position in the compressed data, that was reached with the specific block (for process information)
+    uint_fast64_t input_position [COMPRESSED_INPUT_NUMBER_OF_BLOCKS];
+
+    size_t read_index;                                              ///< Block, that will be read
+    size_t read_position;                                           ///< Begin of the next line in the read block
+    _Bool read_block_available;                                     ///< Is the block "read_index" in use ?
+    uint_fast64_t read_input_position;                              ///< Input position of the read block
+    uint_fast64_t decompressed_bytes;                               ///< Number of decompressed bytes, that were read
+
+    pthread_t decompression_thread;                                 ///< Thread, that fills the blocks
+    pthread_mutex_t mutex;                                          ///< Mutex for the shared fields
+    pthread_cond_t block_full;                                      ///< Signal: A block is ready for reading
+    pthread_cond_t block_free;                                      ///< Signal: A block was read
+
+    size_t full_blocks;                                             ///< Number of blocks, that are ready (shared)
+    _Bool end_of_data;                                              ///< The last block was filled (shared)
+    _Bool stop;                                                     ///< The reader stops early (shared)
+    const char* error_message;                                      ///< Decompression error; NULL: no error (shared)
+    uint_fast64_t error_position;                                   ///< Position of the error in the input (shared)
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Detect the compression format with the magic bytes at the begin of the data.
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] data Begin of the file content
+ * @param[in] size Size of the file content
+ *
+ * @return Detected compression format (COMPRESSION_NONE, if the magic bytes are unknown)
+ */
+extern enum Compression_Format
+CompressedInput_DetectFormat
+(
+        const char* const data,
+        const uint_fast64_t size
+);
+
+/**
+ * @brief Create a new Compressed_Input object and start the decompression thread.
+ *
+ * The compressed data needs to be available until the object will be deleted.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      file_name != NULL
+ *      The format is not COMPRESSION_NONE and was enabled at build time
+ *      The thread can be created
+ *
+ * @param[in] input_file Compressed file content
+ * @param[in] format Compression format (See CompressedInput_DetectFormat())
+ * @param[in] file_name Name of the input file (for error messages)
+ *
+ * @return Address to the new dynamic Compressed_Input object
+ */
+extern struct Compressed_Input*
+CompressedInput_CreateObject
+(
+        const struct Mapped_File* const restrict input_file,
+        const enum Compression_Format format,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Stop the decompression thread and delete the Compressed_Input object. Not read data will be discarded.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Compressed_Input object
+ */
+extern void
+CompressedInput_DeleteObject
+(
+        struct Compressed_Input* object
+);
+
+/**
+ * @brief Determine the next decompressed line. The calling thread waits, until the line is available.
+ *
+ * The newline char is not part of the line. The last line of the file does not need a newline char (like in
+ * MappedFile_NextLine()). The line view is valid until the next call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      line != NULL
+ *      No decompression error occurred
+ *
+ * @param[in] object Compressed_Input object
+ * @param[out] line View of the next line
+ *
+ * @return true, if a line was found; false at the end of the decompressed data
+ */
+extern _Bool
+CompressedInput_NextLine
+(
+        struct Compressed_Input* const restrict object,
+        struct Line_View* const restrict line
+);
+
+/**
+ * @brief Get the begin of the decompressed data without reading a line. (E.g. for the detection of the file type)
+ *
+ * The calling thread waits, until the first block is available.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      size != NULL
+ *      No decompression error occurred
+ *
+ * @param[in] object Compressed_Input object
+ * @param[out] data Begin of the decompressed data (not null terminated)
+ * @param[out] size Number of available bytes (0: The decompressed data is empty)
+ */
+extern void
+CompressedInput_PeekBegin
+(
+        struct Compressed_Input* const restrict object,
+        const char** const restrict data,
+        size_t* const restrict size
+);
+
+/**
+ * @brief Position in the compressed data, that belongs to the current read position. (For process information)
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Compressed_Input object
+ *
+ * @return Number of compressed bytes, that were decompressed for the lines until now
+ */
+extern uint_fast64_t
+CompressedInput_GetInputPosition
+(
+        const struct Compressed_Input* const object
+);
+
+/**
+ * @brief Name of a compression format.
+ *
+ * @param[in] format Compression format
+ *
+ * @return Name as constant C string
+ */
+extern const char*
+CompressedInput_FormatToString
+(
+        const enum Compression_Format format
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* COMPRESSED_INPUT_H */
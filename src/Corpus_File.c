@@ -0,0 +1,1859 @@
+/**
+ * @file Corpus_File.c
+ *
+ * @brief A compiled corpus file: the encoded tokens of an input file and the vocabulary in a flat binary layout.
+ *
+ * The file will be written with buffered stdio calls; the headers will be written at the end, when all positions and
+ * checksums are known. The checksum is a FNV-1a variant, that processes 8 bytes per step. So the check of a large
+ * file is limited by the memory bandwidth and not by the checksum calculation.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Corpus_File.h"
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include "Defines.h"
+#include "Misc.h"
+#include "Print_Tools.h"
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+
+
+
+/**
+ * @brief Known value in the header. With an other byte order the value in the file is different.
+ */
+#ifndef BYTE_ORDER_MARK
+#define BYTE_ORDER_MARK 0x0102030405060708ULL
+#else
+#error "The macro \"BYTE_ORDER_MARK\" is already defined !"
+#endif /* BYTE_ORDER_MARK */
+
+/**
+ * @brief Alignment of the headers and the sections in the file.
+ */
+#ifndef SECTION_ALIGNMENT
+#define SECTION_ALIGNMENT 8
+#else
+#error "The macro \"SECTION_ALIGNMENT\" is already defined !"
+#endif /* SECTION_ALIGNMENT */
+
+/**
+ * @brief Start value of the checksum (FNV-1a 64 bit offset basis).
+ */
+#ifndef CHECKSUM_OFFSET_BASIS
+#define CHECKSUM_OFFSET_BASIS 14695981039346656037ULL
+#else
+#error "The macro \"CHECKSUM_OFFSET_BASIS\" is already defined !"
+#endif /* CHECKSUM_OFFSET_BASIS */
+
+/**
+ * @brief Multiplier of the checksum (FNV-1a 64 bit prime).
+ */
+#ifndef CHECKSUM_PRIME
+#define CHECKSUM_PRIME 1099511628211ULL
+#else
+#error "The macro \"CHECKSUM_PRIME\" is already defined !"
+#endif /* CHECKSUM_PRIME */
+
+/**
+ * @brief Minimum widths of the offsets in a new corpus file (in byte).
+ *
+ * The offsets will be saved with the narrowest width, that fits the largest offset of the corpus, but not narrower
+ * than the default offset types. So a program with the default offset types can use the offsets of every file, that
+ * it has written, directly from the mapped file.
+ */
+#ifndef MIN_CHAR_OFFSET_SIZE
+#define MIN_CHAR_OFFSET_SIZE 2
+#else
+#error "The macro \"MIN_CHAR_OFFSET_SIZE\" is already defined !"
+#endif /* MIN_CHAR_OFFSET_SIZE */
+
+#ifndef MIN_SENTENCE_OFFSET_SIZE
+#define MIN_SENTENCE_OFFSET_SIZE 1
+#else
+#error "The macro \"MIN_SENTENCE_OFFSET_SIZE\" is already defined !"
+#endif /* MIN_SENTENCE_OFFSET_SIZE */
+
+#ifndef MIN_WORD_OFFSET_SIZE
+#define MIN_WORD_OFFSET_SIZE 2
+#else
+#error "The macro \"MIN_WORD_OFFSET_SIZE\" is already defined !"
+#endif /* MIN_WORD_OFFSET_SIZE */
+
+/**
+ * @brief Is the value a valid width of offsets in a corpus file (1, 2 or 4 byte) ?
+ */
+#ifndef IS_VALID_OFFSET_SIZE
+#define IS_VALID_OFFSET_SIZE(size) ((size) == sizeof (uint8_t) || (size) == sizeof (uint16_t) ||                        \
+        (size) == sizeof (uint32_t))
+#else
+#error "The macro \"IS_VALID_OFFSET_SIZE\" is already defined !"
+#endif /* IS_VALID_OFFSET_SIZE */
+
+/**
+ * @brief Name of a JSON token array like in the CLI parameter --match_on (for messages).
+ */
+#ifndef TOKEN_ARRAY_NAME
+#define TOKEN_ARRAY_NAME(token_array) (((token_array) == JSON_TOKEN_ARRAY_LEMMA) ? "lemma" : "tokens")
+#else
+#error "The macro \"TOKEN_ARRAY_NAME\" is already defined !"
+#endif /* TOKEN_ARRAY_NAME */
+
+/**
+ * @brief Number of offsets, that will be converted at once, when offsets will be written with an other width.
+ */
+#ifndef OFFSET_BUFFER_LENGTH
+#define OFFSET_BUFFER_LENGTH 4096
+#else
+#error "The macro \"OFFSET_BUFFER_LENGTH\" is already defined !"
+#endif /* OFFSET_BUFFER_LENGTH */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+// The headers will be mapped directly; so they need to keep the alignment of the sections
+_Static_assert(sizeof (struct Corpus_File_Header) % SECTION_ALIGNMENT == 0,
+        "The size of the corpus file header is not a multiple of SECTION_ALIGNMENT !");
+_Static_assert(sizeof (struct Corpus_File_Segment_Header) % SECTION_ALIGNMENT == 0,
+        "The size of the segment header is not a multiple of SECTION_ALIGNMENT !");
+// The checksum processes whole 8 byte values
+_Static_assert(SECTION_ALIGNMENT == sizeof (uint64_t), "SECTION_ALIGNMENT needs to be the size of uint64_t !");
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+/**
+ * @brief State of a checksum calculation. The data can be added in parts of any size.
+ */
+struct Checksum
+{
+    uint64_t value;                         ///< Current checksum
+    unsigned char word [sizeof (uint64_t)]; ///< Bytes, that do not fill a whole value yet
+    size_t bytes_in_word;                   ///< Number of used bytes in word
+};
+
+/**
+ * @brief State, while a corpus file will be written.
+ */
+struct Corpus_File_Writer
+{
+    FILE* file;                             ///< Corpus file
+    const char* file_name;                  ///< Name of the corpus file (for error messages)
+    uint64_t position;                      ///< Current position in the file
+    struct Checksum checksum;               ///< Checksum of the written sections
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Initialize a checksum calculation.
+ *
+ * Asserts:
+ *      checksum != NULL
+ *
+ * @param[out] checksum Checksum object
+ */
+static void
+Checksum_Init
+(
+        struct Checksum* const checksum
+);
+
+/**
+ * @brief Add data to a checksum calculation.
+ *
+ * Asserts:
+ *      checksum != NULL
+ *      data != NULL
+ *
+ * @param[in] checksum Checksum object
+ * @param[in] data Data
+ * @param[in] size Size of the data in bytes
+ */
+static void
+Checksum_Add
+(
+        struct Checksum* const restrict checksum,
+        const void* const restrict data,
+        const size_t size
+);
+
+/**
+ * @brief Finish a checksum calculation. Not complete values will be filled with zeros.
+ *
+ * Asserts:
+ *      checksum != NULL
+ *
+ * @param[in] checksum Checksum object
+ *
+ * @return The checksum
+ */
+static uint64_t
+Checksum_Finish
+(
+        struct Checksum* const checksum
+);
+
+/**
+ * @brief Calculate the checksum of a memory block.
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] data Data
+ * @param[in] size Size of the data in bytes
+ *
+ * @return The checksum
+ */
+static uint64_t
+Checksum_Of_Block
+(
+        const void* const data,
+        const size_t size
+);
+
+/**
+ * @brief Write data to the corpus file and add it to the checksum of the writer.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      data != NULL
+ *      The data can be written
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] data Data
+ * @param[in] size Size of the data in bytes
+ */
+static void
+Write_Bytes
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const void* const restrict data,
+        const size_t size
+);
+
+/**
+ * @brief Begin a section of a segment. The position will be saved in the segment header.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      segment_header != NULL
+ *      section < CORPUS_FILE_NUMBER_OF_SECTIONS
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[out] segment_header Header of the segment
+ * @param[in] section Section, that begins
+ */
+static void
+Begin_Section
+(
+        struct Corpus_File_Writer* const restrict writer,
+        struct Corpus_File_Segment_Header* const restrict segment_header,
+        const enum Corpus_File_Section section
+);
+
+/**
+ * @brief End a section of a segment. The size will be saved in the segment header and the file will be filled with
+ * zeros until the next aligned position.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      segment_header != NULL
+ *      section < CORPUS_FILE_NUMBER_OF_SECTIONS
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[out] segment_header Header of the segment
+ * @param[in] section Section, that ends
+ */
+static void
+End_Section
+(
+        struct Corpus_File_Writer* const restrict writer,
+        struct Corpus_File_Segment_Header* const restrict segment_header,
+        const enum Corpus_File_Section section
+);
+
+/**
+ * @brief Write a header at a position before the current position and return to the current position.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      header != NULL
+ *      The header can be written
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] position Position of the header
+ * @param[in] header Header
+ * @param[in] header_size Size of the header in bytes
+ */
+static void
+Write_Header_At
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const uint64_t position,
+        const void* const restrict header,
+        const size_t header_size
+);
+
+/**
+ * @brief Read a header at a position before the current position and return to the current position.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      header != NULL
+ *      The header can be read
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] position Position of the header
+ * @param[out] header Memory for the header
+ * @param[in] header_size Size of the header in bytes
+ */
+static void
+Read_Header_At
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const uint64_t position,
+        void* const restrict header,
+        const size_t header_size
+);
+
+/**
+ * @brief Write a segment at the current position: the segment header, the new part of the vocabulary and the data of
+ * an Encoded_Corpus. The next segment in the segment header is 0.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      corpus != NULL
+ *      token_int_mapping != NULL
+ *      vocabulary_begins != NULL
+ *      header != NULL
+ *      segment_header != NULL
+ *      The current position is aligned
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] corpus Encoded_Corpus object
+ * @param[in] token_int_mapping Token_Int_Mapping object, that was used for the encoding of the corpus
+ * @param[in] vocabulary_begins First token per C-String array, that belongs to the segment (The tokens before are in
+ * the previous segments)
+ * @param[in] header File header with the offset widths (The offsets of the corpus need to fit in these widths) and
+ * the encoded token array
+ * @param[out] segment_header Header of the written segment
+ *
+ * @return Position of the segment header
+ */
+static uint64_t
+Write_Segment
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const struct Encoded_Corpus* const restrict corpus,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const uint_fast32_t* const restrict vocabulary_begins,
+        const struct Corpus_File_Header* const restrict header,
+        struct Corpus_File_Segment_Header* const restrict segment_header
+);
+
+/**
+ * @brief Check the header of a corpus file.
+ *
+ * Asserts:
+ *      header != NULL
+ *      file_name != NULL
+ *      Magic bytes, version, byte order, type sizes, offset widths, token array, checksum and file size are valid
+ *
+ * @param[in] header Header of the corpus file
+ * @param[in] file_size Size of the mapped file
+ * @param[in] file_name Name of the corpus file (for error messages)
+ */
+static void
+Check_Header
+(
+        const struct Corpus_File_Header* const restrict header,
+        const uint_fast64_t file_size,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Check a segment of a corpus file and return its header.
+ *
+ * Asserts:
+ *      corpus_file != NULL
+ *      header != NULL
+ *      file_name != NULL
+ *      The segment header is in the file and aligned
+ *      Checksums, section positions and section sizes are valid
+ *
+ * @param[in] corpus_file Mapped corpus file
+ * @param[in] header Checked header of the corpus file (file size and offset widths)
+ * @param[in] position Position of the segment header
+ * @param[in] file_name Name of the corpus file (for error messages)
+ *
+ * @return Header of the segment (in the mapped file)
+ */
+static const struct Corpus_File_Segment_Header*
+Check_Segment
+(
+        const struct Mapped_File* const restrict corpus_file,
+        const struct Corpus_File_Header* const restrict header,
+        const uint64_t position,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Determine the widths of the char, sentence and word offsets of an Encoded_Corpus in a corpus file.
+ *
+ * Asserts:
+ *      corpus != NULL
+ *      header != NULL
+ *
+ * @param[in] corpus Encoded_Corpus object
+ * @param[out] header File header; only the offset widths will be set
+ */
+static void
+Determine_Offset_Sizes
+(
+        const struct Encoded_Corpus* const restrict corpus,
+        struct Corpus_File_Header* const restrict header
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Convert offsets with the width 1, 2 or 4 byte in an other type. Every width has its own loop without
+ * branches; so the compiler can vectorize it. The largest value will be saved in max_value.
+ */
+#define CONVERT_OFFSETS(target, source, source_type, target_type, count, max_value)                                     \
+    for (size_t i_ = 0; i_ < (count); ++ i_)                                                                            \
+    {                                                                                                                   \
+        const source_type value_ = ((const source_type*) (const void*) (source)) [i_];                                  \
+        (max_value) = MAX((max_value), (uint_fast64_t) value_);                                                         \
+        (target) [i_] = (target_type) value_;                                                                           \
+    }
+
+/**
+ * @brief Define the functions, that write and read the offsets of one offset type in a corpus file.
+ *
+ * Write_<name>_Offsets() writes offsets with the width of the file. Convert_<name>_Offsets() converts offsets from
+ * the file in the offset type of the program; this is only necessary, if the file was written with an other width.
+ * With the same width both functions copy the data without a conversion.
+ */
+#define DEFINE_OFFSET_FUNCTIONS(name, kind, offset_type, offset_type_max, bits_macro)                                   \
+static void                                                                                                             \
+Write_##name##_Offsets                                                                                                  \
+(                                                                                                                       \
+        struct Corpus_File_Writer* const restrict writer,                                                               \
+        const offset_type* const restrict offsets,                                                                      \
+        const size_t count,                                                                                             \
+        const uint64_t offset_size                                                                                      \
+)                                                                                                                       \
+{                                                                                                                       \
+    if (offset_size == sizeof (offset_type))                                                                            \
+    {                                                                                                                   \
+        Write_Bytes(writer, offsets, count * sizeof (offset_type));                                                     \
+        return;                                                                                                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    union { uint8_t u8 [OFFSET_BUFFER_LENGTH]; uint16_t u16 [OFFSET_BUFFER_LENGTH];                                     \
+            uint32_t u32 [OFFSET_BUFFER_LENGTH]; } buffer;                                                              \
+    for (size_t begin = 0; begin < count; begin += OFFSET_BUFFER_LENGTH)                                                \
+    {                                                                                                                   \
+        const size_t block = MIN(count - begin, OFFSET_BUFFER_LENGTH);                                                  \
+        uint_fast64_t max_value = 0;                                                                                    \
+        switch (offset_size)                                                                                            \
+        {                                                                                                               \
+        case sizeof (uint8_t):  CONVERT_OFFSETS(buffer.u8, offsets + begin, offset_type, uint8_t, block, max_value)     \
+            break;                                                                                                      \
+        case sizeof (uint16_t): CONVERT_OFFSETS(buffer.u16, offsets + begin, offset_type, uint16_t, block, max_value)   \
+            break;                                                                                                      \
+        case sizeof (uint32_t): CONVERT_OFFSETS(buffer.u32, offsets + begin, offset_type, uint32_t, block, max_value)   \
+            break;                                                                                                      \
+        default:                                                                                                        \
+            ASSERT_FMSG(false, "Invalid " kind " offset width: %" PRIu64 " byte !", offset_size);                       \
+        }                                                                                                               \
+        ASSERT_FMSG(max_value < ((uint_fast64_t) 1 << (offset_size * CHAR_BIT)), "The " kind " offset %" PRIuFAST64     \
+                " does not fit in %" PRIu64 " byte !", max_value, offset_size);                                         \
+        Write_Bytes(writer, &buffer, block * (size_t) offset_size);                                                     \
+    }                                                                                                                   \
+                                                                                                                        \
+    return;                                                                                                             \
+}                                                                                                                       \
+                                                                                                                        \
+static void                                                                                                             \
+Convert_##name##_Offsets                                                                                                \
+(                                                                                                                       \
+        offset_type* const restrict target,                                                                             \
+        const char* const restrict source,                                                                              \
+        const size_t count,                                                                                             \
+        const uint64_t offset_size,                                                                                     \
+        const char* const restrict file_name                                                                            \
+)                                                                                                                       \
+{                                                                                                                       \
+    uint_fast64_t max_value = 0;                                                                                        \
+    switch (offset_size)                                                                                                \
+    {                                                                                                                   \
+    case sizeof (uint8_t):  CONVERT_OFFSETS(target, source, uint8_t, offset_type, count, max_value)                     \
+        break;                                                                                                          \
+    case sizeof (uint16_t): CONVERT_OFFSETS(target, source, uint16_t, offset_type, count, max_value)                    \
+        break;                                                                                                          \
+    case sizeof (uint32_t): CONVERT_OFFSETS(target, source, uint32_t, offset_type, count, max_value)                    \
+        break;                                                                                                          \
+    default:                                                                                                            \
+        ASSERT_FMSG(false, "Invalid " kind " offset width (%" PRIu64 " byte) in the corpus file \"%s\" !",              \
+                offset_size, file_name);                                                                                \
+    }                                                                                                                   \
+    ASSERT_FMSG(max_value <= (uint_fast64_t) (offset_type_max), "The " kind " offset %" PRIuFAST64 " in the corpus "    \
+            "file \"%s\" is too large for this program ! Please rebuild it with a larger " #bits_macro " value.",       \
+            max_value, file_name);                                                                                      \
+                                                                                                                        \
+    return;                                                                                                             \
+}
+
+DEFINE_OFFSET_FUNCTIONS(Char, "char", CHAR_OFFSET_TYPE, CHAR_OFFSET_TYPE_MAX, CHAR_OFFSET_BITS)
+DEFINE_OFFSET_FUNCTIONS(Sentence, "sentence", SENTENCE_OFFSET_TYPE, SENTENCE_OFFSET_TYPE_MAX, SENTENCE_OFFSET_BITS)
+DEFINE_OFFSET_FUNCTIONS(Word, "word", WORD_OFFSET_TYPE, WORD_OFFSET_TYPE_MAX, WORD_OFFSET_BITS)
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether a file is a compiled corpus file. (Only the magic bytes will be compared)
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the file
+ *
+ * @return true, if the file starts with the magic bytes of a compiled corpus file, otherwise false
+ */
+extern _Bool
+CorpusFile_IsCorpusFile
+(
+        const char* const file_name
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    _Bool result = false;
+    FILE* file = fopen(file_name, "rb");
+
+    if (file != NULL)
+    {
+        char magic [sizeof (CORPUS_FILE_MAGIC)];
+        result = fread(magic, sizeof (char), COUNT_ARRAY_ELEMENTS(magic), file) == COUNT_ARRAY_ELEMENTS(magic) &&
+                memcmp(magic, CORPUS_FILE_MAGIC, COUNT_ARRAY_ELEMENTS(magic)) == 0;
+        const int close_result = fclose(file);
+        file = NULL;
+        ASSERT_FMSG(close_result != EOF, "Cannot close the file \"%s\" ! EOF was returned !", file_name);
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write an Encoded_Corpus and the vocabulary in a compiled corpus file with one segment.
+ *
+ * The vocabulary needs to be the mapping, that was used for the encoding of the corpus (and nothing else). So the
+ * mapping integers in the corpus file are valid after the loading.
+ *
+ * Asserts:
+ *      corpus != NULL
+ *      token_int_mapping != NULL
+ *      file_name != NULL
+ *      The file can be written
+ *
+ * @param[in] corpus Encoded_Corpus object
+ * @param[in] token_int_mapping Token_Int_Mapping object, that was used for the encoding of the corpus
+ * @param[in] file_name Name of the corpus file (An existing file will be overwritten)
+ * @param[in] token_array JSON array, that was encoded (will be saved in the header; like the stop word removal of the
+ * corpus)
+ */
+extern void
+CorpusFile_Write
+(
+        const struct Encoded_Corpus* const restrict corpus,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const char* const restrict file_name,
+        const enum JSON_Token_Array token_array
+)
+{
+    ASSERT_MSG(corpus != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    struct Corpus_File_Writer writer;
+    memset(&writer, '\0', sizeof (writer));
+    writer.file = fopen(file_name, "wb");
+    writer.file_name = file_name;
+    ASSERT_FMSG(writer.file != NULL, "Cannot create the corpus file \"%s\" !", file_name);
+
+    // Placeholder; the header will be written again, when all values are known
+    struct Corpus_File_Header header;
+    memset(&header, '\0', sizeof (header));
+    Write_Bytes(&writer, &header, sizeof (header));
+    Determine_Offset_Sizes(corpus, &header);
+    // The segment contains the surface forms only with lemmas
+    header.token_array = (uint64_t) token_array;
+    header.stop_words_removed = (corpus->built_in_stop_words_removed) ? 1 : 0;
+    header.removed_stop_words = (uint64_t) corpus->removed_stop_words;
+
+    // The whole vocabulary belongs to the first segment
+    const uint_fast32_t vocabulary_begins [C_STR_ARRAYS] = { 0 };
+    struct Corpus_File_Segment_Header segment_header;
+    const uint64_t segment_position = Write_Segment(&writer, corpus, token_int_mapping, vocabulary_begins, &header,
+            &segment_header);
+
+    memcpy(header.magic, CORPUS_FILE_MAGIC, sizeof (header.magic));
+    header.version                  = CORPUS_FILE_VERSION;
+    header.byte_order_mark          = BYTE_ORDER_MARK;
+    header.mapping_int_size         = sizeof (uint_fast32_t);
+    header.array_begin_size         = sizeof (uint_fast64_t);
+    header.dataset_id_length        = DATASET_ID_LENGTH;
+    header.max_token_length         = MAX_TOKEN_LENGTH;
+    header.c_str_arrays             = C_STR_ARRAYS;
+    header.number_of_segments       = 1;
+    header.first_segment            = segment_position;
+    header.last_segment             = segment_position;
+    header.file_size                = writer.position;
+    header.number_of_data_sets      = segment_header.number_of_data_sets;
+    header.number_of_tokens         = segment_header.number_of_tokens;
+    header.longest_data_set         = segment_header.longest_data_set;
+    header.tokens_in_vocabulary     = segment_header.vocabulary_tokens;
+    header.header_checksum          = Checksum_Of_Block(&header, offsetof(struct Corpus_File_Header, header_checksum));
+
+    // The file header at last; so an incomplete file has never a valid header
+    Write_Header_At(&writer, 0, &header, sizeof (header));
+
+    const int close_result = fclose(writer.file);
+    writer.file = NULL;
+    ASSERT_FMSG(close_result != EOF, "Cannot close the corpus file \"%s\" ! EOF was returned !", file_name);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read and encode an input file and write the result as compiled corpus file.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      corpus_file != NULL
+ *      number_of_threads > 0
+ *      The input file is not a compiled corpus file
+ *
+ * @param[in] input_file Name of the input file (JSON, CSV, ...)
+ * @param[in] corpus_file Name of the corpus file (An existing file will be overwritten)
+ * @param[in] number_of_threads Number of threads, that parse the input file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens (The queries need the same setting)
+ * @param[in] remove_stop_words Remove the built-in stop words ? (will be saved in the header)
+ */
+extern void
+CorpusFile_Compile
+(
+        const char* const restrict input_file,
+        const char* const restrict corpus_file,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const _Bool remove_stop_words
+)
+{
+    ASSERT_MSG(input_file != NULL, "Input file name is NULL !");
+    ASSERT_MSG(corpus_file != NULL, "Corpus file name is NULL !");
+    ASSERT_MSG(number_of_threads > 0, "Number of threads is 0 !");
+    ASSERT_FMSG(! CorpusFile_IsCorpusFile(input_file), "The input file \"%s\" is already a compiled corpus file !",
+            input_file);
+
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject();
+    // Without the stop words a loaded file can be used directly for an intersection
+    struct Encoded_Corpus* corpus = EncodedCorpus_CreateObject(input_file, token_int_mapping, number_of_threads,
+            json_parser_mode, NULL,
+            ((token_array == JSON_TOKEN_ARRAY_LEMMA) ? ENCODING_MATCH_ON_LEMMA : ENCODING_DEFAULT) |
+            ((remove_stop_words) ? ENCODING_REMOVE_STOP_WORDS : ENCODING_DEFAULT));
+
+    CorpusFile_Write(corpus, token_int_mapping, corpus_file, token_array);
+    printf ("\nCorpus file \"%s\": %" PRIuFAST32 " data sets, %" PRIuFAST64 " tokens, %" PRIuFAST32 " tokens in the "
+            "vocabulary\n", corpus_file, corpus->token_ints->next_free_array, corpus->number_of_tokens,
+            corpus->tokens_added_to_mapping);
+
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read and encode an input file and append the result as new segment to an existing compiled corpus file.
+ *
+ * The input file will be encoded with the vocabulary of the corpus file. The new segment contains only the tokens,
+ * that extend the vocabulary, and the new data sets. The existing segments will not be changed; only the link of the
+ * last segment and the file header will be written again. The file header will be written at last: If the process
+ * will be interrupted, the file header describes still the old segments and the rest of the file will be ignored.
+ *
+ * If the file has more than CORPUS_FILE_MAX_SEGMENTS segments after the append, it will be compacted.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      corpus_file != NULL
+ *      number_of_threads > 0
+ *      The input file is not a compiled corpus file
+ *      The corpus file is a valid compiled corpus file and can be written
+ *      The corpus file was compiled with the same token_array
+ *
+ * @param[in] input_file Name of the input file (JSON, CSV, ...)
+ * @param[in] corpus_file Name of the existing corpus file
+ * @param[in] number_of_threads Number of threads, that parse the input file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens (The same as in the corpus file)
+ */
+extern void
+CorpusFile_Append
+(
+        const char* const restrict input_file,
+        const char* const restrict corpus_file,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array
+)
+{
+    ASSERT_MSG(input_file != NULL, "Input file name is NULL !");
+    ASSERT_MSG(corpus_file != NULL, "Corpus file name is NULL !");
+    ASSERT_MSG(number_of_threads > 0, "Number of threads is 0 !");
+    ASSERT_FMSG(! CorpusFile_IsCorpusFile(input_file), "The input file \"%s\" is already a compiled corpus file !",
+            input_file);
+
+    // The loading checks the whole file (also the token array); only the vocabulary and the header will be used for the
+    // append
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* corpus = CorpusFile_Load(corpus_file, token_int_mapping, token_array);
+    struct Corpus_File_Header header;
+    memcpy(&header, corpus->corpus_file->data, sizeof (header));
+    uint_fast32_t vocabulary_begins [C_STR_ARRAYS];
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        vocabulary_begins [i] = (uint_fast32_t) token_int_mapping->c_str_array_lengths [i];
+    }
+    // The file will be closed, before it will be changed
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+
+    // New tokens get new mapping integers; the known tokens keep their integers
+    // The new segment gets the stop word removal of the existing segments
+    corpus = EncodedCorpus_CreateObject(input_file, token_int_mapping, number_of_threads, json_parser_mode, NULL,
+            ((token_array == JSON_TOKEN_ARRAY_LEMMA) ? ENCODING_MATCH_ON_LEMMA : ENCODING_DEFAULT) |
+            ((header.stop_words_removed != 0) ? ENCODING_REMOVE_STOP_WORDS : ENCODING_DEFAULT));
+
+    // The existing segments define the offset widths of the whole file
+    struct Corpus_File_Header new_offset_sizes;
+    Determine_Offset_Sizes(corpus, &new_offset_sizes);
+    ASSERT_FMSG(new_offset_sizes.char_offset_size <= header.char_offset_size &&
+            new_offset_sizes.sentence_offset_size <= header.sentence_offset_size &&
+            new_offset_sizes.word_offset_size <= header.word_offset_size, "The offsets of the input file \"%s\" do not "
+            "fit in the offset widths of the corpus file \"%s\" ! Please compile the corpus again with all input "
+            "files.", input_file, corpus_file);
+
+    struct Corpus_File_Writer writer;
+    memset(&writer, '\0', sizeof (writer));
+    writer.file = fopen(corpus_file, "r+b");
+    writer.file_name = corpus_file;
+    ASSERT_FMSG(writer.file != NULL, "Cannot open the corpus file \"%s\" for writing !", corpus_file);
+    // Data after the end in the header is the rest of an interrupted append and will be overwritten
+    writer.position = header.file_size;
+    ASSERT_FMSG(fseek(writer.file, (long int) writer.position, SEEK_SET) == 0, "Cannot go to the end of the corpus "
+            "file \"%s\" !", corpus_file);
+
+    struct Corpus_File_Segment_Header segment_header;
+    const uint64_t segment_position = Write_Segment(&writer, corpus, token_int_mapping, vocabulary_begins, &header,
+            &segment_header);
+
+    // Link the new segment with the previous last segment
+    struct Corpus_File_Segment_Header last_segment_header;
+    Read_Header_At(&writer, header.last_segment, &last_segment_header, sizeof (last_segment_header));
+    ASSERT_FMSG(last_segment_header.next_segment == 0, "The last segment in the corpus file \"%s\" is not the end of "
+            "the segment list !", corpus_file);
+    last_segment_header.next_segment    = segment_position;
+    last_segment_header.header_checksum = Checksum_Of_Block(&last_segment_header,
+            offsetof(struct Corpus_File_Segment_Header, header_checksum));
+    Write_Header_At(&writer, header.last_segment, &last_segment_header, sizeof (last_segment_header));
+
+    header.number_of_segments       += 1;
+    header.last_segment             = segment_position;
+    header.file_size                = writer.position;
+    header.number_of_data_sets      += segment_header.number_of_data_sets;
+    header.number_of_tokens         += segment_header.number_of_tokens;
+    header.longest_data_set         = MAX(header.longest_data_set, segment_header.longest_data_set);
+    header.tokens_in_vocabulary     += segment_header.vocabulary_tokens;
+    header.removed_stop_words       += (uint64_t) corpus->removed_stop_words;
+    header.header_checksum          = Checksum_Of_Block(&header, offsetof(struct Corpus_File_Header, header_checksum));
+    Write_Header_At(&writer, 0, &header, sizeof (header));
+
+    const int close_result = fclose(writer.file);
+    writer.file = NULL;
+    ASSERT_FMSG(close_result != EOF, "Cannot close the corpus file \"%s\" ! EOF was returned !", corpus_file);
+
+    printf ("\nCorpus file \"%s\": %" PRIu64 " new data sets, %" PRIu64 " new tokens in the vocabulary, %" PRIu64
+            " segments\n", corpus_file, segment_header.number_of_data_sets, segment_header.vocabulary_tokens,
+            header.number_of_segments);
+
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    if (header.number_of_segments > CORPUS_FILE_MAX_SEGMENTS)
+    {
+        CorpusFile_Compact(corpus_file, token_array);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Rewrite a compiled corpus file with only one segment.
+ *
+ * The new file will be written with a temporary name and replaces the old file after it is complete. The content
+ * (vocabulary, mapping integers, data sets) does not change.
+ *
+ * Asserts:
+ *      corpus_file != NULL
+ *      The corpus file is a valid compiled corpus file
+ *      The corpus file was compiled with the same token_array
+ *      The temporary file can be written and renamed
+ *
+ * @param[in] corpus_file Name of the corpus file
+ * @param[in] token_array JSON array with the tokens (The same as in the corpus file)
+ */
+extern void
+CorpusFile_Compact
+(
+        const char* const corpus_file,
+        const enum JSON_Token_Array token_array
+)
+{
+    ASSERT_MSG(corpus_file != NULL, "Corpus file name is NULL !");
+
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* corpus = CorpusFile_Load(corpus_file, token_int_mapping, token_array);
+    const uint64_t old_number_of_segments =
+            ((const struct Corpus_File_Header*) corpus->corpus_file->data)->number_of_segments;
+
+    const size_t temp_file_name_length = strlen(corpus_file) + strlen(CORPUS_FILE_COMPACT_SUFFIX);
+    char* temp_file_name = (char*) MALLOC(temp_file_name_length + 1);
+    ASSERT_ALLOC(temp_file_name, "Cannot allocate memory for the temporary file name !", temp_file_name_length + 1);
+    strcpy(temp_file_name, corpus_file);
+    strcat(temp_file_name, CORPUS_FILE_COMPACT_SUFFIX);
+
+    // The Document_Word_List points in the mapped old file; the new file will be written from there
+    CorpusFile_Write(corpus, token_int_mapping, temp_file_name, token_array);
+    printf ("\nCorpus file \"%s\": %" PRIu64 " segments compacted to 1 segment\n", corpus_file,
+            old_number_of_segments);
+
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    ASSERT_FMSG(rename(temp_file_name, corpus_file) == 0, "Cannot replace the corpus file \"%s\" with the compacted "
+            "file \"%s\" !", corpus_file, temp_file_name);
+    FREE_AND_SET_TO_NULL(temp_file_name);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Map a compiled corpus file and create an Encoded_Corpus object with the data in the file.
+ *
+ * The mapped tokens and the offsets will not be copied; the Document_Word_List points in the mapped file. Only
+ * offsets, that were written with an other width than the offset types of this program, will be converted in dynamic
+ * arrays. The data set IDs will be copied only, if the file has more than one segment. The vocabulary will be copied
+ * in the empty mapping without a search. The mapped file will be closed with EncodedCorpus_DeleteObject().
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      token_int_mapping != NULL
+ *      The mapping is empty (A compiled corpus can only be the first input file)
+ *      The file is a valid compiled corpus file (magic bytes, version, type sizes, checksums, positions)
+ *      The offsets in the file fit in the offset types of this program
+ *      The file was compiled with the same token_array
+ *
+ * @param[in] file_name Name of the corpus file
+ * @param[in] token_int_mapping Empty Token_Int_Mapping object (The vocabulary of the file will be added)
+ * @param[in] token_array JSON array, that the caller expects in the file (tokens or lemma)
+ *
+ * @return Address to the new dynamic Encoded_Corpus object
+ */
+extern struct Encoded_Corpus*
+CorpusFile_Load
+(
+        const char* const restrict file_name,
+        struct Token_Int_Mapping* const restrict token_int_mapping,
+        const enum JSON_Token_Array token_array
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
+
+    // The mapping integers in the file are only valid in a mapping, that contains nothing else
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        ASSERT_FMSG(token_int_mapping->c_str_array_lengths [i] == 0, "The compiled corpus file \"%s\" can only be used "
+                "as first input file !", file_name);
+    }
+
+    struct Mapped_File* corpus_file = MappedFile_CreateObject(file_name);
+    ASSERT_FMSG(corpus_file->size >= sizeof (struct Corpus_File_Header), "The corpus file \"%s\" is too small !",
+            file_name);
+    const struct Corpus_File_Header* const header = (const struct Corpus_File_Header*) corpus_file->data;
+    Check_Header(header, corpus_file->size, file_name);
+    // Lemmas and surface tokens have different mapping integers; they can never be mixed
+    ASSERT_FMSG(header->token_array == (uint64_t) token_array, "The corpus file \"%s\" contains the \"%s\" array; "
+            "but the \"%s\" array was requested ! Please use the same --match_on setting as for the compilation.",
+            file_name, TOKEN_ARRAY_NAME(header->token_array), TOKEN_ARRAY_NAME(token_array));
+
+    struct Encoded_Corpus* new_object = (struct Encoded_Corpus*) CALLOC(1, sizeof (struct Encoded_Corpus));
+    ASSERT_ALLOC(new_object, "Cannot allocate memory for a Encoded_Corpus object !", sizeof (struct Encoded_Corpus));
+
+    const size_t number_of_data_sets = (size_t) header->number_of_data_sets;
+    new_object->corpus_file = corpus_file;
+    new_object->token_ints = DocumentWordList_CreateObjectWithExternalData(MAX(number_of_data_sets, 1));
+    if (header->token_array == JSON_TOKEN_ARRAY_LEMMA)
+    {
+        new_object->surface_token_ints = DocumentWordList_CreateObjectWithExternalData(MAX(number_of_data_sets, 1));
+    }
+    new_object->list_of_too_long_token = TwoDimCStrArray_CreateObject(1);
+    if (header->number_of_segments > 1)
+    {
+        // The IDs of all segments need to be in one array
+        new_object->dataset_ids = (char*) MALLOC(MAX(number_of_data_sets, 1) * DATASET_ID_LENGTH);
+        ASSERT_ALLOC(new_object->dataset_ids, "Cannot allocate memory for the data set IDs !",
+                MAX(number_of_data_sets, 1) * DATASET_ID_LENGTH);
+        new_object->allocated_dataset_ids = MAX(number_of_data_sets, 1);
+    }
+
+    // Offsets with an other width need a conversion; all segments have the same width
+    const size_t number_of_tokens = (size_t) header->number_of_tokens;
+    if (header->char_offset_size != sizeof (CHAR_OFFSET_TYPE))
+    {
+        new_object->converted_char_offsets = (CHAR_OFFSET_TYPE*) MALLOC(MAX(number_of_tokens, 1) *
+                sizeof (CHAR_OFFSET_TYPE));
+        ASSERT_ALLOC(new_object->converted_char_offsets, "Cannot allocate memory for the converted char offsets !",
+                MAX(number_of_tokens, 1) * sizeof (CHAR_OFFSET_TYPE));
+    }
+    if (header->sentence_offset_size != sizeof (SENTENCE_OFFSET_TYPE))
+    {
+        new_object->converted_sentence_offsets = (SENTENCE_OFFSET_TYPE*) MALLOC(MAX(number_of_tokens, 1) *
+                sizeof (SENTENCE_OFFSET_TYPE));
+        ASSERT_ALLOC(new_object->converted_sentence_offsets, "Cannot allocate memory for the converted sentence "
+                "offsets !", MAX(number_of_tokens, 1) * sizeof (SENTENCE_OFFSET_TYPE));
+    }
+    if (header->word_offset_size != sizeof (WORD_OFFSET_TYPE))
+    {
+        new_object->converted_word_offsets = (WORD_OFFSET_TYPE*) MALLOC(MAX(number_of_tokens, 1) *
+                sizeof (WORD_OFFSET_TYPE));
+        ASSERT_ALLOC(new_object->converted_word_offsets, "Cannot allocate memory for the converted word offsets !",
+                MAX(number_of_tokens, 1) * sizeof (WORD_OFFSET_TYPE));
+    }
+
+    uint64_t segment_position = header->first_segment;
+    uint64_t vocabulary_tokens = 0;
+    size_t first_token = 0;
+    for (uint64_t segment = 0; segment < header->number_of_segments; ++ segment)
+    {
+        const struct Corpus_File_Segment_Header* const segment_header = Check_Segment(corpus_file, header,
+                segment_position, file_name);
+        const char* const data = corpus_file->data;
+        const uint64_t* const sections = segment_header->sections;
+        const size_t data_sets_in_segment = (size_t) segment_header->number_of_data_sets;
+        const size_t tokens_in_segment = (size_t) segment_header->number_of_tokens;
+        ASSERT_FMSG(tokens_in_segment <= number_of_tokens - first_token, "The segments of the corpus file \"%s\" "
+                "contain more tokens than the header !", file_name);
+
+        // >>> Vocabulary: One copy per C-String array <<<
+        const uint64_t* const vocabulary_lengths =
+                (const uint64_t*) (data + sections [CORPUS_FILE_SECTION_VOCABULARY_LENGTHS]);
+        const char* tokens = data + sections [CORPUS_FILE_SECTION_VOCABULARY_TOKENS];
+        const uint_fast32_t* mapping_ints = (const uint_fast32_t*) (data + sections [CORPUS_FILE_SECTION_VOCABULARY_INTS]);
+        for (uint_fast32_t i = 0; i < C_STR_ARRAYS; ++ i)
+        {
+            TokenIntMapping_AppendCStringArray(token_int_mapping, i, tokens, mapping_ints,
+                    (size_t) vocabulary_lengths [i]);
+            tokens += vocabulary_lengths [i] * MAX_TOKEN_LENGTH;
+            mapping_ints += vocabulary_lengths [i];
+        }
+        vocabulary_tokens += segment_header->vocabulary_tokens;
+
+        // >>> Documents: The Document_Word_List points in the mapped file or in the converted offsets <<<
+        const CHAR_OFFSET_TYPE* char_offsets = (const CHAR_OFFSET_TYPE*) (data +
+                sections [CORPUS_FILE_SECTION_CHAR_OFFSETS]);
+        const SENTENCE_OFFSET_TYPE* sentence_offsets = (const SENTENCE_OFFSET_TYPE*) (data +
+                sections [CORPUS_FILE_SECTION_SENTENCE_OFFSETS]);
+        const WORD_OFFSET_TYPE* word_offsets = (const WORD_OFFSET_TYPE*) (data +
+                sections [CORPUS_FILE_SECTION_WORD_OFFSETS]);
+        if (new_object->converted_char_offsets != NULL)
+        {
+            Convert_Char_Offsets(new_object->converted_char_offsets + first_token,
+                    data + sections [CORPUS_FILE_SECTION_CHAR_OFFSETS], tokens_in_segment, header->char_offset_size,
+                    file_name);
+            char_offsets = new_object->converted_char_offsets + first_token;
+        }
+        if (new_object->converted_sentence_offsets != NULL)
+        {
+            Convert_Sentence_Offsets(new_object->converted_sentence_offsets + first_token,
+                    data + sections [CORPUS_FILE_SECTION_SENTENCE_OFFSETS], tokens_in_segment,
+                    header->sentence_offset_size, file_name);
+            sentence_offsets = new_object->converted_sentence_offsets + first_token;
+        }
+        if (new_object->converted_word_offsets != NULL)
+        {
+            Convert_Word_Offsets(new_object->converted_word_offsets + first_token,
+                    data + sections [CORPUS_FILE_SECTION_WORD_OFFSETS], tokens_in_segment, header->word_offset_size,
+                    file_name);
+            word_offsets = new_object->converted_word_offsets + first_token;
+        }
+        first_token += tokens_in_segment;
+
+        const size_t first_data_set = (size_t) new_object->token_ints->next_free_array;
+        if (data_sets_in_segment > 0)
+        {
+            DocumentWordList_AppendExternalData
+            (
+                    new_object->token_ints,
+                    data_sets_in_segment,
+                    (const uint_fast64_t*) (data + sections [CORPUS_FILE_SECTION_ARRAY_BEGINS]),
+                    (const uint_fast32_t*) (data + sections [CORPUS_FILE_SECTION_DATA]),
+                    char_offsets,
+                    sentence_offsets,
+                    word_offsets
+            );
+            // The surface forms have the same layout as the mapped tokens; the offsets are shared
+            if (new_object->surface_token_ints != NULL)
+            {
+                DocumentWordList_AppendExternalData
+                (
+                        new_object->surface_token_ints,
+                        data_sets_in_segment,
+                        (const uint_fast64_t*) (data + sections [CORPUS_FILE_SECTION_ARRAY_BEGINS]),
+                        (const uint_fast32_t*) (data + sections [CORPUS_FILE_SECTION_SURFACE_DATA]),
+                        char_offsets,
+                        sentence_offsets,
+                        word_offsets
+                );
+            }
+        }
+
+        // >>> Data set IDs and too long tokens <<<
+        if (new_object->allocated_dataset_ids > 0)
+        {
+            memcpy(new_object->dataset_ids + (first_data_set * DATASET_ID_LENGTH),
+                    data + sections [CORPUS_FILE_SECTION_DATASET_IDS], data_sets_in_segment * DATASET_ID_LENGTH);
+        }
+        else
+        {
+            // The IDs are never written; the pointer is only not const, because the IDs of a read file are dynamic
+            new_object->dataset_ids = (char*) (data + sections [CORPUS_FILE_SECTION_DATASET_IDS]);
+        }
+
+        const char* too_long_token = data + sections [CORPUS_FILE_SECTION_TOO_LONG_TOKENS];
+        for (uint64_t i = 0; i < segment_header->number_of_too_long_tokens; ++ i)
+        {
+            const size_t too_long_token_length = strlen(too_long_token);
+            TwoDimCStrArray_AppendNewString(new_object->list_of_too_long_token, too_long_token, too_long_token_length);
+            too_long_token += too_long_token_length + 1;
+        }
+
+        segment_position = segment_header->next_segment;
+    }
+
+    ASSERT_FMSG((uint64_t) new_object->token_ints->next_free_array == header->number_of_data_sets &&
+            vocabulary_tokens == header->tokens_in_vocabulary, "The segments of the corpus file \"%s\" do not match "
+            "with the header !", file_name);
+
+    new_object->tokens_added_to_mapping = (uint_fast32_t) header->tokens_in_vocabulary;
+    new_object->number_of_tokens        = (uint_fast64_t) header->number_of_tokens;
+    new_object->longest_data_set        = (size_t) header->longest_data_set;
+    new_object->removed_stop_words      = (uint_fast64_t) header->removed_stop_words;
+    new_object->built_in_stop_words_removed = header->stop_words_removed != 0;
+
+    return new_object;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Initialize a checksum calculation.
+ *
+ * Asserts:
+ *      checksum != NULL
+ *
+ * @param[out] checksum Checksum object
+ */
+static void
+Checksum_Init
+(
+        struct Checksum* const checksum
+)
+{
+    ASSERT_MSG(checksum != NULL, "Checksum object is NULL !");
+
+    checksum->value = CHECKSUM_OFFSET_BASIS;
+    memset(checksum->word, '\0', sizeof (checksum->word));
+    checksum->bytes_in_word = 0;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add data to a checksum calculation.
+ *
+ * Asserts:
+ *      checksum != NULL
+ *      data != NULL
+ *
+ * @param[in] checksum Checksum object
+ * @param[in] data Data
+ * @param[in] size Size of the data in bytes
+ */
+static void
+Checksum_Add
+(
+        struct Checksum* const restrict checksum,
+        const void* const restrict data,
+        const size_t size
+)
+{
+    ASSERT_MSG(checksum != NULL, "Checksum object is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+
+    const unsigned char* bytes = (const unsigned char*) data;
+    size_t bytes_left = size;
+    uint64_t value = checksum->value;
+
+    // Complete the value of the last call
+    if (checksum->bytes_in_word > 0)
+    {
+        const size_t missing_bytes = MIN(sizeof (checksum->word) - checksum->bytes_in_word, bytes_left);
+        memcpy(checksum->word + checksum->bytes_in_word, bytes, missing_bytes);
+        checksum->bytes_in_word += missing_bytes;
+        bytes += missing_bytes;
+        bytes_left -= missing_bytes;
+
+        if (checksum->bytes_in_word == sizeof (checksum->word))
+        {
+            uint64_t word = 0;
+            memcpy(&word, checksum->word, sizeof (word));
+            value = (value ^ word) * CHECKSUM_PRIME;
+            value ^= value >> 32;
+            checksum->bytes_in_word = 0;
+        }
+    }
+
+    // Whole values (memcpy, because the data is not necessarily aligned)
+    for (; bytes_left >= sizeof (uint64_t); bytes += sizeof (uint64_t), bytes_left -= sizeof (uint64_t))
+    {
+        uint64_t word = 0;
+        memcpy(&word, bytes, sizeof (word));
+        value = (value ^ word) * CHECKSUM_PRIME;
+        value ^= value >> 32;
+    }
+
+    // The rest will be used in the next call or in Checksum_Finish()
+    if (bytes_left > 0)
+    {
+        memset(checksum->word, '\0', sizeof (checksum->word));
+        memcpy(checksum->word, bytes, bytes_left);
+        checksum->bytes_in_word = bytes_left;
+    }
+
+    checksum->value = value;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Finish a checksum calculation. Not complete values will be filled with zeros.
+ *
+ * Asserts:
+ *      checksum != NULL
+ *
+ * @param[in] checksum Checksum object
+ *
+ * @return The checksum
+ */
+static uint64_t
+Checksum_Finish
+(
+        struct Checksum* const checksum
+)
+{
+    ASSERT_MSG(checksum != NULL, "Checksum object is NULL !");
+
+    if (checksum->bytes_in_word > 0)
+    {
+        const unsigned char zeros [sizeof (uint64_t)] = { 0 };
+        Checksum_Add(checksum, zeros, sizeof (uint64_t) - checksum->bytes_in_word);
+    }
+
+    return checksum->value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Calculate the checksum of a memory block.
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] data Data
+ * @param[in] size Size of the data in bytes
+ *
+ * @return The checksum
+ */
+static uint64_t
+Checksum_Of_Block
+(
+        const void* const data,
+        const size_t size
+)
+{
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+
+    struct Checksum checksum;
+    Checksum_Init(&checksum);
+    Checksum_Add(&checksum, data, size);
+
+    return Checksum_Finish(&checksum);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write data to the corpus file and add it to the checksum of the writer.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      data != NULL
+ *      The data can be written
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] data Data
+ * @param[in] size Size of the data in bytes
+ */
+static void
+Write_Bytes
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const void* const restrict data,
+        const size_t size
+)
+{
+    ASSERT_MSG(writer != NULL, "Corpus_File_Writer is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+
+    if (size == 0) { return; }
+
+    ASSERT_FMSG(fwrite(data, 1, size, writer->file) == size, "Cannot write %zu bytes in the corpus file \"%s\" !", size,
+            writer->file_name);
+    Checksum_Add(&writer->checksum, data, size);
+    writer->position += (uint64_t) size;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Begin a section of a segment. The position will be saved in the segment header.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      segment_header != NULL
+ *      section < CORPUS_FILE_NUMBER_OF_SECTIONS
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[out] segment_header Header of the segment
+ * @param[in] section Section, that begins
+ */
+static void
+Begin_Section
+(
+        struct Corpus_File_Writer* const restrict writer,
+        struct Corpus_File_Segment_Header* const restrict segment_header,
+        const enum Corpus_File_Section section
+)
+{
+    ASSERT_MSG(writer != NULL, "Corpus_File_Writer is NULL !");
+    ASSERT_MSG(segment_header != NULL, "Segment header is NULL !");
+    ASSERT_FMSG(section < CORPUS_FILE_NUMBER_OF_SECTIONS, "Invalid section: %d !", (int) section);
+
+    segment_header->sections [section] = writer->position;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief End a section of a segment. The size will be saved in the segment header and the file will be filled with
+ * zeros until the next aligned position.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      segment_header != NULL
+ *      section < CORPUS_FILE_NUMBER_OF_SECTIONS
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[out] segment_header Header of the segment
+ * @param[in] section Section, that ends
+ */
+static void
+End_Section
+(
+        struct Corpus_File_Writer* const restrict writer,
+        struct Corpus_File_Segment_Header* const restrict segment_header,
+        const enum Corpus_File_Section section
+)
+{
+    ASSERT_MSG(writer != NULL, "Corpus_File_Writer is NULL !");
+    ASSERT_MSG(segment_header != NULL, "Segment header is NULL !");
+    ASSERT_FMSG(section < CORPUS_FILE_NUMBER_OF_SECTIONS, "Invalid section: %d !", (int) section);
+
+    segment_header->section_sizes [section] = writer->position - segment_header->sections [section];
+
+    const unsigned char padding [SECTION_ALIGNMENT] = { 0 };
+    const size_t padding_size = (size_t) ((SECTION_ALIGNMENT - (writer->position % SECTION_ALIGNMENT)) %
+            SECTION_ALIGNMENT);
+    Write_Bytes(writer, padding, padding_size);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write a header at a position before the current position and return to the current position.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      header != NULL
+ *      The header can be written
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] position Position of the header
+ * @param[in] header Header
+ * @param[in] header_size Size of the header in bytes
+ */
+static void
+Write_Header_At
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const uint64_t position,
+        const void* const restrict header,
+        const size_t header_size
+)
+{
+    ASSERT_MSG(writer != NULL, "Corpus_File_Writer is NULL !");
+    ASSERT_MSG(header != NULL, "Header is NULL !");
+
+    ASSERT_FMSG(fseek(writer->file, (long int) position, SEEK_SET) == 0 &&
+            fwrite(header, 1, header_size, writer->file) == header_size &&
+            fseek(writer->file, (long int) writer->position, SEEK_SET) == 0, "Cannot write a header in the corpus file \"%s\" !",
+            writer->file_name);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a header at a position before the current position and return to the current position.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      header != NULL
+ *      The header can be read
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] position Position of the header
+ * @param[out] header Memory for the header
+ * @param[in] header_size Size of the header in bytes
+ */
+static void
+Read_Header_At
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const uint64_t position,
+        void* const restrict header,
+        const size_t header_size
+)
+{
+    ASSERT_MSG(writer != NULL, "Corpus_File_Writer is NULL !");
+    ASSERT_MSG(header != NULL, "Header is NULL !");
+
+    ASSERT_FMSG(fseek(writer->file, (long int) position, SEEK_SET) == 0 &&
+            fread(header, 1, header_size, writer->file) == header_size &&
+            fseek(writer->file, (long int) writer->position, SEEK_SET) == 0, "Cannot read a header in the corpus file "
+            "\"%s\" !", writer->file_name);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write a segment at the current position: the segment header, the new part of the vocabulary and the data of
+ * an Encoded_Corpus. The next segment in the segment header is 0.
+ *
+ * Asserts:
+ *      writer != NULL
+ *      corpus != NULL
+ *      token_int_mapping != NULL
+ *      vocabulary_begins != NULL
+ *      header != NULL
+ *      segment_header != NULL
+ *      The current position is aligned
+ *
+ * @param[in] writer Corpus_File_Writer object
+ * @param[in] corpus Encoded_Corpus object
+ * @param[in] token_int_mapping Token_Int_Mapping object, that was used for the encoding of the corpus
+ * @param[in] vocabulary_begins First token per C-String array, that belongs to the segment (The tokens before are in
+ * the previous segments)
+ * @param[in] header File header with the offset widths (The offsets of the corpus need to fit in these widths) and
+ * the encoded token array
+ * @param[out] segment_header Header of the written segment
+ *
+ * @return Position of the segment header
+ */
+static uint64_t
+Write_Segment
+(
+        struct Corpus_File_Writer* const restrict writer,
+        const struct Encoded_Corpus* const restrict corpus,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const uint_fast32_t* const restrict vocabulary_begins,
+        const struct Corpus_File_Header* const restrict header,
+        struct Corpus_File_Segment_Header* const restrict segment_header
+)
+{
+    ASSERT_MSG(writer != NULL, "Corpus_File_Writer is NULL !");
+    ASSERT_MSG(corpus != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
+    ASSERT_MSG(vocabulary_begins != NULL, "Vocabulary begins are NULL !");
+    ASSERT_MSG(header != NULL, "Header is NULL !");
+    ASSERT_MSG(segment_header != NULL, "Segment header is NULL !");
+    ASSERT_FMSG(writer->position % SECTION_ALIGNMENT == 0, "The segment position %" PRIu64 " is not aligned !",
+            writer->position);
+
+    // Placeholder; the segment header will be written again, when all values are known
+    memset(segment_header, '\0', sizeof (*segment_header));
+    const uint64_t segment_position = writer->position;
+    Write_Bytes(writer, segment_header, sizeof (*segment_header));
+
+    // The checksum of the segment contains only the sections
+    Checksum_Init(&writer->checksum);
+
+    const struct Document_Word_List* const token_ints = corpus->token_ints;
+    const size_t number_of_data_sets = (size_t) token_ints->next_free_array;
+
+    // >>> Vocabulary <<<
+    uint64_t vocabulary_lengths [C_STR_ARRAYS];
+    uint64_t vocabulary_tokens = 0;
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        ASSERT_FMSG(vocabulary_begins [i] <= token_int_mapping->c_str_array_lengths [i], "Invalid vocabulary begin "
+                "in C-String array %zu !", i);
+        vocabulary_lengths [i] = (uint64_t) (token_int_mapping->c_str_array_lengths [i] - vocabulary_begins [i]);
+        vocabulary_tokens += vocabulary_lengths [i];
+    }
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_VOCABULARY_LENGTHS);
+    Write_Bytes(writer, vocabulary_lengths, sizeof (vocabulary_lengths));
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_VOCABULARY_LENGTHS);
+
+    // The tokens and the integers will be written in the layout of the C-String arrays
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_VOCABULARY_TOKENS);
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        Write_Bytes(writer, token_int_mapping->c_str_arrays [i] + (vocabulary_begins [i] * MAX_TOKEN_LENGTH),
+                (size_t) vocabulary_lengths [i] * MAX_TOKEN_LENGTH);
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_VOCABULARY_TOKENS);
+
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_VOCABULARY_INTS);
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        Write_Bytes(writer, token_int_mapping->int_mapping [i] + vocabulary_begins [i], (size_t) vocabulary_lengths [i] *
+                sizeof (uint_fast32_t));
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_VOCABULARY_INTS);
+
+    // >>> Documents <<<
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_ARRAY_BEGINS);
+    uint_fast64_t array_begin = 0;
+    for (size_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        Write_Bytes(writer, &array_begin, sizeof (array_begin));
+        array_begin += (uint_fast64_t) token_ints->arrays_lengths [i];
+    }
+    // The end of the last data set
+    Write_Bytes(writer, &array_begin, sizeof (array_begin));
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_ARRAY_BEGINS);
+
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_DATA);
+    for (size_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        Write_Bytes(writer, token_ints->data_struct.data [i], token_ints->arrays_lengths [i] * sizeof (uint_fast32_t));
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_DATA);
+
+    // The output of a file with lemmas shows the surface forms
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_SURFACE_DATA);
+    if (header->token_array == JSON_TOKEN_ARRAY_LEMMA)
+    {
+        ASSERT_MSG(corpus->surface_token_ints != NULL, "The surface forms of the lemmas are missing !");
+        for (size_t i = 0; i < number_of_data_sets; ++ i)
+        {
+            Write_Bytes(writer, corpus->surface_token_ints->data_struct.data [i],
+                    corpus->surface_token_ints->arrays_lengths [i] * sizeof (uint_fast32_t));
+        }
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_SURFACE_DATA);
+
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_CHAR_OFFSETS);
+    for (size_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        Write_Char_Offsets(writer, token_ints->data_struct.char_offsets [i], token_ints->arrays_lengths [i],
+                header->char_offset_size);
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_CHAR_OFFSETS);
+
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_SENTENCE_OFFSETS);
+    for (size_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        Write_Sentence_Offsets(writer, token_ints->data_struct.sentence_offsets [i], token_ints->arrays_lengths [i],
+                header->sentence_offset_size);
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_SENTENCE_OFFSETS);
+
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_WORD_OFFSETS);
+    for (size_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        Write_Word_Offsets(writer, token_ints->data_struct.word_offsets [i], token_ints->arrays_lengths [i],
+                header->word_offset_size);
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_WORD_OFFSETS);
+
+    // >>> Data set IDs and too long tokens <<<
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_DATASET_IDS);
+    if (number_of_data_sets > 0)
+    {
+        Write_Bytes(writer, corpus->dataset_ids, number_of_data_sets * DATASET_ID_LENGTH);
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_DATASET_IDS);
+
+    Begin_Section(writer, segment_header, CORPUS_FILE_SECTION_TOO_LONG_TOKENS);
+    const struct Two_Dim_C_String_Array* const too_long_tokens = corpus->list_of_too_long_token;
+    const uint_fast32_t number_of_too_long_tokens = (too_long_tokens != NULL) ? too_long_tokens->next_free_c_str : 0;
+    for (uint_fast32_t i = 0; i < number_of_too_long_tokens; ++ i)
+    {
+        Write_Bytes(writer, too_long_tokens->data [i], strlen(too_long_tokens->data [i]) + 1);
+    }
+    End_Section(writer, segment_header, CORPUS_FILE_SECTION_TOO_LONG_TOKENS);
+
+    // >>> Segment header <<<
+    segment_header->next_segment                = 0;
+    segment_header->number_of_data_sets         = (uint64_t) number_of_data_sets;
+    segment_header->number_of_tokens            = (uint64_t) array_begin;
+    segment_header->longest_data_set            = (uint64_t) corpus->longest_data_set;
+    segment_header->vocabulary_tokens           = vocabulary_tokens;
+    segment_header->number_of_too_long_tokens   = (uint64_t) number_of_too_long_tokens;
+    segment_header->segment_end                 = writer->position;
+    segment_header->data_checksum               = Checksum_Finish(&writer->checksum);
+    segment_header->header_checksum             = Checksum_Of_Block(segment_header,
+            offsetof(struct Corpus_File_Segment_Header, header_checksum));
+
+    Write_Header_At(writer, segment_position, segment_header, sizeof (*segment_header));
+
+    return segment_position;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the header of a corpus file.
+ *
+ * Asserts:
+ *      header != NULL
+ *      file_name != NULL
+ *      Magic bytes, version, byte order, type sizes, offset widths, token array, checksum and file size are valid
+ *
+ * @param[in] header Header of the corpus file
+ * @param[in] file_size Size of the mapped file
+ * @param[in] file_name Name of the corpus file (for error messages)
+ */
+static void
+Check_Header
+(
+        const struct Corpus_File_Header* const restrict header,
+        const uint_fast64_t file_size,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(header != NULL, "Header is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    ASSERT_FMSG(memcmp(header->magic, CORPUS_FILE_MAGIC, sizeof (header->magic)) == 0, "The file \"%s\" is not a "
+            "compiled corpus file !", file_name);
+    ASSERT_FMSG(header->version == CORPUS_FILE_VERSION, "Unsupported version (%" PRIu64 ") of the corpus file \"%s\" !"
+            " Supported version: %d", header->version, file_name, CORPUS_FILE_VERSION);
+    ASSERT_FMSG(header->byte_order_mark == BYTE_ORDER_MARK, "The corpus file \"%s\" was created with an other byte "
+            "order ! Please compile the corpus again.", file_name);
+    ASSERT_FMSG(header->header_checksum == Checksum_Of_Block(header, offsetof(struct Corpus_File_Header,
+            header_checksum)), "The header of the corpus file \"%s\" is damaged (wrong checksum) !", file_name);
+    ASSERT_FMSG(header->mapping_int_size == sizeof (uint_fast32_t) &&
+            header->array_begin_size == sizeof (uint_fast64_t) &&
+            IS_VALID_OFFSET_SIZE(header->char_offset_size) &&
+            IS_VALID_OFFSET_SIZE(header->sentence_offset_size) &&
+            IS_VALID_OFFSET_SIZE(header->word_offset_size) &&
+            header->dataset_id_length == DATASET_ID_LENGTH &&
+            header->max_token_length == MAX_TOKEN_LENGTH &&
+            header->c_str_arrays == C_STR_ARRAYS &&
+            (header->token_array == JSON_TOKEN_ARRAY_TOKENS || header->token_array == JSON_TOKEN_ARRAY_LEMMA) &&
+            header->stop_words_removed <= 1,
+            "The corpus file \"%s\" was created with other type sizes ! Please "
+            "compile the corpus again.", file_name);
+    // Data after the end in the header is the rest of an interrupted append (See CorpusFile_Append())
+    ASSERT_FMSG(header->file_size >= sizeof (struct Corpus_File_Header) && header->file_size <= (uint64_t) file_size,
+            "The corpus file \"%s\" is incomplete ! Expected size: %" PRIu64 " byte; Got: %" PRIuFAST64 " byte",
+            file_name, header->file_size, file_size);
+    ASSERT_FMSG(header->number_of_segments > 0, "The corpus file \"%s\" contains no segment !", file_name);
+    ASSERT_FMSG(header->tokens_in_vocabulary <= UINT_FAST32_MAX, "The vocabulary of the corpus file \"%s\" is too "
+            "large !", file_name);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check a segment of a corpus file and return its header.
+ *
+ * Asserts:
+ *      corpus_file != NULL
+ *      header != NULL
+ *      file_name != NULL
+ *      The segment header is in the file and aligned
+ *      Checksums, section positions and section sizes are valid
+ *
+ * @param[in] corpus_file Mapped corpus file
+ * @param[in] header Checked header of the corpus file (file size and offset widths)
+ * @param[in] position Position of the segment header
+ * @param[in] file_name Name of the corpus file (for error messages)
+ *
+ * @return Header of the segment (in the mapped file)
+ */
+static const struct Corpus_File_Segment_Header*
+Check_Segment
+(
+        const struct Mapped_File* const restrict corpus_file,
+        const struct Corpus_File_Header* const restrict header,
+        const uint64_t position,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(corpus_file != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(header != NULL, "Header is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    const uint64_t file_size = header->file_size;
+    ASSERT_FMSG(position >= sizeof (struct Corpus_File_Header) && position % SECTION_ALIGNMENT == 0 &&
+            file_size >= sizeof (struct Corpus_File_Segment_Header) &&
+            position <= file_size - sizeof (struct Corpus_File_Segment_Header), "Invalid segment position (%" PRIu64
+            ") in the corpus file \"%s\" !", position, file_name);
+
+    const struct Corpus_File_Segment_Header* const segment_header =
+            (const struct Corpus_File_Segment_Header*) (corpus_file->data + position);
+    ASSERT_FMSG(segment_header->header_checksum == Checksum_Of_Block(segment_header,
+            offsetof(struct Corpus_File_Segment_Header, header_checksum)), "The segment header at %" PRIu64 " in the "
+            "corpus file \"%s\" is damaged (wrong checksum) !", position, file_name);
+
+    const uint64_t sections_begin = position + sizeof (struct Corpus_File_Segment_Header);
+    ASSERT_FMSG(segment_header->segment_end >= sections_begin && segment_header->segment_end <= file_size,
+            "Invalid end of the segment at %" PRIu64 " in the corpus file \"%s\" !", position, file_name);
+
+    // The expected size of every section
+    const uint64_t data_sets = segment_header->number_of_data_sets;
+    const uint64_t tokens = segment_header->number_of_tokens;
+    const uint64_t vocabulary = segment_header->vocabulary_tokens;
+    const uint64_t expected_sizes [CORPUS_FILE_NUMBER_OF_SECTIONS] =
+    {
+            [CORPUS_FILE_SECTION_VOCABULARY_LENGTHS]    = C_STR_ARRAYS * sizeof (uint64_t),
+            [CORPUS_FILE_SECTION_VOCABULARY_TOKENS]     = vocabulary * MAX_TOKEN_LENGTH,
+            [CORPUS_FILE_SECTION_VOCABULARY_INTS]       = vocabulary * sizeof (uint_fast32_t),
+            [CORPUS_FILE_SECTION_ARRAY_BEGINS]          = (data_sets + 1) * sizeof (uint_fast64_t),
+            [CORPUS_FILE_SECTION_DATA]                  = tokens * sizeof (uint_fast32_t),
+            [CORPUS_FILE_SECTION_SURFACE_DATA]          = (header->token_array == JSON_TOKEN_ARRAY_LEMMA) ?
+                    tokens * sizeof (uint_fast32_t) : 0,
+            [CORPUS_FILE_SECTION_CHAR_OFFSETS]          = tokens * header->char_offset_size,
+            [CORPUS_FILE_SECTION_SENTENCE_OFFSETS]      = tokens * header->sentence_offset_size,
+            [CORPUS_FILE_SECTION_WORD_OFFSETS]          = tokens * header->word_offset_size,
+            [CORPUS_FILE_SECTION_DATASET_IDS]           = data_sets * DATASET_ID_LENGTH,
+            // Variable size
+            [CORPUS_FILE_SECTION_TOO_LONG_TOKENS]       = segment_header->section_sizes [CORPUS_FILE_SECTION_TOO_LONG_TOKENS]
+    };
+    for (size_t i = 0; i < CORPUS_FILE_NUMBER_OF_SECTIONS; ++ i)
+    {
+        ASSERT_FMSG(segment_header->sections [i] >= sections_begin &&
+                segment_header->sections [i] % SECTION_ALIGNMENT == 0 &&
+                segment_header->section_sizes [i] == expected_sizes [i] &&
+                segment_header->section_sizes [i] <= segment_header->segment_end - segment_header->sections [i],
+                "Invalid section %zu in the segment at %" PRIu64 " in the corpus file \"%s\" !", i, position,
+                file_name);
+    }
+
+    // The whole data will be read once; the following intersections need the data anyway
+    ASSERT_FMSG(segment_header->data_checksum == Checksum_Of_Block(corpus_file->data + sections_begin,
+            (size_t) (segment_header->segment_end - sections_begin)), "The segment at %" PRIu64 " in the corpus file "
+            "\"%s\" is damaged (wrong checksum) !", position, file_name);
+
+    // Values, that will be used as array indices
+    const uint64_t* const vocabulary_lengths =
+            (const uint64_t*) (corpus_file->data + segment_header->sections [CORPUS_FILE_SECTION_VOCABULARY_LENGTHS]);
+    uint64_t sum_vocabulary_lengths = 0;
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        sum_vocabulary_lengths += vocabulary_lengths [i];
+    }
+    const uint_fast64_t* const array_begins =
+            (const uint_fast64_t*) (corpus_file->data + segment_header->sections [CORPUS_FILE_SECTION_ARRAY_BEGINS]);
+    ASSERT_FMSG(sum_vocabulary_lengths == vocabulary && array_begins [0] == 0 && array_begins [data_sets] == tokens,
+            "The segment at %" PRIu64 " in the corpus file \"%s\" is inconsistent !", position, file_name);
+
+    return segment_header;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Narrowest width of offsets in a corpus file, that fits the largest value.
+ *
+ * Not narrower than min_size and not wider than the offset type of the program (type_size).
+ */
+#ifndef OFFSET_SIZE_FOR
+#define OFFSET_SIZE_FOR(max_value, min_size, type_size)                                                                 \
+    MIN(MAX((uint64_t) (((max_value) > UINT16_MAX) ? sizeof (uint32_t) : ((max_value) > UINT8_MAX) ?                    \
+            sizeof (uint16_t) : sizeof (uint8_t)), (uint64_t) (min_size)), (uint64_t) (type_size))
+#else
+#error "The macro \"OFFSET_SIZE_FOR\" is already defined !"
+#endif /* OFFSET_SIZE_FOR */
+
+/**
+ * @brief Determine the widths of the char, sentence and word offsets of an Encoded_Corpus in a corpus file.
+ *
+ * Asserts:
+ *      corpus != NULL
+ *      header != NULL
+ *
+ * @param[in] corpus Encoded_Corpus object
+ * @param[out] header File header; only the offset widths will be set
+ */
+static void
+Determine_Offset_Sizes
+(
+        const struct Encoded_Corpus* const restrict corpus,
+        struct Corpus_File_Header* const restrict header
+)
+{
+    ASSERT_MSG(corpus != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_MSG(header != NULL, "Header is NULL !");
+
+    const struct Document_Word_List* const token_ints = corpus->token_ints;
+    uint_fast64_t max_char_offset = 0;
+    uint_fast64_t max_sentence_offset = 0;
+    uint_fast64_t max_word_offset = 0;
+
+    for (uint_fast32_t i = 0; i < token_ints->next_free_array; ++ i)
+    {
+        const CHAR_OFFSET_TYPE* const char_offsets = token_ints->data_struct.char_offsets [i];
+        const SENTENCE_OFFSET_TYPE* const sentence_offsets = token_ints->data_struct.sentence_offsets [i];
+        const WORD_OFFSET_TYPE* const word_offsets = token_ints->data_struct.word_offsets [i];
+
+        for (size_t i2 = 0; i2 < token_ints->arrays_lengths [i]; ++ i2)
+        {
+            max_char_offset     = MAX(max_char_offset, (uint_fast64_t) char_offsets [i2]);
+            max_sentence_offset = MAX(max_sentence_offset, (uint_fast64_t) sentence_offsets [i2]);
+            max_word_offset     = MAX(max_word_offset, (uint_fast64_t) word_offsets [i2]);
+        }
+    }
+
+    header->char_offset_size        = OFFSET_SIZE_FOR(max_char_offset, MIN_CHAR_OFFSET_SIZE, sizeof (CHAR_OFFSET_TYPE));
+    header->sentence_offset_size    = OFFSET_SIZE_FOR(max_sentence_offset, MIN_SENTENCE_OFFSET_SIZE,
+            sizeof (SENTENCE_OFFSET_TYPE));
+    header->word_offset_size        = OFFSET_SIZE_FOR(max_word_offset, MIN_WORD_OFFSET_SIZE, sizeof (WORD_OFFSET_TYPE));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef BYTE_ORDER_MARK
+#undef BYTE_ORDER_MARK
+#endif /* BYTE_ORDER_MARK */
+
+#ifdef SECTION_ALIGNMENT
+#undef SECTION_ALIGNMENT
+#endif /* SECTION_ALIGNMENT */
+
+#ifdef CHECKSUM_OFFSET_BASIS
+#undef CHECKSUM_OFFSET_BASIS
+#endif /* CHECKSUM_OFFSET_BASIS */
+
+#ifdef CHECKSUM_PRIME
+#undef CHECKSUM_PRIME
+#endif /* CHECKSUM_PRIME */
+
+#ifdef MIN_CHAR_OFFSET_SIZE
+#undef MIN_CHAR_OFFSET_SIZE
+#endif /* MIN_CHAR_OFFSET_SIZE */
+
+#ifdef MIN_SENTENCE_OFFSET_SIZE
+#undef MIN_SENTENCE_OFFSET_SIZE
+#endif /* MIN_SENTENCE_OFFSET_SIZE */
+
+#ifdef MIN_WORD_OFFSET_SIZE
+#undef MIN_WORD_OFFSET_SIZE
+#endif /* MIN_WORD_OFFSET_SIZE */
+
+#ifdef IS_VALID_OFFSET_SIZE
+#undef IS_VALID_OFFSET_SIZE
+#endif /* IS_VALID_OFFSET_SIZE */
+
+#ifdef OFFSET_BUFFER_LENGTH
+#undef OFFSET_BUFFER_LENGTH
+#endif /* OFFSET_BUFFER_LENGTH */
+
+#ifdef CONVERT_OFFSETS
+#undef CONVERT_OFFSETS
+#endif /* CONVERT_OFFSETS */
+
+#ifdef DEFINE_OFFSET_FUNCTIONS
+#undef DEFINE_OFFSET_FUNCTIONS
+#endif /* DEFINE_OFFSET_FUNCTIONS */
+
+#ifdef OFFSET_SIZE_FOR
+#undef OFFSET_SIZE_FOR
+#endif /* OFFSET_SIZE_FOR */
@@ -0,0 +1,356 @@
+/**
+ * @file Corpus_File.h
+ *
+ * @brief A compiled corpus file: the encoded tokens of an input file and the vocabulary in a flat binary layout.
+ *
+ * Reading, tokenizing and mapping a large input file takes much longer than the intersection with a small query file.
+ * If the same file is used again and again as first input file, it can be compiled once (--compile_corpus). A
+ * compiled corpus file will be mapped read only; the mapped tokens, the offsets and the data set IDs will be used
+ * directly from the mapped file. Only the vocabulary (the Token_Int_Mapping) will be copied in dynamic memory, because
+ * the tokens of the query file extend it.
+ *
+ * File layout (all values in the byte order and with the type sizes of the program, that compiled the file; only the
+ * offsets have an own width):
+ *
+ * - Corpus_File_Header: Magic bytes, version, type sizes, totals and the position of the first segment
+ * - One or more segments. Every segment starts with a Corpus_File_Segment_Header and contains the sections:
+ *      -- Vocabulary: number of new tokens per C-String array, the tokens (MAX_TOKEN_LENGTH chars per token) and their
+ *         mapping integers
+ *      -- Documents: begin of every data set, the mapped tokens, the mapped surface forms (only with lemmas) and the
+ *         char, sentence and word offsets (flat arrays)
+ *      -- The data set IDs (DATASET_ID_LENGTH chars per ID) and the too long tokens (null terminated strings)
+ *
+ * Every section is aligned to 8 bytes. Header and segments have a checksum, that will be checked before the data
+ * will be used. A file, that was created with other type sizes, will be rejected (It needs to be compiled again).
+ *
+ * The char, sentence and word offsets will be written with the narrowest width (1, 2 or 4 byte), that fits the
+ * largest offset of the corpus, but not narrower than the default offset types (See CHAR_OFFSET_BITS in Defines.h).
+ * If the width in the file is the size of the offset type of the program, the offsets will be used directly from the
+ * mapped file; otherwise they will be converted while loading. So a corpus of short documents keeps the compact layout,
+ * even if it was compiled by a program with wider offset types.
+ *
+ * The header contains also the JSON array, that was encoded (tokens or lemma; See --match_on). The mapping integers of
+ * a file with lemmas are not comparable with the mapping integers of surface tokens. So every loading, append and
+ * compaction needs the same setting; otherwise the file will be rejected.
+ *
+ * The built-in stop words can be removed while the compilation (See Is_Word_In_Stop_Word_List()); the header saves,
+ * whether they were removed. Such a file can be used directly for an intersection with the stop word removal.
+ * Otherwise the stop words will be removed after the loading and the data will be copied
+ * (See EncodedCorpus_CreateObject()).
+ * An append removes the stop words of the new input file with the setting in the header.
+ *
+ * New input files can be appended to a corpus file (--append_corpus). Every append adds one segment with the new
+ * tokens of the vocabulary and the new data sets; the existing segments will not be changed. A file with many
+ * segments will be compacted to one segment (automatically after an append or with --compact_corpus). The loading
+ * of a file with several segments creates the same Encoded_Corpus as the loading of a compacted file.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef CORPUS_FILE_H
+#define CORPUS_FILE_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+#include "Encoded_Corpus.h"
+#include "File_Reader.h"
+#include "Token_Int_Mapping.h"
+#include "Error_Handling/_Generics.h"
+
+
+
+/**
+ * @brief Magic bytes at the begin of a compiled corpus file.
+ */
+#ifndef CORPUS_FILE_MAGIC
+#define CORPUS_FILE_MAGIC "BTMCORP"
+#else
+#error "The macro \"CORPUS_FILE_MAGIC\" is already defined !"
+#endif /* CORPUS_FILE_MAGIC */
+
+/**
+ * @brief Version of the compiled corpus file format.
+ */
+#ifndef CORPUS_FILE_VERSION
+#define CORPUS_FILE_VERSION 2
+#else
+#error "The macro \"CORPUS_FILE_VERSION\" is already defined !"
+#endif /* CORPUS_FILE_VERSION */
+
+/**
+ * @brief Max. number of segments after an append. A file with more segments will be compacted.
+ */
+#ifndef CORPUS_FILE_MAX_SEGMENTS
+#define CORPUS_FILE_MAX_SEGMENTS 16
+#else
+#error "The macro \"CORPUS_FILE_MAX_SEGMENTS\" is already defined !"
+#endif /* CORPUS_FILE_MAX_SEGMENTS */
+
+/**
+ * @brief Suffix of the temporary file, that will be written while a corpus file will be compacted.
+ */
+#ifndef CORPUS_FILE_COMPACT_SUFFIX
+#define CORPUS_FILE_COMPACT_SUFFIX ".compact"
+#else
+#error "The macro \"CORPUS_FILE_COMPACT_SUFFIX\" is already defined !"
+#endif /* CORPUS_FILE_COMPACT_SUFFIX */
+
+/**
+ * @brief Check, whether the macro values are valid.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+// Magic bytes and the terminator fill exactly one 8 byte value
+_Static_assert(sizeof (CORPUS_FILE_MAGIC) == 8, "The macro \"CORPUS_FILE_MAGIC\" needs exactly 7 chars !");
+_Static_assert(CORPUS_FILE_VERSION > 0, "The macro \"CORPUS_FILE_VERSION\" needs to be at least 1 !");
+_Static_assert(CORPUS_FILE_MAX_SEGMENTS > 0, "The macro \"CORPUS_FILE_MAX_SEGMENTS\" needs to be at least 1 !");
+
+IS_CONST_STR(CORPUS_FILE_MAGIC)
+IS_TYPE(CORPUS_FILE_VERSION, int)
+IS_TYPE(CORPUS_FILE_MAX_SEGMENTS, int)
+IS_CONST_STR(CORPUS_FILE_COMPACT_SUFFIX)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//=====================================================================================================================
+
+/**
+ * @brief Sections of a segment. The positions of the sections are saved in the segment header.
+ */
+enum Corpus_File_Section
+{
+    CORPUS_FILE_SECTION_VOCABULARY_LENGTHS = 0,     ///< Number of new tokens per C-String array (uint64_t)
+    CORPUS_FILE_SECTION_VOCABULARY_TOKENS,          ///< New tokens (MAX_TOKEN_LENGTH chars per token)
+    CORPUS_FILE_SECTION_VOCABULARY_INTS,            ///< Mapping integers of the new tokens (uint_fast32_t)
+    CORPUS_FILE_SECTION_ARRAY_BEGINS,               ///< Begin of every data set in the flat arrays (uint_fast64_t)
+    CORPUS_FILE_SECTION_DATA,                       ///< Mapped tokens (uint_fast32_t)
+    CORPUS_FILE_SECTION_SURFACE_DATA,               ///< Mapped surface forms (uint_fast32_t; empty without lemmas)
+    CORPUS_FILE_SECTION_CHAR_OFFSETS,               ///< Char offsets (CHAR_OFFSET_TYPE)
+    CORPUS_FILE_SECTION_SENTENCE_OFFSETS,           ///< Sentence offsets (SENTENCE_OFFSET_TYPE)
+    CORPUS_FILE_SECTION_WORD_OFFSETS,               ///< Word offsets (WORD_OFFSET_TYPE)
+    CORPUS_FILE_SECTION_DATASET_IDS,                ///< Data set IDs (DATASET_ID_LENGTH chars per ID)
+    CORPUS_FILE_SECTION_TOO_LONG_TOKENS,            ///< Too long tokens (null terminated strings)
+
+    CORPUS_FILE_NUMBER_OF_SECTIONS                  ///< Number of sections (No section !)
+};
+
+/**
+ * @brief Header at the begin of a compiled corpus file.
+ */
+struct Corpus_File_Header
+{
+    char magic [8];                         ///< CORPUS_FILE_MAGIC (with terminator)
+    uint64_t version;                       ///< CORPUS_FILE_VERSION
+    uint64_t byte_order_mark;               ///< Known value to detect files with an other byte order
+
+    uint64_t mapping_int_size;              ///< sizeof (uint_fast32_t)
+    uint64_t array_begin_size;              ///< sizeof (uint_fast64_t)
+    uint64_t char_offset_size;              ///< Width of the char offsets in the file (1, 2 or 4 byte)
+    uint64_t sentence_offset_size;          ///< Width of the sentence offsets in the file (1, 2 or 4 byte)
+    uint64_t word_offset_size;              ///< Width of the word offsets in the file (1, 2 or 4 byte)
+    uint64_t dataset_id_length;             ///< DATASET_ID_LENGTH
+    uint64_t max_token_length;              ///< MAX_TOKEN_LENGTH
+    uint64_t c_str_arrays;                  ///< C_STR_ARRAYS
+    uint64_t token_array;                   ///< JSON array, that was encoded (enum JSON_Token_Array)
+    uint64_t stop_words_removed;            ///< Were the built-in stop words removed while the encoding ? (0 / 1)
+    uint64_t removed_stop_words;            ///< Number of the removed stop word tokens
+
+    uint64_t number_of_segments;            ///< Number of segments
+    uint64_t first_segment;                 ///< Position of the first segment header
+    uint64_t last_segment;                  ///< Position of the last segment header
+    uint64_t file_size;                     ///< Size of the whole file in bytes
+
+    uint64_t number_of_data_sets;           ///< Data sets in all segments
+    uint64_t number_of_tokens;              ///< Encoded tokens in all segments
+    uint64_t longest_data_set;              ///< Number of tokens in the longest data set
+    uint64_t tokens_in_vocabulary;          ///< Tokens in the vocabulary of all segments
+
+    uint64_t header_checksum;               ///< Checksum of all fields before this one
+};
+
+/**
+ * @brief Header at the begin of a segment.
+ */
+struct Corpus_File_Segment_Header
+{
+    uint64_t next_segment;                  ///< Position of the next segment header (0: last segment)
+    uint64_t number_of_data_sets;           ///< Data sets in this segment
+    uint64_t number_of_tokens;              ///< Encoded tokens in this segment
+    uint64_t longest_data_set;              ///< Number of tokens in the longest data set of this segment
+    uint64_t vocabulary_tokens;             ///< Tokens, that this segment adds to the vocabulary
+    uint64_t number_of_too_long_tokens;     ///< Number of too long tokens in this segment
+
+    uint64_t sections [CORPUS_FILE_NUMBER_OF_SECTIONS];     ///< Position of every section in the file
+    uint64_t section_sizes [CORPUS_FILE_NUMBER_OF_SECTIONS];///< Size of every section (without the alignment)
+    uint64_t segment_end;                   ///< Position after the last section
+
+    uint64_t data_checksum;                 ///< Checksum of all sections
+    uint64_t header_checksum;               ///< Checksum of all fields before this one
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Check, whether a file is a compiled corpus file. (Only the magic bytes will be compared)
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the file
+ *
+ * @return true, if the file starts with the magic bytes of a compiled corpus file, otherwise false
+ */
+extern _Bool
+CorpusFile_IsCorpusFile
+(
+        const char* const file_name
+);
+
+/**
+ * @brief Write an Encoded_Corpus and the vocabulary in a compiled corpus file with one segment.
+ *
+ * The vocabulary needs to be the mapping, that was used for the encoding of the corpus (and nothing else). So the
+ * mapping integers in the corpus file are valid after the loading.
+ *
+ * Asserts:
+ *      corpus != NULL
+ *      token_int_mapping != NULL
+ *      file_name != NULL
+ *      The file can be written
+ *
+ * @param[in] corpus Encoded_Corpus object
+ * @param[in] token_int_mapping Token_Int_Mapping object, that was used for the encoding of the corpus
+ * @param[in] file_name Name of the corpus file (An existing file will be overwritten)
+ * @param[in] token_array JSON array, that was encoded (will be saved in the header; like the stop word removal of the
+ * corpus)
+ */
+extern void
+CorpusFile_Write
+(
+        const struct Encoded_Corpus* const restrict corpus,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const char* const restrict file_name,
+        const enum JSON_Token_Array token_array
+);
+
+/**
+ * @brief Read and encode an input file and write the result as compiled corpus file.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      corpus_file != NULL
+ *      number_of_threads > 0
+ *      The input file is not a compiled corpus file
+ *
+ * @param[in] input_file Name of the input file (JSON, CSV, ...)
+ * @param[in] corpus_file Name of the corpus file (An existing file will be overwritten)
+ * @param[in] number_of_threads Number of threads, that parse the input file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens (The queries need the same setting)
+ * @param[in] remove_stop_words Remove the built-in stop words ? (will be saved in the header)
+ */
+extern void
+CorpusFile_Compile
+(
+        const char* const restrict input_file,
+        const char* const restrict corpus_file,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const _Bool remove_stop_words
+);
+
+/**
+ * @brief Read and encode an input file and append the result as new segment to an existing compiled corpus file.
+ *
+ * The input file will be encoded with the vocabulary of the corpus file. The new segment contains only the tokens,
+ * that extend the vocabulary, and the new data sets. If the file has more than CORPUS_FILE_MAX_SEGMENTS segments after
+ * the append, it will be compacted.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      corpus_file != NULL
+ *      number_of_threads > 0
+ *      The input file is not a compiled corpus file
+ *      The corpus file is a valid compiled corpus file and can be written
+ *      The corpus file was compiled with the same token_array
+ *
+ * @param[in] input_file Name of the input file (JSON, CSV, ...)
+ * @param[in] corpus_file Name of the existing corpus file
+ * @param[in] number_of_threads Number of threads, that parse the input file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens (The same as in the corpus file)
+ */
+extern void
+CorpusFile_Append
+(
+        const char* const restrict input_file,
+        const char* const restrict corpus_file,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array
+);
+
+/**
+ * @brief Rewrite a compiled corpus file with only one segment.
+ *
+ * The new file will be written with a temporary name and replaces the old file after it is complete. The content
+ * (vocabulary, mapping integers, data sets) does not change.
+ *
+ * Asserts:
+ *      corpus_file != NULL
+ *      The corpus file is a valid compiled corpus file
+ *      The corpus file was compiled with the same token_array
+ *      The temporary file can be written and renamed
+ *
+ * @param[in] corpus_file Name of the corpus file
+ * @param[in] token_array JSON array with the tokens (The same as in the corpus file)
+ */
+extern void
+CorpusFile_Compact
+(
+        const char* const corpus_file,
+        const enum JSON_Token_Array token_array
+);
+
+/**
+ * @brief Map a compiled corpus file and create an Encoded_Corpus object with the data in the file.
+ *
+ * The mapped tokens and the offsets will not be copied; the Document_Word_List points in the mapped file. The data
+ * set IDs will be copied only, if the file has more than one segment. The vocabulary will be copied in the empty
+ * mapping without a search. The mapped file will be closed with EncodedCorpus_DeleteObject().
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      token_int_mapping != NULL
+ *      The mapping is empty (A compiled corpus can only be the first input file)
+ *      The file is a valid compiled corpus file (magic bytes, version, type sizes, checksums, positions)
+ *      The file was compiled with the same token_array
+ *
+ * @param[in] file_name Name of the corpus file
+ * @param[in] token_int_mapping Empty Token_Int_Mapping object (The vocabulary of the file will be added)
+ * @param[in] token_array JSON array, that the caller expects in the file (tokens or lemma)
+ *
+ * @return Address to the new dynamic Encoded_Corpus object
+ */
+extern struct Encoded_Corpus*
+CorpusFile_Load
+(
+        const char* const restrict file_name,
+        struct Token_Int_Mapping* const restrict token_int_mapping,
+        const enum JSON_Token_Array token_array
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CORPUS_FILE_H */
@@ -22,12 +22,58 @@ extern "C"
 
 
 
+/**
+ * @brief Format specifier and max value of an offset type with the given width in bit. Only necessary without C11,
+ * because with C11 the values will be determined with a _Generic expression.
+ *
+ * E.g.: OFFSET_BITS_MAX(16) -> OFFSET_BITS_MAX_16 -> USHRT_MAX
+ */
+#ifndef OFFSET_BITS_FSTR_SPECIFIER
+#define OFFSET_BITS_FSTR_SPECIFIER(bits) OFFSET_BITS_FSTR_SPECIFIER_EXPAND(bits)
+#define OFFSET_BITS_FSTR_SPECIFIER_EXPAND(bits) OFFSET_BITS_FSTR_SPECIFIER_ ## bits
+#define OFFSET_BITS_FSTR_SPECIFIER_8 "%hhu"
+#define OFFSET_BITS_FSTR_SPECIFIER_16 "%hu"
+#define OFFSET_BITS_FSTR_SPECIFIER_32 "%u"
+#else
+#error "The macro \"OFFSET_BITS_FSTR_SPECIFIER\" is already defined !"
+#endif /* OFFSET_BITS_FSTR_SPECIFIER */
+
+#ifndef OFFSET_BITS_MAX
+#define OFFSET_BITS_MAX(bits) OFFSET_BITS_MAX_EXPAND(bits)
+#define OFFSET_BITS_MAX_EXPAND(bits) OFFSET_BITS_MAX_ ## bits
+#define OFFSET_BITS_MAX_8 UCHAR_MAX
+#define OFFSET_BITS_MAX_16 USHRT_MAX
+#define OFFSET_BITS_MAX_32 UINT_MAX
+#else
+#error "The macro \"OFFSET_BITS_MAX\" is already defined !"
+#endif /* OFFSET_BITS_MAX */
+
+
+
+/**
+ * @brief Width of the char offset type in bit: 8, 16 or 32.
+ *
+ * Build time setting; see the Makefile variable CHAR_OFFSET_BITS.
+ */
+#ifndef CHAR_OFFSET_BITS
+#define CHAR_OFFSET_BITS 16
+#endif /* CHAR_OFFSET_BITS */
+
 #ifndef CHAR_OFFSET_TYPE
-#define CHAR_OFFSET_TYPE unsigned short int     ///< Char offset type
+    #if CHAR_OFFSET_BITS == 8
+    #define CHAR_OFFSET_TYPE unsigned char          ///< Type for the char offsets
+    #elif CHAR_OFFSET_BITS == 16
+    #define CHAR_OFFSET_TYPE unsigned short int     ///< Type for the char offsets
+    #elif CHAR_OFFSET_BITS == 32
+    #define CHAR_OFFSET_TYPE unsigned int           ///< Type for the char offsets
+    #else
+    #error "The macro \"CHAR_OFFSET_BITS\" needs to be 8, 16 or 32 !"
+    #endif
 #else
 #error "The macro \"CHAR_OFFSET_TYPE\" is already defined !"
 #endif /* CHAR_OFFSET_TYPE */
 
+// If C11 available -> auto determining the printf specifier and max value
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
     /**
      * @brief Get suitable format specifier with a _Generic expression.
@@ -48,22 +94,40 @@ extern "C"
     #endif /* CHAR_OFFSET_TYPE_MAX */
 #else
     #ifndef CHAR_OFFSET_TYPE_FSTR_SPECIFIER
-    #define CHAR_OFFSET_TYPE_FSTR_SPECIFIER "hu"    ///< Specifier for the char offset type
+    /// Specifier for the char offset type
+    #define CHAR_OFFSET_TYPE_FSTR_SPECIFIER OFFSET_BITS_FSTR_SPECIFIER(CHAR_OFFSET_BITS)
     #else
     #error "The macro \"CHAR_OFFSET_TYPE_FSTR_SPECIFIER\" is already defined !"
     #endif /* CHAR_OFFSET_TYPE_FSTR_SPECIFIER */
 
     #ifndef CHAR_OFFSET_TYPE_MAX
-    #define CHAR_OFFSET_TYPE_MAX USHRT_MAX          ///< Max value for the char offset type
+    #define CHAR_OFFSET_TYPE_MAX OFFSET_BITS_MAX(CHAR_OFFSET_BITS) ///< Max value for the char offset type
     #else
     #error "The macro \"CHAR_OFFSET_TYPE_MAX\" is already defined !"
     #endif /* CHAR_OFFSET_TYPE_MAX */
-#endif /* #defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
 
 
 
+/**
+ * @brief Width of the sentence offset type in bit: 8, 16 or 32.
+ *
+ * Build time setting; see the Makefile variable SENTENCE_OFFSET_BITS.
+ */
+#ifndef SENTENCE_OFFSET_BITS
+#define SENTENCE_OFFSET_BITS 8
+#endif /* SENTENCE_OFFSET_BITS */
+
 #ifndef SENTENCE_OFFSET_TYPE
-#define SENTENCE_OFFSET_TYPE unsigned char      ///< Type for the sentence offsets
+    #if SENTENCE_OFFSET_BITS == 8
+    #define SENTENCE_OFFSET_TYPE unsigned char          ///< Type for the sentence offsets
+    #elif SENTENCE_OFFSET_BITS == 16
+    #define SENTENCE_OFFSET_TYPE unsigned short int     ///< Type for the sentence offsets
+    #elif SENTENCE_OFFSET_BITS == 32
+    #define SENTENCE_OFFSET_TYPE unsigned int           ///< Type for the sentence offsets
+    #else
+    #error "The macro \"SENTENCE_OFFSET_BITS\" needs to be 8, 16 or 32 !"
+    #endif
 #else
 #error "The macro \"SENTENCE_OFFSET_TYPE\" is already defined !"
 #endif /* SENTENCE_OFFSET_TYPE */
@@ -89,13 +153,14 @@ extern "C"
     #endif /* SENTENCE_OFFSET_TYPE_MAX */
 #else
     #ifndef SENTENCE_OFFSET_TYPE_FSTR_SPECIFIER
-    #define SENTENCE_OFFSET_TYPE_FSTR_SPECIFIER "cu"///< Type for the sentence offsets
+    /// Specifier for the sentence offset type
+    #define SENTENCE_OFFSET_TYPE_FSTR_SPECIFIER OFFSET_BITS_FSTR_SPECIFIER(SENTENCE_OFFSET_BITS)
     #else
     #error "The macro \"SENTENCE_OFFSET_TYPE_FSTR_SPECIFIER\" is already defined !"
     #endif /* SENTENCE_OFFSET_TYPE_FSTR_SPECIFIER */
 
     #ifndef SENTENCE_OFFSET_TYPE_MAX
-    #define SENTENCE_OFFSET_TYPE_MAX UCHAR_MAX      ///< Max value for the sentence offset type
+    #define SENTENCE_OFFSET_TYPE_MAX OFFSET_BITS_MAX(SENTENCE_OFFSET_BITS) ///< Max value for the sentence offset type
     #else
     #error "The macro \"SENTENCE_OFFSET_TYPE_MAX\" is already defined !"
     #endif /* SENTENCE_OFFSET_TYPE_MAX */
@@ -103,8 +168,25 @@ extern "C"
 
 
 
+/**
+ * @brief Width of the word offset type in bit: 8, 16 or 32.
+ *
+ * Build time setting; see the Makefile variable WORD_OFFSET_BITS.
+ */
+#ifndef WORD_OFFSET_BITS
+#define WORD_OFFSET_BITS 16
+#endif /* WORD_OFFSET_BITS */
+
 #ifndef WORD_OFFSET_TYPE
-#define WORD_OFFSET_TYPE unsigned short      ///< Type for the word offsets
+    #if WORD_OFFSET_BITS == 8
+    #define WORD_OFFSET_TYPE unsigned char          ///< Type for the word offsets
+    #elif WORD_OFFSET_BITS == 16
+    #define WORD_OFFSET_TYPE unsigned short int     ///< Type for the word offsets
+    #elif WORD_OFFSET_BITS == 32
+    #define WORD_OFFSET_TYPE unsigned int           ///< Type for the word offsets
+    #else
+    #error "The macro \"WORD_OFFSET_BITS\" needs to be 8, 16 or 32 !"
+    #endif
 #else
 #error "The macro \"WORD_OFFSET_TYPE\" is already defined !"
 #endif /* WORD_OFFSET_TYPE */
@@ -130,18 +212,28 @@ extern "C"
     #endif /* WORD_OFFSET_TYPE_MAX */
 #else
     #ifndef WORD_OFFSET_TYPE_FSTR_SPECIFIER
-    #define WORD_OFFSET_TYPE_FSTR_SPECIFIER "hu" ///< Format specifier for the sentence offsets
+    /// Specifier for the word offset type
+    #define WORD_OFFSET_TYPE_FSTR_SPECIFIER OFFSET_BITS_FSTR_SPECIFIER(WORD_OFFSET_BITS)
     #else
     #error "The macro \"WORD_OFFSET_TYPE_FSTR_SPECIFIER\" is already defined !"
     #endif /* WORD_OFFSET_TYPE_FSTR_SPECIFIER */
 
     #ifndef WORD_OFFSET_TYPE_MAX
-    #define WORD_OFFSET_TYPE_MAX USHRT_MAX      ///< Max value for the sentence offset type
+    #define WORD_OFFSET_TYPE_MAX OFFSET_BITS_MAX(WORD_OFFSET_BITS) ///< Max value for the word offset type
     #else
     #error "The macro \"WORD_OFFSET_TYPE_MAX\" is already defined !"
     #endif /* WORD_OFFSET_TYPE_MAX */
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
 
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(sizeof (CHAR_OFFSET_TYPE) * CHAR_BIT == CHAR_OFFSET_BITS,
+        "CHAR_OFFSET_TYPE has not the expected width !");
+_Static_assert(sizeof (SENTENCE_OFFSET_TYPE) * CHAR_BIT == SENTENCE_OFFSET_BITS,
+        "SENTENCE_OFFSET_TYPE has not the expected width !");
+_Static_assert(sizeof (WORD_OFFSET_TYPE) * CHAR_BIT == WORD_OFFSET_BITS,
+        "WORD_OFFSET_TYPE has not the expected width !");
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
 
 
 #ifndef INT_MAPPING_TYPE
@@ -106,6 +106,20 @@ static inline void Increase_Data_Array_Size_Allocation_Step_Size
         const size_t data_array_index
 );
 
+/**
+ * @brief Double the number of arrays. The new arrays get the same initial allocation as the arrays of a new object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object The Document_Word_List
+ */
+static void
+Increase_Number_Of_Arrays
+(
+        struct Document_Word_List* const object
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -227,6 +241,140 @@ DocumentWordList_CreateObjectAsIntersectionResult
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Create a read only document word list, whose data and offsets are in external memory.
+ *
+ * Only the outer dimensions (the pointers and the length information) will be allocated. The data sets will be added
+ * with DocumentWordList_AppendExternalData(); the inner arrays point then in the external memory (e.g. a mapped corpus
+ * file). So no data will be copied. The external memory needs to be available until the object will be deleted.
+ *
+ * Asserts:
+ *      number_of_arrays > 0
+ *
+ * @param[in] number_of_arrays Number of arrays (Subsets), that can be added
+ *
+ * @return Pointer to the new dynamic allocated Document_Word_List
+ */
+extern struct Document_Word_List*
+DocumentWordList_CreateObjectWithExternalData
+(
+        const size_t number_of_arrays
+)
+{
+    ASSERT_MSG(number_of_arrays != 0, "Number of arrays is 0 !");
+
+    struct Document_Word_List* new_object = (struct Document_Word_List*) CALLOC(1, sizeof (struct Document_Word_List));
+    ASSERT_ALLOC(new_object, "Cannot create new Document_Word_List !", sizeof (struct Document_Word_List));
+
+    // Only the outer dimensions; the inner arrays are in the external memory
+    new_object->data_struct.data = (uint_fast32_t**) CALLOC(number_of_arrays, sizeof (uint_fast32_t*));
+    ASSERT_ALLOC(new_object->data_struct.data, "Cannot create new Document_Word_List !",
+            number_of_arrays * sizeof (uint_fast32_t*));
+    new_object->data_struct.char_offsets = (CHAR_OFFSET_TYPE**) CALLOC(number_of_arrays, sizeof (CHAR_OFFSET_TYPE*));
+    ASSERT_ALLOC(new_object->data_struct.char_offsets, "Cannot create new Document_Word_List !",
+            number_of_arrays * sizeof (CHAR_OFFSET_TYPE*));
+    new_object->data_struct.sentence_offsets =
+            (SENTENCE_OFFSET_TYPE**) CALLOC(number_of_arrays, sizeof (SENTENCE_OFFSET_TYPE*));
+    ASSERT_ALLOC(new_object->data_struct.sentence_offsets, "Cannot create new Document_Word_List !",
+            number_of_arrays * sizeof (SENTENCE_OFFSET_TYPE*));
+    new_object->data_struct.word_offsets = (WORD_OFFSET_TYPE**) CALLOC(number_of_arrays, sizeof (WORD_OFFSET_TYPE*));
+    ASSERT_ALLOC(new_object->data_struct.word_offsets, "Cannot create new Document_Word_List !",
+            number_of_arrays * sizeof (WORD_OFFSET_TYPE*));
+    new_object->allocated_array_size = (size_t*) CALLOC(number_of_arrays, sizeof (size_t));
+    ASSERT_ALLOC(new_object->allocated_array_size, "Cannot create new Document_Word_List !",
+            number_of_arrays * sizeof (size_t));
+    new_object->arrays_lengths = (size_t*) CALLOC(number_of_arrays, sizeof (size_t));
+    ASSERT_ALLOC(new_object->arrays_lengths, "Cannot create new Document_Word_List !",
+            number_of_arrays * sizeof (size_t));
+    new_object->malloc_calloc_calls += 7;
+
+    new_object->max_array_length    = 0;
+    new_object->number_of_arrays    = number_of_arrays;
+    new_object->next_free_array     = 0;
+    // The offsets are available like in an intersection result
+    new_object->intersection_data   = true;
+    new_object->external_data       = true;
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add a block of data sets, that are in external flat arrays, to a Document_Word_List with external data.
+ *
+ * The data of all data sets in the block is in one array; the data set i starts at array_begins [i] and ends before
+ * array_begins [i + 1]. The offset arrays have the same layout. The new arrays point in the flat arrays; the data will
+ * not be copied. A block is e.g. one segment of a corpus file.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object was created with DocumentWordList_CreateObjectWithExternalData()
+ *      The object has enough free arrays for the new data sets
+ *      array_begins != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *      Every data set contains at least one value
+ *
+ * @param[in] object Document_Word_List
+ * @param[in] number_of_new_arrays Number of data sets in the block
+ * @param[in] array_begins Begin of every data set in the flat arrays (number_of_new_arrays + 1 values)
+ * @param[in] data Flat data array
+ * @param[in] char_offsets Flat char offset array
+ * @param[in] sentence_offsets Flat sentence offset array
+ * @param[in] word_offsets Flat word offset array
+ */
+extern void
+DocumentWordList_AppendExternalData
+(
+        struct Document_Word_List* const restrict object,
+        const size_t number_of_new_arrays,
+        const uint_fast64_t* const restrict array_begins,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets
+)
+{
+    ASSERT_MSG(object != NULL, "Object is NULL !");
+    ASSERT_MSG(object->external_data, "The Document_Word_List was not created for external data !");
+    ASSERT_FMSG((size_t) object->next_free_array + number_of_new_arrays <= object->number_of_arrays, "Not enough free "
+            "arrays for the external data ! Free: %zu; Got: %zu !",
+            object->number_of_arrays - (size_t) object->next_free_array, number_of_new_arrays);
+    ASSERT_MSG(array_begins != NULL, "Array begins are NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(char_offsets != NULL, "Char offsets are NULL !");
+    ASSERT_MSG(sentence_offsets != NULL, "Sentence offsets are NULL !");
+    ASSERT_MSG(word_offsets != NULL, "Word offsets are NULL !");
+
+    for (size_t i = 0; i < number_of_new_arrays; ++ i)
+    {
+        ASSERT_FMSG(array_begins [i] < array_begins [i + 1], "The data set %zu of the block is empty or its begin is "
+                "invalid !", i);
+
+        const size_t array_index = (size_t) object->next_free_array;
+        const size_t array_length = (size_t) (array_begins [i + 1] - array_begins [i]);
+
+        // The inner arrays are never written, because no data can be appended to this object
+        object->data_struct.data [array_index]              = (uint_fast32_t*) (data + array_begins [i]);
+        object->data_struct.char_offsets [array_index]      = (CHAR_OFFSET_TYPE*) (char_offsets + array_begins [i]);
+        object->data_struct.sentence_offsets [array_index]  =
+                (SENTENCE_OFFSET_TYPE*) (sentence_offsets + array_begins [i]);
+        object->data_struct.word_offsets [array_index]      = (WORD_OFFSET_TYPE*) (word_offsets + array_begins [i]);
+        object->allocated_array_size [array_index]          = array_length;
+        object->arrays_lengths [array_index]                = array_length;
+
+        object->max_array_length = MAX(object->max_array_length, array_length);
+        ++ object->next_free_array;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Delete a Document_Word_List object.
  *
@@ -243,14 +391,17 @@ DocumentWordList_DeleteObject
 {
     ASSERT_MSG(object != NULL, "Object is NULL !");
 
-    // Inner dimension
-    for (uint_fast32_t i = 0; i < object->number_of_arrays; ++ i)
+    // Inner dimension (Not in external memory)
+    if (! object->external_data)
     {
-        free(object->data_struct.data [i]);
-        // FREE_AND_SET_TO_NULL(object->data_struct.data [i]);
+        for (uint_fast32_t i = 0; i < object->number_of_arrays; ++ i)
+        {
+            free(object->data_struct.data [i]);
+            // FREE_AND_SET_TO_NULL(object->data_struct.data [i]);
+        }
+        GLOBAL_free_calls += object->number_of_arrays;
     }
-    GLOBAL_free_calls += object->number_of_arrays;
-    if (object->intersection_data)
+    if (object->intersection_data && ! object->external_data)
     {
         for (uint_fast32_t i = 0; i < object->number_of_arrays; ++ i)
         {
@@ -294,6 +445,9 @@ DocumentWordList_DeleteObject
 /**
  * @brief Add data to a Document_Word_List.
  *
+ * If all arrays are in use, the number of arrays will be doubled. So the object can be filled without knowing the
+ * number of data sets in advance.
+ *
  * Asserts:
  *      object != NULL
  *      new_data != NULL
@@ -314,11 +468,14 @@ DocumentWordList_AppendData
     ASSERT_MSG(object != NULL, "Object is NULL !");
     ASSERT_MSG(new_data != NULL, "New data is NULL !");
     ASSERT_MSG(data_length != 0, "New data length is 0 !");
+    ASSERT_MSG(! object->external_data, "Cannot append data to a Document_Word_List with external data !");
 
     //ASSERT_FMSG(data_length <= object->max_array_length, "New data is too large ! Value %zu; max. valid: %zu",
     //        data_length, object->max_array_length);
-    ASSERT_FMSG(object->number_of_arrays > (size_t) object->next_free_array, "All arrays are in use ! (%zu arrays)",
-            object->number_of_arrays);
+    if ((size_t) object->next_free_array >= object->number_of_arrays)
+    {
+        Increase_Number_Of_Arrays(object);
+    }
 
     // Increase data, if necessary
     if (data_length > object->allocated_array_size [object->next_free_array])
@@ -467,6 +624,7 @@ Put_One_Value_To_Document_Word_List
 )
 {
     ASSERT_MSG(object != NULL, "Object is NULL !");
+    ASSERT_MSG(! object->external_data, "Cannot append data to a Document_Word_List with external data !");
 
     const uint_fast32_t next_free_array = object->next_free_array;
 
@@ -973,6 +1131,99 @@ static inline void Increase_Data_Array_Size_Allocation_Step_Size
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Double the number of arrays. The new arrays get the same initial allocation as the arrays of a new object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object The Document_Word_List
+ */
+static void
+Increase_Number_Of_Arrays
+(
+        struct Document_Word_List* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Object is NULL !");
+
+    const size_t old_number_of_arrays = object->number_of_arrays;
+    const size_t new_number_of_arrays = old_number_of_arrays * 2;
+
+    uint_fast32_t** tmp_data = (uint_fast32_t**) REALLOC(object->data_struct.data,
+            new_number_of_arrays * sizeof (uint_fast32_t*));
+    ASSERT_ALLOC(tmp_data, "Cannot increase the number of arrays !", new_number_of_arrays * sizeof (uint_fast32_t*));
+    object->data_struct.data = tmp_data;
+
+    size_t* tmp_allocated_array_size = (size_t*) REALLOC(object->allocated_array_size,
+            new_number_of_arrays * sizeof (size_t));
+    ASSERT_ALLOC(tmp_allocated_array_size, "Cannot increase the number of arrays !",
+            new_number_of_arrays * sizeof (size_t));
+    object->allocated_array_size = tmp_allocated_array_size;
+
+    size_t* tmp_arrays_lengths = (size_t*) REALLOC(object->arrays_lengths, new_number_of_arrays * sizeof (size_t));
+    ASSERT_ALLOC(tmp_arrays_lengths, "Cannot increase the number of arrays !", new_number_of_arrays * sizeof (size_t));
+    object->arrays_lengths = tmp_arrays_lengths;
+    object->realloc_calls += 3;
+
+    for (size_t i = old_number_of_arrays; i < new_number_of_arrays; ++ i)
+    {
+        object->data_struct.data [i] = (uint_fast32_t*) CALLOC(INT_ALLOCATION_STEP_SIZE, sizeof (uint_fast32_t));
+        ASSERT_ALLOC(object->data_struct.data [i], "Cannot increase the number of arrays !",
+                sizeof (uint_fast32_t) * INT_ALLOCATION_STEP_SIZE);
+        object->malloc_calloc_calls ++;
+
+        object->allocated_array_size [i]    = INT_ALLOCATION_STEP_SIZE;
+        object->arrays_lengths [i]          = 0;
+    }
+
+    // The offset arrays exist only in intersection data
+    if (object->intersection_data)
+    {
+        CHAR_OFFSET_TYPE** tmp_char_offsets = (CHAR_OFFSET_TYPE**) REALLOC(object->data_struct.char_offsets,
+                new_number_of_arrays * sizeof (CHAR_OFFSET_TYPE*));
+        ASSERT_ALLOC(tmp_char_offsets, "Cannot increase the number of arrays !",
+                new_number_of_arrays * sizeof (CHAR_OFFSET_TYPE*));
+        object->data_struct.char_offsets = tmp_char_offsets;
+
+        SENTENCE_OFFSET_TYPE** tmp_sentence_offsets = (SENTENCE_OFFSET_TYPE**) REALLOC(object->data_struct.sentence_offsets,
+                new_number_of_arrays * sizeof (SENTENCE_OFFSET_TYPE*));
+        ASSERT_ALLOC(tmp_sentence_offsets, "Cannot increase the number of arrays !",
+                new_number_of_arrays * sizeof (SENTENCE_OFFSET_TYPE*));
+        object->data_struct.sentence_offsets = tmp_sentence_offsets;
+
+        WORD_OFFSET_TYPE** tmp_word_offsets = (WORD_OFFSET_TYPE**) REALLOC(object->data_struct.word_offsets,
+                new_number_of_arrays * sizeof (WORD_OFFSET_TYPE*));
+        ASSERT_ALLOC(tmp_word_offsets, "Cannot increase the number of arrays !",
+                new_number_of_arrays * sizeof (WORD_OFFSET_TYPE*));
+        object->data_struct.word_offsets = tmp_word_offsets;
+        object->realloc_calls += 3;
+
+        for (size_t i = old_number_of_arrays; i < new_number_of_arrays; ++ i)
+        {
+            object->data_struct.char_offsets [i] = (CHAR_OFFSET_TYPE*) CALLOC(INT_ALLOCATION_STEP_SIZE,
+                    sizeof (CHAR_OFFSET_TYPE));
+            ASSERT_ALLOC(object->data_struct.char_offsets [i], "Cannot increase the number of arrays !",
+                    sizeof (CHAR_OFFSET_TYPE) * INT_ALLOCATION_STEP_SIZE);
+            object->data_struct.sentence_offsets [i] = (SENTENCE_OFFSET_TYPE*) CALLOC(INT_ALLOCATION_STEP_SIZE,
+                    sizeof (SENTENCE_OFFSET_TYPE));
+            ASSERT_ALLOC(object->data_struct.sentence_offsets [i], "Cannot increase the number of arrays !",
+                    sizeof (SENTENCE_OFFSET_TYPE) * INT_ALLOCATION_STEP_SIZE);
+            object->data_struct.word_offsets [i] = (WORD_OFFSET_TYPE*) CALLOC(INT_ALLOCATION_STEP_SIZE,
+                    sizeof (WORD_OFFSET_TYPE));
+            ASSERT_ALLOC(object->data_struct.word_offsets [i], "Cannot increase the number of arrays !",
+                    sizeof (WORD_OFFSET_TYPE) * INT_ALLOCATION_STEP_SIZE);
+            object->malloc_calloc_calls += 3;
+        }
+    }
+
+    object->number_of_arrays = new_number_of_arrays;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 
 
 #ifdef INT_ALLOCATION_STEP_SIZE
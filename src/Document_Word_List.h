@@ -57,6 +57,8 @@ struct Document_Word_List
     size_t realloc_calls;           ///< How many realloc calls were done with this object ?
 
     _Bool intersection_data;        ///< Was this object created as intersection result ?
+    /// Point the inner arrays in external memory (e.g. a mapped corpus file) ? Then only the outer arrays are owned
+    _Bool external_data;
 
     /**
      * @brief First ID of the data set (only valid data, when the object is intersection data).
@@ -123,6 +125,65 @@ DocumentWordList_CreateObjectAsIntersectionResult
         const size_t max_array_length
 );
 
+/**
+ * @brief Create a read only document word list, whose data and offsets are in external memory.
+ *
+ * Only the outer dimensions (the pointers and the length information) will be allocated. The data sets will be added
+ * with DocumentWordList_AppendExternalData(); the inner arrays point then in the external memory (e.g. a mapped corpus
+ * file). So no data will be copied. The external memory needs to be available until the object will be deleted.
+ *
+ * Asserts:
+ *      number_of_arrays > 0
+ *
+ * @param[in] number_of_arrays Number of arrays (Subsets), that can be added
+ *
+ * @return Pointer to the new dynamic allocated Document_Word_List
+ */
+extern struct Document_Word_List*
+DocumentWordList_CreateObjectWithExternalData
+(
+        const size_t number_of_arrays
+);
+
+/**
+ * @brief Add a block of data sets, that are in external flat arrays, to a Document_Word_List with external data.
+ *
+ * The data of all data sets in the block is in one array; the data set i starts at array_begins [i] and ends before
+ * array_begins [i + 1]. The offset arrays have the same layout. The new arrays point in the flat arrays; the data will
+ * not be copied. A block is e.g. one segment of a corpus file.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object was created with DocumentWordList_CreateObjectWithExternalData()
+ *      The object has enough free arrays for the new data sets
+ *      array_begins != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *      Every data set contains at least one value
+ *
+ * @param[in] object Document_Word_List
+ * @param[in] number_of_new_arrays Number of data sets in the block
+ * @param[in] array_begins Begin of every data set in the flat arrays (number_of_new_arrays + 1 values)
+ * @param[in] data Flat data array
+ * @param[in] char_offsets Flat char offset array
+ * @param[in] sentence_offsets Flat sentence offset array
+ * @param[in] word_offsets Flat word offset array
+ */
+extern void
+DocumentWordList_AppendExternalData
+(
+        struct Document_Word_List* const restrict object,
+        const size_t number_of_new_arrays,
+        const uint_fast64_t* const restrict array_begins,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets
+);
+
+
 /**
  * @brief Delete a Document_Word_List object.
  *
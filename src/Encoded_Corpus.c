@@ -0,0 +1,971 @@
+/**
+ * @file Encoded_Corpus.c
+ *
+ * @brief The tokens of one input file as mapped integers - created in one pass over the file.
+ *
+ * The Encoded_Corpus gets the Token_List objects directly from the file reader (See TokenListContainer_StreamFile()).
+ * Every token will be added to the mapping and encoded with one search; the integers and the offsets will be appended
+ * to the Document_Word_List immediately.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Encoded_Corpus.h"
+#include <stdio.h>
+#include <string.h>
+#include "Corpus_File.h"
+#include "Defines.h"
+#include "Misc.h"
+#include "Stop_Words/Stop_Words.h"
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+
+
+
+/**
+ * @brief Initial number of data sets. The Document_Word_List and the ID array grow with the data.
+ */
+#ifndef INITIAL_NUMBER_OF_DATA_SETS
+#define INITIAL_NUMBER_OF_DATA_SETS 1024
+#else
+#error "The macro \"INITIAL_NUMBER_OF_DATA_SETS\" is already defined !"
+#endif /* INITIAL_NUMBER_OF_DATA_SETS */
+
+/**
+ * @brief State of the encoding, while the file will be read.
+ */
+struct Encoder_State
+{
+    struct Encoded_Corpus* corpus;                  ///< Object, that will be filled
+    struct Token_Int_Mapping* token_int_mapping;    ///< Mapping for the tokens
+
+    const struct Stop_Word_Hash_Table* stop_words;  ///< Tokens, that will be removed (NULL: No removal)
+    _Bool remove_stop_words;                        ///< Remove the tokens of the built-in stop word list ?
+
+    uint_fast32_t* token_int_values;                ///< Mapped tokens of the current data set
+    uint_fast32_t* raw_token_int_values;            ///< All mapped tokens of the current data set (Only raw tokens)
+    uint_fast32_t* surface_token_int_values;        ///< Mapped surface forms of the kept tokens (Only lemmas)
+    CHAR_OFFSET_TYPE* char_offsets;                 ///< Char offsets of the kept tokens (Only with a removal)
+    SENTENCE_OFFSET_TYPE* sentence_offsets;         ///< Sentence offsets of the kept tokens (Only with a removal)
+    WORD_OFFSET_TYPE* word_offsets;                 ///< Word offsets of the kept tokens (Only with a removal)
+    size_t allocated_token_int_values;              ///< Allocated size of token_int_values (and the offset arrays)
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Encode the tokens of one data set and append them to the corpus. (Token_List_Consumer)
+ *
+ * Asserts:
+ *      token_list != NULL
+ *      encoder_state != NULL
+ *
+ * @param[in] token_list Token_List object with the tokens of one data set
+ * @param[in] encoder_state Encoder_State object (as void*)
+ */
+static void
+Encode_Token_List
+(
+        const struct Token_List* const token_list,
+        void* const encoder_state
+);
+
+/**
+ * @brief Append the ID of a data set. The ID array will be doubled, if it is full.
+ *
+ * Asserts:
+ *      object != NULL
+ *      dataset_id != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] dataset_id ID of the data set (max. DATASET_ID_LENGTH chars; not necessarily null terminated)
+ */
+static void
+Append_Dataset_ID
+(
+        struct Encoded_Corpus* const restrict object,
+        const char* const restrict dataset_id
+);
+
+/**
+ * @brief Remove the stop words from a loaded compiled corpus: The tokens of the built-in stop word list (optional) and
+ * the tokens in the stop_words table.
+ *
+ * The tokens of a compiled corpus are already mapped; so the stop words will be determined over the mapping integers.
+ *
+ * Asserts:
+ *      object != NULL
+ *      token_int_mapping != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] token_int_mapping Token_Int_Mapping object, that was used for the loading
+ * @param[in] stop_words Tokens, that will be removed (NULL: Only the built-in stop words)
+ * @param[in] remove_built_in Remove the tokens of the built-in stop word list ?
+ * @param[in] keep_raw_tokens Save all tokens in raw_token_ints before the removal ?
+ */
+static void
+Remove_Stop_Words_From_Loaded_Corpus
+(
+        struct Encoded_Corpus* const restrict object,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const struct Stop_Word_Hash_Table* const restrict stop_words,
+        const _Bool remove_built_in,
+        const _Bool keep_raw_tokens
+);
+
+/**
+ * @brief Free the converted offsets of a loaded compiled corpus (if there are some).
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ */
+static void
+Free_Converted_Offsets
+(
+        struct Encoded_Corpus* const object
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a file and encode the tokens with the given mapping.
+ *
+ * Data sets without tokens will be skipped (like in the former Document_Word_List creation). So the array i in
+ * token_ints and the ID i belong always together.
+ *
+ * Tokens in the stop_words table will be removed with their offsets, before they will be added to the mapping. So they
+ * are never part of an intersection. With ENCODING_REMOVE_STOP_WORDS also the tokens of the built-in stop word list
+ * will be removed. The offsets of the other tokens are unchanged; they refer still to the original positions. With
+ * ENCODING_KEEP_RAW_TOKENS the removed tokens will be mapped anyway and saved in raw_token_ints (e.g. for the output of
+ * the original token list). With ENCODING_MATCH_ON_LEMMA the lemmas of a JSON file will be mapped; so all inflected
+ * forms of a word get the same mapping integer. The surface forms will be mapped, too, and saved in surface_token_ints
+ * for the output.
+ *
+ * A compiled corpus file (See Corpus_File.h) will be detected with the magic bytes; then the file will be mapped
+ * instead of read (See CorpusFile_Load()). A compiled corpus file contains already mapped tokens; its header knows,
+ * whether lemmas or surface tokens were encoded. A file with the other array than ENCODING_MATCH_ON_LEMMA requests
+ * will be rejected. A file, that was compiled with the removal of the built-in stop words, will be used directly from
+ * the mapped file; its stop words cannot be restored (So it needs ENCODING_REMOVE_STOP_WORDS) and its raw_token_ints
+ * stay NULL. The built-in stop words of a file, that was compiled without the removal, and the tokens in the
+ * stop_words table will be removed after the loading; then the data will be copied (See EncodedCorpus_RemoveTokens()).
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      token_int_mapping != NULL
+ *      number_of_threads > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] token_int_mapping Token_Int_Mapping object (New tokens will be added)
+ * @param[in] number_of_threads Number of threads, that parse the file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] stop_words Tokens, that will be removed while the encoding (NULL: No removal)
+ * @param[in] encoding_options Combination of Encoding_Options values
+ *
+ * @return Address to the new dynamic Encoded_Corpus object
+ */
+extern struct Encoded_Corpus*
+EncodedCorpus_CreateObject
+(
+        const char* const file_name,
+        struct Token_Int_Mapping* const token_int_mapping,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const struct Stop_Word_Hash_Table* const stop_words,
+        const unsigned int encoding_options
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(strlen(file_name) > 0, "File name is empty !");
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
+    ASSERT_MSG(number_of_threads > 0, "Number of threads is 0 !");
+
+    const _Bool remove_stop_words = (encoding_options & ENCODING_REMOVE_STOP_WORDS) != 0;
+    const _Bool keep_raw_tokens = (encoding_options & ENCODING_KEEP_RAW_TOKENS) != 0;
+    const enum JSON_Token_Array token_array =
+            ((encoding_options & ENCODING_MATCH_ON_LEMMA) != 0) ? JSON_TOKEN_ARRAY_LEMMA : JSON_TOKEN_ARRAY_TOKENS;
+
+    if (CorpusFile_IsCorpusFile(file_name))
+    {
+        struct Encoded_Corpus* loaded_corpus = CorpusFile_Load(file_name, token_int_mapping, token_array);
+        ASSERT_FMSG(remove_stop_words || ! loaded_corpus->built_in_stop_words_removed, "The corpus file \"%s\" was "
+                "compiled without the built-in stop words ! They cannot be restored.", file_name);
+        // A file without stop words stays in the mapped memory; only the other files and own stop words need a
+        // filtered copy
+        const _Bool remove_built_in = remove_stop_words && ! loaded_corpus->built_in_stop_words_removed;
+        if (remove_built_in || stop_words != NULL)
+        {
+            Remove_Stop_Words_From_Loaded_Corpus(loaded_corpus, token_int_mapping, stop_words, remove_built_in,
+                    keep_raw_tokens && ! loaded_corpus->built_in_stop_words_removed);
+        }
+        return loaded_corpus;
+    }
+
+    struct Encoded_Corpus* new_object = (struct Encoded_Corpus*) CALLOC(1, sizeof (struct Encoded_Corpus));
+    ASSERT_ALLOC(new_object, "Cannot allocate memory for a Encoded_Corpus object !", sizeof (struct Encoded_Corpus));
+
+    new_object->token_ints = DocumentWordList_CreateObjectAsIntersectionResult(INITIAL_NUMBER_OF_DATA_SETS, 1);
+    new_object->dataset_ids = (char*) CALLOC(INITIAL_NUMBER_OF_DATA_SETS, DATASET_ID_LENGTH);
+    ASSERT_ALLOC(new_object->dataset_ids, "Cannot allocate memory for the data set IDs !",
+            (size_t) INITIAL_NUMBER_OF_DATA_SETS * DATASET_ID_LENGTH);
+    new_object->allocated_dataset_ids = INITIAL_NUMBER_OF_DATA_SETS;
+    new_object->built_in_stop_words_removed = remove_stop_words;
+    if (keep_raw_tokens)
+    {
+        new_object->raw_token_ints = DocumentWordList_CreateObject(INITIAL_NUMBER_OF_DATA_SETS, 1);
+    }
+    if (token_array == JSON_TOKEN_ARRAY_LEMMA)
+    {
+        new_object->surface_token_ints = DocumentWordList_CreateObject(INITIAL_NUMBER_OF_DATA_SETS, 1);
+    }
+
+    struct Encoder_State encoder_state =
+    {
+            .corpus                     = new_object,
+            .token_int_mapping          = token_int_mapping,
+            .stop_words                 = stop_words,
+            .remove_stop_words          = remove_stop_words,
+            .token_int_values           = NULL,
+            .raw_token_int_values       = NULL,
+            .surface_token_int_values   = NULL,
+            .char_offsets               = NULL,
+            .sentence_offsets           = NULL,
+            .word_offsets               = NULL,
+            .allocated_token_int_values = 0
+    };
+
+    new_object->list_of_too_long_token = TokenListContainer_StreamFile (file_name, number_of_threads, json_parser_mode,
+            token_array, Encode_Token_List, &encoder_state);
+
+    if (encoder_state.token_int_values != NULL)
+    {
+        FREE_AND_SET_TO_NULL(encoder_state.token_int_values);
+    }
+    if (encoder_state.raw_token_int_values != NULL)
+    {
+        FREE_AND_SET_TO_NULL(encoder_state.raw_token_int_values);
+    }
+    if (encoder_state.surface_token_int_values != NULL)
+    {
+        FREE_AND_SET_TO_NULL(encoder_state.surface_token_int_values);
+    }
+    if (encoder_state.char_offsets != NULL)
+    {
+        FREE_AND_SET_TO_NULL(encoder_state.char_offsets);
+        FREE_AND_SET_TO_NULL(encoder_state.sentence_offsets);
+        FREE_AND_SET_TO_NULL(encoder_state.word_offsets);
+    }
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a dynamic allocated Encoded_Corpus object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ */
+extern void
+EncodedCorpus_DeleteObject
+(
+        struct Encoded_Corpus* object
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+
+    DocumentWordList_DeleteObject(object->token_ints);
+    object->token_ints = NULL;
+    if (object->raw_token_ints != NULL)
+    {
+        DocumentWordList_DeleteObject(object->raw_token_ints);
+        object->raw_token_ints = NULL;
+    }
+    if (object->surface_token_ints != NULL)
+    {
+        DocumentWordList_DeleteObject(object->surface_token_ints);
+        object->surface_token_ints = NULL;
+    }
+    TwoDimCStrArray_DeleteObject(object->list_of_too_long_token);
+    object->list_of_too_long_token = NULL;
+    if (object->allocated_dataset_ids > 0)
+    {
+        FREE_AND_SET_TO_NULL(object->dataset_ids);
+    }
+    object->dataset_ids = NULL;
+    Free_Converted_Offsets(object);
+    // The data points in the mapped file; so the file can be closed only at the end
+    if (object->corpus_file != NULL)
+    {
+        MappedFile_DeleteObject(object->corpus_file);
+        object->corpus_file = NULL;
+    }
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the ID of a data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      index_data_set < object->token_ints->next_free_array
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] index_data_set Index of the data set (-> index of the array in token_ints)
+ *
+ * @return Pointer to the null terminated ID
+ */
+extern const char*
+EncodedCorpus_GetDatasetID
+(
+        const struct Encoded_Corpus* const object,
+        const uint_fast32_t index_data_set
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_FMSG(index_data_set < object->token_ints->next_free_array, "Data set index is invalid ! Max. valid: %"
+            PRIuFAST32 "; Got: %" PRIuFAST32 " !", object->token_ints->next_free_array - 1, index_data_set);
+
+    return object->dataset_ids + ((size_t) index_data_set * DATASET_ID_LENGTH);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the full memory usage in byte.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+EncodedCorpus_GetAllocatedMemSize
+(
+        const struct Encoded_Corpus* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+
+    return sizeof (struct Encoded_Corpus) + DocumentWordList_GetAllocatedMemSize(object->token_ints) +
+            ((object->raw_token_ints != NULL) ? DocumentWordList_GetAllocatedMemSize(object->raw_token_ints) : 0) +
+            ((object->surface_token_ints != NULL) ? DocumentWordList_GetAllocatedMemSize(object->surface_token_ints) :
+                    0) +
+            (object->allocated_dataset_ids * DATASET_ID_LENGTH) +
+            // The converted offsets have one value per token of the loaded file (See EncodedCorpus_RemoveTokens())
+            ((object->converted_char_offsets != NULL) ? object->number_of_tokens * sizeof (CHAR_OFFSET_TYPE) : 0) +
+            ((object->converted_sentence_offsets != NULL) ? object->number_of_tokens * sizeof (SENTENCE_OFFSET_TYPE) :
+                    0) +
+            ((object->converted_word_offsets != NULL) ? object->number_of_tokens * sizeof (WORD_OFFSET_TYPE) : 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the tokens, that occur in more than the given fraction of the data sets (document frequency).
+ *
+ * The result is a table with one flag per mapping integer; the flag of a too frequent token is true. Mapping integers
+ * outside of the table (e.g. new tokens of a later file) occur in no data set of this corpus.
+ *
+ * Asserts:
+ *      object != NULL
+ *      max_document_frequency > 0.0 and <= 1.0
+ *      table_size != NULL
+ *      number_of_frequent_tokens != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] max_document_frequency Max. fraction of the data sets, that contain a token, that is not too frequent
+ * @param[out] table_size Number of flags in the table
+ * @param[out] number_of_frequent_tokens Number of true flags in the table
+ *
+ * @return Address to the new dynamic flag table (index is the mapping integer)
+ */
+extern _Bool*
+EncodedCorpus_DetermineFrequentTokens
+(
+        const struct Encoded_Corpus* const restrict object,
+        const float max_document_frequency,
+        size_t* const restrict table_size,
+        uint_fast32_t* const restrict number_of_frequent_tokens
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_FMSG(max_document_frequency > 0.0f && max_document_frequency <= 1.0f, "Max. document frequency (%f) is "
+            "not in the range (0, 1] !", max_document_frequency);
+    ASSERT_MSG(table_size != NULL, "Table size is NULL !");
+    ASSERT_MSG(number_of_frequent_tokens != NULL, "Number of frequent tokens is NULL !");
+
+    const struct Document_Word_List* const token_ints = object->token_ints;
+
+    // The mapping integers are not dense (See TokenIntMapping_AddTokenAndGetInt()); the tables cover all used integers
+    uint_fast32_t max_mapping_int = 0;
+    for (uint_fast32_t i = 0; i < token_ints->next_free_array; ++ i)
+    {
+        const uint_fast32_t* const data = token_ints->data_struct.data [i];
+        for (size_t i2 = 0; i2 < token_ints->arrays_lengths [i]; ++ i2)
+        {
+            max_mapping_int = MAX(max_mapping_int, data [i2]);
+        }
+    }
+    const size_t number_of_flags = (size_t) max_mapping_int + 1;
+
+    uint_fast32_t* document_frequencies = (uint_fast32_t*) CALLOC(number_of_flags, sizeof (uint_fast32_t));
+    ASSERT_ALLOC(document_frequencies, "Cannot allocate memory for the document frequencies !",
+            number_of_flags * sizeof (uint_fast32_t));
+    // A token, that occurs several times in one data set, will be counted only once (Last data set index + 1)
+    uint_fast32_t* last_data_set = (uint_fast32_t*) CALLOC(number_of_flags, sizeof (uint_fast32_t));
+    ASSERT_ALLOC(last_data_set, "Cannot allocate memory for the last data set of the tokens !",
+            number_of_flags * sizeof (uint_fast32_t));
+
+    for (uint_fast32_t i = 0; i < token_ints->next_free_array; ++ i)
+    {
+        const uint_fast32_t* const data = token_ints->data_struct.data [i];
+        for (size_t i2 = 0; i2 < token_ints->arrays_lengths [i]; ++ i2)
+        {
+            if (last_data_set [data [i2]] != i + 1)
+            {
+                last_data_set [data [i2]] = i + 1;
+                ++ document_frequencies [data [i2]];
+            }
+        }
+    }
+
+    _Bool* frequent_tokens = (_Bool*) CALLOC(number_of_flags, sizeof (_Bool));
+    ASSERT_ALLOC(frequent_tokens, "Cannot allocate memory for the frequent token table !",
+            number_of_flags * sizeof (_Bool));
+
+    const double max_number_of_data_sets = (double) max_document_frequency * (double) token_ints->next_free_array;
+    *number_of_frequent_tokens = 0;
+    for (size_t i = 0; i < number_of_flags; ++ i)
+    {
+        if ((double) document_frequencies [i] > max_number_of_data_sets)
+        {
+            frequent_tokens [i] = true;
+            ++ *number_of_frequent_tokens;
+        }
+    }
+    *table_size = number_of_flags;
+
+    FREE_AND_SET_TO_NULL(last_data_set);
+    FREE_AND_SET_TO_NULL(document_frequencies);
+
+    return frequent_tokens;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Remove all tokens with a true flag in the table with their offsets from the corpus.
+ *
+ * The offsets of the other tokens are unchanged; they refer still to the original positions. Data sets without tokens
+ * after the removal will be removed with their IDs (and their raw_token_ints arrays). The surface_token_ints will be
+ * filtered in the same way. The data will be copied in new
+ * arrays; so also the data of a compiled corpus file can be filtered.
+ *
+ * Asserts:
+ *      object != NULL
+ *      removed_tokens != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] removed_tokens Table with one flag per mapping integer (true: The token will be removed)
+ * @param[in] table_size Number of flags in the table
+ *
+ * @return Number of removed tokens
+ */
+extern uint_fast64_t
+EncodedCorpus_RemoveTokens
+(
+        struct Encoded_Corpus* const restrict object,
+        const _Bool* const restrict removed_tokens,
+        const size_t table_size
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_MSG(removed_tokens != NULL, "Table of the removed tokens is NULL !");
+
+    const struct Document_Word_List* const old_token_ints = object->token_ints;
+    const uint_fast32_t number_of_data_sets = old_token_ints->next_free_array;
+    if (number_of_data_sets == 0 || object->longest_data_set == 0) { return 0; }
+
+    struct Document_Word_List* new_token_ints = DocumentWordList_CreateObjectAsIntersectionResult(number_of_data_sets,
+            1);
+    char* new_dataset_ids = (char*) CALLOC(number_of_data_sets, DATASET_ID_LENGTH);
+    ASSERT_ALLOC(new_dataset_ids, "Cannot allocate memory for the data set IDs !",
+            (size_t) number_of_data_sets * DATASET_ID_LENGTH);
+    // The raw tokens stay complete; only the arrays of removed data sets will be dropped
+    const struct Document_Word_List* const old_raw_token_ints = object->raw_token_ints;
+    struct Document_Word_List* new_raw_token_ints = (old_raw_token_ints != NULL) ?
+            DocumentWordList_CreateObject(number_of_data_sets, 1) : NULL;
+    // The surface forms belong to the kept tokens; so they will be filtered like the tokens
+    const struct Document_Word_List* const old_surface_token_ints = object->surface_token_ints;
+    struct Document_Word_List* new_surface_token_ints = (old_surface_token_ints != NULL) ?
+            DocumentWordList_CreateObject(number_of_data_sets, 1) : NULL;
+
+    // Buffers for the kept tokens of one data set
+    const size_t buffer_size = object->longest_data_set;
+    uint_fast32_t* kept_data = (uint_fast32_t*) MALLOC(buffer_size * sizeof (uint_fast32_t));
+    ASSERT_ALLOC(kept_data, "Cannot allocate memory for the kept tokens !", buffer_size * sizeof (uint_fast32_t));
+    uint_fast32_t* kept_surface_data = NULL;
+    if (new_surface_token_ints != NULL)
+    {
+        kept_surface_data = (uint_fast32_t*) MALLOC(buffer_size * sizeof (uint_fast32_t));
+        ASSERT_ALLOC(kept_surface_data, "Cannot allocate memory for the kept surface tokens !",
+                buffer_size * sizeof (uint_fast32_t));
+    }
+    CHAR_OFFSET_TYPE* kept_char_offsets = (CHAR_OFFSET_TYPE*) MALLOC(buffer_size * sizeof (CHAR_OFFSET_TYPE));
+    ASSERT_ALLOC(kept_char_offsets, "Cannot allocate memory for the char offsets !",
+            buffer_size * sizeof (CHAR_OFFSET_TYPE));
+    SENTENCE_OFFSET_TYPE* kept_sentence_offsets = (SENTENCE_OFFSET_TYPE*) MALLOC(buffer_size *
+            sizeof (SENTENCE_OFFSET_TYPE));
+    ASSERT_ALLOC(kept_sentence_offsets, "Cannot allocate memory for the sentence offsets !",
+            buffer_size * sizeof (SENTENCE_OFFSET_TYPE));
+    WORD_OFFSET_TYPE* kept_word_offsets = (WORD_OFFSET_TYPE*) MALLOC(buffer_size * sizeof (WORD_OFFSET_TYPE));
+    ASSERT_ALLOC(kept_word_offsets, "Cannot allocate memory for the word offsets !",
+            buffer_size * sizeof (WORD_OFFSET_TYPE));
+
+    uint_fast64_t removed_counter = 0;
+    uint_fast64_t number_of_tokens = 0;
+    size_t longest_data_set = 0;
+
+    for (uint_fast32_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        const uint_fast32_t* const data = old_token_ints->data_struct.data [i];
+        const size_t data_length = old_token_ints->arrays_lengths [i];
+        size_t kept_tokens = 0;
+
+        for (size_t i2 = 0; i2 < data_length; ++ i2)
+        {
+            if (data [i2] < table_size && removed_tokens [data [i2]]) { continue; }
+
+            kept_data [kept_tokens]             = data [i2];
+            kept_char_offsets [kept_tokens]     = old_token_ints->data_struct.char_offsets [i][i2];
+            kept_sentence_offsets [kept_tokens] = old_token_ints->data_struct.sentence_offsets [i][i2];
+            kept_word_offsets [kept_tokens]     = old_token_ints->data_struct.word_offsets [i][i2];
+            if (kept_surface_data != NULL)
+            {
+                kept_surface_data [kept_tokens] = old_surface_token_ints->data_struct.data [i][i2];
+            }
+            ++ kept_tokens;
+        }
+        removed_counter += (uint_fast64_t) (data_length - kept_tokens);
+
+        // All tokens were removed: Like a data set without tokens
+        if (kept_tokens == 0) { continue; }
+
+        DocumentWordList_AppendDataWithThreeTypeOffsets(new_token_ints, kept_data, kept_char_offsets,
+                kept_sentence_offsets, kept_word_offsets, kept_tokens);
+        memcpy(new_dataset_ids + ((size_t) (new_token_ints->next_free_array - 1) * DATASET_ID_LENGTH),
+                EncodedCorpus_GetDatasetID(object, i), DATASET_ID_LENGTH);
+        if (new_raw_token_ints != NULL)
+        {
+            DocumentWordList_AppendData(new_raw_token_ints, old_raw_token_ints->data_struct.data [i],
+                    old_raw_token_ints->arrays_lengths [i]);
+        }
+        if (new_surface_token_ints != NULL)
+        {
+            DocumentWordList_AppendData(new_surface_token_ints, kept_surface_data, kept_tokens);
+        }
+
+        number_of_tokens += (uint_fast64_t) kept_tokens;
+        longest_data_set = MAX(longest_data_set, kept_tokens);
+    }
+
+    FREE_AND_SET_TO_NULL(kept_data);
+    FREE_AND_SET_TO_NULL(kept_char_offsets);
+    FREE_AND_SET_TO_NULL(kept_sentence_offsets);
+    FREE_AND_SET_TO_NULL(kept_word_offsets);
+    if (kept_surface_data != NULL)
+    {
+        FREE_AND_SET_TO_NULL(kept_surface_data);
+    }
+
+    // The IDs of a compiled corpus are in the mapped file; the file stays mapped until the object will be deleted
+    DocumentWordList_DeleteObject(object->token_ints);
+    if (object->raw_token_ints != NULL)
+    {
+        DocumentWordList_DeleteObject(object->raw_token_ints);
+    }
+    if (object->surface_token_ints != NULL)
+    {
+        DocumentWordList_DeleteObject(object->surface_token_ints);
+    }
+    if (object->allocated_dataset_ids > 0)
+    {
+        FREE_AND_SET_TO_NULL(object->dataset_ids);
+    }
+    // The new Document_Word_List contains copies of the converted offsets
+    Free_Converted_Offsets(object);
+    object->token_ints              = new_token_ints;
+    object->raw_token_ints          = new_raw_token_ints;
+    object->surface_token_ints      = new_surface_token_ints;
+    object->dataset_ids             = new_dataset_ids;
+    object->allocated_dataset_ids   = number_of_data_sets;
+    object->number_of_tokens        = number_of_tokens;
+    object->longest_data_set        = longest_data_set;
+    object->removed_stop_words      += removed_counter;
+
+    return removed_counter;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Encode the tokens of one data set and append them to the corpus. (Token_List_Consumer)
+ *
+ * Asserts:
+ *      token_list != NULL
+ *      encoder_state != NULL
+ *
+ * @param[in] token_list Token_List object with the tokens of one data set
+ * @param[in] encoder_state Encoder_State object (as void*)
+ */
+static void
+Encode_Token_List
+(
+        const struct Token_List* const token_list,
+        void* const encoder_state
+)
+{
+    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    ASSERT_MSG(encoder_state != NULL, "Encoder_State is NULL !");
+
+    struct Encoder_State* const state = (struct Encoder_State*) encoder_state;
+    struct Encoded_Corpus* const corpus = state->corpus;
+    const size_t number_of_tokens = (size_t) token_list->next_free_element;
+
+    // Data sets without tokens are not part of the intersection
+    if (number_of_tokens == 0) { return; }
+
+    // Without a removal the offsets of the Token_List can be used directly
+    const _Bool filter_tokens = state->stop_words != NULL || state->remove_stop_words;
+
+    if (number_of_tokens > state->allocated_token_int_values)
+    {
+        if (state->token_int_values != NULL)
+        {
+            FREE_AND_SET_TO_NULL(state->token_int_values);
+        }
+        state->token_int_values = (uint_fast32_t*) MALLOC(number_of_tokens * sizeof (uint_fast32_t));
+        ASSERT_ALLOC(state->token_int_values, "Cannot allocate memory for token int mapping values !",
+                number_of_tokens * sizeof (uint_fast32_t));
+
+        if (filter_tokens)
+        {
+            if (state->char_offsets != NULL)
+            {
+                FREE_AND_SET_TO_NULL(state->char_offsets);
+                FREE_AND_SET_TO_NULL(state->sentence_offsets);
+                FREE_AND_SET_TO_NULL(state->word_offsets);
+            }
+            state->char_offsets = (CHAR_OFFSET_TYPE*) MALLOC(number_of_tokens * sizeof (CHAR_OFFSET_TYPE));
+            ASSERT_ALLOC(state->char_offsets, "Cannot allocate memory for the char offsets !",
+                    number_of_tokens * sizeof (CHAR_OFFSET_TYPE));
+            state->sentence_offsets = (SENTENCE_OFFSET_TYPE*) MALLOC(number_of_tokens * sizeof (SENTENCE_OFFSET_TYPE));
+            ASSERT_ALLOC(state->sentence_offsets, "Cannot allocate memory for the sentence offsets !",
+                    number_of_tokens * sizeof (SENTENCE_OFFSET_TYPE));
+            state->word_offsets = (WORD_OFFSET_TYPE*) MALLOC(number_of_tokens * sizeof (WORD_OFFSET_TYPE));
+            ASSERT_ALLOC(state->word_offsets, "Cannot allocate memory for the word offsets !",
+                    number_of_tokens * sizeof (WORD_OFFSET_TYPE));
+        }
+        if (corpus->raw_token_ints != NULL)
+        {
+            if (state->raw_token_int_values != NULL)
+            {
+                FREE_AND_SET_TO_NULL(state->raw_token_int_values);
+            }
+            state->raw_token_int_values = (uint_fast32_t*) MALLOC(number_of_tokens * sizeof (uint_fast32_t));
+            ASSERT_ALLOC(state->raw_token_int_values, "Cannot allocate memory for the raw token int values !",
+                    number_of_tokens * sizeof (uint_fast32_t));
+        }
+        if (corpus->surface_token_ints != NULL)
+        {
+            if (state->surface_token_int_values != NULL)
+            {
+                FREE_AND_SET_TO_NULL(state->surface_token_int_values);
+            }
+            state->surface_token_int_values = (uint_fast32_t*) MALLOC(number_of_tokens * sizeof (uint_fast32_t));
+            ASSERT_ALLOC(state->surface_token_int_values, "Cannot allocate memory for the surface token int values !",
+                    number_of_tokens * sizeof (uint_fast32_t));
+        }
+        state->allocated_token_int_values = number_of_tokens;
+    }
+
+    const CHAR_OFFSET_TYPE* char_offsets = token_list->char_offsets;
+    const SENTENCE_OFFSET_TYPE* sentence_offsets = token_list->sentence_offsets;
+    const WORD_OFFSET_TYPE* word_offsets = token_list->word_offsets;
+    size_t kept_tokens = 0;
+
+    // Add the token to the mapping and encode it with only one search
+    for (uint_fast32_t i = 0; i < token_list->next_free_element; ++ i)
+    {
+        const char* token = TokenList_GetToken(token_list, i);
+        const size_t token_length = strlen(token);
+        // Without lemmas every token is its own surface form
+        const char* surface_token = (corpus->surface_token_ints != NULL) ? TokenList_GetSurfaceToken(token_list, i) :
+                token;
+
+        if (filter_tokens)
+        {
+            const _Bool removed = (state->remove_stop_words && Is_Word_In_Stop_Word_List(token, token_length, ENG)) ||
+                    (state->stop_words != NULL && StopWordHash_ContainsAnyCase(state->stop_words, token, token_length));
+
+            if (removed)
+            {
+                ++ corpus->removed_stop_words;
+
+                // A removed token is only in the mapping, if the raw tokens are necessary
+                if (corpus->raw_token_ints != NULL)
+                {
+                    _Bool token_added = false;
+                    state->raw_token_int_values [i] = TokenIntMapping_AddTokenAndGetInt(state->token_int_mapping,
+                            surface_token, strlen(surface_token), &token_added);
+                    if (token_added) { ++ corpus->tokens_added_to_mapping; }
+                }
+                continue;
+            }
+            state->char_offsets [kept_tokens]     = token_list->char_offsets [i];
+            state->sentence_offsets [kept_tokens] = token_list->sentence_offsets [i];
+            state->word_offsets [kept_tokens]     = token_list->word_offsets [i];
+        }
+
+        _Bool token_added = false;
+        state->token_int_values [kept_tokens] = TokenIntMapping_AddTokenAndGetInt(state->token_int_mapping, token,
+                token_length, &token_added);
+        if (token_added) { ++ corpus->tokens_added_to_mapping; }
+
+        // A lemma, that differs from its surface form, needs an own mapping integer for the output
+        uint_fast32_t surface_token_int = state->token_int_values [kept_tokens];
+        if (surface_token != token && strcmp(surface_token, token) != 0)
+        {
+            token_added = false;
+            surface_token_int = TokenIntMapping_AddTokenAndGetInt(state->token_int_mapping, surface_token,
+                    strlen(surface_token), &token_added);
+            if (token_added) { ++ corpus->tokens_added_to_mapping; }
+        }
+        if (corpus->surface_token_ints != NULL)
+        {
+            state->surface_token_int_values [kept_tokens] = surface_token_int;
+        }
+        if (corpus->raw_token_ints != NULL)
+        {
+            state->raw_token_int_values [i] = surface_token_int;
+        }
+        ++ kept_tokens;
+    }
+    if (filter_tokens)
+    {
+        // All tokens were removed: Like a data set without tokens
+        if (kept_tokens == 0) { return; }
+
+        char_offsets = state->char_offsets;
+        sentence_offsets = state->sentence_offsets;
+        word_offsets = state->word_offsets;
+    }
+
+    DocumentWordList_AppendDataWithThreeTypeOffsets
+    (
+            corpus->token_ints,
+            state->token_int_values,
+            char_offsets,
+            sentence_offsets,
+            word_offsets,
+            kept_tokens
+    );
+    if (corpus->raw_token_ints != NULL)
+    {
+        DocumentWordList_AppendData(corpus->raw_token_ints, state->raw_token_int_values, number_of_tokens);
+    }
+    if (corpus->surface_token_ints != NULL)
+    {
+        DocumentWordList_AppendData(corpus->surface_token_ints, state->surface_token_int_values, kept_tokens);
+    }
+    Append_Dataset_ID(corpus, token_list->dataset_id);
+
+    corpus->number_of_tokens += (uint_fast64_t) kept_tokens;
+    corpus->longest_data_set = MAX(corpus->longest_data_set, kept_tokens);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append the ID of a data set. The ID array will be doubled, if it is full.
+ *
+ * Asserts:
+ *      object != NULL
+ *      dataset_id != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] dataset_id ID of the data set (max. DATASET_ID_LENGTH chars; not necessarily null terminated)
+ */
+static void
+Append_Dataset_ID
+(
+        struct Encoded_Corpus* const restrict object,
+        const char* const restrict dataset_id
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_MSG(dataset_id != NULL, "Data set ID is NULL !");
+
+    // The Document_Word_List contains already the new data set
+    const size_t index_data_set = (size_t) object->token_ints->next_free_array - 1;
+
+    if (index_data_set >= object->allocated_dataset_ids)
+    {
+        const size_t new_allocated_dataset_ids = object->allocated_dataset_ids * 2;
+        char* tmp_dataset_ids = (char*) REALLOC(object->dataset_ids, new_allocated_dataset_ids * DATASET_ID_LENGTH);
+        ASSERT_ALLOC(tmp_dataset_ids, "Cannot increase the memory for the data set IDs !",
+                new_allocated_dataset_ids * DATASET_ID_LENGTH);
+        object->dataset_ids = tmp_dataset_ids;
+        object->allocated_dataset_ids = new_allocated_dataset_ids;
+    }
+
+    char* const new_id = object->dataset_ids + (index_data_set * DATASET_ID_LENGTH);
+    memcpy(new_id, dataset_id, DATASET_ID_LENGTH);
+    // Equal with the ID in the Token_List: the last char is always the terminator
+    new_id [DATASET_ID_LENGTH - 1] = '\0';
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Remove the stop words from a loaded compiled corpus: The tokens of the built-in stop word list (optional) and
+ * the tokens in the stop_words table.
+ *
+ * The tokens of a compiled corpus are already mapped; so the stop words will be determined over the mapping integers.
+ *
+ * Asserts:
+ *      object != NULL
+ *      token_int_mapping != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] token_int_mapping Token_Int_Mapping object, that was used for the loading
+ * @param[in] stop_words Tokens, that will be removed (NULL: Only the built-in stop words)
+ * @param[in] remove_built_in Remove the tokens of the built-in stop word list ?
+ * @param[in] keep_raw_tokens Save all tokens in raw_token_ints before the removal ?
+ */
+static void
+Remove_Stop_Words_From_Loaded_Corpus
+(
+        struct Encoded_Corpus* const restrict object,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const struct Stop_Word_Hash_Table* const restrict stop_words,
+        const _Bool remove_built_in,
+        const _Bool keep_raw_tokens
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
+
+    const struct Document_Word_List* const token_ints = object->token_ints;
+
+    if (keep_raw_tokens)
+    {
+        // The raw tokens of a lemma corpus are the surface forms
+        const struct Document_Word_List* const raw_source = (object->surface_token_ints != NULL) ?
+                object->surface_token_ints : token_ints;
+        object->raw_token_ints = DocumentWordList_CreateObject(MAX(token_ints->next_free_array, 1), 1);
+        for (uint_fast32_t i = 0; i < token_ints->next_free_array; ++ i)
+        {
+            DocumentWordList_AppendData(object->raw_token_ints, raw_source->data_struct.data [i],
+                    raw_source->arrays_lengths [i]);
+        }
+    }
+
+    uint_fast32_t max_mapping_int = 0;
+    for (uint_fast32_t i = 0; i < token_ints->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < token_ints->arrays_lengths [i]; ++ i2)
+        {
+            max_mapping_int = MAX(max_mapping_int, token_ints->data_struct.data [i][i2]);
+        }
+    }
+    const size_t table_size = (size_t) max_mapping_int + 1;
+
+    // Every used mapping integer will be classified only once
+    _Bool* checked_tokens = (_Bool*) CALLOC(table_size, sizeof (_Bool));
+    ASSERT_ALLOC(checked_tokens, "Cannot allocate memory for the checked token table !", table_size * sizeof (_Bool));
+    _Bool* stop_word_tokens = (_Bool*) CALLOC(table_size, sizeof (_Bool));
+    ASSERT_ALLOC(stop_word_tokens, "Cannot allocate memory for the stop word table !", table_size * sizeof (_Bool));
+
+    for (uint_fast32_t i = 0; i < token_ints->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < token_ints->arrays_lengths [i]; ++ i2)
+        {
+            const uint_fast32_t token_int = token_ints->data_struct.data [i][i2];
+            if (checked_tokens [token_int]) { continue; }
+
+            const char* const token = TokenIntMapping_IntToTokenStaticMem(token_int_mapping, token_int);
+            const size_t token_length = strlen(token);
+            stop_word_tokens [token_int] = (remove_built_in && Is_Word_In_Stop_Word_List(token, token_length, ENG)) ||
+                    (stop_words != NULL && StopWordHash_ContainsAnyCase(stop_words, token, token_length));
+            checked_tokens [token_int] = true;
+        }
+    }
+
+    EncodedCorpus_RemoveTokens(object, stop_word_tokens, table_size);
+    object->built_in_stop_words_removed |= remove_built_in;
+
+    FREE_AND_SET_TO_NULL(checked_tokens);
+    FREE_AND_SET_TO_NULL(stop_word_tokens);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Free the converted offsets of a loaded compiled corpus (if there are some).
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ */
+static void
+Free_Converted_Offsets
+(
+        struct Encoded_Corpus* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Encoded_Corpus is NULL !");
+
+    if (object->converted_char_offsets != NULL)
+    {
+        FREE_AND_SET_TO_NULL(object->converted_char_offsets);
+    }
+    if (object->converted_sentence_offsets != NULL)
+    {
+        FREE_AND_SET_TO_NULL(object->converted_sentence_offsets);
+    }
+    if (object->converted_word_offsets != NULL)
+    {
+        FREE_AND_SET_TO_NULL(object->converted_word_offsets);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef INITIAL_NUMBER_OF_DATA_SETS
+#undef INITIAL_NUMBER_OF_DATA_SETS
+#endif /* INITIAL_NUMBER_OF_DATA_SETS */
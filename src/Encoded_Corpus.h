@@ -0,0 +1,267 @@
+/**
+ * @file Encoded_Corpus.h
+ *
+ * @brief The tokens of one input file as mapped integers - created in one pass over the file.
+ *
+ * Before the intersection the tokens of a file were collected in a Token_List_Container, then added to the
+ * Token_Int_Mapping and at the end mapped in a Document_Word_List. So the tokens of the whole file were in the memory
+ * twice (as strings and as integers) and every token was searched two times in the mapping.
+ *
+ * The Encoded_Corpus gets the Token_List objects directly from the file reader (See TokenListContainer_StreamFile()).
+ * Every token will be added to the mapping and encoded with one search; the integers and the offsets will be appended
+ * to the Document_Word_List immediately. The strings of a data set are only in the memory, until the data set was
+ * encoded.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef ENCODED_CORPUS_H
+#define ENCODED_CORPUS_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+#include "File_Reader.h"
+#include "Token_Int_Mapping.h"
+#include "Document_Word_List.h"
+#include "Two_Dim_C_String_Array.h"
+#include "Mapped_File.h"
+#include "Stop_Words/Stop_Word_Hash.h"
+
+
+
+//=====================================================================================================================
+
+/**
+ * @brief Options for the encoding (See EncodedCorpus_CreateObject()). Can be combined with '|'.
+ */
+enum Encoding_Options
+{
+    ENCODING_DEFAULT            = 0,        ///< All tokens will be encoded
+    /// Tokens of the built-in stop word list (See Is_Word_In_Stop_Word_List()) will be removed with their offsets
+    ENCODING_REMOVE_STOP_WORDS  = 1 << 0,
+    /// All mapped tokens of a data set - also the removed ones - will be saved in raw_token_ints
+    ENCODING_KEEP_RAW_TOKENS    = 1 << 1,
+    /// The lemmas will be mapped instead of the surface tokens (See JSON_TOKEN_ARRAY_LEMMA)
+    ENCODING_MATCH_ON_LEMMA     = 1 << 2
+};
+
+/**
+ * @brief The Encoded_Corpus object.
+ */
+struct Encoded_Corpus
+{
+    /**
+     * @brief Mapped tokens with the char, sentence and word offsets. One array per data set with tokens.
+     */
+    struct Document_Word_List* token_ints;
+
+    /**
+     * @brief All mapped tokens of the data sets - also the removed tokens - without offsets. The array i belongs to the
+     * array i in token_ints. With ENCODING_MATCH_ON_LEMMA the surface forms instead of the lemmas. Only with
+     * ENCODING_KEEP_RAW_TOKENS; otherwise NULL.
+     */
+    struct Document_Word_List* raw_token_ints;
+
+    /**
+     * @brief Mapped surface forms of the tokens in token_ints (same array lengths). The output shows them instead of
+     * the lemmas. Only with ENCODING_MATCH_ON_LEMMA; otherwise NULL.
+     */
+    struct Document_Word_List* surface_token_ints;
+
+    /**
+     * @brief IDs of the data sets. The ID of the array i in token_ints starts at i * DATASET_ID_LENGTH.
+     */
+    char* dataset_ids;
+    /// Number of IDs, that can be saved without a reallocation (0: The IDs are in the mapped corpus file)
+    size_t allocated_dataset_ids;
+
+    struct Two_Dim_C_String_Array* list_of_too_long_token;  ///< Tokens, that were longer than expected
+
+    uint_fast32_t tokens_added_to_mapping;  ///< Number of tokens, that were new in the mapping
+    uint_fast64_t removed_stop_words;       ///< Number of tokens, that were removed with the stop word lists
+    _Bool built_in_stop_words_removed;      ///< Were the tokens of the built-in stop word list removed ?
+    uint_fast64_t number_of_tokens;         ///< Number of all encoded tokens
+    size_t longest_data_set;                ///< Number of tokens in the longest data set
+
+    /**
+     * @brief Mapped compiled corpus file, if the corpus was loaded from one (See Corpus_File.h). Otherwise NULL.
+     *
+     * The tokens, the offsets and possibly the data set IDs point in this file.
+     */
+    struct Mapped_File* corpus_file;
+
+    /// Offsets of a compiled corpus file, that were written with an other width than the offset types of this program;
+    /// converted while loading (one flat array for all data sets). NULL, if the offsets point in the mapped file.
+    CHAR_OFFSET_TYPE* converted_char_offsets;
+    SENTENCE_OFFSET_TYPE* converted_sentence_offsets;   ///< See converted_char_offsets
+    WORD_OFFSET_TYPE* converted_word_offsets;           ///< See converted_char_offsets
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Read a file and encode the tokens with the given mapping.
+ *
+ * Data sets without tokens will be skipped (like in the former Document_Word_List creation). So the array i in
+ * token_ints and the ID i belong always together.
+ *
+ * Tokens in the stop_words table will be removed with their offsets, before they will be added to the mapping. So they
+ * are never part of an intersection. With ENCODING_REMOVE_STOP_WORDS also the tokens of the built-in stop word list
+ * will be removed. The offsets of the other tokens are unchanged; they refer still to the original positions. With
+ * ENCODING_KEEP_RAW_TOKENS the removed tokens will be mapped anyway and saved in raw_token_ints (e.g. for the output of
+ * the original token list). With ENCODING_MATCH_ON_LEMMA the lemmas of a JSON file will be mapped; so all inflected
+ * forms of a word get the same mapping integer. The surface forms will be mapped, too, and saved in surface_token_ints
+ * for the output.
+ *
+ * A compiled corpus file (See Corpus_File.h) will be detected with the magic bytes; then the file will be mapped
+ * instead of read (See CorpusFile_Load()). A compiled corpus file contains already mapped tokens; its header knows,
+ * whether lemmas or surface tokens were encoded. A file with the other array than ENCODING_MATCH_ON_LEMMA requests
+ * will be rejected. A file, that was compiled with the removal of the built-in stop words, will be used directly from
+ * the mapped file; its stop words cannot be restored (So it needs ENCODING_REMOVE_STOP_WORDS) and its raw_token_ints
+ * stay NULL. The built-in stop words of a file, that was compiled without the removal, and the tokens in the
+ * stop_words table will be removed after the loading; then the data will be copied (See EncodedCorpus_RemoveTokens()).
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      token_int_mapping != NULL
+ *      number_of_threads > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] token_int_mapping Token_Int_Mapping object (New tokens will be added)
+ * @param[in] number_of_threads Number of threads, that parse the file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] stop_words Tokens, that will be removed while the encoding (NULL: No removal)
+ * @param[in] encoding_options Combination of Encoding_Options values
+ *
+ * @return Address to the new dynamic Encoded_Corpus object
+ */
+extern struct Encoded_Corpus*
+EncodedCorpus_CreateObject
+(
+        const char* const file_name,
+        struct Token_Int_Mapping* const token_int_mapping,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const struct Stop_Word_Hash_Table* const stop_words,
+        const unsigned int encoding_options
+);
+
+/**
+ * @brief Delete a dynamic allocated Encoded_Corpus object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ */
+extern void
+EncodedCorpus_DeleteObject
+(
+        struct Encoded_Corpus* object
+);
+
+/**
+ * @brief Get the ID of a data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      index_data_set < object->token_ints->next_free_array
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] index_data_set Index of the data set (-> index of the array in token_ints)
+ *
+ * @return Pointer to the null terminated ID
+ */
+extern const char*
+EncodedCorpus_GetDatasetID
+(
+        const struct Encoded_Corpus* const object,
+        const uint_fast32_t index_data_set
+);
+
+/**
+ * @brief Determine the tokens, that occur in more than the given fraction of the data sets (document frequency).
+ *
+ * The result is a table with one flag per mapping integer; the flag of a too frequent token is true. Mapping integers
+ * outside of the table (e.g. new tokens of a later file) occur in no data set of this corpus.
+ *
+ * Asserts:
+ *      object != NULL
+ *      max_document_frequency > 0.0 and <= 1.0
+ *      table_size != NULL
+ *      number_of_frequent_tokens != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] max_document_frequency Max. fraction of the data sets, that contain a token, that is not too frequent
+ * @param[out] table_size Number of flags in the table
+ * @param[out] number_of_frequent_tokens Number of true flags in the table
+ *
+ * @return Address to the new dynamic flag table (index is the mapping integer)
+ */
+extern _Bool*
+EncodedCorpus_DetermineFrequentTokens
+(
+        const struct Encoded_Corpus* const restrict object,
+        const float max_document_frequency,
+        size_t* const restrict table_size,
+        uint_fast32_t* const restrict number_of_frequent_tokens
+);
+
+/**
+ * @brief Remove all tokens with a true flag in the table with their offsets from the corpus.
+ *
+ * The offsets of the other tokens are unchanged; they refer still to the original positions. Data sets without tokens
+ * after the removal will be removed with their IDs (and their raw_token_ints arrays). The surface_token_ints will be
+ * filtered in the same way. The data will be copied in new
+ * arrays; so also the data of a compiled corpus file can be filtered.
+ *
+ * Asserts:
+ *      object != NULL
+ *      removed_tokens != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ * @param[in] removed_tokens Table with one flag per mapping integer (true: The token will be removed)
+ * @param[in] table_size Number of flags in the table
+ *
+ * @return Number of removed tokens
+ */
+extern uint_fast64_t
+EncodedCorpus_RemoveTokens
+(
+        struct Encoded_Corpus* const restrict object,
+        const _Bool* const restrict removed_tokens,
+        const size_t table_size
+);
+
+/**
+ * @brief Determine the full memory usage in byte.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Encoded_Corpus object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+EncodedCorpus_GetAllocatedMemSize
+(
+        const struct Encoded_Corpus* const object
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ENCODED_CORPUS_H */
@@ -13,10 +13,10 @@
 
 
 // Global variables to count the malloc (), calloc (), realloc () and free () calls
-uint_fast64_t GLOBAL_malloc_calls   = 0;
-uint_fast64_t GLOBAL_calloc_calls   = 0;
-uint_fast64_t GLOBAL_realloc_calls  = 0;
-uint_fast64_t GLOBAL_free_calls     = 0;
+MEMORY_COUNTER_TYPE GLOBAL_malloc_calls   = 0;
+MEMORY_COUNTER_TYPE GLOBAL_calloc_calls   = 0;
+MEMORY_COUNTER_TYPE GLOBAL_realloc_calls  = 0;
+MEMORY_COUNTER_TYPE GLOBAL_free_calls     = 0;
 
 
 
@@ -29,11 +29,27 @@ extern "C"
 #include "Assert_Msg.h"
 
 
+/**
+ * @brief Type of the counter variables.
+ *
+ * The counters will be incremented by several threads (e.g. the reader threads of the file reader). With C11 atomics
+ * no increment gets lost.
+ */
+#ifndef MEMORY_COUNTER_TYPE
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && ! defined(__STDC_NO_ATOMICS__) && ! defined(__cplusplus)
+    #define MEMORY_COUNTER_TYPE _Atomic uint_fast64_t
+#else
+    #define MEMORY_COUNTER_TYPE uint_fast64_t
+#endif
+#else
+#error "The macro \"MEMORY_COUNTER_TYPE\" is already defined !"
+#endif /* MEMORY_COUNTER_TYPE */
+
 // Global variables to count the malloc (), calloc (), realloc () and free () calls
-extern uint_fast64_t GLOBAL_malloc_calls;   ///< Number of executed malloc calls
-extern uint_fast64_t GLOBAL_calloc_calls;   ///< Number of executed calloc calls
-extern uint_fast64_t GLOBAL_realloc_calls;  ///< Number of executed realloc calls
-extern uint_fast64_t GLOBAL_free_calls;     ///< Number of executed free calls
+extern MEMORY_COUNTER_TYPE GLOBAL_malloc_calls;     ///< Number of executed malloc calls
+extern MEMORY_COUNTER_TYPE GLOBAL_calloc_calls;     ///< Number of executed calloc calls
+extern MEMORY_COUNTER_TYPE GLOBAL_realloc_calls;    ///< Number of executed realloc calls
+extern MEMORY_COUNTER_TYPE GLOBAL_free_calls;       ///< Number of executed free calls
 
 
 
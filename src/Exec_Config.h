@@ -37,7 +37,8 @@ enum Exec_Config_Types
     NO_FILENAMES                = 1 << 9,   ///< Don't show the input file names in the general info block.
     NO_CREATION_TIME            = 1 << 10,  ///< Don't show the creation time in the general info block.
     NO_PROGRAM_VERSION          = 1 << 11,  ///< Don't show the program version in the general info block.
-    KEEP_SINGLE_TOKEN_RESULTS   = 1 << 12   ///< Keep results with only one token
+    KEEP_SINGLE_TOKEN_RESULTS   = 1 << 12,  ///< Keep results with only one token
+    COMPRESS_OUTPUT             = 1 << 13   ///< Write a gzip compressed result file
 };
 
 /**
@@ -128,6 +129,12 @@ enum Exec_Config_Types
 #error "The macro \"KEEP_SINGLE_TOKEN_RESULTS_BIT\" is already defined !"
 #endif /* KEEP_SINGLE_TOKEN_RESULTS_BIT */
 
+#ifndef COMPRESS_OUTPUT_BIT
+#define COMPRESS_OUTPUT_BIT(input) ((input) & COMPRESS_OUTPUT) ///< Is COMPRESS_OUTPUT bit set ?
+#else
+#error "The macro \"COMPRESS_OUTPUT_BIT\" is already defined !"
+#endif /* COMPRESS_OUTPUT_BIT */
+
 
 
 /**
@@ -50,6 +50,15 @@ extern "C"
  * - Create the intersections and save the information in the output file
  *      -- At the end the intersection between two Document_Word_List objects will be calculated
  *      -- The results will be written in the result file
+ *      -- Before an intersection result will be created, the relevant matches (without stop words) will be counted. Only
+ *         pairs with enough matches get an intersection result
+ *      -- In the count only mode (--counts_only) no intersection result will be created. Only the counters will be
+ *         written in the result file
+ *
+ * - Batch mode (--batch): The first file will be read and encoded only once
+ *      -- Every job of the job list reads its query file (instead of the second input file) and writes its own result
+ *         file
+ *      -- The new tokens of a query file extend the token int mapping of the first file
  *
  *
  *
@@ -15,8 +15,9 @@
 #include <time.h>
 #include <math.h>
 #include <limits.h>
-#include <errno.h>
 #include <ctype.h>
+#include <errno.h>
+#include <pthread.h>
 #include "Error_Handling/Assert_Msg.h"
 #include "Error_Handling/Dynamic_Memory.h"
 #include "Error_Handling/_Generics.h"
@@ -29,13 +30,16 @@
 #include "String_Tools.h"
 #include "UTF8/utf8.h"
 #include "ANSI_Esc_Seq.h"
+#include "Mapped_File.h"
+#include "JSON_Token_Scanner.h"
+#include "Compressed_Input.h"
 
 
 
 /**
- * @brief Number of tokens in a Token_List
+ * @brief Minimal number of tokens in a Token_List, if the number of tokens is not known before
  *
- * It is also the allocation step size, if a reallocation is necessary.
+ * The lists grow geometrically (at least doubling) beginning with this value.
  */
 #ifndef TOKENS_ALLOCATION_STEP_SIZE
 #define TOKENS_ALLOCATION_STEP_SIZE 15
@@ -44,9 +48,9 @@
 #endif /* TOKENS_ALLOCATION_STEP_SIZE */
 
 /**
- * @brief Number of Token_Lists in a Token_List_Container
+ * @brief Initial number of Token_Lists in a Token_List_Container
  *
- * It is also the allocation step size, if a reallocation is necessary.
+ * The container grows geometrically (doubling), if more Token_Lists are necessary.
  */
 #ifndef TOKEN_CONTAINER_ALLOCATION_STEP_SIZE
 #define TOKEN_CONTAINER_ALLOCATION_STEP_SIZE 4
@@ -72,6 +76,24 @@
 #error "The macro \"JSON_CHAR_OFFSET_ARRAY_NAME\" is already defined !"
 #endif /* JSON_CHAR_OFFSET_ARRAY_NAME */
 
+/**
+ * @brief Name of the JSON array with the lemmas. (One lemma per token)
+ */
+#ifndef JSON_LEMMA_ARRAY_NAME
+#define JSON_LEMMA_ARRAY_NAME "lemma"
+#else
+#error "The macro \"JSON_LEMMA_ARRAY_NAME\" is already defined !"
+#endif /* JSON_LEMMA_ARRAY_NAME */
+
+/**
+ * @brief Block size of the arena for the cJSON trees. One block holds the tree of a typical JSON fragment.
+ */
+#ifndef CJSON_ARENA_BLOCK_SIZE
+#define CJSON_ARENA_BLOCK_SIZE (64 * 1024)
+#else
+#error "The macro \"CJSON_ARENA_BLOCK_SIZE\" is already defined !"
+#endif /* CJSON_ARENA_BLOCK_SIZE */
+
 /**
  * @brief Check, whether the macro values are valid.
  */
@@ -85,7 +107,9 @@ IS_TYPE(TOKEN_CONTAINER_ALLOCATION_STEP_SIZE, int)
 _Static_assert(sizeof(JSON_TOKENS_ARRAY_NAME) > 0 + 1, "The macro \"JSON_TOKENS_ARRAY_NAME\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(JSON_CHAR_OFFSET_ARRAY_NAME) > 0 + 1, "The macro \"JSON_CHAR_OFFSET_ARRAY_NAME\" needs at least one char (plus '\0') !");
 IS_CONST_STR(JSON_TOKENS_ARRAY_NAME)
+_Static_assert(sizeof(JSON_LEMMA_ARRAY_NAME) > 0 + 1, "The macro \"JSON_LEMMA_ARRAY_NAME\" needs at least one char (plus '\0') !");
 IS_CONST_STR(JSON_CHAR_OFFSET_ARRAY_NAME)
+IS_CONST_STR(JSON_LEMMA_ARRAY_NAME)
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ */
 
 /**
@@ -142,9 +166,10 @@ Get_Average_Token_Length
 );
 
 /**
- * @brief Increase the number of Token_List objects in a Token_List_Container.
+ * @brief Double the number of Token_List objects in a Token_List_Container.
  *
- * The default allocation step size (TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) will be used.
+ * The new Token_List objects are empty: the memory for the tokens will be allocated with the first token (See
+ * Reserve_Tokens()).
  *
  * Asserts:
  *      token_list_container != NULL
@@ -158,41 +183,47 @@ Increase_Number_Of_Token_Lists
 );
 
 /**
- * @brief Increase the number of tokens in a Token_List object.
+ * @brief Resize the memory of a Token_List object to the given number of tokens.
  *
- * The default allocation step size (TOKENS_ALLOCATION_STEP_SIZE) will be used.
+ * The reallocations will be counted in the container.
  *
  * Asserts:
+ *      token_list_container != NULL
  *      token_list != NULL
+ *      new_allocated_tokens > token_list->allocated_tokens
  *
+ * @param[in] token_list_container Token_List_Container object, that holds the Token_List
  * @param[in] token_list Token_List object
+ * @param[in] new_allocated_tokens New number of tokens
  */
 static void
 Increase_Number_Of_Tokens
 (
-        struct Token_List* const token_list
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list,
+        const size_t new_allocated_tokens
 );
 
 /**
- * @brief Read the next line from the file and return the number of char, that were read.
+ * @brief Make sure, that a Token_List can hold the given number of tokens without a further reallocation.
  *
- * Asserts:
- *      input_file != NULL
- *      input_file_data != NULL
- *      input_file_data_length > 0
+ * If the number of tokens of a data set is known before the tokens are appended, the list will be allocated only once
+ * with the exact size.
  *
- * @param[in] input_file Input file pointer
- * @param[in] input_file_data Buffer for the new input file data
- * @param[in] input_file_data_length Length of the input file buffer
+ * Asserts:
+ *      token_list_container != NULL
+ *      token_list != NULL
  *
- * @return Number of char, that were read
+ * @param[in] token_list_container Token_List_Container object, that holds the Token_List
+ * @param[in] token_list Token_List object
+ * @param[in] number_of_tokens Number of tokens, that will be appended
  */
-static size_t
-Read_Next_Line
+static void
+Reserve_Tokens
 (
-        FILE* restrict input_file,
-        char* const restrict input_file_data,
-        const long int input_file_data_length
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list,
+        const size_t number_of_tokens
 );
 
 /**
@@ -227,6 +258,7 @@ Read_File_Process_Print_Function
  *
  * @param[in] main_json Main cJSON object (It holds the object, that works direct with the source file)
  * @param[in] curr The current cJSON object
+ * @param[in] token_array JSON array, whose strings will be saved as tokens
  * @param[in] new_container The new container, that will save the new information
  *
  * @return Number of tokens, that were found (This value can be 0)
@@ -236,6 +268,7 @@ Use_Current_JSON_Fragment
 (
         const cJSON* const main_json,
         const cJSON* const curr,
+        const enum JSON_Token_Array token_array,
         struct Token_List_Container* const new_container
 );
 
@@ -249,10 +282,10 @@ Use_Current_JSON_Fragment
  * Asserts:
  *      N/A
  *
- * @param[in] curr_text Content of the current text line
+ * @param[in] curr_text Content of the current text line (not necessarily null terminated)
  * @param[in] curr_text_len Length of the current text line
  * @param[in] curr_line_num Current line number or UINT_FAST32_MAX, if this variable is unused
- * @param[in] tokenize_data Already calculated tokenize data
+ * @param[in] tokenize_data Positions of the tokens in the current text line (See Tokenize_String_Into_Buffer())
  * @param[in] new_container The new container, that will save the new information
  *
  * @return Number of tokens, that were found (This value can be 0 !)
@@ -260,13 +293,137 @@ Use_Current_JSON_Fragment
 static uint_fast32_t
 Use_Current_Text_Fragment
 (
-        char* const curr_text,
+        const char* const curr_text,
         const size_t curr_text_len,
         const uint_fast32_t curr_line_num,
-        const struct Tokenized_String* const tokenize_data,
+        const struct Token_Position_Buffer* const tokenize_data,
         struct Token_List_Container* const new_container
 );
 
+/**
+ * @brief Append a token to a Token_List and determine the char, sentence and word offset of it.
+ *
+ * The token does not need a null terminator; only the given length will be used.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] new_container The container, that holds the Token_List (For the too long tokens and the counters)
+ * @param[in] current_token_list_obj The Token_List, that gets the new token
+ * @param[in] token Begin of the token
+ * @param[in] token_length Length of the token in bytes
+ * @param[in] char_offset_available Is a char offset from the input file available ?
+ * @param[in] char_offset Char offset from the input file (Only used, if char_offset_available is true)
+ * @param[in] surface_token_chars Length of the surface form in UTF-8 chars, if the token is a lemma (SIZE_MAX: the
+ * token is the surface form)
+ */
+static void
+Append_Token_To_Token_List
+(
+        struct Token_List_Container* const new_container,
+        struct Token_List* const current_token_list_obj,
+        const char* const token,
+        const size_t token_length,
+        const _Bool char_offset_available,
+        const int char_offset,
+        const size_t surface_token_chars
+);
+
+/**
+ * @brief Save the surface form of the next token of a Token_List, before a lemma will be appended instead of it.
+ *
+ * The memory for the surface forms will be created with the first lemma; the tokens before it are their own surface
+ * forms.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] new_container The container, that holds the Token_List (For the counters)
+ * @param[in] current_token_list_obj The Token_List, that gets the next token
+ * @param[in] surface_token Begin of the surface form
+ * @param[in] surface_token_length Length of the surface form in bytes
+ */
+static void
+Set_Surface_Of_Next_Token
+(
+        struct Token_List_Container* const new_container,
+        struct Token_List* const current_token_list_obj,
+        const char* const surface_token,
+        const size_t surface_token_length
+);
+
+/**
+ * @brief Use the current JSON fragment with the streaming scanner and identify the tokens and the offsets of them.
+ *
+ * The result is equal with the result of Use_Current_JSON_Fragment() for all members of the fragment. When a syntax
+ * error occurs, the error position will be saved in the scanner and all changes of the fragment will be rolled back
+ * - like cJSON rejects the whole fragment.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] scanner JSON_Token_Scanner object
+ * @param[in, out] cursor Begin of the JSON fragment; will be moved behind the fragment
+ * @param[in] token_array JSON array, whose strings will be saved as tokens
+ * @param[in] new_container The container, that will save the new information
+ *
+ * @return Number of tokens, that were found (This value can be 0)
+ */
+static uint_fast32_t
+Use_Current_JSON_Fragment_Streaming
+(
+        struct JSON_Token_Scanner* const restrict scanner,
+        struct JSON_Cursor* const restrict cursor,
+        const enum JSON_Token_Array token_array,
+        struct Token_List_Container* const restrict new_container
+);
+
+/**
+ * @brief Create a Token_List from the tokens array and the char offsets array of a data set. (Streaming version)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] scanner JSON_Token_Scanner object
+ * @param[in] tokens_array Begin of the tokens value (position NULL: no tokens value)
+ * @param[in] char_offsets_array Begin of the char offsets value (position NULL: no char offsets value)
+ * @param[in] lemma_array Begin of the lemma value (position NULL: no lemma value; the surface tokens will be saved)
+ * @param[in] dataset_id ID of the data set
+ * @param[in] new_container The container, that will save the new information
+ *
+ * @return Number of tokens, that were found (This value can be 0)
+ */
+static uint_fast32_t
+Use_Streamed_Tokens_Array
+(
+        struct JSON_Token_Scanner* const restrict scanner,
+        struct JSON_Cursor tokens_array,
+        struct JSON_Cursor char_offsets_array,
+        struct JSON_Cursor lemma_array,
+        const char* const restrict dataset_id,
+        struct Token_List_Container* const restrict new_container
+);
+
+/**
+ * @brief Remove all Token_List objects and too long tokens, that were added after the given state.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] next_free_element Saved number of used Token_List objects
+ * @param[in] next_free_too_long_token Saved number of too long tokens
+ * @param[in] longest_token_length Saved length of the longest token
+ */
+static void
+Roll_Back_Token_Lists
+(
+        struct Token_List_Container* const container,
+        const uint_fast32_t next_free_element,
+        const uint_fast32_t next_free_too_long_token,
+        const size_t longest_token_length
+);
+
 
 
 enum File_Type
@@ -283,14 +440,220 @@ enum File_Type
  *
  * The function will check for a JSON or a text file.
  *
- * @param input_file FILE pointer to the already opened file.
+ * @param file_content Content of the whole file
+ * @param file_size Size of the file content in bytes
  *
  * @return Type of the file; if a determination was not possible UNKNOWN_FILE_TYPE will be returned
  */
 static enum File_Type
 Determine_File_Type
 (
-        FILE* input_file
+        const char* const file_content,
+        const uint_fast64_t file_size
+);
+
+/**
+ * @brief Data of one reader thread. (See TokenListContainer_CreateObjectParallel())
+ */
+struct Reader_Thread_Data
+{
+    const struct Mapped_File* input_file;           ///< The mapped input file (shared between the threads)
+    uint_fast64_t range_begin;                      ///< Begin of the chunk, that the thread parses
+    uint_fast64_t range_end;                        ///< End of the chunk (exclusive)
+    enum File_Type file_type;                       ///< Type of the input file
+    enum JSON_Parser_Mode json_parser_mode;         ///< Parser for JSON files
+    enum JSON_Token_Array token_array;              ///< JSON array with the tokens
+    uint_fast32_t first_line_number;                ///< Line number of the first line in the chunk
+    struct Token_List_Container* container;         ///< Own container of the thread
+    uint_fast32_t tokens_found;                     ///< Number of tokens, that the thread found
+};
+
+/**
+ * @brief Create a new Token_List_Container with the default number of empty Token_List objects.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Create_Empty_Container
+(
+        void
+);
+
+/**
+ * @brief Determine the file type of the mapped file and print the result.
+ *
+ * For a compressed file the type will be determined with the begin of the decompressed data.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      file_name != NULL
+ *
+ * @param[in] input_file Mapped_File object
+ * @param[in] decompressed_input Decompressed content of the file (NULL: The file is not compressed)
+ * @param[in] file_name Name of the file (only for the output)
+ *
+ * @return Type of the file
+ */
+static enum File_Type
+Determine_And_Print_File_Type
+(
+        const struct Mapped_File* const restrict input_file,
+        struct Compressed_Input* const restrict decompressed_input,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Copy a line in the line buffer and terminate it. The buffer grows, if the line is too long.
+ *
+ * Asserts:
+ *      line != NULL
+ *      line_buffer != NULL
+ *      line_buffer_length != NULL
+ *      container != NULL
+ *
+ * @param[in] line View of the line
+ * @param[in, out] line_buffer Line buffer (Can be NULL before the first call)
+ * @param[in, out] line_buffer_length Allocated length of the line buffer
+ * @param[in] container Token_List_Container (counts the allocations)
+ */
+static void
+Copy_Line_To_Line_Buffer
+(
+        const struct Line_View* const restrict line,
+        char** const restrict line_buffer,
+        size_t* const restrict line_buffer_length,
+        struct Token_List_Container* const restrict container
+);
+
+/**
+ * @brief Parse all lines in a range of the mapped file and save the tokens in the container.
+ *
+ * Asserts:
+ *      container != NULL
+ *      input_file != NULL
+ *      range_begin <= range_end
+ *
+ * @param[in] container Token_List_Container, that will save the new information
+ * @param[in] input_file Mapped_File object
+ * @param[in] decompressed_input Lines of a compressed file (NULL: The lines will be read from the range of the mapped
+ * file; otherwise the range is only used for the process information)
+ * @param[in] range_begin Begin of the range (needs to be a line begin)
+ * @param[in] range_end End of the range (exclusive)
+ * @param[in] file_type Type of the file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens
+ * @param[in] first_line_number Line number of the first line in the range (For the IDs of the text data sets)
+ * @param[in] print_process Print the process information ?
+ * @param[in] consumer Gets the Token_List objects after every line (NULL: the Token_List objects stay in the
+ * container)
+ * @param[in] consumer_data Data, that will be given to the consumer
+ *
+ * @return Number of tokens, that were found
+ */
+static uint_fast32_t
+Parse_Lines
+(
+        struct Token_List_Container* const restrict container,
+        const struct Mapped_File* const restrict input_file,
+        struct Compressed_Input* const restrict decompressed_input,
+        const uint_fast64_t range_begin,
+        const uint_fast64_t range_end,
+        const enum File_Type file_type,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const uint_fast32_t first_line_number,
+        const _Bool print_process,
+        const Token_List_Consumer consumer,
+        void* const consumer_data
+);
+
+/**
+ * @brief Print the tokens, that were longer than the expected length.
+ *
+ * Asserts:
+ *      new_container != NULL
+ *
+ * @param[in] new_container Token_List_Container object
+ */
+static void
+Print_Too_Long_Tokens
+(
+        const struct Token_List_Container* const new_container
+);
+
+/**
+ * @brief The function of a reader thread: Parse the lines of the given range in the own container.
+ *
+ * @param[in] thread_data Reader_Thread_Data object (as void*)
+ *
+ * @return Always NULL
+ */
+static void*
+Reader_Thread_Function
+(
+        void* thread_data
+);
+
+/**
+ * @brief Concatenate the containers of the reader threads in the given order.
+ *
+ * The Token_List objects will be moved (not copied) in the new container. The used Token_List objects are at the
+ * begin; the unused (but allocated) Token_List objects follow. The containers of the threads will be deleted.
+ *
+ * Asserts:
+ *      thread_data != NULL
+ *      number_of_threads > 0
+ *
+ * @param[in] thread_data Data of the reader threads (with the containers)
+ * @param[in] number_of_threads Number of reader threads
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Concatenate_Containers
+(
+        struct Reader_Thread_Data* const thread_data,
+        const size_t number_of_threads
+);
+
+/**
+ * @brief Create the token list from a file without additional threads.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens
+ * @param[in] consumer Gets the Token_List objects after every line (NULL: the Token_List objects stay in the
+ * container)
+ * @param[in] consumer_data Data, that will be given to the consumer
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Create_Object_With_One_Thread
+(
+        const char* const file_name,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const Token_List_Consumer consumer,
+        void* const consumer_data
+);
+
+/**
+ * @brief Determine the current wall time in seconds. (On systems without clock_gettime() the CPU time will be used)
+ *
+ * @return Wall time in seconds
+ */
+static double
+Get_Wall_Time_In_Seconds
+(
+        void
 );
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -315,248 +678,194 @@ TokenListContainer_CreateObject
     ASSERT_MSG(file_name != NULL, "File name is NULL !");
     ASSERT_MSG(strlen(file_name) > 0, "File name is empty !");
 
-    // Create the (outer) container
-    struct Token_List_Container* new_container =
-            (struct Token_List_Container*) CALLOC(1, sizeof (struct Token_List_Container));
-    ASSERT_ALLOC(new_container, "Cannot create new Token_Container !", 1 * sizeof (struct Token_List_Container));
-    new_container->malloc_calloc_calls ++;
-
-    // Create the inner container
-    new_container->allocated_token_container = TOKEN_CONTAINER_ALLOCATION_STEP_SIZE;
-    new_container->token_lists = (struct Token_List*) CALLOC(new_container->allocated_token_container, sizeof (struct Token_List));
-    ASSERT_ALLOC(new_container->token_lists, "Cannot create new Token objects !", new_container->allocated_token_container *
-            sizeof (struct Token_List));
-    new_container->malloc_calloc_calls ++;
+    return Create_Object_With_One_Thread (file_name, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS, NULL, NULL);
+}
 
-    // Allocate memory for the inner container
-    for (size_t i = 0; i < new_container->allocated_token_container; ++ i)
-    {
-        new_container->token_lists [i].data = (char*) CALLOC(MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE, sizeof (char));
-        ASSERT_ALLOC(new_container->token_lists [i].data, "Cannot create data for a Token object !",
-                MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE);
-        new_container->malloc_calloc_calls ++;
+//---------------------------------------------------------------------------------------------------------------------
 
-        new_container->token_lists [i].char_offsets = (CHAR_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
-        ASSERT_ALLOC(new_container->token_lists [i].char_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
-        new_container->malloc_calloc_calls ++;
+/**
+ * @brief Create the token list from a file with several threads.
+ *
+ * The file will be split at line begins in one chunk per thread. Every thread parses its chunk in a own
+ * Token_List_Container. At the end the containers will be concatenated in the file order. So the order and the IDs of
+ * the data sets are equal with the result of TokenListContainer_CreateObject().
+ *
+ * With one thread the file will be parsed without additional threads.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Number of threads, that parse the file
+ * @param[in] json_parser_mode Parser for JSON files (TokenListContainer_CreateObject() uses the streaming scanner)
+ * @param[in] token_array JSON array with the tokens (TokenListContainer_CreateObject() uses the surface tokens)
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+extern struct Token_List_Container*
+TokenListContainer_CreateObjectParallel
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(strlen(file_name) > 0, "File name is empty !");
+    ASSERT_MSG(number_of_threads > 0, "Number of threads is 0 !");
 
-        new_container->token_lists [i].sentence_offsets = (SENTENCE_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
-        ASSERT_ALLOC(new_container->token_lists [i].sentence_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
-        new_container->malloc_calloc_calls ++;
+    if (number_of_threads == 1)
+    {
+        return Create_Object_With_One_Thread (file_name, json_parser_mode, token_array, NULL, NULL);
+    }
 
-        new_container->token_lists [i].word_offsets = (WORD_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
-        ASSERT_ALLOC(new_container->token_lists [i].word_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
-        new_container->malloc_calloc_calls ++;
+    struct Mapped_File* input_file = MappedFile_CreateObject (file_name);
 
-        // Init new values
-        for (size_t i2 = 0; i2 < TOKENS_ALLOCATION_STEP_SIZE; ++ i2)
+    // The threads need random access to their chunks; a compressed file can only be decompressed from the begin
+    if (CompressedInput_DetectFormat (input_file->data, input_file->size) != COMPRESSION_NONE)
+    {
+        printf ("\"%s\" is compressed; the file will be parsed with one thread\n", file_name);
+        MappedFile_DeleteObject(input_file);
+        input_file = NULL;
+        return Create_Object_With_One_Thread (file_name, json_parser_mode, token_array, NULL, NULL);
+    }
+    const enum File_Type file_type = Determine_And_Print_File_Type (input_file, NULL, file_name);
+
+    // clock() measures the CPU time of all threads; for the throughput the wall time is necessary
+    const double start = Get_Wall_Time_In_Seconds ();
+
+    uint_fast64_t* chunk_begins = (uint_fast64_t*) MALLOC((number_of_threads + 1) * sizeof (uint_fast64_t));
+    ASSERT_ALLOC(chunk_begins, "Cannot allocate memory for the chunk begins !",
+            (number_of_threads + 1) * sizeof (uint_fast64_t));
+    struct Reader_Thread_Data* thread_data = (struct Reader_Thread_Data*) CALLOC(number_of_threads,
+            sizeof (struct Reader_Thread_Data));
+    ASSERT_ALLOC(thread_data, "Cannot allocate memory for the reader thread data !",
+            number_of_threads * sizeof (struct Reader_Thread_Data));
+    pthread_t* threads = (pthread_t*) MALLOC(number_of_threads * sizeof (pthread_t));
+    ASSERT_ALLOC(threads, "Cannot allocate memory for the reader threads !", number_of_threads * sizeof (pthread_t));
+
+    MappedFile_SplitAtLineBegins(input_file, number_of_threads, chunk_begins);
+
+    // The text files get the line number as data set ID; so every thread needs the number of its first line
+    uint_fast64_t first_line_number = 1;
+    for (size_t i = 0; i < number_of_threads; ++ i)
+    {
+        if (i > 0 && file_type == TXT_FILE_TYPE)
         {
-            new_container->token_lists [i].char_offsets [i2] = CHAR_OFFSET_TYPE_MAX;
-            new_container->token_lists [i].sentence_offsets [i2] = SENTENCE_OFFSET_TYPE_MAX;
-            new_container->token_lists [i].word_offsets [i2] = WORD_OFFSET_TYPE_MAX;
+            first_line_number += MappedFile_CountNewlines(input_file, chunk_begins [i - 1], chunk_begins [i]);
         }
 
-        new_container->token_lists [i].max_token_length = MAX_TOKEN_LENGTH;
-        new_container->token_lists [i].allocated_tokens = TOKENS_ALLOCATION_STEP_SIZE;
+        thread_data [i].input_file          = input_file;
+        thread_data [i].range_begin         = chunk_begins [i];
+        thread_data [i].range_end           = chunk_begins [i + 1];
+        thread_data [i].file_type           = file_type;
+        thread_data [i].json_parser_mode    = json_parser_mode;
+        thread_data [i].token_array         = token_array;
+        thread_data [i].first_line_number   = (uint_fast32_t) first_line_number;
+        thread_data [i].container           = Create_Empty_Container ();
+
+        const int pthread_result = pthread_create(&(threads [i]), NULL, Reader_Thread_Function, &(thread_data [i]));
+        ASSERT_FMSG(pthread_result == 0, "Cannot create a reader thread for the file \"%s\": %s", file_name,
+                strerror(pthread_result));
     }
 
-    // Create the container for too long token
-    new_container->list_of_too_long_token = TwoDimCStrArray_CreateObject (10);
-
-    clock_t start       = 0;
-    clock_t end         = 0;
-    float used_seconds  = 0.0f;
+    uint_fast32_t sum_tokens_found = 0;
+    for (size_t i = 0; i < number_of_threads; ++ i)
+    {
+        const int pthread_result = pthread_join(threads [i], NULL);
+        ASSERT_FMSG(pthread_result == 0, "Cannot join a reader thread: %s", strerror(pthread_result));
+        sum_tokens_found += thread_data [i].tokens_found;
+    }
 
-    // Try to open the file
-    FILE* input_file = fopen (file_name, "rb");
-    ASSERT_FMSG(input_file != NULL, "Cannot open the input file: \"%s\" !", file_name);
+    struct Token_List_Container* new_container = Concatenate_Containers (thread_data, number_of_threads);
 
-    // Get file size
-    int fseek_return = fseek (input_file, 0, SEEK_END);
-    ASSERT_MSG(fseek_return == 0, "fseek() returned a nonzero value !");
-    const long int input_file_length = ftell (input_file);
-    ASSERT_MSG(input_file_length != -1, "ftell() returned -1 !");
-    fseek_return = fseek (input_file, 0, SEEK_SET);
-    ASSERT_MSG(fseek_return == 0, "fseek() returned a nonzero value !");
+    Print_Too_Long_Tokens (new_container);
 
-    ASSERT_FMSG(input_file_length > 0, "Input file (%s) has the length 0 !", file_name);
+    const double used_seconds = Get_Wall_Time_In_Seconds () - start;
 
-    char* input_file_data = (char*) CALLOC (((size_t) input_file_length + sizeof ("")), sizeof (char));
-    ASSERT_ALLOC(input_file_data, "Cannot allocate memory for reading the input file !",
-            ((size_t) input_file_length + sizeof ("")) * sizeof (char));
-    new_container->malloc_calloc_calls ++;
+    const float file_size_in_MB = ((float) input_file->size / 1024.0f / 1024.0f);
+    printf ("\n=> %.3f MB in %3.3fs (~ %.3f MB/s) for parsing the whole file with %zu threads (" ANSI_TEXT_BOLD
+            ANSI_TEXT_ITALIC "%" PRIuFAST32 " tokens found" ANSI_RESET_ALL ")\n",
+            file_size_in_MB, used_seconds, file_size_in_MB / used_seconds, number_of_threads, sum_tokens_found);
 
-    // Determine the file type
-    const enum File_Type file_type = Determine_File_Type (input_file);
-    switch (file_type)
-    {
-    case NOT_SPECIFIED_FILE_TYPE:
-        printf("Not specified file type for \"%s\"\n", file_name);
-        break;
-    case JSON_FILE_TYPE:
-        printf("Assume, that \"%s\" is a " ANSI_TEXT_BOLD "JSON file" ANSI_RESET_ALL "\n", file_name);
-        break;
-    case TXT_FILE_TYPE:
-        printf("Assume, that \"%s\" is a " ANSI_TEXT_BOLD "text file" ANSI_RESET_ALL "\n", file_name);
-        break;
-    case UNKNOWN_FILE_TYPE:
-        printf("Cannot determine the file type for \"%s\" !\n", file_name);
-        break;
-    default:
-        ASSERT_MSG(false, "Switch case default path executed !");
-    }
+    FREE_AND_SET_TO_NULL(threads);
+    FREE_AND_SET_TO_NULL(thread_data);
+    FREE_AND_SET_TO_NULL(chunk_begins);
+    MappedFile_DeleteObject(input_file);
+    input_file = NULL;
 
-    uint_fast32_t line_counter              = 0;
-    uint_fast32_t sum_tokens_found          = 0;
-    const uint_fast8_t count_steps          = 200;
-    const size_t unsigned_input_file_length = (size_t) input_file_length;
-    const uint_fast32_t print_steps         = ((unsigned_input_file_length / count_steps) == 0) ?
-            1 : (unsigned_input_file_length / count_steps);
+    return new_container;
+}
 
-    // Read the first line from the file
-    size_t char_read                    = Read_Next_Line (input_file, input_file_data, input_file_length);
-    size_t sum_char_read                = char_read;
-    size_t char_read_before_last_output = 0;
+//---------------------------------------------------------------------------------------------------------------------
 
-    CLOCK_WITH_RETURN_CHECK(start);
-    // ===== ===== ===== ===== ===== BEGIN Read file line by line ===== ===== ===== ===== =====
-    while(char_read > 0)
-    {
-        ++ line_counter;
-        const char* current_parsing_position = input_file_data;
-        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
-        if (file_type == JSON_FILE_TYPE)
-        {
-        while (*current_parsing_position != '\0')
-        {
-            // Parse the file JSON fragment per JSON fragment
-            cJSON* json = cJSON_ParseWithOpts(current_parsing_position, (const char**) &current_parsing_position, false);
-
-            // Print process information
-            char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
-                    sum_char_read, unsigned_input_file_length, true,
-                    Read_File_Process_Print_Function,
-                    NULL,
-                    NULL);
-
-            if (! json)
-            {
-                // Sometimes the json pointer is NULL. But an error only occurs, when an error message is available
-                //if (strlen (cJSON_GetErrorPtr()) > 0)
-                if (! IS_STRING_LENGTH_ZERO(cJSON_GetErrorPtr()))
-                {
-                    printf("Error before: [%s] %" PRIuFAST32 ": %ld\n", cJSON_GetErrorPtr(), line_counter,
-                            (long int) (current_parsing_position - input_file_data));
-                }
-                break;
-            }
-            cJSON* curr = json->child;
-
-            // ===== ===== ===== BEGIN Use current cJSON object ===== ===== =====
-            while (curr != NULL)
-            {
-                // Extract the information from the current cJSON object
-                sum_tokens_found += Use_Current_JSON_Fragment(json, curr, new_container);
-                curr = curr->next;
-            }
-            // ===== ===== ===== BEGIN Use current cJSON object ===== ===== =====
-
-            cJSON_Delete(json);
-            json = NULL;
-        }
-        }
-        else if (file_type == TXT_FILE_TYPE)
-        {
-            // Add explicit a delimiter at the end of the input data to avoid problems with the last token
-            // The tokenize function go one char behind the last token and - when there is no extra char - the function
-            // determines a '\0' and stop working. The result: the last token will be skipped
-            // But this modification is only possible, when the input array has at least one char left
-            ASSERT_FMSG((char_read + 1) < unsigned_input_file_length,
-                    "Cannot prepare data for the tokenization ! The array needs to be at least %zu large; current length: %zu",
-                    (char_read + 1) + 1, unsigned_input_file_length)
-            input_file_data [char_read] = ' ';
-            input_file_data [char_read + 1] = '\0';
-            const struct Tokenized_String tokenized_string = Tokenize_String(input_file_data, " \t\n\r");
-
-            // Print process information
-            char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
-                    sum_char_read, unsigned_input_file_length, true,
-                    Read_File_Process_Print_Function,
-                    NULL,
-                    NULL);
-
-            if (input_file_length > 0 && tokenized_string.next_free_pos_len == 0)
-            {
-                printf ("Error in the line %" PRIuFAST32 "\n", line_counter);
-                continue; // while (*current_parsing_position != '\0')
-            }
-
-            if (tokenized_string.next_free_pos_len > 0)
-            {
-                sum_tokens_found +=
-                        Use_Current_Text_Fragment(input_file_data, unsigned_input_file_length, line_counter,
-                                &tokenized_string, new_container);
-            }
-        }
-        else
-        {
-            ASSERT_MSG(false,
-                    "Else path in the line parsing executed ! (No code for parsing the current file format available)");
-        }
-        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
+/**
+ * @brief Read a file and give every Token_List object to a consumer instead of collecting them in a container.
+ *
+ * With one thread the Token_List objects of a line will be given to the consumer directly after the line was parsed;
+ * afterwards the memory will be reused for the next line. So the tokens of the whole file are never in the memory at
+ * the same time. With several threads the chunks will be parsed in parallel (See
+ * TokenListContainer_CreateObjectParallel()) and the consumer gets the Token_List objects after the parsing.
+ *
+ * In both cases the consumer gets the Token_List objects in the file order. Token_List objects without tokens will
+ * also be given to the consumer.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *      consumer != NULL
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Number of threads, that parse the file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens
+ * @param[in] consumer Function, that gets every Token_List object
+ * @param[in] consumer_data Data, that will be given to the consumer
+ *
+ * @return List of the too long tokens (The caller is responsible for the deletion)
+ */
+extern struct Two_Dim_C_String_Array*
+TokenListContainer_StreamFile
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const Token_List_Consumer consumer,
+        void* const consumer_data
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(strlen(file_name) > 0, "File name is empty !");
+    ASSERT_MSG(number_of_threads > 0, "Number of threads is 0 !");
+    ASSERT_MSG(consumer != NULL, "Token_List_Consumer is NULL !");
 
-        // Read next line
-        char_read                       = Read_Next_Line (input_file, input_file_data, input_file_length);
-        sum_char_read                   += char_read;
-        char_read_before_last_output    += char_read;
-        //fgets_res = fgets(input_file_data, (int) input_file_length, input_file);
-        //input_file_data [input_file_length] = '\0';
+    struct Token_List_Container* container = NULL;
+    if (number_of_threads == 1)
+    {
+        // The Token_List objects were already given to the consumer line by line
+        container = Create_Object_With_One_Thread (file_name, json_parser_mode, token_array, consumer, consumer_data);
     }
-    // ===== ===== ===== ===== ===== END Read file line by line ===== ===== ===== ===== =====
-
-    // Print tokens, that was longer than the expected length
-    if (new_container->list_of_too_long_token->next_free_c_str > 0)
+    else
     {
-        printf("\n\nTokens, that are longer than expected (max. expected length: %d):\n", MAX_TOKEN_LENGTH - 1);
-        if (new_container->list_of_too_long_token->next_free_c_str <= 50)
-        {
-            TwoDimCStrArray_PrintAllStrings(new_container->list_of_too_long_token);
-        }
-        else
+        container = TokenListContainer_CreateObjectParallel (file_name, number_of_threads, json_parser_mode,
+                token_array);
+        for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
         {
-            const uint_fast32_t next_free_c_str = new_container->list_of_too_long_token->next_free_c_str;
-            const int num_of_digits             = (int) Count_Number_Of_Digits(next_free_c_str);
-            const uint_fast32_t print_range     = 15;
-
-            // Print the first and the last 15 tokens
-            for (uint_fast32_t i = 0; i < print_range; ++ i)
-            {
-                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_too_long_token->data [i]);
-            }
-            PRINT_X_TIMES_SAME_CHAR(' ', num_of_digits + 2);
-            puts("...");
-            for (uint_fast32_t i = (next_free_c_str - print_range); i < next_free_c_str; ++ i)
-            {
-                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_too_long_token->data [i]);
-            }
+            consumer(&(container->token_lists [i]), consumer_data);
         }
     }
 
-    CLOCK_WITH_RETURN_CHECK(end);
-    used_seconds = DETERMINE_USED_TIME(start, end);
-
-    const float file_size_in_MB = ((float) input_file_length / 1024.0f / 1024.0f);
-    printf ("\n=> %.3f MB in %3.3fs (~ %.3f MB/s) for parsing the whole file (" ANSI_TEXT_BOLD ANSI_TEXT_ITALIC
-            "%" PRIuFAST32 " tokens found" ANSI_RESET_ALL ")\n",
-            file_size_in_MB, used_seconds, file_size_in_MB / used_seconds, sum_tokens_found);
+    struct Two_Dim_C_String_Array* too_long_tokens = container->list_of_too_long_token;
+    container->list_of_too_long_token = NULL;
+    TokenListContainer_DeleteObject(container);
+    container = NULL;
 
-    FCLOSE_AND_SET_TO_NULL(input_file);
-    FREE_AND_SET_TO_NULL(input_file_data);
-
-    return new_container;
+    return too_long_tokens;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -577,15 +886,26 @@ TokenListContainer_DeleteObject
 {
     ASSERT_MSG(object != NULL, "Token_List_Container is NULL !");
 
-    TwoDimCStrArray_DeleteObject (object->list_of_too_long_token);
-    object->list_of_too_long_token = NULL;
+    // The list of the too long tokens can be detached from the container (See TokenListContainer_StreamFile())
+    if (object->list_of_too_long_token != NULL)
+    {
+        TwoDimCStrArray_DeleteObject (object->list_of_too_long_token);
+        object->list_of_too_long_token = NULL;
+    }
 
     if (object->token_lists != NULL)
     {
         // Delete from inner to the outer objects
         for (size_t i = 0; i < object->allocated_token_container; ++ i)
         {
+            // Token_List objects, that were never used, have no memory for tokens
+            if (object->token_lists [i].data == NULL) { continue; }
+
             FREE_AND_SET_TO_NULL(object->token_lists [i].data);
+            if (object->token_lists [i].surface_data != NULL)
+            {
+                FREE_AND_SET_TO_NULL(object->token_lists [i].surface_data);
+            }
             FREE_AND_SET_TO_NULL(object->token_lists [i].char_offsets);
             FREE_AND_SET_TO_NULL(object->token_lists [i].sentence_offsets);
             FREE_AND_SET_TO_NULL(object->token_lists [i].word_offsets);
@@ -666,6 +986,10 @@ TokenListContainer_GetAllocatedMemSize
     for (size_t i = 0; i < container->allocated_token_container; ++ i)
     {
         result += (container->token_lists [i].allocated_tokens * max_token_size);
+        if (container->token_lists [i].surface_data != NULL)
+        {
+            result += (container->token_lists [i].allocated_tokens * max_token_size);
+        }
         result += (container->token_lists [i].allocated_tokens * sizeof (CHAR_OFFSET_TYPE));
     }
 
@@ -1019,6 +1343,63 @@ TokenListContainer_ShowAttributes
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Read a specific token from a Token_List.
+ *
+ * Asserts:
+ *      token_list != NULL
+ *      index_token < token_list->next_free_element
+ *
+ * @param[in] token_list Token_List object
+ * @param[in] index_token Index of the token in the Token_List object
+ *
+ * @return Pointer at the begin of the token. (token is terminated with a null byte !)
+ */
+extern const char*
+TokenList_GetToken
+(
+        const struct Token_List* const token_list,
+        const uint_fast32_t index_token
+)
+{
+    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    ASSERT_FMSG(index_token < token_list->next_free_element, "Token index is invalid ! Max. valid: %" PRIuFAST32
+            "; Got: %" PRIuFAST32 " !", token_list->next_free_element - 1, index_token);
+
+    return token_list->data + (token_list->max_token_length * index_token);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read the surface form of a specific token from a Token_List. Without a lemma it is the token itself.
+ *
+ * Asserts:
+ *      token_list != NULL
+ *      index_token < token_list->next_free_element
+ *
+ * @param[in] token_list Token_List object
+ * @param[in] index_token Index of the token in the Token_List object
+ *
+ * @return Pointer at the begin of the surface form. (token is terminated with a null byte !)
+ */
+extern const char*
+TokenList_GetSurfaceToken
+(
+        const struct Token_List* const token_list,
+        const uint_fast32_t index_token
+)
+{
+    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    ASSERT_FMSG(index_token < token_list->next_free_element, "Token index is invalid ! Max. valid: %" PRIuFAST32
+            "; Got: %" PRIuFAST32 " !", token_list->next_free_element - 1, index_token);
+
+    const char* const token_memory = (token_list->surface_data != NULL) ? token_list->surface_data : token_list->data;
+    return token_memory + (token_list->max_token_length * index_token);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Add a tuple with the three offsets to a Token_List.
  *
@@ -1144,9 +1525,10 @@ Get_Average_Token_Length
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Increase the number of Token_List objects in a Token_List_Container.
+ * @brief Double the number of Token_List objects in a Token_List_Container.
  *
- * The default allocation step size (TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) will be used.
+ * The new Token_List objects are empty: the memory for the tokens will be allocated with the first token (See
+ * Reserve_Tokens()).
  *
  * Asserts:
  *      token_list_container != NULL
@@ -1161,56 +1543,25 @@ Increase_Number_Of_Token_Lists
 {
     ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
 
-    static size_t token_container_realloc_counter = 0;
-    ++ token_container_realloc_counter;
     const size_t old_allocated_token_container = token_list_container->allocated_token_container;
+    const size_t new_allocated_token_container =
+            MAX(old_allocated_token_container * 2, (size_t) TOKEN_CONTAINER_ALLOCATION_STEP_SIZE);
 
     // Adjust the number of Token_List object
     struct Token_List* temp_ptr = (struct Token_List*) REALLOC(token_list_container->token_lists,
-            (old_allocated_token_container + TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) * sizeof (struct Token_List));
+            new_allocated_token_container * sizeof (struct Token_List));
     ASSERT_ALLOC(temp_ptr, "Cannot reallocate memory for Token_Container objects !",
-            (old_allocated_token_container + TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) * sizeof (struct Token_List));
-    memset(temp_ptr + old_allocated_token_container, '\0', sizeof (struct Token_List) * TOKEN_CONTAINER_ALLOCATION_STEP_SIZE);
+            new_allocated_token_container * sizeof (struct Token_List));
+    memset(temp_ptr + old_allocated_token_container, '\0',
+            sizeof (struct Token_List) * (new_allocated_token_container - old_allocated_token_container));
     token_list_container->realloc_calls ++;
 
     token_list_container->token_lists = temp_ptr;
-    token_list_container->allocated_token_container = old_allocated_token_container + TOKEN_CONTAINER_ALLOCATION_STEP_SIZE;
-
-    // Create memory for the new Token_List objects
-    for (size_t i = old_allocated_token_container; i < token_list_container->allocated_token_container; ++ i)
-    {
-        token_list_container->token_lists [i].data = (char*) CALLOC(MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE, sizeof (char));
-        ASSERT_ALLOC(token_list_container->token_lists [i].data, "Cannot create data for a Token object !",
-                MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE * sizeof (char));
-        token_list_container->malloc_calloc_calls ++;
-
-        token_list_container->token_lists [i].char_offsets =
-                (CHAR_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
-        ASSERT_ALLOC(token_list_container->token_lists [i].char_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
-        token_list_container->malloc_calloc_calls ++;
-
-        token_list_container->token_lists [i].sentence_offsets =
-                (SENTENCE_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
-        ASSERT_ALLOC(token_list_container->token_lists [i].sentence_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
-
-        token_list_container->token_lists [i].word_offsets =
-                        (WORD_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
-        ASSERT_ALLOC(token_list_container->token_lists [i].word_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
-
-        token_list_container->malloc_calloc_calls ++;
-        // Init new values
-        for (size_t i2 = 0; i2 < TOKENS_ALLOCATION_STEP_SIZE; ++ i2)
-        {
-            token_list_container->token_lists [i].char_offsets [i2] = CHAR_OFFSET_TYPE_MAX;
-            token_list_container->token_lists [i].sentence_offsets [i2] = SENTENCE_OFFSET_TYPE_MAX;
-            token_list_container->token_lists [i].word_offsets [i2] = WORD_OFFSET_TYPE_MAX;
-        }
+    token_list_container->allocated_token_container = new_allocated_token_container;
 
+    for (size_t i = old_allocated_token_container; i < new_allocated_token_container; ++ i)
+    {
         token_list_container->token_lists [i].max_token_length = MAX_TOKEN_LENGTH;
-        token_list_container->token_lists [i].allocated_tokens = TOKENS_ALLOCATION_STEP_SIZE;
     }
 
     return;
@@ -1219,63 +1570,84 @@ Increase_Number_Of_Token_Lists
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Increase the number of tokens in a Token_List object.
+ * @brief Resize the memory of a Token_List object to the given number of tokens.
  *
- * The default allocation step size (TOKENS_ALLOCATION_STEP_SIZE) will be used.
+ * The reallocations will be counted in the container.
  *
  * Asserts:
+ *      token_list_container != NULL
  *      token_list != NULL
+ *      new_allocated_tokens > token_list->allocated_tokens
  *
+ * @param[in] token_list_container Token_List_Container object, that holds the Token_List
  * @param[in] token_list Token_List object
+ * @param[in] new_allocated_tokens New number of tokens
  */
 static void
 Increase_Number_Of_Tokens
 (
-        struct Token_List* const token_list
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list,
+        const size_t new_allocated_tokens
 )
 {
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
     ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    ASSERT_FMSG(new_allocated_tokens > token_list->allocated_tokens, "The new size (%zu) of the Token_List is not "
+            "larger than the old size (%zu) !", new_allocated_tokens, token_list->allocated_tokens);
 
-    static size_t tokens_realloc_counter = 0;
-    ++ tokens_realloc_counter;
     const size_t old_tokens_size    = token_list->allocated_tokens;
     const size_t token_size         = token_list->max_token_length;
 
-    char* tmp_ptr = (char*) REALLOC(token_list->data,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * token_size);
-    ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for Tokens data !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * token_size);
-    memset(tmp_ptr + (old_tokens_size * token_size), '\0',
-            (TOKENS_ALLOCATION_STEP_SIZE) * token_size);
+    // The token memory needs no initialization: every token will be written with the full token size
+    char* tmp_ptr = (char*) REALLOC(token_list->data, new_allocated_tokens * token_size);
+    ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for Tokens data !", new_allocated_tokens * token_size);
 
     CHAR_OFFSET_TYPE* tmp_ptr2 = (CHAR_OFFSET_TYPE*) REALLOC (token_list->char_offsets,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (CHAR_OFFSET_TYPE));
-    ASSERT_ALLOC(tmp_ptr2, "Cannot create data for a Token object !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (CHAR_OFFSET_TYPE));
+            new_allocated_tokens * sizeof (CHAR_OFFSET_TYPE));
+    ASSERT_ALLOC(tmp_ptr2, "Cannot create data for a Token object !", new_allocated_tokens * sizeof (CHAR_OFFSET_TYPE));
 
     SENTENCE_OFFSET_TYPE* tmp_ptr3 = (SENTENCE_OFFSET_TYPE*) REALLOC (token_list->sentence_offsets,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (SENTENCE_OFFSET_TYPE));
-    ASSERT_ALLOC(tmp_ptr2, "Cannot create data for a Token object !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (SENTENCE_OFFSET_TYPE));
+            new_allocated_tokens * sizeof (SENTENCE_OFFSET_TYPE));
+    ASSERT_ALLOC(tmp_ptr3, "Cannot create data for a Token object !",
+            new_allocated_tokens * sizeof (SENTENCE_OFFSET_TYPE));
 
     WORD_OFFSET_TYPE* tmp_ptr4 = (WORD_OFFSET_TYPE*) REALLOC (token_list->word_offsets,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (WORD_OFFSET_TYPE));
-    ASSERT_ALLOC(tmp_ptr4, "Cannot create data for a Token object !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (WORD_OFFSET_TYPE))
+            new_allocated_tokens * sizeof (WORD_OFFSET_TYPE));
+    ASSERT_ALLOC(tmp_ptr4, "Cannot create data for a Token object !", new_allocated_tokens * sizeof (WORD_OFFSET_TYPE))
+
+    // The surface forms exist only after the first lemma (See Set_Surface_Of_Next_Token())
+    if (token_list->surface_data != NULL)
+    {
+        char* tmp_ptr5 = (char*) REALLOC(token_list->surface_data, new_allocated_tokens * token_size);
+        ASSERT_ALLOC(tmp_ptr5, "Cannot reallocate memory for the surface tokens !", new_allocated_tokens * token_size);
+        token_list->surface_data = tmp_ptr5;
+        token_list_container->realloc_calls ++;
+    }
 
     // Init new values
-    for (size_t i2 = old_tokens_size; i2 < (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE); ++ i2)
+    for (size_t i2 = old_tokens_size; i2 < new_allocated_tokens; ++ i2)
     {
         tmp_ptr2 [i2] = CHAR_OFFSET_TYPE_MAX;
         tmp_ptr3 [i2] = SENTENCE_OFFSET_TYPE_MAX;
         tmp_ptr4 [i2] = WORD_OFFSET_TYPE_MAX;
     }
 
+    // The first allocation of a list is no reallocation
+    if (token_list->data == NULL)
+    {
+        token_list_container->malloc_calloc_calls += 4;
+    }
+    else
+    {
+        token_list_container->realloc_calls += 4;
+    }
+
     token_list->data                = tmp_ptr;
     token_list->char_offsets        = tmp_ptr2;
     token_list->sentence_offsets    = tmp_ptr3;
     token_list->word_offsets        = tmp_ptr4;
-    token_list->allocated_tokens    += TOKENS_ALLOCATION_STEP_SIZE;
+    token_list->allocated_tokens    = new_allocated_tokens;
 
     return;
 }
@@ -1283,45 +1655,37 @@ Increase_Number_Of_Tokens
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Read the next line from the file and return the number of char, that were read.
+ * @brief Make sure, that a Token_List can hold the given number of tokens without a further reallocation.
  *
- * Asserts:
- *      input_file != NULL
- *      input_file_data != NULL
- *      input_file_data_length > 0
+ * If the number of tokens of a data set is known before the tokens are appended, the list will be allocated only once
+ * with the exact size.
  *
- * @param[in] input_file Input file pointer
- * @param[in] input_file_data Buffer for the new input file data
- * @param[in] input_file_data_length Length of the input file buffer
+ * Asserts:
+ *      token_list_container != NULL
+ *      token_list != NULL
  *
- * @return Number of char, that were read
+ * @param[in] token_list_container Token_List_Container object, that holds the Token_List
+ * @param[in] token_list Token_List object
+ * @param[in] number_of_tokens Number of tokens, that will be appended
  */
-static size_t
-Read_Next_Line
+static void
+Reserve_Tokens
 (
-        FILE* restrict input_file,
-        char* const restrict input_file_data,
-        const long int input_file_data_length
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list,
+        const size_t number_of_tokens
 )
 {
-    ASSERT_MSG(input_file != NULL, "FILE is NULL !");
-    ASSERT_MSG(input_file_data != NULL, "Input file data is NULL !");
-    ASSERT_MSG(input_file_data_length > 0, "Input file data length is zero !");
-
-    size_t char_read = 0;
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
 
-    for (int c = getc(input_file); c != EOF; c = getc(input_file), ++ char_read)
+    const size_t necessary_tokens = token_list->next_free_element + number_of_tokens;
+    if (necessary_tokens > token_list->allocated_tokens)
     {
-        if (c == '\n')
-        {
-            input_file_data [char_read] = '\0';
-            input_file_data [input_file_data_length] = '\0';
-            break;
-        }
-        input_file_data [char_read] = (char) c;
+        Increase_Number_Of_Tokens(token_list_container, token_list, necessary_tokens);
     }
 
-    return char_read;
+    return;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1377,6 +1741,7 @@ Read_File_Process_Print_Function
  *
  * @param[in] main_json Main cJSON object (It holds the object, that works direct with the source file)
  * @param[in] curr The current cJSON object
+ * @param[in] token_array JSON array, whose strings will be saved as tokens
  * @param[in] new_container The new container, that will save the new information
  *
  * @return Number of tokens, that were found (This value can be 0)
@@ -1386,6 +1751,7 @@ Use_Current_JSON_Fragment
 (
         const cJSON* const main_json,
         const cJSON* const curr,
+        const enum JSON_Token_Array token_array,
         struct Token_List_Container* const new_container
 )
 {
@@ -1411,6 +1777,14 @@ Use_Current_JSON_Fragment
     register const cJSON* curr_char_offset = NULL;
     if (char_offsets_array != NULL) { curr_char_offset = char_offsets_array->child; }
 
+    // The lemma array will be used in parallel with the tokens array; like the char offsets
+    const cJSON* curr_lemma = NULL;
+    if (token_array == JSON_TOKEN_ARRAY_LEMMA)
+    {
+        const cJSON* const lemma_array = cJSON_GetObjectItemCaseSensitive(name, JSON_LEMMA_ARRAY_NAME);
+        if (cJSON_IsArray(lemma_array)) { curr_lemma = lemma_array->child; }
+    }
+
 
     // Realloc necessary ?
     // Is it necessary to realloc/increase the number of Token_List objects in the container ?
@@ -1426,93 +1800,40 @@ Use_Current_JSON_Fragment
 
 
     struct Token_List* const current_token_list_obj = &(new_container->token_lists [new_container->next_free_element]);
+    // The number of elements in the array is known; so the list can be allocated with the exact size
+    Reserve_Tokens(new_container, current_token_list_obj, (size_t) cJSON_GetArraySize(tokens_array));
 
     // ===== ===== ===== BEGIN Go though the full chained list (the tokens array in the JSON file) ===== ===== =====
     while (curr_token != NULL)
     {
         if (! curr_token->valuestring) { curr_token = curr_token->next; continue; }
 
-        // Is more memory for the new token in the Token_List necessary ?
-        if (current_token_list_obj->next_free_element >= current_token_list_obj->allocated_tokens)
-        {
-            Increase_Number_Of_Tokens (current_token_list_obj);
-
-            // Adjust the number of reallocs in the upper container
-            new_container->realloc_calls += 3;
-        }
-
-        char* res_mem_for_curr_token = Get_Address_Of_Next_Free_Token (current_token_list_obj);
-
-        const size_t current_token_len = strlen (curr_token->valuestring);
-
-        // Copy token to the current Token_List
-        strncpy(res_mem_for_curr_token, curr_token->valuestring, current_token_list_obj->max_token_length - 1);
-
-        // Save the full token, if it is too long
-        if (current_token_len > (current_token_list_obj->max_token_length - 1))
-        {
-            TwoDimCStrArray_AppendNewString
-            (
-                    new_container->list_of_too_long_token,
-                    curr_token->valuestring,
-                    current_token_len
-            );
-        }
-
-        // Adjust the next offset value
-        // Zero for the fist element
-        if (current_token_list_obj->next_free_element == 0)
+        const size_t token_length = strlen (curr_token->valuestring);
+        if (curr_lemma != NULL && cJSON_IsString(curr_lemma))
         {
-            TokenList_SetOffsets(current_token_list_obj, 0, 0, 0, 0);
+            Set_Surface_Of_Next_Token(new_container, current_token_list_obj, curr_token->valuestring, token_length);
+            Append_Token_To_Token_List(new_container, current_token_list_obj, curr_lemma->valuestring,
+                    strlen (curr_lemma->valuestring), curr_char_offset != NULL,
+                    (curr_char_offset != NULL) ? curr_char_offset->valueint : 0,
+                    u8_strnlen(curr_token->valuestring, token_length));
         }
         else
         {
-            const char* last_token =
-                    Get_Address_Of_Token (current_token_list_obj, current_token_list_obj->next_free_element - 1);
-            // VVV This is the old way without notifying UTF8 char VVV
-            // const size_t last_token_length = strlen(last_token);
-            const size_t last_token_length = (size_t) u8_strlen((char*) last_token);
-
-            size_t new_char_offset = 0;
-            if (curr_char_offset != NULL)
-            {
-                new_char_offset = (size_t) curr_char_offset->valueint;
-            }
-            else
-            {
-                new_char_offset = current_token_list_obj->char_offsets [current_token_list_obj->next_free_element - 1] +
-                        last_token_length;
-
-                // Don't forget, that the char offsets in original data includes the blanks between the tokens !
-                // Example from test_ebm_formatted.json:
-                /* "tokens":            [ "[", "The", "chemotherapy", "of", ... ] */
-                /* abs_char_offsets":   [ 0, 2, 6, 19, ... ] */
-                /* => */ new_char_offset ++;
-            }
-
-            const size_t new_sentence_offset =
-                    current_token_list_obj->sentence_offsets [current_token_list_obj->next_free_element - 1] +
-                    (last_token [0] == '.' && (IS_STRING_LENGTH_ONE(last_token))) ? 1 : 0;
-            const size_t new_word_offset = (size_t)
-                    current_token_list_obj->word_offsets [current_token_list_obj->next_free_element - 1] + 1;
-
-            CAST_CHECK(new_char_offset, size_t, CHAR_OFFSET_TYPE);
-
-            TokenList_SetOffsets(current_token_list_obj, current_token_list_obj->next_free_element,
-                    (CHAR_OFFSET_TYPE) new_char_offset, (SENTENCE_OFFSET_TYPE) new_sentence_offset, (WORD_OFFSET_TYPE) new_word_offset);
+            Append_Token_To_Token_List(new_container, current_token_list_obj, curr_token->valuestring,
+                    token_length, curr_char_offset != NULL,
+                    (curr_char_offset != NULL) ? curr_char_offset->valueint : 0, SIZE_MAX);
         }
-
-        current_token_list_obj->next_free_element ++;
         tokens_found ++;
 
-        // Is the current token longer than the previous tokens ?
-        new_container->longest_token_length = MAX(new_container->longest_token_length, current_token_len);
-
         curr_token = curr_token->next;
         if (curr_char_offset != NULL)
         {
             curr_char_offset = curr_char_offset->next;
         }
+        if (curr_lemma != NULL)
+        {
+            curr_lemma = curr_lemma->next;
+        }
     }
     // ===== ===== ===== END Go though the full chained list (the tokens array in the JSON file) ===== ===== =====
 
@@ -1534,10 +1855,10 @@ Use_Current_JSON_Fragment
  * Asserts:
  *      N/A
  *
- * @param[in] curr_text Content of the current text line
+ * @param[in] curr_text Content of the current text line (not necessarily null terminated)
  * @param[in] curr_text_len Length of the current text line
  * @param[in] curr_line_num Current line number or UINT_FAST32_MAX, if this variable is unused
- * @param[in] tokenize_data Already calculated tokenize data
+ * @param[in] tokenize_data Positions of the tokens in the current text line (See Tokenize_String_Into_Buffer())
  * @param[in] new_container The new container, that will save the new information
  *
  * @return Number of tokens, that were found (This value can be 0 !)
@@ -1545,10 +1866,10 @@ Use_Current_JSON_Fragment
 static uint_fast32_t
 Use_Current_Text_Fragment
 (
-        char* const curr_text,
+        const char* const curr_text,
         const size_t curr_text_len,
         const uint_fast32_t curr_line_num,
-        const struct Tokenized_String* const tokenize_data,
+        const struct Token_Position_Buffer* const tokenize_data,
         struct Token_List_Container* const new_container
 )
 {
@@ -1575,138 +1896,1185 @@ Use_Current_Text_Fragment
     }
 
     struct Token_List* const current_token_list_obj = &(new_container->token_lists [new_container->next_free_element]);
+    Reserve_Tokens(new_container, current_token_list_obj, tokenize_data->next_free_element);
 
     // ===== ===== ===== BEGIN Use all tokens in the current text line ===== ===== =====
-    for (uint_fast32_t i = 0; i < tokenize_data->next_free_pos_len; ++ i)
+    for (size_t i = 0; i < tokenize_data->next_free_element; ++ i)
     {
-        // Skip empty tokens
-        if (tokenize_data->token_data [i].len == 0) { continue; }
-
-        ASSERT_FMSG((size_t) (tokenize_data->token_data[i].pos + tokenize_data->token_data[i].len) <= curr_text_len,
+        ASSERT_FMSG(tokenize_data->data [i].pos + tokenize_data->data [i].len <= curr_text_len,
                 "Invalid tokenize data found ! Length needs to be at least %zu; but a text with %zu is given !",
-                (size_t) (tokenize_data->token_data[i].pos + tokenize_data->token_data[i].len), curr_text_len);
+                tokenize_data->data [i].pos + tokenize_data->data [i].len, curr_text_len);
 
-        // Is more memory for the new token in the Token_List necessary ?
-        if (current_token_list_obj->next_free_element >= current_token_list_obj->allocated_tokens)
-        {
-            Increase_Number_Of_Tokens (current_token_list_obj);
+        // The token will be copied with its length; so the text line needs no terminator
+        Append_Token_To_Token_List(new_container, current_token_list_obj, curr_text + tokenize_data->data [i].pos,
+                tokenize_data->data [i].len, false, 0, SIZE_MAX);
+        tokens_found ++;
+    }
+    // ===== ===== ===== END Use all tokens in the current text line ===== ===== =====
 
-            // Adjust the number of reallocs in the upper container
-            new_container->realloc_calls += 3;
-        }
+    // Use next element in the container
+    new_container->next_free_element ++;
+
+    return tokens_found;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append a token to a Token_List and determine the char, sentence and word offset of it.
+ *
+ * The token does not need a null terminator; only the given length will be used.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] new_container The container, that holds the Token_List (For the too long tokens and the counters)
+ * @param[in] current_token_list_obj The Token_List, that gets the new token
+ * @param[in] token Begin of the token
+ * @param[in] token_length Length of the token in bytes
+ * @param[in] char_offset_available Is a char offset from the input file available ?
+ * @param[in] char_offset Char offset from the input file (Only used, if char_offset_available is true)
+ * @param[in] surface_token_chars Length of the surface form in UTF-8 chars, if the token is a lemma (SIZE_MAX: the
+ * token is the surface form)
+ */
+static void
+Append_Token_To_Token_List
+(
+        struct Token_List_Container* const new_container,
+        struct Token_List* const current_token_list_obj,
+        const char* const token,
+        const size_t token_length,
+        const _Bool char_offset_available,
+        const int char_offset,
+        const size_t surface_token_chars
+)
+{
+    // Is more memory for the new token in the Token_List necessary ? (Only, if the number of tokens was not known)
+    if (current_token_list_obj->next_free_element >= current_token_list_obj->allocated_tokens)
+    {
+        Increase_Number_Of_Tokens (new_container, current_token_list_obj,
+                MAX(current_token_list_obj->allocated_tokens * 2, TOKENS_ALLOCATION_STEP_SIZE));
+    }
 
-        char* const res_mem_for_curr_token = Get_Address_Of_Next_Free_Token (current_token_list_obj);
+    char* res_mem_for_curr_token = Get_Address_Of_Next_Free_Token (current_token_list_obj);
 
-        const size_t curr_token_len = (size_t) tokenize_data->token_data [i].len;
-        char* const token_begin = &(curr_text [tokenize_data->token_data [i].pos]);
+    // Copy token to the current Token_List (The rest of the token memory will be filled with null bytes - like strncpy)
+    // The new token memory is not initialized; so the terminator at the end of the token memory will be set, too
+    const size_t copy_length = MIN(token_length, current_token_list_obj->max_token_length - 1);
+    memcpy(res_mem_for_curr_token, token, copy_length);
+    memset(res_mem_for_curr_token + copy_length, '\0', current_token_list_obj->max_token_length - copy_length);
 
-        // Temporary override end char of the current token to make the char range null terminated
-        const char saved_char = *(token_begin + curr_token_len);
-        *(token_begin + curr_token_len) = '\0';
+    // A token without lemma is its own surface form (The surface form of a lemma was set before)
+    if (current_token_list_obj->surface_data != NULL && surface_token_chars == SIZE_MAX)
+    {
+        memcpy(current_token_list_obj->surface_data +
+                (current_token_list_obj->max_token_length * current_token_list_obj->next_free_element),
+                res_mem_for_curr_token, current_token_list_obj->max_token_length);
+    }
 
-        // Copy token to the current Token_List
-        strncpy(res_mem_for_curr_token, token_begin, current_token_list_obj->max_token_length - 1);
+    // Save the full token, if it is too long
+    if (token_length > (current_token_list_obj->max_token_length - 1))
+    {
+        TwoDimCStrArray_AppendNewString
+        (
+                new_container->list_of_too_long_token,
+                token,
+                token_length
+        );
+    }
 
-        // Save the full token, if it is too long
-        if (curr_token_len > (current_token_list_obj->max_token_length - 1))
-        {
-            TwoDimCStrArray_AppendNewString
-            (
-                    new_container->list_of_too_long_token,
-                    token_begin,
-                    curr_token_len
-            );
-        }
+    // Adjust the next offset value
+    // Zero for the fist element
+    if (current_token_list_obj->next_free_element == 0)
+    {
+        TokenList_SetOffsets(current_token_list_obj, 0, 0, 0, 0);
+    }
+    else
+    {
+        const char* last_token =
+                Get_Address_Of_Token (current_token_list_obj, current_token_list_obj->next_free_element - 1);
 
-        if (current_token_list_obj->next_free_element == 0)
+        size_t new_char_offset = 0;
+        if (char_offset_available)
         {
-            TokenList_SetOffsets(current_token_list_obj, 0, 0, 0, 0);
+            new_char_offset = (size_t) char_offset;
         }
         else
         {
-            const char* last_token =
-                    Get_Address_Of_Token (current_token_list_obj, current_token_list_obj->next_free_element - 1);
-            // VVV This is the old way without notifying UTF8 char VVV
-            // const size_t last_token_length = strlen(last_token);
-            const size_t last_token_length = (size_t) u8_strlen((char*) last_token);
-
-            size_t new_char_offset = current_token_list_obj->char_offsets [current_token_list_obj->next_free_element - 1] +
-                    last_token_length;
+            // The chars of the last token will be counted only here; its byte length is known since the append
+            // A lemma was counted already in its surface form, because the offsets belong to the surface text
+            new_char_offset = current_token_list_obj->char_offsets [current_token_list_obj->next_free_element - 1] +
+                    ((current_token_list_obj->last_token_chars != SIZE_MAX) ? current_token_list_obj->last_token_chars :
+                    u8_strnlen(last_token, current_token_list_obj->last_token_length));
 
             // Don't forget, that the char offsets in original data includes the blanks between the tokens !
             // Example from test_ebm_formatted.json:
             /* "tokens":            [ "[", "The", "chemotherapy", "of", ... ] */
             /* abs_char_offsets":   [ 0, 2, 6, 19, ... ] */
             /* => */ new_char_offset ++;
+        }
 
-            const size_t new_sentence_offset =
-                    current_token_list_obj->sentence_offsets [current_token_list_obj->next_free_element - 1] +
-                    (last_token [0] == '.' && (IS_STRING_LENGTH_ONE(last_token))) ? 1 : 0;
-            const size_t new_word_offset = (size_t)
-                    current_token_list_obj->word_offsets [current_token_list_obj->next_free_element - 1] + 1;
+        const size_t new_sentence_offset =
+                current_token_list_obj->sentence_offsets [current_token_list_obj->next_free_element - 1] +
+                (last_token [0] == '.' && (IS_STRING_LENGTH_ONE(last_token))) ? 1 : 0;
+        const size_t new_word_offset = (size_t)
+                current_token_list_obj->word_offsets [current_token_list_obj->next_free_element - 1] + 1;
+
+        // The width of the offset types is a build time setting (See Defines.h)
+        ASSERT_FMSG(new_char_offset <= (size_t) CHAR_OFFSET_TYPE_MAX, "The char offset %zu is too large for the char "
+                "offset type (%d bit) ! Please build the program with a larger CHAR_OFFSET_BITS value.",
+                new_char_offset, CHAR_OFFSET_BITS);
+        ASSERT_FMSG(new_sentence_offset <= (size_t) SENTENCE_OFFSET_TYPE_MAX, "The sentence offset %zu is too large "
+                "for the sentence offset type (%d bit) ! Please build the program with a larger SENTENCE_OFFSET_BITS "
+                "value.", new_sentence_offset, SENTENCE_OFFSET_BITS);
+        ASSERT_FMSG(new_word_offset <= (size_t) WORD_OFFSET_TYPE_MAX, "The word offset %zu is too large for the word "
+                "offset type (%d bit) ! Please build the program with a larger WORD_OFFSET_BITS value.",
+                new_word_offset, WORD_OFFSET_BITS);
+
+        TokenList_SetOffsets(current_token_list_obj, current_token_list_obj->next_free_element,
+                (CHAR_OFFSET_TYPE) new_char_offset, (SENTENCE_OFFSET_TYPE) new_sentence_offset, (WORD_OFFSET_TYPE) new_word_offset);
+    }
 
-            CAST_CHECK(new_char_offset, size_t, CHAR_OFFSET_TYPE);
+    current_token_list_obj->next_free_element ++;
+    current_token_list_obj->last_token_length = copy_length;
+    current_token_list_obj->last_token_chars = surface_token_chars;
 
-            TokenList_SetOffsets(current_token_list_obj, current_token_list_obj->next_free_element,
-                    (CHAR_OFFSET_TYPE) new_char_offset, (SENTENCE_OFFSET_TYPE) new_sentence_offset, (WORD_OFFSET_TYPE) new_word_offset);
-        }
+    // Is the current token longer than the previous tokens ?
+    new_container->longest_token_length = MAX(new_container->longest_token_length, token_length);
 
-        current_token_list_obj->next_free_element ++;
-        tokens_found ++;
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Save the surface form of the next token of a Token_List, before a lemma will be appended instead of it.
+ *
+ * The memory for the surface forms will be created with the first lemma; the tokens before it are their own surface
+ * forms.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] new_container The container, that holds the Token_List (For the counters)
+ * @param[in] current_token_list_obj The Token_List, that gets the next token
+ * @param[in] surface_token Begin of the surface form
+ * @param[in] surface_token_length Length of the surface form in bytes
+ */
+static void
+Set_Surface_Of_Next_Token
+(
+        struct Token_List_Container* const new_container,
+        struct Token_List* const current_token_list_obj,
+        const char* const surface_token,
+        const size_t surface_token_length
+)
+{
+    if (current_token_list_obj->next_free_element >= current_token_list_obj->allocated_tokens)
+    {
+        Increase_Number_Of_Tokens (new_container, current_token_list_obj,
+                MAX(current_token_list_obj->allocated_tokens * 2, TOKENS_ALLOCATION_STEP_SIZE));
+    }
 
-        // Is the current token longer than the previous tokens ?
-        new_container->longest_token_length = MAX(new_container->longest_token_length, curr_token_len);
+    const size_t token_size = current_token_list_obj->max_token_length;
+    if (current_token_list_obj->surface_data == NULL)
+    {
+        current_token_list_obj->surface_data = (char*) MALLOC(current_token_list_obj->allocated_tokens * token_size);
+        ASSERT_ALLOC(current_token_list_obj->surface_data, "Cannot allocate memory for the surface tokens !",
+                current_token_list_obj->allocated_tokens * token_size);
+        new_container->malloc_calloc_calls ++;
 
-        // Recover the origin text content
-        *(token_begin + tokenize_data->token_data [i].len) = saved_char;
+        // The tokens before the first lemma are their own surface forms
+        memcpy(current_token_list_obj->surface_data, current_token_list_obj->data,
+                current_token_list_obj->next_free_element * token_size);
     }
-    // ===== ===== ===== END Use all tokens in the current text line ===== ===== =====
 
-    // Use next element in the container
-    new_container->next_free_element ++;
+    // Too long surface forms will be cut; the full token is only necessary for the matching
+    char* const surface_mem = current_token_list_obj->surface_data +
+            (token_size * current_token_list_obj->next_free_element);
+    const size_t copy_length = MIN(surface_token_length, token_size - 1);
+    memcpy(surface_mem, surface_token, copy_length);
+    memset(surface_mem + copy_length, '\0', token_size - copy_length);
 
-    return tokens_found;
+    return;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Try to determine the file type.
+ * @brief Use the current JSON fragment with the streaming scanner and identify the tokens and the offsets of them.
  *
- * The function will check for a JSON or a text file.
+ * The result is equal with the result of Use_Current_JSON_Fragment() for all members of the fragment. When a syntax
+ * error occurs, the error position will be saved in the scanner and all changes of the fragment will be rolled back
+ * - like cJSON rejects the whole fragment.
  *
  * Asserts:
- *      input_file != NULL
+ *      N/A
  *
- * @param input_file FILE pointer to the already opened file.
+ * @param[in] scanner JSON_Token_Scanner object
+ * @param[in, out] cursor Begin of the JSON fragment; will be moved behind the fragment
+ * @param[in] token_array JSON array, whose strings will be saved as tokens
+ * @param[in] new_container The container, that will save the new information
  *
- * @return Type of the file; if a determination was not possible UNKNOWN_FILE_TYPE will be returned
+ * @return Number of tokens, that were found (This value can be 0)
  */
-static enum File_Type
-Determine_File_Type
+static uint_fast32_t
+Use_Current_JSON_Fragment_Streaming
 (
-        FILE* input_file
+        struct JSON_Token_Scanner* const restrict scanner,
+        struct JSON_Cursor* const restrict cursor,
+        const enum JSON_Token_Array token_array,
+        struct Token_List_Container* const restrict new_container
 )
 {
-    ASSERT_MSG(input_file != NULL, "FILE is NULL !");
+    const uint_fast32_t saved_next_free_element        = new_container->next_free_element;
+    const uint_fast32_t saved_next_free_too_long_token = new_container->list_of_too_long_token->next_free_c_str;
+    const size_t saved_longest_token_length             = new_container->longest_token_length;
+    uint_fast32_t tokens_found                          = 0;
 
-    _Bool JSON_start_char_found = false;
-    _Bool JSON_end_char_found   = false;
+    // Only objects contain data sets; other values will be skipped
+    if (JSONTokenScanner_NextChar(cursor) != '{')
+    {
+        JSONTokenScanner_SkipValue(scanner, cursor);
+        return 0;
+    }
+    ++ cursor->position;
 
-    // For a simple check mechanism we expect, that an JSON file starts with a '{' and end with a '}'
+    // ===== ===== ===== BEGIN Go through the data sets of the fragment ===== ===== =====
+    _Bool first_data_set = true;
+    while (JSONTokenScanner_NextElement(scanner, cursor, &first_data_set, '}'))
+    {
+        struct JSON_String_View name = { NULL, 0 };
+        if (! JSONTokenScanner_ReadString(scanner, cursor, &name)) { break; }
+
+        // The name view can point in the decode buffer; the next string would override it
+        char dataset_id [DATASET_ID_LENGTH];
+        const size_t dataset_id_length = MIN(name.length, (size_t) (DATASET_ID_LENGTH - 1));
+        memcpy(dataset_id, name.data, dataset_id_length);
+        dataset_id [dataset_id_length] = '\0';
+
+        if (! JSONTokenScanner_Expect(scanner, cursor, ':')) { break; }
+        if (JSONTokenScanner_NextChar(cursor) != '{')
+        {
+            if (! JSONTokenScanner_SkipValue(scanner, cursor)) { break; }
+            continue;
+        }
+        ++ cursor->position;
+
+        // Find the tokens array, the char offsets array and the lemma array; like cJSON the first member with the
+        // name will be used
+        struct JSON_Cursor tokens_array         = { NULL, cursor->end };
+        struct JSON_Cursor char_offsets_array   = { NULL, cursor->end };
+        struct JSON_Cursor lemma_array          = { NULL, cursor->end };
+        _Bool first_member = true;
+        while (JSONTokenScanner_NextElement(scanner, cursor, &first_member, '}'))
+        {
+            struct JSON_String_View member_name = { NULL, 0 };
+            if (! JSONTokenScanner_ReadString(scanner, cursor, &member_name)) { break; }
+            if (! JSONTokenScanner_Expect(scanner, cursor, ':')) { break; }
+
+            if (tokens_array.position == NULL && JSONTokenScanner_StringEquals(&member_name, JSON_TOKENS_ARRAY_NAME))
+            {
+                JSONTokenScanner_NextChar(cursor);
+                tokens_array.position = cursor->position;
+            }
+            else if (char_offsets_array.position == NULL &&
+                    JSONTokenScanner_StringEquals(&member_name, JSON_CHAR_OFFSET_ARRAY_NAME))
+            {
+                JSONTokenScanner_NextChar(cursor);
+                char_offsets_array.position = cursor->position;
+            }
+            else if (token_array == JSON_TOKEN_ARRAY_LEMMA && lemma_array.position == NULL &&
+                    JSONTokenScanner_StringEquals(&member_name, JSON_LEMMA_ARRAY_NAME))
+            {
+                JSONTokenScanner_NextChar(cursor);
+                lemma_array.position = cursor->position;
+            }
+            if (! JSONTokenScanner_SkipValue(scanner, cursor)) { break; }
+        }
+        if (scanner->error_position != NULL) { break; }
+
+        tokens_found += Use_Streamed_Tokens_Array(scanner, tokens_array, char_offsets_array, lemma_array, dataset_id,
+                new_container);
+        if (scanner->error_position != NULL) { break; }
+    }
+    // ===== ===== ===== END Go through the data sets of the fragment ===== ===== =====
+
+    if (scanner->error_position != NULL)
+    {
+        Roll_Back_Token_Lists(new_container, saved_next_free_element, saved_next_free_too_long_token,
+                saved_longest_token_length);
+        tokens_found = 0;
+    }
+
+    return tokens_found;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a Token_List from the tokens array and the char offsets array of a data set. (Streaming version)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] scanner JSON_Token_Scanner object
+ * @param[in] tokens_array Begin of the tokens value (position NULL: no tokens value)
+ * @param[in] char_offsets_array Begin of the char offsets value (position NULL: no char offsets value)
+ * @param[in] lemma_array Begin of the lemma value (position NULL: no lemma value; the surface tokens will be saved)
+ * @param[in] dataset_id ID of the data set
+ * @param[in] new_container The container, that will save the new information
+ *
+ * @return Number of tokens, that were found (This value can be 0)
+ */
+static uint_fast32_t
+Use_Streamed_Tokens_Array
+(
+        struct JSON_Token_Scanner* const restrict scanner,
+        struct JSON_Cursor tokens_array,
+        struct JSON_Cursor char_offsets_array,
+        struct JSON_Cursor lemma_array,
+        const char* const restrict dataset_id,
+        struct Token_List_Container* const restrict new_container
+)
+{
+    uint_fast32_t tokens_found = 0;
+
+    // Exists a tokens array with at least one element ?
+    if (tokens_array.position == NULL || *tokens_array.position != '[') { return 0; }
+    ++ tokens_array.position;
+    _Bool first_token = true;
+    if (! JSONTokenScanner_NextElement(scanner, &tokens_array, &first_token, ']')) { return 0; }
+
+    // If a array with offsets is available ? Use them
+    _Bool char_offset_available = false;
+    _Bool first_char_offset = true;
+    if (char_offsets_array.position != NULL && *char_offsets_array.position == '[')
+    {
+        ++ char_offsets_array.position;
+        char_offset_available = JSONTokenScanner_NextElement(scanner, &char_offsets_array, &first_char_offset, ']');
+    }
+
+    // The lemma array will be used in parallel with the tokens array; like the char offsets
+    _Bool lemma_available = false;
+    _Bool first_lemma = true;
+    if (lemma_array.position != NULL && *lemma_array.position == '[')
+    {
+        ++ lemma_array.position;
+        lemma_available = JSONTokenScanner_NextElement(scanner, &lemma_array, &first_lemma, ']');
+    }
+
+    // Realloc necessary ?
+    // Is it necessary to realloc/increase the number of Token_List objects in the container ?
+    if (new_container->next_free_element >= new_container->allocated_token_container)
+    {
+        Increase_Number_Of_Token_Lists (new_container);
+    }
+    struct Token_List* const current_token_list_obj = &(new_container->token_lists [new_container->next_free_element]);
+    strncpy (current_token_list_obj->dataset_id, dataset_id, DATASET_ID_LENGTH - 1);
+    current_token_list_obj->dataset_id [DATASET_ID_LENGTH - 1] = '\0';
+
+    // ===== ===== ===== BEGIN Go though the tokens array ===== ===== =====
+    do
+    {
+        // Like the cJSON version: values, that are not strings, will be skipped (without using a char offset)
+        if (JSONTokenScanner_NextChar(&tokens_array) != '\"')
+        {
+            if (! JSONTokenScanner_SkipValue(scanner, &tokens_array)) { return tokens_found; }
+            continue;
+        }
+
+        struct JSON_String_View token = { NULL, 0 };
+        if (! JSONTokenScanner_ReadString(scanner, &tokens_array, &token)) { return tokens_found; }
+
+        int char_offset = 0;
+        const _Bool current_char_offset_available = char_offset_available;
+        if (char_offset_available)
+        {
+            if (! JSONTokenScanner_ReadInt(scanner, &char_offsets_array, &char_offset)) { return tokens_found; }
+            char_offset_available =
+                    JSONTokenScanner_NextElement(scanner, &char_offsets_array, &first_char_offset, ']');
+            if (scanner->error_position != NULL) { return tokens_found; }
+        }
+
+        // The token view can point in the decode buffer; so the surface form will be counted and saved before the
+        // lemma will be read
+        size_t surface_token_chars = SIZE_MAX;
+        if (lemma_available)
+        {
+            const size_t token_chars = u8_strnlen(token.data, token.length);
+            if (JSONTokenScanner_NextChar(&lemma_array) == '\"')
+            {
+                Set_Surface_Of_Next_Token(new_container, current_token_list_obj, token.data, token.length);
+                if (! JSONTokenScanner_ReadString(scanner, &lemma_array, &token)) { return tokens_found; }
+                surface_token_chars = token_chars;
+            }
+            else if (! JSONTokenScanner_SkipValue(scanner, &lemma_array)) { return tokens_found; }
+
+            lemma_available = JSONTokenScanner_NextElement(scanner, &lemma_array, &first_lemma, ']');
+            if (scanner->error_position != NULL) { return tokens_found; }
+        }
+
+        Append_Token_To_Token_List(new_container, current_token_list_obj, token.data, token.length,
+                current_char_offset_available, char_offset, surface_token_chars);
+        tokens_found ++;
+    }
+    while (JSONTokenScanner_NextElement(scanner, &tokens_array, &first_token, ']'));
+    // ===== ===== ===== END Go though the tokens array ===== ===== =====
+
+    // Use next element in the container
+    new_container->next_free_element ++;
+
+    return tokens_found;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Remove all Token_List objects and too long tokens, that were added after the given state.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] next_free_element Saved number of used Token_List objects
+ * @param[in] next_free_too_long_token Saved number of too long tokens
+ * @param[in] longest_token_length Saved length of the longest token
+ */
+static void
+Roll_Back_Token_Lists
+(
+        struct Token_List_Container* const container,
+        const uint_fast32_t next_free_element,
+        const uint_fast32_t next_free_too_long_token,
+        const size_t longest_token_length
+)
+{
+    // The Token_List at container->next_free_element can be partially filled
+    for (uint_fast32_t i = next_free_element; i <= container->next_free_element && i < container->allocated_token_container;
+            ++ i)
+    {
+        struct Token_List* const token_list = &(container->token_lists [i]);
+        for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
+        {
+            token_list->char_offsets [i2]       = CHAR_OFFSET_TYPE_MAX;
+            token_list->sentence_offsets [i2]   = SENTENCE_OFFSET_TYPE_MAX;
+            token_list->word_offsets [i2]       = WORD_OFFSET_TYPE_MAX;
+        }
+        token_list->next_free_element = 0;
+        memset(token_list->dataset_id, '\0', DATASET_ID_LENGTH);
+    }
+    container->next_free_element = next_free_element;
+
+    struct Two_Dim_C_String_Array* const too_long_tokens = container->list_of_too_long_token;
+    for (uint_fast32_t i = next_free_too_long_token; i < too_long_tokens->next_free_c_str; ++ i)
+    {
+        memset(too_long_tokens->data [i], '\0', too_long_tokens->allocated_c_str_length [i]);
+        too_long_tokens->next_free_char_in_c_str [i] = 0;
+    }
+    too_long_tokens->next_free_c_str = next_free_too_long_token;
+    container->longest_token_length = longest_token_length;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Token_List_Container with the default number of empty Token_List objects.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Create_Empty_Container
+(
+        void
+)
+{
+    // Create the (outer) container
+    struct Token_List_Container* new_container =
+            (struct Token_List_Container*) CALLOC(1, sizeof (struct Token_List_Container));
+    ASSERT_ALLOC(new_container, "Cannot create new Token_Container !", 1 * sizeof (struct Token_List_Container));
+    new_container->malloc_calloc_calls ++;
+
+    // Create the inner container
+    new_container->allocated_token_container = TOKEN_CONTAINER_ALLOCATION_STEP_SIZE;
+    new_container->token_lists = (struct Token_List*) CALLOC(new_container->allocated_token_container, sizeof (struct Token_List));
+    ASSERT_ALLOC(new_container->token_lists, "Cannot create new Token objects !", new_container->allocated_token_container *
+            sizeof (struct Token_List));
+    new_container->malloc_calloc_calls ++;
+
+    // The memory for the tokens will be allocated with the first data set, that uses the Token_List
+    for (size_t i = 0; i < new_container->allocated_token_container; ++ i)
+    {
+        new_container->token_lists [i].max_token_length = MAX_TOKEN_LENGTH;
+    }
+
+    // Create the container for too long token
+    new_container->list_of_too_long_token = TwoDimCStrArray_CreateObject (10);
+
+    return new_container;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the file type of the mapped file and print the result.
+ *
+ * For a compressed file the type will be determined with the begin of the decompressed data.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      file_name != NULL
+ *
+ * @param[in] input_file Mapped_File object
+ * @param[in] decompressed_input Decompressed content of the file (NULL: The file is not compressed)
+ * @param[in] file_name Name of the file (only for the output)
+ *
+ * @return Type of the file
+ */
+static enum File_Type
+Determine_And_Print_File_Type
+(
+        const struct Mapped_File* const restrict input_file,
+        struct Compressed_Input* const restrict decompressed_input,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(input_file != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    const char* file_content = input_file->data;
+    size_t file_size = (size_t) input_file->size;
+    if (decompressed_input != NULL)
+    {
+        CompressedInput_PeekBegin (decompressed_input, &file_content, &file_size);
+        ASSERT_FMSG(file_size > 0, "The decompressed content of the file \"%s\" is empty !", file_name);
+    }
+
+    const enum File_Type file_type = Determine_File_Type (file_content, file_size);
+    switch (file_type)
+    {
+    case NOT_SPECIFIED_FILE_TYPE:
+        printf("Not specified file type for \"%s\"\n", file_name);
+        break;
+    case JSON_FILE_TYPE:
+        printf("Assume, that \"%s\" is a " ANSI_TEXT_BOLD "JSON file" ANSI_RESET_ALL "\n", file_name);
+        break;
+    case TXT_FILE_TYPE:
+        printf("Assume, that \"%s\" is a " ANSI_TEXT_BOLD "text file" ANSI_RESET_ALL "\n", file_name);
+        break;
+    case UNKNOWN_FILE_TYPE:
+        printf("Cannot determine the file type for \"%s\" !\n", file_name);
+        break;
+    default:
+        ASSERT_MSG(false, "Switch case default path executed !");
+    }
+
+    return file_type;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Copy a line in the line buffer and terminate it. The buffer grows, if the line is too long.
+ *
+ * Asserts:
+ *      line != NULL
+ *      line_buffer != NULL
+ *      line_buffer_length != NULL
+ *      container != NULL
+ *
+ * @param[in] line View of the line
+ * @param[in, out] line_buffer Line buffer (Can be NULL before the first call)
+ * @param[in, out] line_buffer_length Allocated length of the line buffer
+ * @param[in] container Token_List_Container (counts the allocations)
+ */
+static void
+Copy_Line_To_Line_Buffer
+(
+        const struct Line_View* const restrict line,
+        char** const restrict line_buffer,
+        size_t* const restrict line_buffer_length,
+        struct Token_List_Container* const restrict container
+)
+{
+    ASSERT_MSG(line != NULL, "Line view is NULL !");
+    ASSERT_MSG(line_buffer != NULL, "Line buffer is NULL !");
+    ASSERT_MSG(line_buffer_length != NULL, "Line buffer length is NULL !");
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    if (line->length + 1 > *line_buffer_length)
+    {
+        if (*line_buffer != NULL)
+        {
+            FREE_AND_SET_TO_NULL(*line_buffer);
+        }
+        *line_buffer_length = line->length + 1;
+        *line_buffer = (char*) MALLOC(*line_buffer_length * sizeof (char));
+        ASSERT_ALLOC(*line_buffer, "Cannot allocate memory for a line !", *line_buffer_length * sizeof (char));
+        container->malloc_calloc_calls ++;
+    }
+    memcpy(*line_buffer, line->data, line->length);
+    (*line_buffer) [line->length] = '\0';
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Parse all lines in a range of the mapped file and save the tokens in the container.
+ *
+ * Asserts:
+ *      container != NULL
+ *      input_file != NULL
+ *      range_begin <= range_end
+ *
+ * @param[in] container Token_List_Container, that will save the new information
+ * @param[in] input_file Mapped_File object
+ * @param[in] decompressed_input Lines of a compressed file (NULL: The lines will be read from the range of the mapped
+ * file; otherwise the range is only used for the process information)
+ * @param[in] range_begin Begin of the range (needs to be a line begin)
+ * @param[in] range_end End of the range (exclusive)
+ * @param[in] file_type Type of the file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens
+ * @param[in] first_line_number Line number of the first line in the range (For the IDs of the text data sets)
+ * @param[in] print_process Print the process information ?
+ * @param[in] consumer Gets the Token_List objects after every line (NULL: the Token_List objects stay in the
+ * container)
+ * @param[in] consumer_data Data, that will be given to the consumer
+ *
+ * @return Number of tokens, that were found
+ */
+static uint_fast32_t
+Parse_Lines
+(
+        struct Token_List_Container* const restrict container,
+        const struct Mapped_File* const restrict input_file,
+        struct Compressed_Input* const restrict decompressed_input,
+        const uint_fast64_t range_begin,
+        const uint_fast64_t range_end,
+        const enum File_Type file_type,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const uint_fast32_t first_line_number,
+        const _Bool print_process,
+        const Token_List_Consumer consumer,
+        void* const consumer_data
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+    ASSERT_MSG(input_file != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(range_begin <= range_end, "Range begin is behind the range end !");
+
+    // The in-situ mode of cJSON needs a null terminated and writable string. Therefore these lines will be copied in
+    // this buffer. The buffer grows with the longest line
+    char* line_buffer           = NULL;
+    size_t line_buffer_length   = 0;
+
+    // The text lines will be tokenized direct in the file content; the buffer grows with the line with the most tokens
+    struct Delimiter_Set text_delimiters;
+    Init_Delimiter_Set(&text_delimiters, " \t\n\r");
+    struct Token_Position_Buffer token_positions = { NULL, 0, 0 };
+
+    // The streaming scanner holds only a decode buffer for strings with escape sequences
+    struct JSON_Token_Scanner* scanner = NULL;
+    if (file_type == JSON_FILE_TYPE && json_parser_mode == JSON_PARSER_STREAMING)
+    {
+        scanner = JSONTokenScanner_CreateObject ();
+    }
+
+    // The cJSON trees of all fragments will be built in the same arena; after a fragment was used, the arena will be
+    // reset. So the cJSON items need no malloc() and free() calls
+    cJSON_Arena* cjson_arena = NULL;
+    if (file_type == JSON_FILE_TYPE && json_parser_mode == JSON_PARSER_CJSON)
+    {
+        cjson_arena = cJSON_CreateArena(CJSON_ARENA_BLOCK_SIZE);
+        ASSERT_ALLOC(cjson_arena, "Cannot allocate memory for the cJSON arena !", (size_t) CJSON_ARENA_BLOCK_SIZE);
+    }
+
+    uint_fast32_t line_counter              = first_line_number - 1;
+    uint_fast32_t sum_tokens_found          = 0;
+    const uint_fast8_t count_steps          = 200;
+    const size_t unsigned_input_file_length = (size_t) (range_end - range_begin);
+    const uint_fast32_t print_steps         = ((unsigned_input_file_length / count_steps) == 0) ?
+            1 : (unsigned_input_file_length / count_steps);
+
+    uint_fast64_t position              = range_begin;
+    struct Line_View line               = { NULL, 0 };
+    size_t sum_char_read                = 0;
+    size_t char_read_before_last_output = 0;
+
+    // ===== ===== ===== ===== ===== BEGIN Read file line by line ===== ===== ===== ===== =====
+    while ((decompressed_input != NULL) ? CompressedInput_NextLine (decompressed_input, &line) :
+            MappedFile_NextLineInRange (input_file, &position, range_end, &line))
+    {
+        ++ line_counter;
+        // The process information is based on the bytes of the input file; for a compressed file these are the
+        // compressed bytes, that were already decompressed
+        const size_t read_chars = (decompressed_input != NULL) ?
+                (size_t) CompressedInput_GetInputPosition (decompressed_input) - sum_char_read : line.length;
+        sum_char_read                   += read_chars;
+        char_read_before_last_output    += read_chars;
+
+        // Empty lines contain no data
+        if (line.length == 0) { continue; }
+
+        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
+        if (file_type == JSON_FILE_TYPE && json_parser_mode == JSON_PARSER_STREAMING)
+        {
+            struct JSON_Cursor cursor = { line.data, line.data + line.length };
+            while (JSONTokenScanner_NextChar(&cursor) != '\0')
+            {
+                // cJSON skips a UTF-8 BOM at the begin of every parsing call
+                if (cursor.end - cursor.position >= 3 && memcmp(cursor.position, "\xEF\xBB\xBF", 3) == 0)
+                {
+                    cursor.position += 3;
+                }
+
+                scanner->error_position = NULL;
+                sum_tokens_found += Use_Current_JSON_Fragment_Streaming(scanner, &cursor, token_array, container);
+
+                // Print process information
+                if (print_process)
+                {
+                    char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
+                            sum_char_read, unsigned_input_file_length, true,
+                            Read_File_Process_Print_Function,
+                            NULL,
+                            NULL);
+                }
+
+                if (scanner->error_position != NULL)
+                {
+                    printf("Error before: [%.*s] %" PRIuFAST32 ": %ld\n",
+                            (int) MIN((size_t) (cursor.end - scanner->error_position), (size_t) 64),
+                            scanner->error_position, line_counter, (long int) (scanner->error_position - line.data));
+                    break;
+                }
+            }
+        }
+        else if (file_type == JSON_FILE_TYPE)
+        {
+            // cJSON decodes the strings in situ: names and string values point in the line buffer, so every token will
+            // be copied only once (in the Token_List)
+            Copy_Line_To_Line_Buffer(&line, &line_buffer, &line_buffer_length, container);
+            const char* current_parsing_position = line_buffer;
+            const char* const line_end = line_buffer + line.length;
+            while (current_parsing_position < line_end)
+            {
+                // Parse the file JSON fragment per JSON fragment
+                // The decoded strings overwrite only the current fragment; the rest of the line is still unchanged
+                cJSON* json = cJSON_ParseInSituWithArena(line_buffer + (current_parsing_position - line_buffer),
+                        (size_t) (line_end - current_parsing_position), &current_parsing_position, false, cjson_arena);
+
+                // Print process information
+                if (print_process)
+                {
+                    char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
+                            sum_char_read, unsigned_input_file_length, true,
+                            Read_File_Process_Print_Function,
+                            NULL,
+                            NULL);
+                }
+
+                if (! json)
+                {
+                    // Sometimes the json pointer is NULL. But an error only occurs, when data is left in the line
+                    if (current_parsing_position < line_end)
+                    {
+                        printf("Error before: [%.*s] %" PRIuFAST32 ": %ld\n",
+                                (int) MIN((size_t) (line_end - current_parsing_position), (size_t) 64),
+                                current_parsing_position, line_counter, (long int) (current_parsing_position - line_buffer));
+                    }
+                    // The items of the broken fragment are still in the arena
+                    cJSON_ResetArena(cjson_arena);
+                    break;
+                }
+                cJSON* curr = json->child;
+
+                // ===== ===== ===== BEGIN Use current cJSON object ===== ===== =====
+                while (curr != NULL)
+                {
+                    // Extract the information from the current cJSON object
+                    sum_tokens_found += Use_Current_JSON_Fragment(json, curr, token_array, container);
+                    curr = curr->next;
+                }
+                // ===== ===== ===== BEGIN Use current cJSON object ===== ===== =====
+
+                // Release the whole tree at once
+                cJSON_ResetArena(cjson_arena);
+                json = NULL;
+
+                // Skip the whitespace behind the fragment (e.g. a '\r' at the line end)
+                while (current_parsing_position < line_end && isspace((unsigned char) *current_parsing_position))
+                {
+                    ++ current_parsing_position;
+                }
+            }
+        }
+        else if (file_type == TXT_FILE_TYPE)
+        {
+            Tokenize_String_Into_Buffer(line.data, line.length, &text_delimiters, &token_positions);
+
+            // Print process information
+            if (print_process)
+            {
+                char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
+                        sum_char_read, unsigned_input_file_length, true,
+                        Read_File_Process_Print_Function,
+                        NULL,
+                        NULL);
+            }
+
+            // Lines with only whitespace result in a data set without tokens
+            sum_tokens_found += Use_Current_Text_Fragment(line.data, line.length, line_counter, &token_positions,
+                    container);
+        }
+        else
+        {
+            ASSERT_MSG(false,
+                    "Else path in the line parsing executed ! (No code for parsing the current file format available)");
+        }
+        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
+
+        // Hand over the Token_List objects of the line and reuse their memory for the next line. The too long tokens
+        // will be kept
+        if (consumer != NULL)
+        {
+            for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+            {
+                consumer(&(container->token_lists [i]), consumer_data);
+            }
+            Roll_Back_Token_Lists(container, 0, container->list_of_too_long_token->next_free_c_str,
+                    container->longest_token_length);
+        }
+    }
+    // ===== ===== ===== ===== ===== END Read file line by line ===== ===== ===== ===== =====
+
+    if (line_buffer != NULL)
+    {
+        FREE_AND_SET_TO_NULL(line_buffer);
+    }
+    Free_Token_Position_Buffer(&token_positions);
+    if (scanner != NULL)
+    {
+        JSONTokenScanner_DeleteObject(scanner);
+        scanner = NULL;
+    }
+    if (cjson_arena != NULL)
+    {
+        cJSON_DeleteArena(cjson_arena);
+        cjson_arena = NULL;
+    }
+
+    return sum_tokens_found;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print the tokens, that were longer than the expected length.
+ *
+ * Asserts:
+ *      new_container != NULL
+ *
+ * @param[in] new_container Token_List_Container object
+ */
+static void
+Print_Too_Long_Tokens
+(
+        const struct Token_List_Container* const new_container
+)
+{
+    ASSERT_MSG(new_container != NULL, "Token_List_Container is NULL !");
+
+    // Print tokens, that was longer than the expected length
+    if (new_container->list_of_too_long_token->next_free_c_str > 0)
+    {
+        printf("\n\nTokens, that are longer than expected (max. expected length: %d):\n", MAX_TOKEN_LENGTH - 1);
+        if (new_container->list_of_too_long_token->next_free_c_str <= 50)
+        {
+            TwoDimCStrArray_PrintAllStrings(new_container->list_of_too_long_token);
+        }
+        else
+        {
+            const uint_fast32_t next_free_c_str = new_container->list_of_too_long_token->next_free_c_str;
+            const int num_of_digits             = (int) Count_Number_Of_Digits(next_free_c_str);
+            const uint_fast32_t print_range     = 15;
+
+            // Print the first and the last 15 tokens
+            for (uint_fast32_t i = 0; i < print_range; ++ i)
+            {
+                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_too_long_token->data [i]);
+            }
+            PRINT_X_TIMES_SAME_CHAR(' ', num_of_digits + 2);
+            puts("...");
+            for (uint_fast32_t i = (next_free_c_str - print_range); i < next_free_c_str; ++ i)
+            {
+                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_too_long_token->data [i]);
+            }
+        }
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief The function of a reader thread: Parse the lines of the given range in the own container.
+ *
+ * @param[in] thread_data Reader_Thread_Data object (as void*)
+ *
+ * @return Always NULL
+ */
+static void*
+Reader_Thread_Function
+(
+        void* thread_data
+)
+{
+    struct Reader_Thread_Data* const data = (struct Reader_Thread_Data*) thread_data;
+
+    data->tokens_found = Parse_Lines (data->container, data->input_file, NULL, data->range_begin, data->range_end,
+            data->file_type, data->json_parser_mode, data->token_array, data->first_line_number, false, NULL,
+            NULL);
+
+    return NULL;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Concatenate the containers of the reader threads in the given order.
+ *
+ * The Token_List objects will be moved (not copied) in the new container. The used Token_List objects are at the
+ * begin; the unused (but allocated) Token_List objects follow. The containers of the threads will be deleted.
+ *
+ * Asserts:
+ *      thread_data != NULL
+ *      number_of_threads > 0
+ *
+ * @param[in] thread_data Data of the reader threads (with the containers)
+ * @param[in] number_of_threads Number of reader threads
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Concatenate_Containers
+(
+        struct Reader_Thread_Data* const thread_data,
+        const size_t number_of_threads
+)
+{
+    ASSERT_MSG(thread_data != NULL, "Reader thread data is NULL !");
+    ASSERT_MSG(number_of_threads > 0, "Number of threads is 0 !");
+
+    size_t used_token_lists         = 0;
+    size_t allocated_token_lists    = 0;
+    for (size_t i = 0; i < number_of_threads; ++ i)
+    {
+        used_token_lists        += thread_data [i].container->next_free_element;
+        allocated_token_lists   += thread_data [i].container->allocated_token_container;
+    }
+
+    struct Token_List_Container* new_container =
+            (struct Token_List_Container*) CALLOC(1, sizeof (struct Token_List_Container));
+    ASSERT_ALLOC(new_container, "Cannot create new Token_Container !", 1 * sizeof (struct Token_List_Container));
+    new_container->malloc_calloc_calls ++;
+
+    new_container->token_lists = (struct Token_List*) MALLOC(allocated_token_lists * sizeof (struct Token_List));
+    ASSERT_ALLOC(new_container->token_lists, "Cannot create new Token objects !",
+            allocated_token_lists * sizeof (struct Token_List));
+    new_container->malloc_calloc_calls ++;
+    new_container->list_of_too_long_token = TwoDimCStrArray_CreateObject (10);
+
+    size_t next_used_list   = 0;
+    size_t next_unused_list = used_token_lists;
+    for (size_t i = 0; i < number_of_threads; ++ i)
+    {
+        struct Token_List_Container* container = thread_data [i].container;
+        const size_t used_lists = container->next_free_element;
+
+        memcpy(new_container->token_lists + next_used_list, container->token_lists, used_lists * sizeof (struct Token_List));
+        memcpy(new_container->token_lists + next_unused_list, container->token_lists + used_lists,
+                (container->allocated_token_container - used_lists) * sizeof (struct Token_List));
+        next_used_list      += used_lists;
+        next_unused_list    += container->allocated_token_container - used_lists;
+
+        for (uint_fast32_t i2 = 0; i2 < container->list_of_too_long_token->next_free_c_str; ++ i2)
+        {
+            TwoDimCStrArray_AppendNewString(new_container->list_of_too_long_token,
+                    container->list_of_too_long_token->data [i2],
+                    strlen (container->list_of_too_long_token->data [i2]));
+        }
+
+        new_container->longest_token_length = MAX(new_container->longest_token_length, container->longest_token_length);
+        new_container->malloc_calloc_calls  += container->malloc_calloc_calls;
+        new_container->realloc_calls        += container->realloc_calls;
+
+        // The Token_List objects are now in the new container; only the outer parts will be deleted
+        TwoDimCStrArray_DeleteObject(container->list_of_too_long_token);
+        container->list_of_too_long_token = NULL;
+        FREE_AND_SET_TO_NULL(container->token_lists);
+        FREE_AND_SET_TO_NULL(container);
+        thread_data [i].container = NULL;
+    }
+
+    new_container->next_free_element            = (uint_fast32_t) used_token_lists;
+    new_container->allocated_token_container    = allocated_token_lists;
+
+    return new_container;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the token list from a file without additional threads.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens
+ * @param[in] consumer Gets the Token_List objects after every line (NULL: the Token_List objects stay in the
+ * container)
+ * @param[in] consumer_data Data, that will be given to the consumer
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Create_Object_With_One_Thread
+(
+        const char* const file_name,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const Token_List_Consumer consumer,
+        void* const consumer_data
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(strlen(file_name) > 0, "File name is empty !");
+
+    struct Token_List_Container* new_container = Create_Empty_Container ();
+
+    clock_t start       = 0;
+    clock_t end         = 0;
+    float used_seconds  = 0.0f;
+
+    // Map the file; the lines will be used direct in the file content (no line buffer for the JSON parsing)
+    struct Mapped_File* input_file = MappedFile_CreateObject (file_name);
+
+    // A compressed file will be decompressed in a helper thread, while the lines will be parsed
+    const enum Compression_Format compression_format = CompressedInput_DetectFormat (input_file->data, input_file->size);
+    struct Compressed_Input* decompressed_input = NULL;
+    if (compression_format != COMPRESSION_NONE)
+    {
+        printf("\"%s\" is " ANSI_TEXT_BOLD "%s compressed" ANSI_RESET_ALL "\n", file_name,
+                CompressedInput_FormatToString (compression_format));
+        decompressed_input = CompressedInput_CreateObject (input_file, compression_format, file_name);
+    }
+    const enum File_Type file_type = Determine_And_Print_File_Type (input_file, decompressed_input, file_name);
+
+    CLOCK_WITH_RETURN_CHECK(start);
+    const uint_fast32_t sum_tokens_found = Parse_Lines (new_container, input_file, decompressed_input, 0,
+            input_file->size, file_type, json_parser_mode, token_array, 1, true, consumer, consumer_data);
+
+    Print_Too_Long_Tokens (new_container);
+
+    CLOCK_WITH_RETURN_CHECK(end);
+    used_seconds = DETERMINE_USED_TIME(start, end);
+
+    const float file_size_in_MB = ((float) input_file->size / 1024.0f / 1024.0f);
+    printf ("\n=> %.3f MB in %3.3fs (~ %.3f MB/s) for parsing the whole file (" ANSI_TEXT_BOLD ANSI_TEXT_ITALIC
+            "%" PRIuFAST32 " tokens found" ANSI_RESET_ALL ")\n",
+            file_size_in_MB, used_seconds, file_size_in_MB / used_seconds, sum_tokens_found);
+
+    if (decompressed_input != NULL)
+    {
+        printf ("   (%.3f MB after the decompression)\n",
+                ((float) decompressed_input->decompressed_bytes / 1024.0f / 1024.0f));
+        CompressedInput_DeleteObject (decompressed_input);
+        decompressed_input = NULL;
+    }
+    MappedFile_DeleteObject(input_file);
+    input_file = NULL;
+
+    return new_container;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the current wall time in seconds. (On systems without clock_gettime() the CPU time will be used)
+ *
+ * @return Wall time in seconds
+ */
+static double
+Get_Wall_Time_In_Seconds
+(
+        void
+)
+{
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    struct timespec current_time;
+    const int clock_result = clock_gettime(CLOCK_MONOTONIC, &current_time);
+    ASSERT_FMSG(clock_result == 0, "clock_gettime() failed: %s", strerror(errno));
+
+    return (double) current_time.tv_sec + (double) current_time.tv_nsec / 1000000000.0;
+#else
+    clock_t current_time = 0;
+    CLOCK_WITH_RETURN_CHECK(current_time);
+
+    return (double) current_time / CLOCKS_PER_SEC;
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Try to determine the file type.
+ *
+ * The function will check for a JSON or a text file.
+ *
+ * Asserts:
+ *      file_content != NULL
+ *      file_size > 0
+ *
+ * @param file_content Content of the whole file
+ * @param file_size Size of the file content in bytes
+ *
+ * @return Type of the file; if a determination was not possible UNKNOWN_FILE_TYPE will be returned
+ */
+static enum File_Type
+Determine_File_Type
+(
+        const char* const file_content,
+        const uint_fast64_t file_size
+)
+{
+    ASSERT_MSG(file_content != NULL, "File content is NULL !");
+    ASSERT_MSG(file_size > 0, "File size is 0 !");
+
+    _Bool JSON_start_char_found = false;
+    _Bool JSON_end_char_found   = false;
+
+    // For a simple check mechanism we expect, that an JSON file starts with a '{' and end with a '}'
     // There will be no check, if the input file is a full valid JSON file. This will done in the reading process, when
     // this function determines a JSON file
 
-    // Set the cursor to the start of the file and save the current cursor position
-    const long int curr_cursor_pos = ftell (input_file);
-    ASSERT_FMSG(curr_cursor_pos != -1L, "ftell() returned -1: %s", strerror(errno));
-    int fseek_return = fseek (input_file, 0, SEEK_SET);
-    ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
-
     // Reading until an '{' or a not space char was found
-    int curr_c = 0;
-    while ((curr_c = fgetc(input_file)) != EOF)
+    for (uint_fast64_t i = 0; i < file_size; ++ i)
     {
+        const int curr_c = (unsigned char) file_content [i];
         if (curr_c == '{')
         {
             JSON_start_char_found = true;
@@ -1719,14 +3087,10 @@ Determine_File_Type
         }
     }
 
-    // Reading until an '}' or a not space char was found
-    curr_c = 0;
-    for (long int i = 0; curr_c != EOF; i ++)
+    // Reading backwards until an '}' or a not space char was found
+    for (uint_fast64_t i = file_size; i > 0; -- i)
     {
-        fseek_return = fseek (input_file, -(i + 1), SEEK_END);
-        ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
-
-        curr_c = fgetc (input_file);
+        const int curr_c = (unsigned char) file_content [i - 1];
         if (curr_c == '}')
         {
             JSON_end_char_found = true;
@@ -1739,10 +3103,6 @@ Determine_File_Type
         }
     }
 
-    // Set the file cursor the origin position
-    fseek_return = fseek (input_file, curr_cursor_pos, SEEK_SET);
-    ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
-
     return (JSON_start_char_found && JSON_end_char_found) ? JSON_FILE_TYPE : TXT_FILE_TYPE;
 }
 
@@ -1765,3 +3125,11 @@ Determine_File_Type
 #ifdef JSON_CHAR_OFFSET_ARRAY_NAME
 #undef JSON_CHAR_OFFSET_ARRAY_NAME
 #endif /* JSON_CHAR_OFFSET_ARRAY_NAME */
+
+#ifdef JSON_LEMMA_ARRAY_NAME
+#undef JSON_LEMMA_ARRAY_NAME
+#endif /* JSON_LEMMA_ARRAY_NAME */
+
+#ifdef CJSON_ARENA_BLOCK_SIZE
+#undef CJSON_ARENA_BLOCK_SIZE
+#endif /* CJSON_ARENA_BLOCK_SIZE */
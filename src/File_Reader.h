@@ -45,6 +45,13 @@ struct Token_List_Container
          */
         char* data;
 
+        /**
+         * @brief Surface forms of the tokens in the same layout as data. (NULL: data contains the surface forms)
+         *
+         * Only, if a lemma replaced a token (See JSON_TOKEN_ARRAY_LEMMA). The output shows the surface forms.
+         */
+        char* surface_data;
+
         /**
          * @brief Char offsets of each token.
          */
@@ -72,6 +79,18 @@ struct Token_List_Container
          */
         uint_fast32_t next_free_element;
         size_t allocated_tokens;                            ///< Allocated number of tokens
+        /**
+         * @brief Length of the last appended token in bytes (as saved; too long tokens are cut)
+         *
+         * The char offset of the next token needs the length of the last token in UTF-8 chars. With the byte length
+         * the chars can be counted without a search for the terminator.
+         */
+        size_t last_token_length;
+        /**
+         * @brief Length of the surface form of the last appended token in UTF-8 chars (SIZE_MAX: the saved token is
+         * the surface form; the chars will be counted with last_token_length)
+         */
+        size_t last_token_chars;
         /**
          * @brief ID of the data set
          *
@@ -92,6 +111,35 @@ struct Token_List_Container
     struct Two_Dim_C_String_Array* list_of_too_long_token;  ///< List of tokens, that are longer than expected
 };
 
+/**
+ * @brief Parser for the JSON input files.
+ */
+enum JSON_Parser_Mode
+{
+    JSON_PARSER_STREAMING = 0,  ///< Streaming scanner; reads only the data set IDs, the tokens and the char offsets
+    JSON_PARSER_CJSON           ///< Validating cJSON parser; creates the full DOM of every JSON fragment
+};
+
+/**
+ * @brief JSON array, whose strings will be saved as tokens. (The char offsets are always determined with the surface
+ * tokens)
+ */
+enum JSON_Token_Array
+{
+    JSON_TOKEN_ARRAY_TOKENS = 0,    ///< Surface tokens ("tokens" array)
+    JSON_TOKEN_ARRAY_LEMMA          ///< Lemmas ("lemma" array); tokens without a lemma string keep the surface form
+};
+
+/**
+ * @brief Function, that gets the Token_List objects of a streamed file. (See TokenListContainer_StreamFile())
+ *
+ * The Token_List object is only valid while the call; after the call the memory will be reused for the next data set.
+ *
+ * @param[in] token_list Token_List object with the tokens of one data set
+ * @param[in] consumer_data Data of the consumer (e.g. the object, that will be filled)
+ */
+typedef void (*Token_List_Consumer) (const struct Token_List* const token_list, void* const consumer_data);
+
 //=====================================================================================================================
 
 /**
@@ -111,6 +159,73 @@ TokenListContainer_CreateObject
         const char* const file_name
 );
 
+/**
+ * @brief Create the token list from a file with several threads.
+ *
+ * The file will be split at line begins in one chunk per thread. Every thread parses its chunk in a own
+ * Token_List_Container. At the end the containers will be concatenated in the file order. So the order and the IDs of
+ * the data sets are equal with the result of TokenListContainer_CreateObject().
+ *
+ * With one thread the file will be parsed without additional threads.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Number of threads, that parse the file
+ * @param[in] json_parser_mode Parser for JSON files (TokenListContainer_CreateObject() uses the streaming scanner)
+ * @param[in] token_array JSON array with the tokens (TokenListContainer_CreateObject() uses the surface tokens)
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+extern struct Token_List_Container*
+TokenListContainer_CreateObjectParallel
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array
+);
+
+/**
+ * @brief Read a file and give every Token_List object to a consumer instead of collecting them in a container.
+ *
+ * With one thread the Token_List objects of a line will be given to the consumer directly after the line was parsed;
+ * afterwards the memory will be reused for the next line. So the tokens of the whole file are never in the memory at
+ * the same time. With several threads the chunks will be parsed in parallel (See
+ * TokenListContainer_CreateObjectParallel()) and the consumer gets the Token_List objects after the parsing.
+ *
+ * In both cases the consumer gets the Token_List objects in the file order. Token_List objects without tokens will
+ * also be given to the consumer.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *      consumer != NULL
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Number of threads, that parse the file
+ * @param[in] json_parser_mode Parser for JSON files
+ * @param[in] token_array JSON array with the tokens
+ * @param[in] consumer Function, that gets every Token_List object
+ * @param[in] consumer_data Data, that will be given to the consumer
+ *
+ * @return List of the too long tokens (The caller is responsible for the deletion)
+ */
+extern struct Two_Dim_C_String_Array*
+TokenListContainer_StreamFile
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode,
+        const enum JSON_Token_Array token_array,
+        const Token_List_Consumer consumer,
+        void* const consumer_data
+);
+
 /**
  * @brief Delete a dynamic allocated Delete_Token_Container object.
  *
@@ -335,6 +450,44 @@ TokenListContainer_ShowAttributes
         const struct Token_List_Container* const container
 );
 
+/**
+ * @brief Read a specific token from a Token_List.
+ *
+ * Asserts:
+ *      token_list != NULL
+ *      index_token < token_list->next_free_element
+ *
+ * @param[in] token_list Token_List object
+ * @param[in] index_token Index of the token in the Token_List object
+ *
+ * @return Pointer at the begin of the token. (token is terminated with a null byte !)
+ */
+extern const char*
+TokenList_GetToken
+(
+        const struct Token_List* const token_list,
+        const uint_fast32_t index_token
+);
+
+/**
+ * @brief Read the surface form of a specific token from a Token_List. Without a lemma it is the token itself.
+ *
+ * Asserts:
+ *      token_list != NULL
+ *      index_token < token_list->next_free_element
+ *
+ * @param[in] token_list Token_List object
+ * @param[in] index_token Index of the token in the Token_List object
+ *
+ * @return Pointer at the begin of the surface form. (token is terminated with a null byte !)
+ */
+extern const char*
+TokenList_GetSurfaceToken
+(
+        const struct Token_List* const token_list,
+        const uint_fast32_t index_token
+);
+
 /**
  * @brief Add a tuple with the three offsets to a Token_List.
  *
@@ -333,6 +333,8 @@ IntersectionApproach_HeapSortAndBinarySearch
  *      word_offsets != NULL
  *
  * @param[in] data_1 Data, that will be used for the intersection with the second data array
+ * @param[in] output_data_1 Values, that will be saved in the result instead of data_1 (Same length as data_1; e.g. the
+ * surface forms of lemmas) (NULL: data_1 will be saved)
  * @param[in] char_offsets Char offsets of the data focused on the source file, that was also the source for data_1
  * @param[in] sentence_offsets Sentence offsets of the data focused on the source file, that was also the source for data_1
  * @param[in] word_offset Offset of the words focused on the source file
@@ -349,6 +351,7 @@ extern struct Document_Word_List*
 IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 (
     const uint_fast32_t* const restrict data_1,
+    const uint_fast32_t* const restrict output_data_1,
     const CHAR_OFFSET_TYPE* const restrict char_offsets,
     const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
     const WORD_OFFSET_TYPE* const restrict word_offsets,
@@ -422,6 +425,9 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
     ASSERT_ALLOC(multiple_guard_data_2, "Cannot create the multiple guard for data 2 !", data_2_length * sizeof (_Bool));
 #endif /* __STDC_NO_VLA__ */
 
+    // The matches will be determined with data_1; the result contains the values of output_data_1
+    const uint_fast32_t* const result_values = (output_data_1 != NULL) ? output_data_1 : data_1;
+
     // Calculate intersection
     for (register size_t d1 = 0; d1 < data_1_length; ++ d1)
     {
@@ -432,7 +438,7 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
                 // Was the current value already inserted in the intersection result ?
                 if (! multiple_guard_data_1 [d1] && ! multiple_guard_data_2 [d2])
                 {
-                    Put_One_Value_And_Offset_Types_To_Document_Word_List(intersection_result, data_1 [d1],
+                    Put_One_Value_And_Offset_Types_To_Document_Word_List(intersection_result, result_values [d1],
                             char_offsets [d1], sentence_offsets [d1], word_offsets [d1]);
                     multiple_guard_data_1 [d1] = true;
                     multiple_guard_data_2 [d2] = true;
@@ -471,6 +477,95 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 
     return intersection_result;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine only the number of intersection values between two raw data arrays. No result object will be
+ * created.
+ *
+ * Every value of the first array can match one value of the second array and vice versa (the same rule as in
+ * IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays()). So the result is equal with the length of the
+ * intersection result of this function.
+ *
+ * The counting stops early, when
+ *      - "stop_after_matches" matches were found or
+ *      - "min_matches" matches cannot be reached with the remaining values of the first array.
+ * In the second case the result is smaller than "min_matches"; the exact number is not determined.
+ *
+ * ATTENTION: Here are two raw data arrays used. NO Document_Word_List as one of the input parameter.
+ *
+ * Asserts:
+ *      data_1 != NULL
+ *      data_2 != NULL
+ *
+ * @param[in] data_1 Data, that will be used for the intersection with the second data array
+ * @param[in] data_1_length Number of the elements in the first data array
+ * @param[in] data_2 Data, that will be used for the intersection with the first data array
+ * @param[in] data_2_length Number of the elements in the second data array
+ * @param[in] min_matches Minimum number of matches, that are necessary for a valid result
+ * @param[in] stop_after_matches Stop the counting, when this number of matches were found (SIZE_MAX: exact counting)
+ *
+ * @return Number of matches (See the rules for an early stop)
+ */
+extern size_t
+IntersectionApproach_CountMatchesWithTwoRawDataArrays
+(
+    const uint_fast32_t* const restrict data_1,
+    const size_t data_1_length,
+    const uint_fast32_t* const restrict data_2,
+    const size_t data_2_length,
+    const size_t min_matches,
+    const size_t stop_after_matches
+)
+{
+    ASSERT_MSG(data_1 != NULL, "Data 1 is NULL !");
+    ASSERT_MSG(data_2 != NULL, "Data 2 is NULL !");
+
+    // Not enough values in the second array for a valid result
+    if (data_2_length == 0 || data_2_length < min_matches)
+    {
+        return 0;
+    }
+
+#ifndef __STDC_NO_VLA__
+    #ifndef UNSAFE_VLA_USAGE
+        ASSERT_FMSG(data_2_length <= MAX_VLA_LENGTH, "Length of the data 2 is too large for VLA ! Max. valid: %zu; Got %zu !",
+                MAX_VLA_LENGTH, data_2_length);
+    #endif /* UNSAFE_VLA_USAGE */
+    // Array, which display, if a value of the second array was already matched
+    _Bool multiple_guard_data_2 [data_2_length];
+    memset(multiple_guard_data_2, '\0', data_2_length);
+#else
+    _Bool* multiple_guard_data_2 = (_Bool*) CALLOC(data_2_length, sizeof (_Bool));
+    ASSERT_ALLOC(multiple_guard_data_2, "Cannot create the multiple guard for data 2 !", data_2_length * sizeof (_Bool));
+#endif /* __STDC_NO_VLA__ */
+
+    size_t matches = 0;
+    for (register size_t d1 = 0; d1 < data_1_length; ++ d1)
+    {
+        // Even when every remaining value matches, the minimum cannot be reached
+        if (matches + (data_1_length - d1) < min_matches) { break; }
+
+        for (register size_t d2 = 0; d2 < data_2_length; ++ d2)
+        {
+            if (data_1 [d1] == data_2 [d2] && ! multiple_guard_data_2 [d2])
+            {
+                multiple_guard_data_2 [d2] = true;
+                ++ matches;
+                break;
+            }
+        }
+
+        if (matches >= stop_after_matches) { break; }
+    }
+
+#ifdef __STDC_NO_VLA__
+    FREE_AND_SET_TO_NULL(multiple_guard_data_2);
+#endif /* __STDC_NO_VLA__ */
+
+    return matches;
+}
 // Enable the -Wstack-protector warning again
 #ifdef __GNUC__
     #pragma GCC diagnostic pop
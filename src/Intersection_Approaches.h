@@ -118,6 +118,8 @@ IntersectionApproach_HeapSortAndBinarySearch
  *      word_offsets != NULL
  *
  * @param[in] data_1 Data, that will be used for the intersection with the second data array
+ * @param[in] output_data_1 Values, that will be saved in the result instead of data_1 (Same length as data_1; e.g. the
+ * surface forms of lemmas) (NULL: data_1 will be saved)
  * @param[in] char_offsets Char offsets of the data focused on the source file, that was also the source for data_1
  * @param[in] sentence_offsets Sentence offsets of the data focused on the source file, that was also the source for data_1
  * @param[in] word_offset Offset of the words focused on the source file
@@ -134,6 +136,7 @@ extern struct Document_Word_List*
 IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 (
     const uint_fast32_t* const restrict data_1,
+    const uint_fast32_t* const restrict output_data_1,
     const CHAR_OFFSET_TYPE* const restrict char_offsets,
     const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
     const WORD_OFFSET_TYPE* const restrict word_offsets,
@@ -146,6 +149,45 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 );
 
 
+/**
+ * @brief Determine only the number of intersection values between two raw data arrays. No result object will be
+ * created.
+ *
+ * Every value of the first array can match one value of the second array and vice versa (the same rule as in
+ * IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays()). So the result is equal with the length of the
+ * intersection result of this function.
+ *
+ * The counting stops early, when
+ *      - "stop_after_matches" matches were found or
+ *      - "min_matches" matches cannot be reached with the remaining values of the first array.
+ * In the second case the result is smaller than "min_matches"; the exact number is not determined.
+ *
+ * ATTENTION: Here are two raw data arrays used. NO Document_Word_List as one of the input parameter.
+ *
+ * Asserts:
+ *      data_1 != NULL
+ *      data_2 != NULL
+ *
+ * @param[in] data_1 Data, that will be used for the intersection with the second data array
+ * @param[in] data_1_length Number of the elements in the first data array
+ * @param[in] data_2 Data, that will be used for the intersection with the first data array
+ * @param[in] data_2_length Number of the elements in the second data array
+ * @param[in] min_matches Minimum number of matches, that are necessary for a valid result
+ * @param[in] stop_after_matches Stop the counting, when this number of matches were found (SIZE_MAX: exact counting)
+ *
+ * @return Number of matches (See the rules for an early stop)
+ */
+extern size_t
+IntersectionApproach_CountMatchesWithTwoRawDataArrays
+(
+    const uint_fast32_t* const restrict data_1,
+    const size_t data_1_length,
+    const uint_fast32_t* const restrict data_2,
+    const size_t data_2_length,
+    const size_t min_matches,
+    const size_t stop_after_matches
+);
+
 
 #ifdef __cplusplus
 }
@@ -89,7 +89,12 @@ typedef struct {
     const unsigned char *json;
     size_t position;
 } error;
+/* The file reader parses with several threads; every thread needs an own error position */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+static _Thread_local error global_error = { NULL, 0 };
+#else
 static error global_error = { NULL, 0 };
+#endif
 
 CJSON_PUBLIC(const char *) cJSON_GetErrorPtr(void)
 {
@@ -237,6 +242,126 @@ CJSON_PUBLIC(void) cJSON_InitHooks(cJSON_Hooks* hooks)
     }
 }
 
+/* Arena for parse trees, that will be discarded as a whole. Every block begins with this header */
+typedef struct cJSON_Arena_Block
+{
+    struct cJSON_Arena_Block *next;
+    size_t size; /* usable bytes behind the header */
+    size_t used;
+} cJSON_Arena_Block;
+
+struct cJSON_Arena
+{
+    cJSON_Arena_Block *first;
+    cJSON_Arena_Block *current;
+    size_t block_size;
+};
+
+/* every allocation in the arena is aligned for all members of a cJSON item */
+typedef union
+{
+    double number;
+    void *pointer;
+    size_t size;
+} arena_alignment;
+
+#define arena_align(size) ((((size) + sizeof(arena_alignment) - 1) / sizeof(arena_alignment)) * sizeof(arena_alignment))
+#define arena_block_data(block) ((unsigned char*)(block) + arena_align(sizeof(cJSON_Arena_Block)))
+
+static cJSON_Arena_Block *arena_new_block(size_t size)
+{
+    cJSON_Arena_Block *block = (cJSON_Arena_Block*)global_hooks.allocate(arena_align(sizeof(cJSON_Arena_Block)) + size);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+
+    return block;
+}
+
+static void *arena_allocate(cJSON_Arena * const arena, size_t size)
+{
+    cJSON_Arena_Block *block = arena->current;
+    void *memory = NULL;
+
+    size = arena_align(size);
+
+    /* the blocks behind the current block are left over from the last reset and can be reused */
+    while ((block->size - block->used) < size)
+    {
+        if (block->next == NULL)
+        {
+            cJSON_Arena_Block *new_block = arena_new_block((size > arena->block_size) ? size : arena->block_size);
+            if (new_block == NULL)
+            {
+                return NULL;
+            }
+            block->next = new_block;
+        }
+        block = block->next;
+        block->used = 0;
+    }
+    arena->current = block;
+
+    memory = arena_block_data(block) + block->used;
+    block->used += size;
+
+    return memory;
+}
+
+CJSON_PUBLIC(cJSON_Arena *) cJSON_CreateArena(size_t block_size)
+{
+    cJSON_Arena *arena = (cJSON_Arena*)global_hooks.allocate(sizeof(cJSON_Arena));
+    if (arena == NULL)
+    {
+        return NULL;
+    }
+
+    arena->block_size = arena_align((block_size > 0) ? block_size : sizeof(cJSON));
+    arena->first = arena_new_block(arena->block_size);
+    if (arena->first == NULL)
+    {
+        global_hooks.deallocate(arena);
+        return NULL;
+    }
+    arena->current = arena->first;
+
+    return arena;
+}
+
+CJSON_PUBLIC(void) cJSON_ResetArena(cJSON_Arena *arena)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    arena->current = arena->first;
+    arena->first->used = 0;
+}
+
+CJSON_PUBLIC(void) cJSON_DeleteArena(cJSON_Arena *arena)
+{
+    cJSON_Arena_Block *block = NULL;
+
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    block = arena->first;
+    while (block != NULL)
+    {
+        cJSON_Arena_Block *next = block->next;
+        global_hooks.deallocate(block);
+        block = next;
+    }
+    global_hooks.deallocate(arena);
+}
+
 /* Internal constructor. */
 static cJSON *cJSON_New_Item(const internal_hooks * const hooks)
 {
@@ -291,8 +416,42 @@ typedef struct
     size_t offset;
     size_t depth; /* How deeply nested (in arrays/objects) is the input at the current offset. */
     internal_hooks hooks;
+    /* in-situ mode: writable alias of content. The strings will be decoded in the input and not in new buffers */
+    unsigned char *in_situ_content;
+    /* arena mode: the items and strings will be allocated in the arena and released with cJSON_ResetArena */
+    cJSON_Arena *arena;
 } parse_buffer;
 
+static void *parse_allocate(parse_buffer * const input_buffer, size_t size)
+{
+    if (input_buffer->arena != NULL)
+    {
+        return arena_allocate(input_buffer->arena, size);
+    }
+
+    return input_buffer->hooks.allocate(size);
+}
+
+static cJSON *parse_new_item(parse_buffer * const input_buffer)
+{
+    cJSON *node = (cJSON*)parse_allocate(input_buffer, sizeof(cJSON));
+    if (node)
+    {
+        memset(node, '\0', sizeof(cJSON));
+    }
+
+    return node;
+}
+
+/* items of an arena will be released with the arena */
+static void parse_delete(const parse_buffer * const input_buffer, cJSON *item)
+{
+    if (input_buffer->arena == NULL)
+    {
+        cJSON_Delete(item);
+    }
+}
+
 /* check if the given size is left to read in a given parse buffer (starting with 1) */
 #define can_read(buffer, size) ((buffer != NULL) && (((buffer)->offset + size) <= (buffer)->length))
 /* check if the buffer can be accessed at the given index (starting with 0) */
@@ -572,7 +731,8 @@ static cJSON_bool print_number(const cJSON * const item, printbuffer * const out
     }
     //else if(d == (double)item->valueint)
     // It's better to use this comparison, because item->valueint is before the cast an integer value !
-    else if((int) d == item->valueint)
+    // The truncated value alone is not enough: (int) 0.2 == 0 would print a fraction as integer
+    else if((int) d == item->valueint && compare_double((double) item->valueint, d))
     {
         length = sprintf((char*)number_buffer, "%d", item->valueint);
     }
@@ -817,12 +977,21 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
             goto fail; /* string ended unexpectedly */
         }
 
-        /* This is at most how much we need for the output */
-        allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
-        output = (unsigned char*)input_buffer->hooks.allocate(allocation_length + sizeof(""));
-        if (output == NULL)
+        if (input_buffer->in_situ_content != NULL)
         {
-            goto fail; /* allocation failure */
+            /* the decoded string is never longer than the literal, so it can overwrite the literal from the begin
+             * to the closing quote (the closing quote becomes the terminator) */
+            output = input_buffer->in_situ_content + (input_pointer - input_buffer->content);
+        }
+        else
+        {
+            /* This is at most how much we need for the output */
+            allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
+            output = (unsigned char*)parse_allocate(input_buffer, allocation_length + sizeof(""));
+            if (output == NULL)
+            {
+                goto fail; /* allocation failure */
+            }
         }
     }
 
@@ -886,7 +1055,8 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
     /* zero terminate the output */
     *output_pointer = '\0';
 
-    item->type = cJSON_String;
+    /* in-situ strings are owned by the input buffer, so cJSON_Delete must not free them */
+    item->type = (input_buffer->in_situ_content != NULL) ? (cJSON_String | cJSON_IsReference) : cJSON_String;
     item->valuestring = (char*)output;
 
     input_buffer->offset = (size_t) (input_end - input_buffer->content);
@@ -895,7 +1065,7 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
     return true;
 
 fail:
-    if (output != NULL)
+    if (output != NULL && input_buffer->in_situ_content == NULL && input_buffer->arena == NULL)
     {
         input_buffer->hooks.deallocate(output);
     }
@@ -1101,10 +1271,11 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return
     return cJSON_ParseWithLengthOpts(value, buffer_length, return_parse_end, require_null_terminated);
 }
 
-/* Parse an object - create a new root, and populate. */
-CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated)
+/* Parse an object - create a new root, and populate. With in_situ_content != NULL the strings will be decoded in value;
+ * with arena != NULL all memory comes from the arena */
+static cJSON *parse_with_length_opts(const char *value, unsigned char *in_situ_content, cJSON_Arena *arena, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated)
 {
-    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 } };
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0 };
     cJSON *item = NULL;
 
     /* reset error position */
@@ -1120,8 +1291,10 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer
     buffer.length = buffer_length;
     buffer.offset = 0;
     buffer.hooks = global_hooks;
+    buffer.in_situ_content = in_situ_content;
+    buffer.arena = arena;
 
-    item = cJSON_New_Item(&global_hooks);
+    item = parse_new_item(&buffer);
     if (item == NULL) /* memory fail */
     {
         goto fail;
@@ -1152,7 +1325,7 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer
 fail:
     if (item != NULL)
     {
-        cJSON_Delete(item);
+        parse_delete(&buffer, item);
     }
 
     if (value != NULL)
@@ -1181,6 +1354,26 @@ fail:
     return NULL;
 }
 
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    return parse_with_length_opts(value, NULL, NULL, buffer_length, return_parse_end, require_null_terminated);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInSituWithLengthOpts(char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    return parse_with_length_opts(value, (unsigned char*)value, NULL, buffer_length, return_parse_end, require_null_terminated);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInSituWithArena(char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated, cJSON_Arena *arena)
+{
+    if (arena == NULL)
+    {
+        return NULL;
+    }
+
+    return parse_with_length_opts(value, (unsigned char*)value, arena, buffer_length, return_parse_end, require_null_terminated);
+}
+
 /* Default options for cJSON_Parse */
 CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value)
 {
@@ -1486,7 +1679,7 @@ static cJSON_bool parse_array(cJSON * const item, parse_buffer * const input_buf
     do
     {
         /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
+        cJSON *new_item = parse_new_item(input_buffer);
         if (new_item == NULL)
         {
             goto fail; /* allocation failure */
@@ -1539,7 +1732,7 @@ success:
 fail:
     if (head != NULL)
     {
-        cJSON_Delete(head);
+        parse_delete(input_buffer, head);
     }
 
     return false;
@@ -1644,7 +1837,7 @@ static cJSON_bool parse_object(cJSON * const item, parse_buffer * const input_bu
     do
     {
         /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
+        cJSON *new_item = parse_new_item(input_buffer);
         if (new_item == NULL)
         {
             goto fail; /* allocation failure */
@@ -1676,6 +1869,10 @@ static cJSON_bool parse_object(cJSON * const item, parse_buffer * const input_bu
         /* swap valuestring and string, because we parsed the name */
         current_item->string = current_item->valuestring;
         current_item->valuestring = NULL;
+        if (input_buffer->in_situ_content != NULL)
+        {
+            current_item->type |= cJSON_StringIsConst;
+        }
 
         if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != ':'))
         {
@@ -1689,6 +1886,11 @@ static cJSON_bool parse_object(cJSON * const item, parse_buffer * const input_bu
         {
             goto fail; /* failed to parse value */
         }
+        /* parse_value overwrites the type; the in-situ name still belongs to the input buffer */
+        if (input_buffer->in_situ_content != NULL)
+        {
+            current_item->type |= cJSON_StringIsConst;
+        }
         buffer_skip_whitespace(input_buffer);
     }
     while (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ','));
@@ -1714,7 +1916,7 @@ success:
 fail:
     if (head != NULL)
     {
-        cJSON_Delete(head);
+        parse_delete(input_buffer, head);
     }
 
     return false;
@@ -131,6 +131,9 @@ typedef struct cJSON_Hooks
 
 typedef int cJSON_bool;
 
+/* Bump allocator for parse trees, that will be discarded as a whole (see cJSON_ParseInSituWithArena) */
+typedef struct cJSON_Arena cJSON_Arena;
+
 /* Limits how deeply nested arrays/objects can be before cJSON rejects to parse them.
  * This is to prevent stack overflows. */
 #ifndef CJSON_NESTING_LIMIT
@@ -151,6 +154,17 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithLength(const char *value, size_t buffer_len
 /* If you supply a ptr in return_parse_end and parsing fails, then return_parse_end will contain a pointer to the error so will match cJSON_GetErrorPtr(). */
 CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated);
 CJSON_PUBLIC(cJSON *) cJSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated);
+/* In-situ parsing: the strings will be decoded in the (writable) input buffer instead of new allocated buffers. All names
+ * and string values of the result point into value; therefore value must outlive the result and its content is
+ * undefined after the call. cJSON_Delete does not free these strings (cJSON_IsReference / cJSON_StringIsConst). */
+CJSON_PUBLIC(cJSON *) cJSON_ParseInSituWithLengthOpts(char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated);
+/* In-situ parsing, where all items come from the arena. The result must NOT be deleted with cJSON_Delete; it is valid
+ * until the next cJSON_ResetArena, which releases all trees of the arena at once and keeps the blocks for reuse. An
+ * arena is not thread safe: use one arena per thread. The blocks will be allocated with the cJSON hooks. */
+CJSON_PUBLIC(cJSON *) cJSON_ParseInSituWithArena(char *value, size_t buffer_length, const char **return_parse_end, cJSON_bool require_null_terminated, cJSON_Arena *arena);
+CJSON_PUBLIC(cJSON_Arena *) cJSON_CreateArena(size_t block_size);
+CJSON_PUBLIC(void) cJSON_ResetArena(cJSON_Arena *arena);
+CJSON_PUBLIC(void) cJSON_DeleteArena(cJSON_Arena *arena);
 
 /* Render a cJSON entity to text for transfer/storage. */
 CJSON_PUBLIC(char *) cJSON_Print(const cJSON *item);
@@ -0,0 +1,752 @@
+/**
+ * @file JSON_Token_Scanner.c
+ *
+ * @brief A minimal streaming scanner for the JSON input files.
+ *
+ * From a JSON fragment the file reader needs only the data set IDs, the tokens arrays and the char offset arrays. cJSON
+ * builds a full DOM for every fragment, inclusive all other arrays (e.g. "text", "lemma", "pos"). This scanner works
+ * direct on the (not null terminated) file content: values, that are not necessary, will be skipped with memchr() and
+ * strings without escape sequences will be used without copying. Only strings with escape sequences will be decoded in
+ * a buffer of the scanner. The decoding is equal with the decoding of cJSON.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "JSON_Token_Scanner.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+
+
+
+/**
+ * @brief Initial size of the decode buffer.
+ */
+#ifndef DECODE_BUFFER_INITIAL_LENGTH
+#define DECODE_BUFFER_INITIAL_LENGTH 256
+#else
+#error "The macro \"DECODE_BUFFER_INITIAL_LENGTH\" is already defined !"
+#endif /* DECODE_BUFFER_INITIAL_LENGTH */
+
+/**
+ * @brief Max. number of chars in a number. (Longer numbers are not plausible in the input files)
+ */
+#ifndef MAX_NUMBER_LENGTH
+#define MAX_NUMBER_LENGTH 64
+#else
+#error "The macro \"MAX_NUMBER_LENGTH\" is already defined !"
+#endif /* MAX_NUMBER_LENGTH */
+
+/**
+ * @brief Check, whether the macro values are valid.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(DECODE_BUFFER_INITIAL_LENGTH > 0, "The marco \"DECODE_BUFFER_INITIAL_LENGTH\" is zero !");
+_Static_assert(MAX_NUMBER_LENGTH > 1, "The marco \"MAX_NUMBER_LENGTH\" needs to be at least 2 !");
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+/**
+ * @brief Find the closing quotation mark of a string.
+ *
+ * A quotation mark is escaped, when an odd number of backslashes is in front of it.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] string_begin First char behind the opening quotation mark
+ * @param[in] end End of the input data
+ *
+ * @return Position of the closing quotation mark or NULL, if the string is not terminated
+ */
+static const char*
+Find_String_End
+(
+        const char* const string_begin,
+        const char* const end
+);
+
+/**
+ * @brief Convert four hex digits to a number. Invalid digits result in 0. (Equal with parse_hex4() of cJSON)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input The four hex digits
+ *
+ * @return The converted number
+ */
+static unsigned int
+Parse_Hex4
+(
+        const unsigned char* const input
+);
+
+/**
+ * @brief Decode a string with escape sequences in the decode buffer. (Equal with parse_string() of cJSON)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object JSON_Token_Scanner object
+ * @param[in] string_begin First char behind the opening quotation mark
+ * @param[in] string_end Closing quotation mark
+ * @param[out] string View of the decoded string
+ *
+ * @return NULL, if the string was decoded, otherwise the position of the invalid escape sequence
+ */
+static const char*
+Decode_String
+(
+        struct JSON_Token_Scanner* const restrict object,
+        const char* const string_begin,
+        const char* const string_end,
+        struct JSON_String_View* const restrict string
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new JSON_Token_Scanner object.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Address to the new dynamic JSON_Token_Scanner object
+ */
+extern struct JSON_Token_Scanner*
+JSONTokenScanner_CreateObject
+(
+        void
+)
+{
+    struct JSON_Token_Scanner* new_object = (struct JSON_Token_Scanner*) CALLOC(1, sizeof (struct JSON_Token_Scanner));
+    ASSERT_ALLOC(new_object, "Cannot create a new JSON_Token_Scanner object !", sizeof (struct JSON_Token_Scanner));
+
+    new_object->decode_buffer_length = DECODE_BUFFER_INITIAL_LENGTH;
+    new_object->decode_buffer = (char*) MALLOC(new_object->decode_buffer_length * sizeof (char));
+    ASSERT_ALLOC(new_object->decode_buffer, "Cannot allocate memory for the decode buffer !",
+            new_object->decode_buffer_length * sizeof (char));
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a dynamic allocated JSON_Token_Scanner object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object
+ */
+extern void
+JSONTokenScanner_DeleteObject
+(
+        struct JSON_Token_Scanner* object
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Token_Scanner is NULL !");
+
+    FREE_AND_SET_TO_NULL(object->decode_buffer);
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Skip the whitespace and return the next char. The char will not be consumed.
+ *
+ * Asserts:
+ *      cursor != NULL
+ *
+ * @param[in, out] cursor JSON_Cursor object
+ *
+ * @return The next char or '\0' at the end of the input data
+ */
+extern char
+JSONTokenScanner_NextChar
+(
+        struct JSON_Cursor* const cursor
+)
+{
+    ASSERT_MSG(cursor != NULL, "JSON_Cursor is NULL !");
+
+    // Like cJSON: every char up to the space is whitespace
+    while (cursor->position < cursor->end && (unsigned char) *cursor->position <= 32)
+    {
+        ++ cursor->position;
+    }
+
+    return (cursor->position < cursor->end) ? *cursor->position : '\0';
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Skip the whitespace and consume the expected char.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object (gets the error position)
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[in] expected_char Expected char
+ *
+ * @return true, if the expected char was found, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_Expect
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        const char expected_char
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Token_Scanner is NULL !");
+    ASSERT_MSG(cursor != NULL, "JSON_Cursor is NULL !");
+
+    if (JSONTokenScanner_NextChar(cursor) != expected_char)
+    {
+        object->error_position = cursor->position;
+        return false;
+    }
+    ++ cursor->position;
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Go to the next element of an array or to the next member of an object.
+ *
+ * The cursor needs to be behind the opening bracket, when this function will be called the first time. Between the
+ * elements the ',' will be consumed; the closing bracket at the end too.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *      first_element != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object (gets the error position)
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[in, out] first_element Is it the first call for the current array / object ? (Will be set to false)
+ * @param[in] closing_bracket ']' for arrays, '}' for objects
+ *
+ * @return true, if a element follows; false at the end of the array / object or on a error
+ */
+extern _Bool
+JSONTokenScanner_NextElement
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        _Bool* const restrict first_element,
+        const char closing_bracket
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Token_Scanner is NULL !");
+    ASSERT_MSG(cursor != NULL, "JSON_Cursor is NULL !");
+    ASSERT_MSG(first_element != NULL, "First element flag is NULL !");
+
+    const char next_char = JSONTokenScanner_NextChar(cursor);
+
+    if (next_char == closing_bracket)
+    {
+        ++ cursor->position;
+        return false;
+    }
+    if (*first_element)
+    {
+        *first_element = false;
+        return true;
+    }
+    if (next_char == ',')
+    {
+        ++ cursor->position;
+        return true;
+    }
+
+    object->error_position = cursor->position;
+
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a string and decode the escape sequences.
+ *
+ * Strings without escape sequences will not be copied: the view points in the input data. Otherwise the view points in
+ * the decode buffer of the scanner; this view is only valid until the next string will be read.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *      string != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[out] string View of the decoded string
+ *
+ * @return true, if a valid string was read, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_ReadString
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        struct JSON_String_View* const restrict string
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Token_Scanner is NULL !");
+    ASSERT_MSG(cursor != NULL, "JSON_Cursor is NULL !");
+    ASSERT_MSG(string != NULL, "String view is NULL !");
+
+    if (JSONTokenScanner_NextChar(cursor) != '\"')
+    {
+        object->error_position = cursor->position;
+        return false;
+    }
+
+    const char* const string_begin = cursor->position + 1;
+    const char* const string_end = Find_String_End(string_begin, cursor->end);
+    if (string_end == NULL)
+    {
+        object->error_position = cursor->position;
+        return false;
+    }
+
+    const size_t raw_length = (size_t) (string_end - string_begin);
+    if (memchr(string_begin, '\\', raw_length) == NULL)
+    {
+        // The common case: the string can be used direct in the input data
+        string->data    = string_begin;
+        string->length  = raw_length;
+    }
+    else
+    {
+        const char* const invalid_escape_sequence = Decode_String(object, string_begin, string_end, string);
+        if (invalid_escape_sequence != NULL)
+        {
+            object->error_position = invalid_escape_sequence;
+            return false;
+        }
+    }
+    cursor->position = string_end + 1;
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a value as int. The conversion is equal with the valueint member of cJSON: numbers will be saturated to
+ * the int range; all other values will be skipped and result in 0.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *      value != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[out] value The int value
+ *
+ * @return true, if a value was read, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_ReadInt
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        int* const restrict value
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Token_Scanner is NULL !");
+    ASSERT_MSG(cursor != NULL, "JSON_Cursor is NULL !");
+    ASSERT_MSG(value != NULL, "Value is NULL !");
+
+    const char next_char = JSONTokenScanner_NextChar(cursor);
+    *value = 0;
+
+    if (next_char != '-' && (next_char < '0' || next_char > '9'))
+    {
+        return JSONTokenScanner_SkipValue(object, cursor);
+    }
+
+    // strtod() needs a null terminated string; the input data is not null terminated
+    char number [MAX_NUMBER_LENGTH];
+    size_t number_length = 0;
+    while (cursor->position + number_length < cursor->end && number_length < MAX_NUMBER_LENGTH - 1 &&
+            strchr("0123456789+-.eE", cursor->position [number_length]) != NULL)
+    {
+        number [number_length] = cursor->position [number_length];
+        ++ number_length;
+    }
+    number [number_length] = '\0';
+
+    char* number_end = NULL;
+    const double number_value = strtod(number, &number_end);
+    if (number_end == number)
+    {
+        object->error_position = cursor->position;
+        return false;
+    }
+    cursor->position += (number_end - number);
+
+    if (number_value >= INT_MAX)
+    {
+        *value = INT_MAX;
+    }
+    else if (number_value <= (double) INT_MIN)
+    {
+        *value = INT_MIN;
+    }
+    else
+    {
+        *value = (int) number_value;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Skip the next value (string, number, literal, array or object).
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object (gets the error position)
+ * @param[in, out] cursor JSON_Cursor object
+ *
+ * @return true, if a value was skipped, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_SkipValue
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Token_Scanner is NULL !");
+    ASSERT_MSG(cursor != NULL, "JSON_Cursor is NULL !");
+
+    const char next_char = JSONTokenScanner_NextChar(cursor);
+    const char* const value_begin = cursor->position;
+    const char* position = value_begin;
+
+    if (next_char == '\"')
+    {
+        const char* const string_end = Find_String_End(position + 1, cursor->end);
+        if (string_end == NULL)
+        {
+            object->error_position = value_begin;
+            return false;
+        }
+        cursor->position = string_end + 1;
+    }
+    else if (next_char == '[' || next_char == '{')
+    {
+        // Only the brackets outside of the strings are relevant
+        size_t depth = 0;
+        while (position < cursor->end)
+        {
+            const char c = *position;
+            if (c == '\"')
+            {
+                const char* const string_end = Find_String_End(position + 1, cursor->end);
+                if (string_end == NULL) { break; }
+                position = string_end + 1;
+                continue;
+            }
+            ++ position;
+            if (c == '[' || c == '{')
+            {
+                ++ depth;
+            }
+            else if (c == ']' || c == '}')
+            {
+                -- depth;
+                if (depth == 0)
+                {
+                    cursor->position = position;
+                    return true;
+                }
+            }
+        }
+        object->error_position = value_begin;
+        return false;
+    }
+    else
+    {
+        // Numbers and the literals true, false and null
+        while (position < cursor->end && strchr("0123456789+-.eEtrufalsn", *position) != NULL && *position != '\0')
+        {
+            ++ position;
+        }
+        if (position == value_begin)
+        {
+            object->error_position = value_begin;
+            return false;
+        }
+        cursor->position = position;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compare a string view with a c string.
+ *
+ * Asserts:
+ *      string != NULL
+ *      c_str != NULL
+ *
+ * @param[in] string String view
+ * @param[in] c_str Null terminated c string
+ *
+ * @return true, if both strings are equal, otherwise false
+ */
+extern _Bool
+JSONTokenScanner_StringEquals
+(
+        const struct JSON_String_View* const restrict string,
+        const char* const restrict c_str
+)
+{
+    ASSERT_MSG(string != NULL, "String view is NULL !");
+    ASSERT_MSG(c_str != NULL, "C string is NULL !");
+
+    return strlen(c_str) == string->length && memcmp(string->data, c_str, string->length) == 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Find the closing quotation mark of a string.
+ *
+ * A quotation mark is escaped, when an odd number of backslashes is in front of it.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] string_begin First char behind the opening quotation mark
+ * @param[in] end End of the input data
+ *
+ * @return Position of the closing quotation mark or NULL, if the string is not terminated
+ */
+static const char*
+Find_String_End
+(
+        const char* const string_begin,
+        const char* const end
+)
+{
+    const char* position = string_begin;
+
+    while (position < end)
+    {
+        const char* const quotation_mark = (const char*) memchr(position, '\"', (size_t) (end - position));
+        if (quotation_mark == NULL) { return NULL; }
+
+        size_t backslashes = 0;
+        while (quotation_mark - backslashes > string_begin && *(quotation_mark - backslashes - 1) == '\\')
+        {
+            ++ backslashes;
+        }
+        if (backslashes % 2 == 0) { return quotation_mark; }
+
+        position = quotation_mark + 1;
+    }
+
+    return NULL;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Convert four hex digits to a number. Invalid digits result in 0. (Equal with parse_hex4() of cJSON)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input The four hex digits
+ *
+ * @return The converted number
+ */
+static unsigned int
+Parse_Hex4
+(
+        const unsigned char* const input
+)
+{
+    unsigned int result = 0;
+
+    for (size_t i = 0; i < 4; ++ i)
+    {
+        result <<= 4;
+        if (input [i] >= '0' && input [i] <= '9')
+        {
+            result += (unsigned int) input [i] - '0';
+        }
+        else if (input [i] >= 'A' && input [i] <= 'F')
+        {
+            result += (unsigned int) 10 + input [i] - 'A';
+        }
+        else if (input [i] >= 'a' && input [i] <= 'f')
+        {
+            result += (unsigned int) 10 + input [i] - 'a';
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Decode a string with escape sequences in the decode buffer. (Equal with parse_string() of cJSON)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object JSON_Token_Scanner object
+ * @param[in] string_begin First char behind the opening quotation mark
+ * @param[in] string_end Closing quotation mark
+ * @param[out] string View of the decoded string
+ *
+ * @return NULL, if the string was decoded, otherwise the position of the invalid escape sequence
+ */
+static const char*
+Decode_String
+(
+        struct JSON_Token_Scanner* const restrict object,
+        const char* const string_begin,
+        const char* const string_end,
+        struct JSON_String_View* const restrict string
+)
+{
+    // The decoded string is never longer than the raw string
+    const size_t raw_length = (size_t) (string_end - string_begin);
+    if (raw_length > object->decode_buffer_length)
+    {
+        FREE_AND_SET_TO_NULL(object->decode_buffer);
+        object->decode_buffer_length = raw_length;
+        object->decode_buffer = (char*) MALLOC(object->decode_buffer_length * sizeof (char));
+        ASSERT_ALLOC(object->decode_buffer, "Cannot allocate memory for the decode buffer !",
+                object->decode_buffer_length * sizeof (char));
+    }
+
+    const unsigned char* input = (const unsigned char*) string_begin;
+    const unsigned char* const input_end = (const unsigned char*) string_end;
+    unsigned char* output = (unsigned char*) object->decode_buffer;
+
+    while (input < input_end)
+    {
+        if (*input != '\\')
+        {
+            *output++ = *input++;
+            continue;
+        }
+
+        size_t sequence_length = 2;
+        switch (input [1])
+        {
+        case 'b': *output++ = '\b'; break;
+        case 'f': *output++ = '\f'; break;
+        case 'n': *output++ = '\n'; break;
+        case 'r': *output++ = '\r'; break;
+        case 't': *output++ = '\t'; break;
+        case '\"':
+        case '\\':
+        case '/':
+            *output++ = input [1];
+            break;
+        case 'u':
+        {
+            // UTF-16 literal; a surrogate pair needs two literals
+            if (input_end - input < 6) { return (const char*) input; }
+            const unsigned int first_code = Parse_Hex4(input + 2);
+            unsigned long int codepoint = first_code;
+            sequence_length = 6;
+
+            if (first_code >= 0xDC00 && first_code <= 0xDFFF) { return (const char*) input; }
+            if (first_code >= 0xD800 && first_code <= 0xDBFF)
+            {
+                const unsigned char* const second_sequence = input + 6;
+                if (input_end - second_sequence < 6) { return (const char*) input; }
+                if (second_sequence [0] != '\\' || second_sequence [1] != 'u') { return (const char*) input; }
+                const unsigned int second_code = Parse_Hex4(second_sequence + 2);
+                if (second_code < 0xDC00 || second_code > 0xDFFF) { return (const char*) input; }
+
+                codepoint = 0x10000 + (((first_code & 0x3FF) << 10) | (second_code & 0x3FF));
+                sequence_length = 12;
+            }
+
+            // Encode the codepoint as UTF-8
+            if (codepoint < 0x80)
+            {
+                *output++ = (unsigned char) codepoint;
+            }
+            else if (codepoint < 0x800)
+            {
+                *output++ = (unsigned char) (0xC0 | (codepoint >> 6));
+                *output++ = (unsigned char) (0x80 | (codepoint & 0x3F));
+            }
+            else if (codepoint < 0x10000)
+            {
+                *output++ = (unsigned char) (0xE0 | (codepoint >> 12));
+                *output++ = (unsigned char) (0x80 | ((codepoint >> 6) & 0x3F));
+                *output++ = (unsigned char) (0x80 | (codepoint & 0x3F));
+            }
+            else
+            {
+                *output++ = (unsigned char) (0xF0 | (codepoint >> 18));
+                *output++ = (unsigned char) (0x80 | ((codepoint >> 12) & 0x3F));
+                *output++ = (unsigned char) (0x80 | ((codepoint >> 6) & 0x3F));
+                *output++ = (unsigned char) (0x80 | (codepoint & 0x3F));
+            }
+            break;
+        }
+        default:
+            return (const char*) input;
+        }
+        input += sequence_length;
+    }
+
+    // cJSON uses the decoded string as c string; an escaped null byte ends the string
+    const size_t decoded_length = (size_t) (output - (unsigned char*) object->decode_buffer);
+    const char* const null_byte = (const char*) memchr(object->decode_buffer, '\0', decoded_length);
+
+    string->data    = object->decode_buffer;
+    string->length  = (null_byte != NULL) ? (size_t) (null_byte - object->decode_buffer) : decoded_length;
+
+    return NULL;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+#ifdef DECODE_BUFFER_INITIAL_LENGTH
+#undef DECODE_BUFFER_INITIAL_LENGTH
+#endif /* DECODE_BUFFER_INITIAL_LENGTH */
+
+#ifdef MAX_NUMBER_LENGTH
+#undef MAX_NUMBER_LENGTH
+#endif /* MAX_NUMBER_LENGTH */
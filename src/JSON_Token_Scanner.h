@@ -0,0 +1,250 @@
+/**
+ * @file JSON_Token_Scanner.h
+ *
+ * @brief A minimal streaming scanner for the JSON input files.
+ *
+ * From a JSON fragment the file reader needs only the data set IDs, the tokens arrays and the char offset arrays. cJSON
+ * builds a full DOM for every fragment, inclusive all other arrays (e.g. "text", "lemma", "pos"). This scanner works
+ * direct on the (not null terminated) file content: values, that are not necessary, will be skipped with memchr() and
+ * strings without escape sequences will be used without copying. Only strings with escape sequences will be decoded in
+ * a buffer of the scanner. The decoding is equal with the decoding of cJSON.
+ *
+ * The scanner checks the member syntax of the objects and arrays, that will be read. Skipped values are only checked
+ * for terminated strings and balanced brackets. The full validation is still available with the cJSON parser.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef JSON_TOKEN_SCANNER_H
+#define JSON_TOKEN_SCANNER_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+
+
+
+//=====================================================================================================================
+
+/**
+ * @brief Position in the input data. Several cursors can iterate over the same input data.
+ */
+struct JSON_Cursor
+{
+    const char* position;               ///< Current position
+    const char* end;                    ///< End of the input data (exclusive)
+};
+
+/**
+ * @brief View of a decoded string. No null terminator at the end !
+ */
+struct JSON_String_View
+{
+    const char* data;                   ///< Begin of the string (in the input data or in the decode buffer)
+    size_t length;                      ///< Length of the string in bytes
+};
+
+/**
+ * @brief The JSON_Token_Scanner object.
+ */
+struct JSON_Token_Scanner
+{
+    char* decode_buffer;                ///< Buffer for strings with escape sequences
+    size_t decode_buffer_length;        ///< Allocated size of the decode buffer
+
+    const char* error_position;         ///< Position of the first syntax error (NULL: no error occurred)
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Create a new JSON_Token_Scanner object.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Address to the new dynamic JSON_Token_Scanner object
+ */
+extern struct JSON_Token_Scanner*
+JSONTokenScanner_CreateObject
+(
+        void
+);
+
+/**
+ * @brief Delete a dynamic allocated JSON_Token_Scanner object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object
+ */
+extern void
+JSONTokenScanner_DeleteObject
+(
+        struct JSON_Token_Scanner* object
+);
+
+/**
+ * @brief Skip the whitespace and return the next char. The char will not be consumed.
+ *
+ * Asserts:
+ *      cursor != NULL
+ *
+ * @param[in, out] cursor JSON_Cursor object
+ *
+ * @return The next char or '\0' at the end of the input data
+ */
+extern char
+JSONTokenScanner_NextChar
+(
+        struct JSON_Cursor* const cursor
+);
+
+/**
+ * @brief Skip the whitespace and consume the expected char.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object (gets the error position)
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[in] expected_char Expected char
+ *
+ * @return true, if the expected char was found, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_Expect
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        const char expected_char
+);
+
+/**
+ * @brief Go to the next element of an array or to the next member of an object.
+ *
+ * The cursor needs to be behind the opening bracket, when this function will be called the first time. Between the
+ * elements the ',' will be consumed; the closing bracket at the end too.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *      first_element != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object (gets the error position)
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[in, out] first_element Is it the first call for the current array / object ? (Will be set to false)
+ * @param[in] closing_bracket ']' for arrays, '}' for objects
+ *
+ * @return true, if a element follows; false at the end of the array / object or on a error
+ */
+extern _Bool
+JSONTokenScanner_NextElement
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        _Bool* const restrict first_element,
+        const char closing_bracket
+);
+
+/**
+ * @brief Read a string and decode the escape sequences.
+ *
+ * Strings without escape sequences will not be copied: the view points in the input data. Otherwise the view points in
+ * the decode buffer of the scanner; this view is only valid until the next string will be read.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *      string != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[out] string View of the decoded string
+ *
+ * @return true, if a valid string was read, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_ReadString
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        struct JSON_String_View* const restrict string
+);
+
+/**
+ * @brief Read a value as int. The conversion is equal with the valueint member of cJSON: numbers will be saturated to
+ * the int range; all other values will be skipped and result in 0.
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *      value != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object
+ * @param[in, out] cursor JSON_Cursor object
+ * @param[out] value The int value
+ *
+ * @return true, if a value was read, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_ReadInt
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor,
+        int* const restrict value
+);
+
+/**
+ * @brief Skip the next value (string, number, literal, array or object).
+ *
+ * Asserts:
+ *      object != NULL
+ *      cursor != NULL
+ *
+ * @param[in] object JSON_Token_Scanner object (gets the error position)
+ * @param[in, out] cursor JSON_Cursor object
+ *
+ * @return true, if a value was skipped, otherwise false (error)
+ */
+extern _Bool
+JSONTokenScanner_SkipValue
+(
+        struct JSON_Token_Scanner* const restrict object,
+        struct JSON_Cursor* const restrict cursor
+);
+
+/**
+ * @brief Compare a string view with a c string.
+ *
+ * Asserts:
+ *      string != NULL
+ *      c_str != NULL
+ *
+ * @param[in] string String view
+ * @param[in] c_str Null terminated c string
+ *
+ * @return true, if both strings are equal, otherwise false
+ */
+extern _Bool
+JSONTokenScanner_StringEquals
+(
+        const struct JSON_String_View* const restrict string,
+        const char* const restrict c_str
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* JSON_TOKEN_SCANNER_H */
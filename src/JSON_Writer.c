@@ -0,0 +1,722 @@
+/**
+ * @file JSON_Writer.c
+ *
+ * @brief A small streaming JSON writer, that writes keys, escaped strings and integers directly in a dynamic buffer.
+ *
+ * The result is byte identical to the output of cJSON_PrintBuffered() (formatted and unformatted). But there are no
+ * intermediate cJSON objects: no allocation for every token and no double conversion for every offset. The buffer
+ * will be reused after a JSONWriter_Reset() call; so in normal cases only a few allocations are necessary for the
+ * whole export.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "JSON_Writer.h"
+#include <string.h>
+#include <stdlib.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+
+
+
+/**
+ * @brief Make sure, that the buffer can hold additional "needed_bytes" bytes.
+ *
+ * The buffer size will be doubled, until the new data fits in the buffer.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] needed_bytes Number of bytes, that will be appended
+ */
+static inline void
+Ensure_Buffer_Size
+(
+        struct JSON_Writer* const object,
+        const size_t needed_bytes
+);
+
+/**
+ * @brief Write the separator, that is necessary before a new value.
+ *
+ * Only array elements need a separator before the value. The separator for object members will be written with the
+ * key.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ */
+static inline void
+Write_Value_Separator
+(
+        struct JSON_Writer* const object
+);
+
+/**
+ * @brief Write the escaped string (with the quotation marks) in the buffer.
+ *
+ * The escaping follows the rules of the cJSON function print_string_ptr().
+ *
+ * Asserts:
+ *      object != NULL
+ *      str != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] str String
+ * @param[in] str_length Length of the string
+ */
+static void
+Write_Escaped_String
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict str,
+        const size_t str_length
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new JSON_Writer object.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] format Formatted output ?
+ *
+ * @return Address to the new dynamic JSON_Writer
+ */
+extern struct JSON_Writer*
+JSONWriter_CreateObject
+(
+        const _Bool format
+)
+{
+    struct JSON_Writer* new_object = (struct JSON_Writer*) CALLOC(1, sizeof (struct JSON_Writer));
+    ASSERT_ALLOC(new_object, "Cannot create a new JSON_Writer object !", sizeof (struct JSON_Writer));
+    new_object->malloc_calloc_calls ++;
+
+    new_object->data = (char*) MALLOC(JSON_WRITER_INITIAL_BUFFER_SIZE * sizeof (char));
+    ASSERT_ALLOC(new_object->data, "Cannot create the buffer for a JSON_Writer object !",
+            JSON_WRITER_INITIAL_BUFFER_SIZE * sizeof (char));
+    new_object->malloc_calloc_calls ++;
+
+    new_object->allocated_bytes = JSON_WRITER_INITIAL_BUFFER_SIZE;
+    new_object->format          = format;
+    JSONWriter_Reset(new_object, 0);
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a dynamic allocated JSON_Writer object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_DeleteObject
+(
+        struct JSON_Writer* object
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+
+    FREE_AND_SET_TO_NULL(object->data);
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Reset the writer. The allocated buffer will be reused.
+ *
+ * With a depth > 0 the writer continues inside of an object, that was opened elsewhere (e.g. in an other
+ * JSON_Writer). This makes it possible to create the members of an object separately and append them later with
+ * JSONWriter_AppendMembers().
+ *
+ * Asserts:
+ *      object != NULL
+ *      depth < JSON_WRITER_MAX_DEPTH
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] depth Nesting depth of the object, that will get the next members
+ */
+extern void
+JSONWriter_Reset
+(
+        struct JSON_Writer* const object,
+        const size_t depth
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_FMSG(depth < JSON_WRITER_MAX_DEPTH, "Depth %zu is too large ! Max. valid: %d", depth,
+            JSON_WRITER_MAX_DEPTH - 1);
+
+    object->used_bytes                  = 0;
+    object->depth                       = depth;
+    object->is_array [depth]            = false;
+    object->element_written [depth]     = false;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Open a new JSON object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth + 1 < JSON_WRITER_MAX_DEPTH
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_BeginObject
+(
+        struct JSON_Writer* const object
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_FMSG(object->depth + 1 < JSON_WRITER_MAX_DEPTH, "Max. depth (%d) reached !", JSON_WRITER_MAX_DEPTH);
+
+    Write_Value_Separator(object);
+    Ensure_Buffer_Size(object, 2);
+
+    object->data [object->used_bytes ++] = '{';
+    if (object->format)
+    {
+        object->data [object->used_bytes ++] = '\n';
+    }
+
+    ++ object->depth;
+    object->is_array [object->depth]        = false;
+    object->element_written [object->depth] = false;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Close the current JSON object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth > 0
+ *      ! object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_EndObject
+(
+        struct JSON_Writer* const object
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(object->depth > 0, "There is no open object !");
+    ASSERT_MSG(! object->is_array [object->depth], "The current container is an array !");
+
+    // Formatted: A newline after the last member and the closing bracket with the indentation of the parent object
+    Ensure_Buffer_Size(object, object->depth + 1);
+    if (object->format)
+    {
+        if (object->element_written [object->depth])
+        {
+            object->data [object->used_bytes ++] = '\n';
+        }
+        memset (object->data + object->used_bytes, '\t', object->depth - 1);
+        object->used_bytes += object->depth - 1;
+    }
+    object->data [object->used_bytes ++] = '}';
+
+    -- object->depth;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Open a new JSON array.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth + 1 < JSON_WRITER_MAX_DEPTH
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_BeginArray
+(
+        struct JSON_Writer* const object
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_FMSG(object->depth + 1 < JSON_WRITER_MAX_DEPTH, "Max. depth (%d) reached !", JSON_WRITER_MAX_DEPTH);
+
+    Write_Value_Separator(object);
+    Ensure_Buffer_Size(object, 1);
+
+    object->data [object->used_bytes ++] = '[';
+
+    ++ object->depth;
+    object->is_array [object->depth]        = true;
+    object->element_written [object->depth] = false;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Close the current JSON array.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth > 0
+ *      object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_EndArray
+(
+        struct JSON_Writer* const object
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(object->depth > 0, "There is no open array !");
+    ASSERT_MSG(object->is_array [object->depth], "The current container is not an array !");
+
+    Ensure_Buffer_Size(object, 1);
+    object->data [object->used_bytes ++] = ']';
+
+    -- object->depth;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write the key of a new member in the current object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      key != NULL
+ *      ! object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] key Key of the member (will be escaped)
+ */
+extern void
+JSONWriter_AddKey
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict key
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(key != NULL, "Key is NULL !");
+    ASSERT_MSG(! object->is_array [object->depth], "A key is not allowed in an array !");
+
+    // Separator of the last member and the indentation
+    Ensure_Buffer_Size(object, object->depth + 2);
+    if (object->element_written [object->depth])
+    {
+        object->data [object->used_bytes ++] = ',';
+        if (object->format)
+        {
+            object->data [object->used_bytes ++] = '\n';
+        }
+    }
+    if (object->format)
+    {
+        memset (object->data + object->used_bytes, '\t', object->depth);
+        object->used_bytes += object->depth;
+    }
+    object->element_written [object->depth] = true;
+
+    Write_Escaped_String(object, key, strlen (key));
+
+    Ensure_Buffer_Size(object, 2);
+    object->data [object->used_bytes ++] = ':';
+    if (object->format)
+    {
+        object->data [object->used_bytes ++] = '\t';
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write an escaped string value.
+ *
+ * Asserts:
+ *      object != NULL
+ *      str != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] str String
+ * @param[in] str_length Length of the string
+ */
+extern void
+JSONWriter_AddString
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict str,
+        const size_t str_length
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(str != NULL, "String is NULL !");
+
+    Write_Value_Separator(object);
+    Write_Escaped_String(object, str, str_length);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write a string value, that is already escaped (with the quotation marks).
+ *
+ * Only the separator will be written before the data is copied. So strings, that are written many times (e.g. the
+ * tokens of the vocabulary), need to be escaped only once.
+ *
+ * Asserts:
+ *      object != NULL
+ *      escaped_str != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] escaped_str Escaped string with the quotation marks
+ * @param[in] escaped_str_length Length of the escaped string
+ */
+extern void
+JSONWriter_AddEscapedString
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict escaped_str,
+        const size_t escaped_str_length
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(escaped_str != NULL, "Escaped string is NULL !");
+
+    Write_Value_Separator(object);
+
+    Ensure_Buffer_Size(object, escaped_str_length);
+    memcpy (object->data + object->used_bytes, escaped_str, escaped_str_length);
+    object->used_bytes += escaped_str_length;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write an unsigned integer value.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] value Value
+ */
+extern void
+JSONWriter_AddUInt
+(
+        struct JSON_Writer* const object,
+        const uint_fast64_t value
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+
+    Write_Value_Separator(object);
+
+    // The digits will be created in reverse order
+    char digits [20];
+    size_t number_of_digits = 0;
+    uint_fast64_t remaining_value = value;
+    do
+    {
+        digits [number_of_digits ++] = (char) ('0' + (remaining_value % 10));
+        remaining_value /= 10;
+    } while (remaining_value != 0);
+
+    Ensure_Buffer_Size(object, number_of_digits);
+    while (number_of_digits > 0)
+    {
+        object->data [object->used_bytes ++] = digits [-- number_of_digits];
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append the members, that were created in the other JSON_Writer, to the current object.
+ *
+ * The member writer needs to be reseted with the depth of the current object in the destination writer.
+ *
+ * Asserts:
+ *      object != NULL
+ *      members != NULL
+ *      object->depth == members->depth
+ *      ! object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object (destination)
+ * @param[in] members JSON_Writer with the members
+ */
+extern void
+JSONWriter_AppendMembers
+(
+        struct JSON_Writer* const restrict object,
+        const struct JSON_Writer* const restrict members
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(members != NULL, "JSON_Writer with the members is NULL !");
+    ASSERT_FMSG(object->depth == members->depth, "Depth of the members (%zu) is not the depth of the object (%zu) !",
+            members->depth, object->depth);
+    ASSERT_MSG(! object->is_array [object->depth], "Members cannot be appended to an array !");
+
+    if (! members->element_written [members->depth])
+    {
+        return;
+    }
+
+    // The separator between the existing members and the new members
+    Ensure_Buffer_Size(object, members->used_bytes + 2);
+    if (object->element_written [object->depth])
+    {
+        object->data [object->used_bytes ++] = ',';
+        if (object->format)
+        {
+            object->data [object->used_bytes ++] = '\n';
+        }
+    }
+    memcpy (object->data + object->used_bytes, members->data, members->used_bytes);
+    object->used_bytes += members->used_bytes;
+    object->element_written [object->depth] = true;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append raw data to the buffer. There is no JSON handling (no separator, no escaping, no depth change).
+ *
+ * This is useful for separators between concatenated JSON values (e.g. the newline in a NDJSON file) or for the usage
+ * of the writer as a simple dynamic byte buffer.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] data Raw data
+ * @param[in] data_length Number of bytes
+ */
+extern void
+JSONWriter_AddRawData
+(
+        struct JSON_Writer* const restrict object,
+        const void* const restrict data,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(data != NULL, "Raw data is NULL !");
+
+    Ensure_Buffer_Size(object, data_length);
+    memcpy (object->data + object->used_bytes, data, data_length);
+    object->used_bytes += data_length;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the full memory usage in bytes.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+JSONWriter_GetAllocatedMemSize
+(
+        const struct JSON_Writer* const object
+)
+{
+    ASSERT_MSG(object != NULL, "JSON_Writer is NULL !");
+
+    return sizeof (struct JSON_Writer) + object->allocated_bytes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Make sure, that the buffer can hold additional "needed_bytes" bytes.
+ *
+ * The buffer size will be doubled, until the new data fits in the buffer.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] needed_bytes Number of bytes, that will be appended
+ */
+static inline void
+Ensure_Buffer_Size
+(
+        struct JSON_Writer* const object,
+        const size_t needed_bytes
+)
+{
+    if ((object->used_bytes + needed_bytes) <= object->allocated_bytes)
+    {
+        return;
+    }
+
+    size_t new_size = object->allocated_bytes;
+    while (new_size < (object->used_bytes + needed_bytes))
+    {
+        new_size *= 2;
+    }
+
+    char* new_data = (char*) REALLOC(object->data, new_size * sizeof (char));
+    ASSERT_ALLOC(new_data, "Cannot increase the buffer of a JSON_Writer object !", new_size * sizeof (char));
+    object->data            = new_data;
+    object->allocated_bytes = new_size;
+    object->realloc_calls ++;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write the separator, that is necessary before a new value.
+ *
+ * Only array elements need a separator before the value. The separator for object members will be written with the
+ * key.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ */
+static inline void
+Write_Value_Separator
+(
+        struct JSON_Writer* const object
+)
+{
+    if (! object->is_array [object->depth])
+    {
+        return;
+    }
+
+    if (object->element_written [object->depth])
+    {
+        Ensure_Buffer_Size(object, 2);
+        object->data [object->used_bytes ++] = ',';
+        if (object->format)
+        {
+            object->data [object->used_bytes ++] = ' ';
+        }
+    }
+    object->element_written [object->depth] = true;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write the escaped string (with the quotation marks) in the buffer.
+ *
+ * The escaping follows the rules of the cJSON function print_string_ptr().
+ *
+ * Asserts:
+ *      object != NULL
+ *      str != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] str String
+ * @param[in] str_length Length of the string
+ */
+static void
+Write_Escaped_String
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict str,
+        const size_t str_length
+)
+{
+    // Worst case: Every char needs an UTF-16 escape sequence (\uXXXX) + the two quotation marks
+    Ensure_Buffer_Size(object, (str_length * 6) + 2);
+
+    char* output = object->data + object->used_bytes;
+    *output ++ = '\"';
+
+    for (size_t i = 0; i < str_length; ++ i)
+    {
+        const unsigned char c = (unsigned char) str [i];
+
+        if (c > 31 && c != '\"' && c != '\\')
+        {
+            *output ++ = (char) c;
+            continue;
+        }
+
+        *output ++ = '\\';
+        switch (c)
+        {
+        case '\\':  *output ++ = '\\';  break;
+        case '\"':  *output ++ = '\"';  break;
+        case '\b':  *output ++ = 'b';   break;
+        case '\f':  *output ++ = 'f';   break;
+        case '\n':  *output ++ = 'n';   break;
+        case '\r':  *output ++ = 'r';   break;
+        case '\t':  *output ++ = 't';   break;
+        default:
+            // Escape and print as unicode codepoint
+            *output ++ = 'u';
+            *output ++ = '0';
+            *output ++ = '0';
+            *output ++ = "0123456789abcdef" [c >> 4];
+            *output ++ = "0123456789abcdef" [c & 0xF];
+            break;
+        }
+    }
+    *output ++ = '\"';
+
+    object->used_bytes = (size_t) (output - object->data);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,338 @@
+/**
+ * @file JSON_Writer.h
+ *
+ * @brief A small streaming JSON writer, that writes keys, escaped strings and integers directly in a dynamic buffer.
+ *
+ * The result is byte identical to the output of cJSON_PrintBuffered() (formatted and unformatted). But there are no
+ * intermediate cJSON objects: no allocation for every token and no double conversion for every offset. The buffer
+ * will be reused after a JSONWriter_Reset() call; so in normal cases only a few allocations are necessary for the
+ * whole export.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+#include "Error_Handling/_Generics.h"
+
+
+
+/**
+ * @brief Initial size of the output buffer in bytes.
+ */
+#ifndef JSON_WRITER_INITIAL_BUFFER_SIZE
+#define JSON_WRITER_INITIAL_BUFFER_SIZE 65536
+#else
+#error "The macro \"JSON_WRITER_INITIAL_BUFFER_SIZE\" is already defined !"
+#endif /* JSON_WRITER_INITIAL_BUFFER_SIZE */
+
+/**
+ * @brief Max. nesting depth of the JSON objects and arrays.
+ */
+#ifndef JSON_WRITER_MAX_DEPTH
+#define JSON_WRITER_MAX_DEPTH 16
+#else
+#error "The macro \"JSON_WRITER_MAX_DEPTH\" is already defined !"
+#endif /* JSON_WRITER_MAX_DEPTH */
+
+/**
+ * @brief Check, whether the macro values are valid.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(JSON_WRITER_INITIAL_BUFFER_SIZE > 0, "The marco \"JSON_WRITER_INITIAL_BUFFER_SIZE\" is zero !");
+_Static_assert(JSON_WRITER_MAX_DEPTH > 1, "The marco \"JSON_WRITER_MAX_DEPTH\" needs to be at least 2 !");
+
+IS_TYPE(JSON_WRITER_INITIAL_BUFFER_SIZE, int)
+IS_TYPE(JSON_WRITER_MAX_DEPTH, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//=====================================================================================================================
+
+/**
+ * @brief The JSON_Writer object.
+ *
+ * The depth has the same meaning as the depth in the cJSON print buffer. Every object and every array increases the
+ * depth by one. In a formatted output the members of an object will be indented with "depth" tabs.
+ */
+struct JSON_Writer
+{
+    char* data;                                         ///< Output buffer (NOT null terminated !)
+    size_t used_bytes;                                  ///< Used bytes in the output buffer
+    size_t allocated_bytes;                             ///< Allocated bytes of the output buffer
+
+    size_t depth;                                       ///< Current nesting depth
+    _Bool format;                                       ///< Formatted output (like cJSON_PrintBuffered) ?
+    _Bool is_array [JSON_WRITER_MAX_DEPTH];             ///< Is the container on the specific depth an array ?
+    _Bool element_written [JSON_WRITER_MAX_DEPTH];      ///< Was on the specific depth already an element written ?
+
+    size_t malloc_calloc_calls;                         ///< How many malloc / calloc calls were done with this object ?
+    size_t realloc_calls;                               ///< How many realloc calls were done with this object ?
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Create a new JSON_Writer object.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] format Formatted output ?
+ *
+ * @return Address to the new dynamic JSON_Writer
+ */
+extern struct JSON_Writer*
+JSONWriter_CreateObject
+(
+        const _Bool format
+);
+
+/**
+ * @brief Delete a dynamic allocated JSON_Writer object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_DeleteObject
+(
+        struct JSON_Writer* object
+);
+
+/**
+ * @brief Reset the writer. The allocated buffer will be reused.
+ *
+ * With a depth > 0 the writer continues inside of an object, that was opened elsewhere (e.g. in an other
+ * JSON_Writer). This makes it possible to create the members of an object separately and append them later with
+ * JSONWriter_AppendMembers().
+ *
+ * Asserts:
+ *      object != NULL
+ *      depth < JSON_WRITER_MAX_DEPTH
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] depth Nesting depth of the object, that will get the next members
+ */
+extern void
+JSONWriter_Reset
+(
+        struct JSON_Writer* const object,
+        const size_t depth
+);
+
+/**
+ * @brief Open a new JSON object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth + 1 < JSON_WRITER_MAX_DEPTH
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_BeginObject
+(
+        struct JSON_Writer* const object
+);
+
+/**
+ * @brief Close the current JSON object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth > 0
+ *      ! object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_EndObject
+(
+        struct JSON_Writer* const object
+);
+
+/**
+ * @brief Open a new JSON array.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth + 1 < JSON_WRITER_MAX_DEPTH
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_BeginArray
+(
+        struct JSON_Writer* const object
+);
+
+/**
+ * @brief Close the current JSON array.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->depth > 0
+ *      object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object
+ */
+extern void
+JSONWriter_EndArray
+(
+        struct JSON_Writer* const object
+);
+
+/**
+ * @brief Write the key of a new member in the current object.
+ *
+ * Asserts:
+ *      object != NULL
+ *      key != NULL
+ *      ! object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] key Key of the member (will be escaped)
+ */
+extern void
+JSONWriter_AddKey
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict key
+);
+
+/**
+ * @brief Write an escaped string value.
+ *
+ * Asserts:
+ *      object != NULL
+ *      str != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] str String
+ * @param[in] str_length Length of the string
+ */
+extern void
+JSONWriter_AddString
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict str,
+        const size_t str_length
+);
+
+/**
+ * @brief Write a string value, that is already escaped (with the quotation marks).
+ *
+ * Only the separator will be written before the data is copied. So strings, that are written many times (e.g. the
+ * tokens of the vocabulary), need to be escaped only once.
+ *
+ * Asserts:
+ *      object != NULL
+ *      escaped_str != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] escaped_str Escaped string with the quotation marks
+ * @param[in] escaped_str_length Length of the escaped string
+ */
+extern void
+JSONWriter_AddEscapedString
+(
+        struct JSON_Writer* const restrict object,
+        const char* const restrict escaped_str,
+        const size_t escaped_str_length
+);
+
+/**
+ * @brief Write an unsigned integer value.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] value Value
+ */
+extern void
+JSONWriter_AddUInt
+(
+        struct JSON_Writer* const object,
+        const uint_fast64_t value
+);
+
+/**
+ * @brief Append the members, that were created in the other JSON_Writer, to the current object.
+ *
+ * The member writer needs to be reseted with the depth of the current object in the destination writer.
+ *
+ * Asserts:
+ *      object != NULL
+ *      members != NULL
+ *      object->depth == members->depth
+ *      ! object->is_array [object->depth]
+ *
+ * @param[in] object JSON_Writer object (destination)
+ * @param[in] members JSON_Writer with the members
+ */
+extern void
+JSONWriter_AppendMembers
+(
+        struct JSON_Writer* const restrict object,
+        const struct JSON_Writer* const restrict members
+);
+
+/**
+ * @brief Append raw data to the buffer. There is no JSON handling (no separator, no escaping, no depth change).
+ *
+ * This is useful for separators between concatenated JSON values (e.g. the newline in a NDJSON file) or for the usage
+ * of the writer as a simple dynamic byte buffer.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *
+ * @param[in] object JSON_Writer object
+ * @param[in] data Raw data
+ * @param[in] data_length Number of bytes
+ */
+extern void
+JSONWriter_AddRawData
+(
+        struct JSON_Writer* const restrict object,
+        const void* const restrict data,
+        const size_t data_length
+);
+
+/**
+ * @brief Determine the full memory usage in bytes.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object JSON_Writer object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+JSONWriter_GetAllocatedMemSize
+(
+        const struct JSON_Writer* const object
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* JSON_WRITER_H */
@@ -0,0 +1,394 @@
+/**
+ * @file Mapped_File.c
+ *
+ * @brief A read only view of a whole input file, that can be iterated line by line without copying the data.
+ *
+ * On POSIX systems the file will be mapped with mmap() and the kernel gets the hint, that the file will be read
+ * sequentially. On other systems the file will be read in one dynamic memory block. In both cases the lines will be
+ * given as (pointer, length) views in the file content. The line end ('\n') is not part of a line view.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Mapped_File.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+
+
+/**
+ * @brief Read the whole file in one dynamic memory block. This is the fallback for systems without mmap().
+ *
+ * Asserts:
+ *      object != NULL
+ *      file_name != NULL
+ *
+ * @param[in] object Mapped_File object
+ * @param[in] file_name Name of the input file
+ */
+static void
+Read_Whole_File
+(
+        struct Mapped_File* const restrict object,
+        const char* const restrict file_name
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Open a file and make the content available as Mapped_File object.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      The file can be opened
+ *      The file size is greater than 0
+ *
+ * @param[in] file_name Name of the input file
+ *
+ * @return Address to the new dynamic Mapped_File object
+ */
+extern struct Mapped_File*
+MappedFile_CreateObject
+(
+        const char* const file_name
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    struct Mapped_File* new_object = (struct Mapped_File*) CALLOC(1, sizeof (struct Mapped_File));
+    ASSERT_ALLOC(new_object, "Cannot create a new Mapped_File object !", sizeof (struct Mapped_File));
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    const int file_descriptor = open(file_name, O_RDONLY);
+    ASSERT_FMSG(file_descriptor != -1, "Cannot open the input file: \"%s\" (%s) !", file_name, strerror(errno));
+
+    struct stat file_info;
+    const int fstat_result = fstat(file_descriptor, &file_info);
+    ASSERT_FMSG(fstat_result == 0, "fstat() failed for the file \"%s\": %s", file_name, strerror(errno));
+    ASSERT_FMSG(file_info.st_size > 0, "Input file (%s) has the length 0 !", file_name);
+    ASSERT_FMSG((uint_fast64_t) file_info.st_size <= SIZE_MAX, "Input file (%s) is too large for the address space !",
+            file_name);
+
+    new_object->size = (uint_fast64_t) file_info.st_size;
+    void* mapping = mmap(NULL, (size_t) new_object->size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+    if (mapping != MAP_FAILED)
+    {
+        // Only a hint for the read ahead of the kernel; an error is not critical
+        (void) posix_madvise(mapping, (size_t) new_object->size, POSIX_MADV_SEQUENTIAL);
+        new_object->data = (const char*) mapping;
+        new_object->memory_mapped = true;
+    }
+    close(file_descriptor);
+
+    // Some file types (e.g. pipes) cannot be mapped
+    if (! new_object->memory_mapped)
+    {
+        Read_Whole_File(new_object, file_name);
+    }
+#else
+    Read_Whole_File(new_object, file_name);
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Unmap (or free) the file content and delete the Mapped_File object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Mapped_File object
+ */
+extern void
+MappedFile_DeleteObject
+(
+        struct Mapped_File* object
+)
+{
+    ASSERT_MSG(object != NULL, "Mapped_File is NULL !");
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    if (object->memory_mapped)
+    {
+        const int munmap_result = munmap((void*) object->data, (size_t) object->size);
+        ASSERT_FMSG(munmap_result == 0, "munmap() failed: %s", strerror(errno));
+        object->data = NULL;
+    }
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+    if (! object->memory_mapped)
+    {
+        char* file_content = (char*) object->data;
+        FREE_AND_SET_TO_NULL(file_content);
+        object->data = NULL;
+    }
+
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the next line in the file content.
+ *
+ * The newline char is not part of the line. The last line of the file does not need a newline char.
+ *
+ * Asserts:
+ *      object != NULL
+ *      line != NULL
+ *
+ * @param[in] object Mapped_File object
+ * @param[out] line View of the next line
+ *
+ * @return true, if a line was found; false at the end of the file
+ */
+extern _Bool
+MappedFile_NextLine
+(
+        struct Mapped_File* const restrict object,
+        struct Line_View* const restrict line
+)
+{
+    ASSERT_MSG(object != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(line != NULL, "Line view is NULL !");
+
+    return MappedFile_NextLineInRange(object, &(object->position), object->size, line);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the next line in a range of the file content. The range needs to begin at a line begin.
+ *
+ * With this function several threads can iterate over disjunct ranges of the same file. (See
+ * MappedFile_SplitAtLineBegins())
+ *
+ * Asserts:
+ *      object != NULL
+ *      position != NULL
+ *      line != NULL
+ *      range_end <= object->size
+ *
+ * @param[in] object Mapped_File object
+ * @param[in, out] position Begin of the next line; will be moved behind the returned line
+ * @param[in] range_end End of the range (exclusive)
+ * @param[out] line View of the next line
+ *
+ * @return true, if a line was found; false at the end of the range
+ */
+extern _Bool
+MappedFile_NextLineInRange
+(
+        const struct Mapped_File* const object,
+        uint_fast64_t* const restrict position,
+        const uint_fast64_t range_end,
+        struct Line_View* const restrict line
+)
+{
+    ASSERT_MSG(object != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(position != NULL, "Position is NULL !");
+    ASSERT_MSG(line != NULL, "Line view is NULL !");
+    ASSERT_FMSG(range_end <= object->size, "Range end (%" PRIuFAST64 ") is behind the file end (%" PRIuFAST64 ") !",
+            range_end, object->size);
+
+    if (*position >= range_end)
+    {
+        line->data = NULL;
+        line->length = 0;
+        return false;
+    }
+
+    const char* const line_begin = object->data + *position;
+    const size_t bytes_left = (size_t) (range_end - *position);
+
+    // memchr() of the C library uses SIMD instructions on the common platforms
+    const char* const line_end = (const char*) memchr(line_begin, '\n', bytes_left);
+
+    line->data = line_begin;
+    if (line_end != NULL)
+    {
+        line->length = (size_t) (line_end - line_begin);
+        *position += (uint_fast64_t) line->length + 1;
+    }
+    else
+    {
+        line->length = bytes_left;
+        *position = range_end;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Split the file content in chunks with nearly the same size. Every chunk begins at a line begin.
+ *
+ * The chunk i is the range [chunk_begins [i], chunk_begins [i + 1]). Chunks can be empty, when the file contains
+ * very long lines.
+ *
+ * Asserts:
+ *      object != NULL
+ *      number_of_chunks > 0
+ *      chunk_begins != NULL
+ *
+ * @param[in] object Mapped_File object
+ * @param[in] number_of_chunks Number of chunks
+ * @param[out] chunk_begins Begins of the chunks (number_of_chunks + 1 elements; the last element is the file size)
+ */
+extern void
+MappedFile_SplitAtLineBegins
+(
+        const struct Mapped_File* const restrict object,
+        const size_t number_of_chunks,
+        uint_fast64_t* const restrict chunk_begins
+)
+{
+    ASSERT_MSG(object != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(number_of_chunks > 0, "Number of chunks is 0 !");
+    ASSERT_MSG(chunk_begins != NULL, "Chunk begins are NULL !");
+
+    const uint_fast64_t chunk_size = object->size / number_of_chunks;
+
+    chunk_begins [0] = 0;
+    for (size_t i = 1; i < number_of_chunks; ++ i)
+    {
+        uint_fast64_t chunk_begin = (uint_fast64_t) i * chunk_size;
+
+        // A chunk cannot begin before the previous chunk
+        if (chunk_begin < chunk_begins [i - 1])
+        {
+            chunk_begin = chunk_begins [i - 1];
+        }
+
+        // Move the begin behind the next newline char; the first chunk begins always at the file begin
+        if (chunk_begin > 0 && chunk_begin < object->size && object->data [chunk_begin - 1] != '\n')
+        {
+            const char* const newline = (const char*) memchr(object->data + chunk_begin, '\n',
+                    (size_t) (object->size - chunk_begin));
+            chunk_begin = (newline != NULL) ? (uint_fast64_t) (newline - object->data) + 1 : object->size;
+        }
+        chunk_begins [i] = chunk_begin;
+    }
+    chunk_begins [number_of_chunks] = object->size;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Count the newline chars in a range of the file content.
+ *
+ * Asserts:
+ *      object != NULL
+ *      range_begin <= range_end
+ *      range_end <= object->size
+ *
+ * @param[in] object Mapped_File object
+ * @param[in] range_begin Begin of the range
+ * @param[in] range_end End of the range (exclusive)
+ *
+ * @return Number of newline chars in the range
+ */
+extern uint_fast64_t
+MappedFile_CountNewlines
+(
+        const struct Mapped_File* const object,
+        const uint_fast64_t range_begin,
+        const uint_fast64_t range_end
+)
+{
+    ASSERT_MSG(object != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(range_begin <= range_end, "Range begin is behind the range end !");
+    ASSERT_MSG(range_end <= object->size, "Range end is behind the file end !");
+
+    uint_fast64_t newlines = 0;
+    const char* current = object->data + range_begin;
+    const char* const end = object->data + range_end;
+
+    while (current < end)
+    {
+        current = (const char*) memchr(current, '\n', (size_t) (end - current));
+        if (current == NULL) { break; }
+        ++ newlines;
+        ++ current;
+    }
+
+    return newlines;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Read the whole file in one dynamic memory block. This is the fallback for systems without mmap().
+ *
+ * Asserts:
+ *      object != NULL
+ *      file_name != NULL
+ *
+ * @param[in] object Mapped_File object
+ * @param[in] file_name Name of the input file
+ */
+static void
+Read_Whole_File
+(
+        struct Mapped_File* const restrict object,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(object != NULL, "Mapped_File is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    FILE* input_file = fopen (file_name, "rb");
+    ASSERT_FMSG(input_file != NULL, "Cannot open the input file: \"%s\" !", file_name);
+
+    size_t allocated_bytes = 1024 * 1024;
+    size_t used_bytes = 0;
+    char* file_content = (char*) MALLOC(allocated_bytes * sizeof (char));
+    ASSERT_ALLOC(file_content, "Cannot allocate memory for reading the input file !", allocated_bytes * sizeof (char));
+
+    // The file size is not known in every case (e.g. pipes); so the file will be read in blocks
+    while (! feof (input_file))
+    {
+        if (used_bytes == allocated_bytes)
+        {
+            char* tmp_ptr = (char*) REALLOC(file_content, allocated_bytes * 2 * sizeof (char));
+            ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for reading the input file !",
+                    allocated_bytes * 2 * sizeof (char));
+            file_content = tmp_ptr;
+            allocated_bytes *= 2;
+        }
+
+        used_bytes += fread (file_content + used_bytes, sizeof (char), allocated_bytes - used_bytes, input_file);
+        ASSERT_FMSG(! ferror (input_file), "Error while reading the input file \"%s\" !", file_name);
+    }
+    FCLOSE_AND_SET_TO_NULL(input_file);
+
+    ASSERT_FMSG(used_bytes > 0, "Input file (%s) has the length 0 !", file_name);
+
+    object->data = file_content;
+    object->size = (uint_fast64_t) used_bytes;
+    object->memory_mapped = false;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
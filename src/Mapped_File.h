@@ -0,0 +1,187 @@
+/**
+ * @file Mapped_File.h
+ *
+ * @brief A read only view of a whole input file, that can be iterated line by line without copying the data.
+ *
+ * On POSIX systems the file will be mapped with mmap() and the kernel gets the hint, that the file will be read
+ * sequentially. On other systems the file will be read in one dynamic memory block. In both cases the lines will be
+ * given as (pointer, length) views in the file content. The line end ('\n') is not part of a line view.
+ *
+ * The file content is NOT null terminated ! Every user of a line view needs to respect the length.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+
+
+
+//=====================================================================================================================
+
+/**
+ * @brief View of one line in the file content. No null terminator at the end !
+ */
+struct Line_View
+{
+    const char* data;                   ///< Begin of the line in the file content
+    size_t length;                      ///< Number of chars (without the '\n')
+};
+
+/**
+ * @brief The Mapped_File object.
+ */
+struct Mapped_File
+{
+    const char* data;                   ///< Content of the whole file
+    uint_fast64_t size;                 ///< Size of the file in bytes
+    uint_fast64_t position;             ///< Begin of the next line, that will be returned
+    _Bool memory_mapped;                ///< Was the content mapped with mmap() ? (Otherwise: dynamic memory)
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Open a file and make the content available as Mapped_File object.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      The file can be opened
+ *      The file size is greater than 0
+ *
+ * @param[in] file_name Name of the input file
+ *
+ * @return Address to the new dynamic Mapped_File object
+ */
+extern struct Mapped_File*
+MappedFile_CreateObject
+(
+        const char* const file_name
+);
+
+/**
+ * @brief Unmap (or free) the file content and delete the Mapped_File object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Mapped_File object
+ */
+extern void
+MappedFile_DeleteObject
+(
+        struct Mapped_File* object
+);
+
+/**
+ * @brief Determine the next line in the file content.
+ *
+ * The newline char is not part of the line. The last line of the file does not need a newline char.
+ *
+ * Asserts:
+ *      object != NULL
+ *      line != NULL
+ *
+ * @param[in] object Mapped_File object
+ * @param[out] line View of the next line
+ *
+ * @return true, if a line was found; false at the end of the file
+ */
+extern _Bool
+MappedFile_NextLine
+(
+        struct Mapped_File* const restrict object,
+        struct Line_View* const restrict line
+);
+
+/**
+ * @brief Determine the next line in a range of the file content. The range needs to begin at a line begin.
+ *
+ * With this function several threads can iterate over disjunct ranges of the same file. (See
+ * MappedFile_SplitAtLineBegins())
+ *
+ * Asserts:
+ *      object != NULL
+ *      position != NULL
+ *      line != NULL
+ *      range_end <= object->size
+ *
+ * @param[in] object Mapped_File object
+ * @param[in, out] position Begin of the next line; will be moved behind the returned line
+ * @param[in] range_end End of the range (exclusive)
+ * @param[out] line View of the next line
+ *
+ * @return true, if a line was found; false at the end of the range
+ */
+extern _Bool
+MappedFile_NextLineInRange
+(
+        const struct Mapped_File* const object,
+        uint_fast64_t* const restrict position,
+        const uint_fast64_t range_end,
+        struct Line_View* const restrict line
+);
+
+/**
+ * @brief Split the file content in chunks with nearly the same size. Every chunk begins at a line begin.
+ *
+ * The chunk i is the range [chunk_begins [i], chunk_begins [i + 1]). Chunks can be empty, when the file contains
+ * very long lines.
+ *
+ * Asserts:
+ *      object != NULL
+ *      number_of_chunks > 0
+ *      chunk_begins != NULL
+ *
+ * @param[in] object Mapped_File object
+ * @param[in] number_of_chunks Number of chunks
+ * @param[out] chunk_begins Begins of the chunks (number_of_chunks + 1 elements; the last element is the file size)
+ */
+extern void
+MappedFile_SplitAtLineBegins
+(
+        const struct Mapped_File* const restrict object,
+        const size_t number_of_chunks,
+        uint_fast64_t* const restrict chunk_begins
+);
+
+/**
+ * @brief Count the newline chars in a range of the file content.
+ *
+ * Asserts:
+ *      object != NULL
+ *      range_begin <= range_end
+ *      range_end <= object->size
+ *
+ * @param[in] object Mapped_File object
+ * @param[in] range_begin Begin of the range
+ * @param[in] range_end End of the range (exclusive)
+ *
+ * @return Number of newline chars in the range
+ */
+extern uint_fast64_t
+MappedFile_CountNewlines
+(
+        const struct Mapped_File* const object,
+        const uint_fast64_t range_begin,
+        const uint_fast64_t range_end
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* MAPPED_FILE_H */
@@ -0,0 +1,2762 @@
+/**
+ * @file Result_Export.c
+ *
+ * @brief Export of the intersection results in different output formats.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Result_Export.h"
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "Exec_Config.h"
+#include "Misc.h"
+#include "String_Tools.h"
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+#include "Error_Handling/_Generics.h"
+#include "JSON_Parser/cJSON.h"
+
+
+
+#ifndef cJSON_NOT_NULL
+#define cJSON_NOT_NULL(cJSON_object)                                                                                    \
+    ASSERT_MSG(cJSON_object != NULL, "Creation of a cJSON object for exporting data as JSON file failed !");            \
+    IS_TYPE(cJSON_object, cJSON*)
+#else
+#error "The macro \"cJSON_NOT_NULL\" is already defined !"
+#endif /* cJSON_NOT_NULL */
+
+#ifndef cJSON_ADD_ITEM_TO_OBJECT_CHECK
+#define cJSON_ADD_ITEM_TO_OBJECT_CHECK(cJSON_object, str, cJSON_item)                                                   \
+    ASSERT_MSG (cJSON_AddItemToObject(cJSON_object,str, cJSON_item) != 0, "Error in the cJSON_AddItemToObject call !"); \
+    IS_TYPE(cJSON_object, cJSON*)                                                                                       \
+    IS_IN_TYPE_LIST_4(str, char*, const char*, char* const, const char* const)                                          \
+    IS_TYPE(cJSON_item, cJSON*)
+#else
+#error "The macro \"cJSON_ADD_ITEM_TO_OBJECT_CHECK\" is already defined !"
+#endif /* cJSON_ADD_ITEM_TO_OBJECT_CHECK */
+
+#ifndef cJSON_ADD_ITEM_TO_ARRAY_CHECK
+#define cJSON_ADD_ITEM_TO_ARRAY_CHECK(cJSON_object, cJSON_item)                                                         \
+    ASSERT_MSG (cJSON_AddItemToArray(cJSON_object, cJSON_item) != 0, "Error in the cJSON_AddItemToArray call !");       \
+    IS_TYPE(cJSON_object, cJSON*)                                                                                       \
+    IS_TYPE(cJSON_item, cJSON*)
+#else
+#error "The macro \"cJSON_ADD_ITEM_TO_ARRAY_CHECK\" is already defined !"
+#endif /* cJSON_ADD_ITEM_TO_ARRAY_CHECK */
+
+#ifndef cJSON_FULL_FREE_AND_SET_TO_NULL
+#define cJSON_FULL_FREE_AND_SET_TO_NULL(cJSON_object)                                                                   \
+    if (cJSON_object != NULL)                                                                                           \
+    {                                                                                                                   \
+        cJSON_Delete(cJSON_object);                                                                                     \
+        cJSON_object = NULL;                                                                                            \
+    }                                                                                                                   \
+    IS_TYPE(cJSON_object, cJSON*)
+#else
+#error "The macro \"cJSON_FULL_FREE_AND_SET_TO_NULL\" is already defined !"
+#endif /* cJSON_FULL_FREE_AND_SET_TO_NULL */
+
+#ifndef CJSON_PRINT_BUFFER_SIZE
+#define CJSON_PRINT_BUFFER_SIZE 10000
+#else
+#error "The macro \"CJSON_PRINT_BUFFER_SIZE\" is already defined !"
+#endif /* CJSON_PRINT_BUFFER_SIZE */
+
+#ifndef TOKEN_FRAGMENT_TABLE_INITIAL_SIZE
+#define TOKEN_FRAGMENT_TABLE_INITIAL_SIZE 4096
+#else
+#error "The macro \"TOKEN_FRAGMENT_TABLE_INITIAL_SIZE\" is already defined !"
+#endif /* TOKEN_FRAGMENT_TABLE_INITIAL_SIZE */
+
+#ifndef READER_INITIAL_ARRAY_SIZE
+#define READER_INITIAL_ARRAY_SIZE 64
+#else
+#error "The macro \"READER_INITIAL_ARRAY_SIZE\" is already defined !"
+#endif /* READER_INITIAL_ARRAY_SIZE */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(CJSON_PRINT_BUFFER_SIZE > 0, "The macro \"CJSON_PRINT_BUFFER_SIZE\" needs to be at least 1 !");
+_Static_assert(TOKEN_FRAGMENT_TABLE_INITIAL_SIZE > 0,
+        "The macro \"TOKEN_FRAGMENT_TABLE_INITIAL_SIZE\" needs to be at least 1 !");
+_Static_assert(READER_INITIAL_ARRAY_SIZE > 0, "The macro \"READER_INITIAL_ARRAY_SIZE\" needs to be at least 1 !");
+
+IS_TYPE(CJSON_PRINT_BUFFER_SIZE, int)
+IS_TYPE(TOKEN_FRAGMENT_TABLE_INITIAL_SIZE, int)
+IS_TYPE(READER_INITIAL_ARRAY_SIZE, int)
+
+// The binary format saves the offsets with the size of the types; a reader expects max. 8 byte wide values
+_Static_assert(sizeof (CHAR_OFFSET_TYPE) <= sizeof (uint_fast64_t), "CHAR_OFFSET_TYPE is too large !");
+_Static_assert(sizeof (SENTENCE_OFFSET_TYPE) <= sizeof (uint_fast64_t), "SENTENCE_OFFSET_TYPE is too large !");
+_Static_assert(sizeof (WORD_OFFSET_TYPE) <= sizeof (uint_fast64_t), "WORD_OFFSET_TYPE is too large !");
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+
+// Here are some #defines for abbreviations
+// If a abbreviation not wanted, simply alter the #define
+#ifndef OFFSET
+#define OFFSET "offs."
+//#define OFFSET "offset"
+#else
+#error "The macro \"OFFSET\" is already defined !"
+#endif /* OFFSET */
+
+#ifndef INTERSECTIONS
+#define INTERSECTIONS "Inters."
+//#define INTERSECTIONS "Intersections"
+#else
+#error "The macro \"INTERSECTIONS\" is already defined !"
+#endif /* INTERSECTIONS */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(sizeof(OFFSET) > 0 + 1, "The macro \"OFFSET\" needs at least one char (plus '\0') !");
+_Static_assert(sizeof(INTERSECTIONS) > 0 + 1, "The macro \"INTERSECTIONS\" needs at least one char (plus '\0') !");
+
+IS_CONST_STR(OFFSET)
+IS_CONST_STR(INTERSECTIONS)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+
+
+/**
+ * @brief Write data to the result file.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] data Data
+ * @param[in] data_length Number of bytes
+ */
+static void
+Write_To_Result_File
+(
+        struct Result_Export* const restrict object,
+        const void* const restrict data,
+        const size_t data_length
+);
+
+/**
+ * @brief Add general information to the export cJSON object.
+ *
+ * General information are:
+ *      - Input file 1
+ *      - Input file 2
+ *      - Program version
+ *      - Creation time (ctime format)
+ *      - Auto stop words (only, if the dynamic stop words were used)
+ *
+ * Creation modes:
+ *      - Partial match
+ *      - Full match
+ *      - Stop word list used
+ *      - Char offset
+ *
+ * Asserts:
+ *      export_results != NULL
+ *
+ * @param export_results The main cJSON pointer for the export JSON file
+ * @param export_settings Settings for the export (Which information will be occur in the general information ?)
+ * @param first_file Name of the first input file
+ * @param second_file Name of the second input file
+ * @param program_version Program version
+ * @param creation_time Creation time
+ * @param max_document_frequency Max. document frequency of a token, that is not a stop word
+ * @param auto_stop_words Tokens, that were removed because of their document frequency (NULL: Not used)
+ */
+static void
+Add_General_Information_To_Export_File
+(
+        cJSON* const export_results,
+        const unsigned int export_settings,
+        const char* const first_file,
+        const char* const second_file,
+        const char* const program_version,
+        const char* const creation_time,
+        const float max_document_frequency,
+        const struct Two_Dim_C_String_Array* const auto_stop_words
+);
+
+/**
+ * @brief Include counter information at the end of the export file.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *
+ * @param export_results The main cJSON pointer for the export JSON file
+ * @param export_settings Settings for the export (Which information will be occur in the result file -> which counter
+ *      are relevant for the general information ?)
+ * @param number_of_partial_sets Number of sets with partial matches in the whole file
+ * @param number_of_full_sets Number of sets with full matches in the whole file
+ * @param number_of_token_in_partial_sets Sum of all tokens in all partial matches
+ * @param number_of_token_in_full_sets Sum of all tokens in all full matches
+ */
+static void
+Add_Counter_To_Export_File
+(
+        cJSON* const export_results,
+        const unsigned int export_settings,
+        const uint_fast64_t number_of_partial_sets,
+        const uint_fast64_t number_of_full_sets,
+        const uint_fast64_t number_of_token_in_partial_sets,
+        const uint_fast64_t number_of_token_in_full_sets
+);
+
+/**
+ * @brief Add too long tokens from the two input file to a JSON block. (One array for each file)
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      too_long_tokens_1 != NULL
+ *      too_long_tokens_2 != NULL
+ *
+ * @param export_results Preallocated cJSON object as result for the operation
+ * @param too_long_tokens_1 Too long tokens of the first file
+ * @param too_long_tokens_2 Too long tokens of the second file
+ */
+static void
+Add_Too_Long_Tokens_To_Export_File
+(
+        cJSON* const export_results,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_1,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_2
+);
+
+/**
+ * @brief Convert a cJSON object to a c string and append it to the result file.
+ *
+ * Asserts:
+ *      object != NULL,
+ *      cJSON_obj != NULL
+ *
+ * @param object Result_Export object
+ * @param cJSON_obj cJSON object
+ */
+static void
+Append_cJSON_Object_To_Result_File
+(
+        struct Result_Export* const restrict object,
+        const cJSON* const restrict cJSON_obj
+);
+
+/**
+ * @brief Get the pre-escaped JSON string (with the quotation marks) of a mapped token.
+ *
+ * The fragment will be created with the first request of the token: Reverse mapping (int -> token) and JSON escaping
+ * are done only once per token. The table grows, when the mapped integer is larger than the table.
+ *
+ * Asserts:
+ *      object != NULL
+ *      mapped_token != UINT_FAST32_MAX
+ *
+ * @param[in] object Result_Export object
+ * @param[in] mapped_token Mapped token
+ *
+ * @return Address of the fragment information (Only valid until the next call !)
+ */
+static const struct Token_Fragment*
+Get_Token_Fragment
+(
+        struct Result_Export* const object,
+        const uint_fast32_t mapped_token
+);
+
+/**
+ * @brief Start the current set: The information about the query will be exported.
+ *
+ * This will be done lazy with the first hit of a query, because most queries have no hits.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+static void
+Start_Set
+(
+        struct Result_Export* const object
+);
+
+/**
+ * @brief Append the "tokens" and the "tokens w/o stop words" array of the current query to the set data.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+static void
+Append_Source_Tokens_To_Export_Results
+(
+        struct Result_Export* const object
+);
+
+/**
+ * @brief Append the members, that all hit formats have: "tokens" and the offset arrays.
+ *
+ * Asserts:
+ *      object != NULL
+ *      export_results != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object (Token fragments and the settings: Which offsets will be exported ?)
+ * @param[in] export_results JSON_Writer; the current container needs to be an object
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets
+ * @param[in] sentence_offsets Sentence offsets
+ * @param[in] word_offsets Word offsets
+ * @param[in] data_length Number of tokens
+ */
+static void
+Append_Tokens_And_Offsets_To_Export_Results
+(
+        struct Result_Export* const restrict object,
+        struct JSON_Writer* const restrict export_results,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+);
+
+/**
+ * @brief Append a TSV field with escaped data. ('\\', '\t', '\n', '\r' and '|' will be escaped with a backslash)
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      str != NULL
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] str String
+ * @param[in] str_length Length of the string
+ */
+static void
+Append_TSV_Escaped_String
+(
+        struct JSON_Writer* const restrict export_results,
+        const char* const restrict str,
+        const size_t str_length
+);
+
+/**
+ * @brief Append a unsigned integer as decimal number.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] value Value
+ */
+static void
+Append_Decimal
+(
+        struct JSON_Writer* const export_results,
+        const uint_fast64_t value
+);
+
+/**
+ * @brief Append one hit as TSV line.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_id != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] document_id ID of the document
+ * @param[in] full_match Is the hit a full match ?
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets
+ * @param[in] sentence_offsets Sentence offsets
+ * @param[in] word_offsets Word offsets
+ * @param[in] data_length Number of tokens
+ */
+static void
+Append_TSV_Line
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict document_id,
+        const _Bool full_match,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+);
+
+/**
+ * @brief Append a unsigned integer in little-endian byte order.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      value_size <= 8
+ *      value fits in value_size bytes
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] value Value
+ * @param[in] value_size Number of bytes
+ */
+static void
+Append_Little_Endian
+(
+        struct JSON_Writer* const export_results,
+        const uint_fast64_t value,
+        const size_t value_size
+);
+
+/**
+ * @brief Append a string in the binary format: u32 length + bytes without terminator.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      str != NULL
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] str String
+ */
+static void
+Append_Binary_String
+(
+        struct JSON_Writer* const restrict export_results,
+        const char* const restrict str
+);
+
+/**
+ * @brief Append one hit as binary record.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_id != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] document_id ID of the document
+ * @param[in] full_match Is the hit a full match ?
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets
+ * @param[in] sentence_offsets Sentence offsets
+ * @param[in] word_offsets Word offsets
+ * @param[in] data_length Number of tokens
+ */
+static void
+Append_Binary_Hit
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict document_id,
+        const _Bool full_match,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+);
+
+/**
+ * @brief Write the header and the vocabulary of the binary format to the result file.
+ *
+ * Asserts:
+ *      object != NULL
+ *      first_file != NULL
+ *      second_file != NULL
+ *      program_version != NULL
+ *      creation_time != NULL
+ *      too_long_tokens_1 != NULL
+ *      too_long_tokens_2 != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] first_file Name of the first input file
+ * @param[in] second_file Name of the second input file
+ * @param[in] program_version Program version
+ * @param[in] creation_time Creation time as string
+ * @param[in] too_long_tokens_1 Too long tokens of the first input file
+ * @param[in] too_long_tokens_2 Too long tokens of the second input file
+ */
+static void
+Write_Binary_Header
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict first_file,
+        const char* const restrict second_file,
+        const char* const restrict program_version,
+        const char* const restrict creation_time,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_1,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_2
+);
+
+/**
+ * @brief Update the "data found" flag.
+ *
+ * If not partial- and full matches should be appear in the result file, then the data found flag needs to be updated,
+ * because this flag only shows, that data was found. There is no differentiation, weather this are partial or full
+ * match data.
+ *
+ * @param[in] intersection_settings Settings for the intersection process
+ * @param[in] current_data_flag Status of the current data found flag
+ * @param[in] intersections_partial_match JSON_Writer with the partial match data, if available
+ * @param[in] intersections_full_match JSON_Writer with the full match data, if available
+ *
+ * @return The updated data found flag
+ */
+static inline _Bool
+Update_Data_Found_Flag
+(
+        const unsigned int intersection_settings,
+        const _Bool current_data_flag,
+        const struct JSON_Writer* const restrict intersections_partial_match,
+        const struct JSON_Writer* const restrict intersections_full_match
+);
+
+/**
+ * @brief Read a little-endian unsigned integer from a binary result file.
+ *
+ * Asserts:
+ *      file != NULL
+ *      file_name != NULL
+ *      value_size <= 8
+ *      value_size bytes are available
+ *
+ * @param[in] file Binary result file
+ * @param[in] file_name Name of the file (for error messages)
+ * @param[in] value_size Number of bytes
+ *
+ * @return The read value
+ */
+static uint_fast64_t
+Read_Little_Endian
+(
+        FILE* const restrict file,
+        const char* const restrict file_name,
+        const size_t value_size
+);
+
+/**
+ * @brief Read a string (u32 length + bytes) from a binary result file in a dynamic buffer.
+ *
+ * The buffer will be increased, if necessary. The result is null terminated.
+ *
+ * Asserts:
+ *      file != NULL
+ *      file_name != NULL
+ *      buffer != NULL
+ *      *buffer != NULL
+ *      buffer_size != NULL
+ *      the string is complete available
+ *
+ * @param[in] file Binary result file
+ * @param[in] file_name Name of the file (for error messages)
+ * @param[in, out] buffer Address of the dynamic buffer
+ * @param[in, out] buffer_size Size of the dynamic buffer in bytes
+ *
+ * @return Length of the string
+ */
+static size_t
+Read_String
+(
+        FILE* const restrict file,
+        const char* const restrict file_name,
+        char** const restrict buffer,
+        size_t* const restrict buffer_size
+);
+
+/**
+ * @brief Increase a dynamic array, if it cannot hold the needed number of elements.
+ *
+ * Asserts:
+ *      array != NULL
+ *      *array != NULL
+ *      allocated_elements != NULL
+ *
+ * @param[in, out] array Address of the dynamic array
+ * @param[in, out] allocated_elements Number of allocated elements
+ * @param[in] needed_elements Number of needed elements
+ * @param[in] element_size Size of one element in bytes
+ */
+static void
+Ensure_Array_Size
+(
+        void** const restrict array,
+        size_t* const restrict allocated_elements,
+        const size_t needed_elements,
+        const size_t element_size
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Convert the name of an output format (e.g. from the CLI) to the enum value.
+ *
+ * Valid names: "json", "ndjson", "tsv", "binary"
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] format_name Name of the output format
+ *
+ * @return The output format or OUTPUT_FORMAT_INVALID, if the name is unknown (or NULL)
+ */
+extern enum Output_Format
+ResultExport_StringToOutputFormat
+(
+        const char* const format_name
+)
+{
+    if (format_name == NULL) { return OUTPUT_FORMAT_INVALID; }
+
+    if (strcmp (format_name, "json") == 0)      { return OUTPUT_FORMAT_JSON; }
+    if (strcmp (format_name, "ndjson") == 0)    { return OUTPUT_FORMAT_NDJSON; }
+    if (strcmp (format_name, "tsv") == 0)       { return OUTPUT_FORMAT_TSV; }
+    if (strcmp (format_name, "binary") == 0)    { return OUTPUT_FORMAT_BINARY; }
+
+    return OUTPUT_FORMAT_INVALID;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Result_Export object. The result file will be created (or truncated).
+ *
+ * The data will be written with an Async_File_Writer. So the intersection and the file I/O overlap.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      format != OUTPUT_FORMAT_INVALID
+ *      token_int_mapping != NULL
+ *
+ * @param[in] file_name Name of the result file
+ * @param[in] format Output format
+ * @param[in] settings Settings of the intersection process (See Exec_Config.h)
+ * @param[in] token_int_mapping Token_Int_Mapping (necessary for the reverse mapping int -> token)
+ * @param[in] preallocation_size Number of bytes, that will be preallocated for the result file (0: No preallocation)
+ *
+ * @return Address to the new dynamic Result_Export object
+ */
+extern struct Result_Export*
+ResultExport_CreateObject
+(
+        const char* const restrict file_name,
+        const enum Output_Format format,
+        const unsigned int settings,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const uint_fast64_t preallocation_size
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(format != OUTPUT_FORMAT_INVALID, "Invalid output format !");
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
+
+    struct Result_Export* new_object = (struct Result_Export*) CALLOC(1, sizeof (struct Result_Export));
+    ASSERT_ALLOC(new_object, "Cannot create a new Result_Export object !", sizeof (struct Result_Export));
+
+    // The writer thread writes the data in the background; the file is opened in binary mode for every format
+    new_object->file_writer = AsyncFileWriter_CreateObject(file_name, preallocation_size,
+            COMPRESS_OUTPUT_BIT(settings) != 0);
+
+    new_object->file_name           = file_name;
+    new_object->format              = format;
+    new_object->settings            = settings;
+    new_object->token_int_mapping   = token_int_mapping;
+
+    // Only the JSON format knows a formatted output; every NDJSON line needs to be compact
+    const _Bool format_output = (format == OUTPUT_FORMAT_JSON) && FORMATTING_ENABLED(settings);
+    new_object->set_data            = JSONWriter_CreateObject (format_output);
+    new_object->partial_matches     = JSONWriter_CreateObject (format_output);
+    new_object->full_matches        = JSONWriter_CreateObject (format_output);
+    new_object->set_header          = JSONWriter_CreateObject (false);
+
+    // The fragments will be created lazy with the first usage of a token
+    new_object->token_fragments     = JSONWriter_CreateObject (false);
+    new_object->token_fragment_table = (struct Token_Fragment*) CALLOC(TOKEN_FRAGMENT_TABLE_INITIAL_SIZE,
+            sizeof (struct Token_Fragment));
+    ASSERT_ALLOC(new_object->token_fragment_table, "Cannot create the token fragment table !",
+            TOKEN_FRAGMENT_TABLE_INITIAL_SIZE * sizeof (struct Token_Fragment));
+    new_object->token_fragment_table_size = TOKEN_FRAGMENT_TABLE_INITIAL_SIZE;
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Close the result file and delete the Result_Export object.
+ *
+ * The data of a set, that was not ended with ResultExport_EndSet(), will be discarded.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+extern void
+ResultExport_DeleteObject
+(
+        struct Result_Export* object
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+
+    AsyncFileWriter_DeleteObject(object->file_writer);
+    object->file_writer = NULL;
+
+    JSONWriter_DeleteObject(object->set_data);
+    object->set_data = NULL;
+    JSONWriter_DeleteObject(object->partial_matches);
+    object->partial_matches = NULL;
+    JSONWriter_DeleteObject(object->full_matches);
+    object->full_matches = NULL;
+    JSONWriter_DeleteObject(object->set_header);
+    object->set_header = NULL;
+    JSONWriter_DeleteObject(object->token_fragments);
+    object->token_fragments = NULL;
+    FREE_AND_SET_TO_NULL(object->token_fragment_table);
+
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Set the dynamic stop words, that will be written in the general information of the result file.
+ *
+ * Only the JSON format contains the dynamic stop words. The list will not be copied; it needs to be available until
+ * the header was written (See ResultExport_WriteHeader()).
+ *
+ * Asserts:
+ *      object != NULL
+ *      auto_stop_words != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] max_document_frequency Max. document frequency of a token, that is not a stop word
+ * @param[in] auto_stop_words Tokens, that were removed because of their document frequency
+ */
+extern void
+ResultExport_SetAutoStopWords
+(
+        struct Result_Export* const restrict object,
+        const float max_document_frequency,
+        const struct Two_Dim_C_String_Array* const restrict auto_stop_words
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(auto_stop_words != NULL, "Dynamic stop words are NULL !");
+
+    object->max_document_frequency  = max_document_frequency;
+    object->auto_stop_words         = auto_stop_words;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write the header of the result file.
+ *
+ * JSON: The general information and the too long tokens; TSV: The column names; Binary: The header and the vocabulary;
+ * NDJSON: Nothing.
+ *
+ * Asserts:
+ *      object != NULL
+ *      first_file != NULL
+ *      second_file != NULL
+ *      too_long_tokens_1 != NULL
+ *      too_long_tokens_2 != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] first_file Name of the first input file
+ * @param[in] second_file Name of the second input file
+ * @param[in] program_version Program version, that created the results (NULL: VERSION_STR will be used)
+ * @param[in] creation_time Creation time as string (NULL: The current time will be used)
+ * @param[in] too_long_tokens_1 Too long tokens of the first input file
+ * @param[in] too_long_tokens_2 Too long tokens of the second input file
+ */
+extern void
+ResultExport_WriteHeader
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict first_file,
+        const char* const restrict second_file,
+        const char* const restrict program_version,
+        const char* const restrict creation_time,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_1,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_2
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(first_file != NULL, "Name of the first file is NULL !");
+    ASSERT_MSG(second_file != NULL, "Name of the second file is NULL !");
+    ASSERT_MSG(too_long_tokens_1 != NULL, "Too long tokens of the first file are NULL !");
+    ASSERT_MSG(too_long_tokens_2 != NULL, "Too long tokens of the second file are NULL !");
+
+    // Creation time
+    char time_string [100];
+    if (creation_time == NULL)
+    {
+        const time_t raw_time = time(NULL);
+        ASSERT_MSG(raw_time != (time_t) -1, "Current calendar time is not available !");
+        const struct tm* const converted_time = localtime(&raw_time);
+        ASSERT_MSG(converted_time != NULL, "time_t cannot be represented as a broken-down time !");
+
+        time_string [0] = '\1'; // Necessary to detect problems in the strftime call
+        const size_t ret = strftime(time_string, COUNT_ARRAY_ELEMENTS(time_string), "%c", converted_time);
+        // This way of checking the strftime call is described in the strftime documentation !
+        ASSERT_MSG(!(ret == 0 && time_string [0] != '\0'), "Something went wrong in the strftime call.")
+        time_string [ret] = '\0';
+    }
+    const char* const used_creation_time    = (creation_time != NULL) ? creation_time : time_string;
+    const char* const used_program_version  = (program_version != NULL) ? program_version : VERSION_STR;
+
+    switch (object->format)
+    {
+    case OUTPUT_FORMAT_JSON:
+    {
+        // Start export file
+        Write_To_Result_File(object, "{", STATIC_STRLEN("{"));
+
+        // Create general information and write them to the result file
+        cJSON* general_information = cJSON_CreateObject();
+        cJSON_NOT_NULL(general_information);
+        Add_General_Information_To_Export_File(general_information, object->settings, first_file, second_file,
+                used_program_version, used_creation_time, object->max_document_frequency, object->auto_stop_words);
+        Append_cJSON_Object_To_Result_File(object, general_information);
+        cJSON_FULL_FREE_AND_SET_TO_NULL(general_information);
+
+        // Create a list with too long token and append them to the result file
+        cJSON* too_long_tokens = cJSON_CreateObject();
+        cJSON_NOT_NULL(too_long_tokens);
+        Add_Too_Long_Tokens_To_Export_File(too_long_tokens, too_long_tokens_1, too_long_tokens_2);
+        Append_cJSON_Object_To_Result_File(object, too_long_tokens);
+        cJSON_FULL_FREE_AND_SET_TO_NULL(too_long_tokens);
+
+        // To have a newline after the general information and after the too long tokens
+        // In the formatted mode this is not necessary
+        if (! FORMATTING_ENABLED(object->settings))
+        {
+            Write_To_Result_File(object, "\n", STATIC_STRLEN("\n"));
+        }
+        break;
+    }
+    case OUTPUT_FORMAT_TSV:
+        JSONWriter_Reset(object->set_data, 0);
+        JSONWriter_AddRawData(object->set_data, "query\tdocument\tmatch\ttokens\tchar " OFFSET,
+                STATIC_STRLEN("query\tdocument\tmatch\ttokens\tchar " OFFSET));
+        if (SENTENCE_OFFSET_BIT(object->settings))
+        {
+            JSONWriter_AddRawData(object->set_data, "\tsentence " OFFSET, STATIC_STRLEN("\tsentence " OFFSET));
+        }
+        if (WORD_OFFSET_BIT(object->settings))
+        {
+            JSONWriter_AddRawData(object->set_data, "\tword " OFFSET, STATIC_STRLEN("\tword " OFFSET));
+        }
+        JSONWriter_AddRawData(object->set_data, "\n", STATIC_STRLEN("\n"));
+        Write_To_Result_File(object, object->set_data->data, object->set_data->used_bytes);
+        JSONWriter_Reset(object->set_data, 0);
+        break;
+    case OUTPUT_FORMAT_BINARY:
+        Write_Binary_Header(object, first_file, second_file, used_program_version, used_creation_time,
+                too_long_tokens_1, too_long_tokens_2);
+        break;
+    case OUTPUT_FORMAT_NDJSON:
+        break;
+    case OUTPUT_FORMAT_INVALID:
+    default:
+        ASSERT_MSG(false, "Invalid output format !");
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write the footer of the result file. (JSON: The closing bracket; Binary: The end record; NDJSON, TSV: Nothing)
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+extern void
+ResultExport_WriteFooter
+(
+        struct Result_Export* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+
+    switch (object->format)
+    {
+    case OUTPUT_FORMAT_JSON:
+        if (FORMATTING_ENABLED(object->settings))
+        {
+            Write_To_Result_File(object, "\n}", STATIC_STRLEN("\n}"));
+        }
+        else
+        {
+            Write_To_Result_File(object, "}", STATIC_STRLEN("}"));
+        }
+        break;
+    case OUTPUT_FORMAT_BINARY:
+        Write_To_Result_File(object, "E", STATIC_STRLEN("E"));
+        break;
+    case OUTPUT_FORMAT_NDJSON:
+    case OUTPUT_FORMAT_TSV:
+        break;
+    case OUTPUT_FORMAT_INVALID:
+    default:
+        ASSERT_MSG(false, "Invalid output format !");
+    }
+
+    return;
+}
+
+/**
+ * @brief Write the counter block of the intersection process to the result file.
+ *
+ * JSON: A "Counter" member after the last set; NDJSON: One line with a "Counter" object. The other formats have no
+ * place for the counters.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->format == OUTPUT_FORMAT_JSON || object->format == OUTPUT_FORMAT_NDJSON
+ *
+ * @param[in] object Result_Export object
+ * @param[in] number_of_partial_sets Number of sets with partial matches
+ * @param[in] number_of_full_sets Number of sets with full matches
+ * @param[in] number_of_token_in_partial_sets Sum of all tokens in all partial matches
+ * @param[in] number_of_token_in_full_sets Sum of all tokens in all full matches
+ */
+extern void
+ResultExport_WriteCounter
+(
+        struct Result_Export* const object,
+        const uint_fast64_t number_of_partial_sets,
+        const uint_fast64_t number_of_full_sets,
+        const uint_fast64_t number_of_token_in_partial_sets,
+        const uint_fast64_t number_of_token_in_full_sets
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(object->format == OUTPUT_FORMAT_JSON || object->format == OUTPUT_FORMAT_NDJSON,
+            "The counters can only be exported in the JSON and in the NDJSON format !");
+
+    cJSON* counter_information = cJSON_CreateObject();
+    cJSON_NOT_NULL(counter_information);
+    Add_Counter_To_Export_File(counter_information, object->settings, number_of_partial_sets, number_of_full_sets,
+            number_of_token_in_partial_sets, number_of_token_in_full_sets);
+
+    const _Bool format_output = (object->format == OUTPUT_FORMAT_JSON) && FORMATTING_ENABLED(object->settings);
+    char* counter_information_as_str = cJSON_PrintBuffered(counter_information, CJSON_PRINT_BUFFER_SIZE,
+            format_output);
+    ASSERT_MSG(counter_information_as_str != NULL, "JSON counter string is NULL !");
+    cJSON_FULL_FREE_AND_SET_TO_NULL(counter_information);
+    const size_t counter_information_as_str_len = strlen (counter_information_as_str);
+
+    if (object->format == OUTPUT_FORMAT_NDJSON)
+    {
+        Write_To_Result_File(object, counter_information_as_str, counter_information_as_str_len);
+        Write_To_Result_File(object, "\n", STATIC_STRLEN("\n"));
+    }
+    else
+    {
+        // The same separator as between two sets
+        if (object->first_set_written)
+        {
+            if (format_output)
+            {
+                Write_To_Result_File(object, ",", STATIC_STRLEN(","));
+            }
+            else
+            {
+                Write_To_Result_File(object, ",\n", STATIC_STRLEN(",\n"));
+            }
+        }
+
+        // Only the members: Without the opening bracket and the trailing closing bracket (and the newline before)
+        const size_t ignored_tail_bytes = (format_output) ? 2 : 1;
+        Write_To_Result_File(object, counter_information_as_str + 1,
+                counter_information_as_str_len - 1 - ignored_tail_bytes);
+        object->first_set_written = true;
+    }
+
+    // Don't use the macro "FREE_AND_SET_TO_NULL" because it increases the free counter. But this memory was
+    // allocated from the JSON lib !
+    free(counter_information_as_str);
+    counter_information_as_str = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Begin a new set. A set contains the results of one query.
+ *
+ * The data will not be copied ! The pointers need to be valid until the next ResultExport_EndSet() call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      query_id != NULL
+ *      query_data != NULL
+ *      query_data_wo_stop_words != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] query_id ID of the query
+ * @param[in] query_data Mapped tokens of the query (with stop words; only for the "tokens" output)
+ * @param[in] query_data_length Number of mapped tokens
+ * @param[in] query_data_wo_stop_words Mapped tokens of the query without stop words (The data of the intersection)
+ * @param[in] query_length_wo_stop_words Number of mapped tokens without stop words
+ */
+extern void
+ResultExport_BeginSet
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict query_id,
+        const uint_fast32_t* const restrict query_data,
+        const size_t query_data_length,
+        const uint_fast32_t* const restrict query_data_wo_stop_words,
+        const size_t query_length_wo_stop_words
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(query_id != NULL, "Query ID is NULL !");
+    ASSERT_MSG(query_data != NULL, "Query data is NULL !");
+    ASSERT_MSG(query_data_wo_stop_words != NULL, "Query data without stop words is NULL !");
+
+    object->query_id                    = query_id;
+    object->query_data                  = query_data;
+    object->query_data_length           = query_data_length;
+    object->query_data_wo_stop_words    = query_data_wo_stop_words;
+    object->query_tokens_wo_stop_words  = query_length_wo_stop_words;
+    object->query_started               = false;
+    object->exported_hits               = 0;
+
+    // The members of the two intersection objects are on the depth 3:
+    // { (1) "query_id": { (2) "Inters. (partial)": { (3) "document_id": ...
+    JSONWriter_Reset(object->set_data, 0);
+    JSONWriter_Reset(object->partial_matches, 3);
+    JSONWriter_Reset(object->full_matches, 3);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add one intersection result (a hit of the current query in a document) to the current set.
+ *
+ * The stop words were already removed from both corpora before the intersection (See EncodedCorpus_CreateObject()).
+ * Whether the hit will be exported depends on the match type and the PART_MATCH / FULL_MATCH bits in the settings.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_id != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] document_id ID of the document
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets of the tokens
+ * @param[in] sentence_offsets Sentence offsets of the tokens
+ * @param[in] word_offsets Word offsets of the tokens
+ * @param[in] data_length Number of tokens
+ *
+ * @return true, if the hit is a full match (The tokens are equal with the query tokens without stop words), otherwise
+ *      false
+ */
+extern _Bool
+ResultExport_AddIntersection
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict document_id,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(document_id != NULL, "Document ID is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(char_offsets != NULL, "Char offsets are NULL !");
+    ASSERT_MSG(sentence_offsets != NULL, "Sentence offsets are NULL !");
+    ASSERT_MSG(word_offsets != NULL, "Word offsets are NULL !");
+
+    // The tokens of the query only appear once for each set
+    if (! object->query_started)
+    {
+        Start_Set(object);
+    }
+
+    // For the comparison it is important to use the number of source tokens without stop words; Because a full match
+    // means a equalness with the list, that contains NO stop words !
+    const _Bool full_match = (data_length == object->query_tokens_wo_stop_words);
+    if ((full_match && ! FULL_MATCH_BIT(object->settings)) || (! full_match && ! PART_MATCH_BIT(object->settings)))
+    {
+        return full_match;
+    }
+
+    switch (object->format)
+    {
+    case OUTPUT_FORMAT_JSON:
+        JSONWriter_AddKey(full_match ? object->full_matches : object->partial_matches, document_id);
+        JSONWriter_BeginObject(full_match ? object->full_matches : object->partial_matches);
+        Append_Tokens_And_Offsets_To_Export_Results(object, full_match ? object->full_matches :
+                object->partial_matches, data, char_offsets, sentence_offsets, word_offsets, data_length);
+        JSONWriter_EndObject(full_match ? object->full_matches : object->partial_matches);
+        break;
+    case OUTPUT_FORMAT_NDJSON:
+        JSONWriter_BeginObject(object->set_data);
+        JSONWriter_AppendMembers(object->set_data, object->set_header);
+        JSONWriter_AddKey(object->set_data, "document");
+        JSONWriter_AddString(object->set_data, document_id, strlen (document_id));
+        JSONWriter_AddKey(object->set_data, "match");
+        JSONWriter_AddString(object->set_data, (full_match) ? "full" : "partial",
+                (full_match) ? STATIC_STRLEN("full") : STATIC_STRLEN("partial"));
+        Append_Tokens_And_Offsets_To_Export_Results(object, object->set_data, data, char_offsets, sentence_offsets,
+                word_offsets, data_length);
+        JSONWriter_EndObject(object->set_data);
+        JSONWriter_AddRawData(object->set_data, "\n", STATIC_STRLEN("\n"));
+        break;
+    case OUTPUT_FORMAT_TSV:
+        Append_TSV_Line(object, document_id, full_match, data, char_offsets, sentence_offsets, word_offsets,
+                data_length);
+        break;
+    case OUTPUT_FORMAT_BINARY:
+        Append_Binary_Hit(object, document_id, full_match, data, char_offsets, sentence_offsets, word_offsets,
+                data_length);
+        break;
+    case OUTPUT_FORMAT_INVALID:
+    default:
+        ASSERT_MSG(false, "Invalid output format !");
+    }
+    ++ object->exported_hits;
+
+    return full_match;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief End the current set and write the collected data to the result file, if data was found.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+extern void
+ResultExport_EndSet
+(
+        struct Result_Export* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+
+    if (! object->query_started)
+    {
+        return;
+    }
+    object->query_started = false;
+
+    if (object->format != OUTPUT_FORMAT_JSON)
+    {
+        // Without the PART_MATCH and FULL_MATCH bit only the query information will be exported (like in the JSON
+        // format)
+        if (object->exported_hits > 0 ||
+                (object->format == OUTPUT_FORMAT_BINARY && ! PART_MATCH_BIT(object->settings) &&
+                        ! FULL_MATCH_BIT(object->settings)))
+        {
+            Write_To_Result_File(object, object->set_data->data, object->set_data->used_bytes);
+        }
+        return;
+    }
+
+    const _Bool data_found = Update_Data_Found_Flag
+    (
+            object->settings,
+            true,
+            object->partial_matches,
+            object->full_matches
+    );
+
+    // Only append the objects from the current outer loop run, when data was found in the inner loop
+    if (! data_found)
+    {
+        return;
+    }
+
+    struct JSON_Writer* const export_results = object->set_data;
+
+    if (PART_MATCH_BIT(object->settings))
+    {
+        JSONWriter_AddKey(export_results, INTERSECTIONS " (partial)");
+        JSONWriter_BeginObject(export_results);
+        JSONWriter_AppendMembers(export_results, object->partial_matches);
+        JSONWriter_EndObject(export_results);
+    }
+    if (FULL_MATCH_BIT(object->settings))
+    {
+        JSONWriter_AddKey(export_results, INTERSECTIONS " (full)");
+        JSONWriter_BeginObject(export_results);
+        JSONWriter_AppendMembers(export_results, object->full_matches);
+        JSONWriter_EndObject(export_results);
+    }
+    JSONWriter_EndObject(export_results);
+    JSONWriter_EndObject(export_results);
+
+    if (object->first_set_written)
+    {
+        if (FORMATTING_ENABLED(object->settings))
+        {
+            Write_To_Result_File(object, ",", STATIC_STRLEN(","));
+        }
+        else
+        {
+            Write_To_Result_File(object, ",\n", STATIC_STRLEN(",\n"));
+        }
+    }
+
+    // The results of every outer loop run are a stand alone JSON object. But in our case we concatenate these
+    // JSON objects. So it is necessary to ignore the opening bracket and the trailing closing bracket (and the
+    // newline before in a formatted output) for a valid JSON result file
+    const size_t ignored_tail_bytes = (FORMATTING_ENABLED(object->settings)) ? 2 : 1;
+    Write_To_Result_File(object, export_results->data + 1, export_results->used_bytes - 1 - ignored_tail_bytes);
+
+    object->first_set_written = true;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the full memory usage in bytes.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+ResultExport_GetAllocatedMemSize
+(
+        const struct Result_Export* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+
+    return sizeof (struct Result_Export) + AsyncFileWriter_GetAllocatedMemSize(object->file_writer) +
+            JSONWriter_GetAllocatedMemSize(object->set_data) +
+            JSONWriter_GetAllocatedMemSize(object->partial_matches) +
+            JSONWriter_GetAllocatedMemSize(object->full_matches) +
+            JSONWriter_GetAllocatedMemSize(object->set_header) +
+            JSONWriter_GetAllocatedMemSize(object->token_fragments) +
+            object->token_fragment_table_size * sizeof (struct Token_Fragment);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Convert a binary result file to a JSON result file.
+ *
+ * The JSON file is equal to the file, that would be created directly with the JSON format.
+ *
+ * Asserts:
+ *      binary_file_name != NULL
+ *      json_file_name != NULL
+ *
+ * @param[in] binary_file_name Name of the binary result file
+ * @param[in] json_file_name Name of the JSON result file
+ * @param[in] format_output Format the JSON output ?
+ */
+extern void
+ResultExport_ConvertBinaryToJSON
+(
+        const char* const restrict binary_file_name,
+        const char* const restrict json_file_name,
+        const _Bool format_output
+)
+{
+    ASSERT_MSG(binary_file_name != NULL, "Name of the binary file is NULL !");
+    ASSERT_MSG(json_file_name != NULL, "Name of the JSON file is NULL !");
+
+    FILE* binary_file = fopen(binary_file_name, "rb");
+    ASSERT_FMSG(binary_file != NULL, "Cannot open the binary result file: \"%s\" !", binary_file_name);
+
+    // >>> Header <<<
+    char magic [STATIC_STRLEN(RESULT_EXPORT_BINARY_MAGIC)];
+    ASSERT_FMSG(fread(magic, sizeof (char), COUNT_ARRAY_ELEMENTS(magic), binary_file) == COUNT_ARRAY_ELEMENTS(magic) &&
+            memcmp(magic, RESULT_EXPORT_BINARY_MAGIC, COUNT_ARRAY_ELEMENTS(magic)) == 0,
+            "The file \"%s\" is not a binary result file !", binary_file_name);
+    const uint_fast64_t version = Read_Little_Endian(binary_file, binary_file_name, 1);
+    ASSERT_FMSG(version == RESULT_EXPORT_BINARY_VERSION, "Unsupported version (%" PRIuFAST64 ") of the binary result "
+            "file \"%s\" ! Supported version: %d", version, binary_file_name, RESULT_EXPORT_BINARY_VERSION);
+
+    const size_t char_offset_size       = (size_t) Read_Little_Endian(binary_file, binary_file_name, 1);
+    const size_t sentence_offset_size   = (size_t) Read_Little_Endian(binary_file, binary_file_name, 1);
+    const size_t word_offset_size       = (size_t) Read_Little_Endian(binary_file, binary_file_name, 1);
+    ASSERT_FMSG(char_offset_size <= sizeof (CHAR_OFFSET_TYPE) && sentence_offset_size <= sizeof (SENTENCE_OFFSET_TYPE) &&
+            word_offset_size <= sizeof (WORD_OFFSET_TYPE), "The offset types in the file \"%s\" (%zu, %zu, %zu byte) are "
+            "larger than the offset types of this program (%zu, %zu, %zu byte) !", binary_file_name, char_offset_size,
+            sentence_offset_size, word_offset_size, sizeof (CHAR_OFFSET_TYPE), sizeof (SENTENCE_OFFSET_TYPE),
+            sizeof (WORD_OFFSET_TYPE));
+
+    unsigned int settings = (unsigned int) Read_Little_Endian(binary_file, binary_file_name, 4);
+    // The formatting is not a property of the results; it is a property of the JSON file
+    settings = (format_output) ? (settings & ~((unsigned int) SHORTEN_OUTPUT)) : (settings | SHORTEN_OUTPUT);
+
+    // Four strings: First file, second file, program version and creation time
+    char* header_strings [4]        = { NULL, NULL, NULL, NULL };
+    size_t header_string_sizes [4]  = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(header_strings); ++ i)
+    {
+        header_string_sizes [i] = READER_INITIAL_ARRAY_SIZE;
+        header_strings [i] = (char*) MALLOC(header_string_sizes [i] * sizeof (char));
+        ASSERT_ALLOC(header_strings [i], "Cannot allocate memory for a string of the binary result file !",
+                header_string_sizes [i] * sizeof (char));
+        Read_String(binary_file, binary_file_name, &(header_strings [i]), &(header_string_sizes [i]));
+    }
+
+    // Buffer for all other strings
+    size_t str_buffer_size = READER_INITIAL_ARRAY_SIZE;
+    char* str_buffer = (char*) MALLOC(str_buffer_size * sizeof (char));
+    ASSERT_ALLOC(str_buffer, "Cannot allocate memory for a string of the binary result file !",
+            str_buffer_size * sizeof (char));
+
+    struct Two_Dim_C_String_Array* too_long_tokens [2] = { NULL, NULL };
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(too_long_tokens); ++ i)
+    {
+        too_long_tokens [i] = TwoDimCStrArray_CreateObject(1);
+        const uint_fast64_t count = Read_Little_Endian(binary_file, binary_file_name, 4);
+        for (uint_fast64_t i2 = 0; i2 < count; ++ i2)
+        {
+            const size_t length = Read_String(binary_file, binary_file_name, &str_buffer, &str_buffer_size);
+            ASSERT_FMSG(length > 0, "Empty too long token in the file \"%s\" !", binary_file_name);
+            TwoDimCStrArray_AppendNewString(too_long_tokens [i], str_buffer, length);
+        }
+    }
+
+    // >>> Vocabulary <<<
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject();
+    const uint_fast64_t vocabulary_size = Read_Little_Endian(binary_file, binary_file_name, 4);
+    for (uint_fast64_t i = 0; i < vocabulary_size; ++ i)
+    {
+        const uint_fast32_t mapping_int = (uint_fast32_t) Read_Little_Endian(binary_file, binary_file_name, 4);
+        const size_t length = Read_String(binary_file, binary_file_name, &str_buffer, &str_buffer_size);
+        ASSERT_FMSG(length > 0, "Empty token in the vocabulary of the file \"%s\" !", binary_file_name);
+        TokenIntMapping_AddTokenWithMappedInt(token_int_mapping, str_buffer, length, mapping_int);
+    }
+
+    // >>> Records <<<
+    struct Result_Export* result_export = ResultExport_CreateObject(json_file_name, OUTPUT_FORMAT_JSON, settings,
+            token_int_mapping, 0);
+    ResultExport_WriteHeader(result_export, header_strings [0], header_strings [1], header_strings [2],
+            header_strings [3], too_long_tokens [0], too_long_tokens [1]);
+
+    size_t query_id_size                = READER_INITIAL_ARRAY_SIZE;
+    size_t query_data_size              = READER_INITIAL_ARRAY_SIZE;
+    size_t query_data_wo_stop_words_size = READER_INITIAL_ARRAY_SIZE;
+    size_t hit_data_size                = READER_INITIAL_ARRAY_SIZE;
+    char* query_id                      = (char*) MALLOC(query_id_size * sizeof (char));
+    ASSERT_ALLOC(query_id, "Cannot allocate memory for a query ID !", query_id_size * sizeof (char));
+    uint_fast32_t* query_data           = (uint_fast32_t*) MALLOC(query_data_size * sizeof (uint_fast32_t));
+    ASSERT_ALLOC(query_data, "Cannot allocate memory for query data !", query_data_size * sizeof (uint_fast32_t));
+    uint_fast32_t* query_data_wo_stop_words = (uint_fast32_t*) MALLOC(query_data_wo_stop_words_size *
+            sizeof (uint_fast32_t));
+    ASSERT_ALLOC(query_data_wo_stop_words, "Cannot allocate memory for query data without stop words !",
+            query_data_wo_stop_words_size * sizeof (uint_fast32_t));
+    uint_fast32_t* hit_data             = (uint_fast32_t*) MALLOC(hit_data_size * sizeof (uint_fast32_t));
+    ASSERT_ALLOC(hit_data, "Cannot allocate memory for hit data !", hit_data_size * sizeof (uint_fast32_t));
+    // All offset arrays will be used with the same number of elements like the hit data
+    size_t char_offsets_size            = hit_data_size;
+    size_t sentence_offsets_size        = hit_data_size;
+    size_t word_offsets_size            = hit_data_size;
+    CHAR_OFFSET_TYPE* char_offsets      = (CHAR_OFFSET_TYPE*) CALLOC(hit_data_size, sizeof (CHAR_OFFSET_TYPE));
+    ASSERT_ALLOC(char_offsets, "Cannot allocate memory for char offsets !", hit_data_size * sizeof (CHAR_OFFSET_TYPE));
+    SENTENCE_OFFSET_TYPE* sentence_offsets = (SENTENCE_OFFSET_TYPE*) CALLOC(hit_data_size, sizeof (SENTENCE_OFFSET_TYPE));
+    ASSERT_ALLOC(sentence_offsets, "Cannot allocate memory for sentence offsets !",
+            hit_data_size * sizeof (SENTENCE_OFFSET_TYPE));
+    WORD_OFFSET_TYPE* word_offsets      = (WORD_OFFSET_TYPE*) CALLOC(hit_data_size, sizeof (WORD_OFFSET_TYPE));
+    ASSERT_ALLOC(word_offsets, "Cannot allocate memory for word offsets !", hit_data_size * sizeof (WORD_OFFSET_TYPE));
+
+    _Bool end_record_found = false;
+    while (! end_record_found)
+    {
+        const int record_type = fgetc(binary_file);
+        ASSERT_FMSG(record_type != EOF, "Unexpected end of the binary result file \"%s\" ! (The file is incomplete)",
+                binary_file_name);
+
+        switch (record_type)
+        {
+        case 'S':
+        {
+            ResultExport_EndSet(result_export);
+
+            Read_String(binary_file, binary_file_name, &query_id, &query_id_size);
+            const size_t query_data_length = (size_t) Read_Little_Endian(binary_file, binary_file_name, 4);
+            Ensure_Array_Size((void**) &query_data, &query_data_size, query_data_length, sizeof (uint_fast32_t));
+            for (size_t i = 0; i < query_data_length; ++ i)
+            {
+                query_data [i] = (uint_fast32_t) Read_Little_Endian(binary_file, binary_file_name, 4);
+            }
+            const size_t query_length_wo_stop_words = (size_t) Read_Little_Endian(binary_file, binary_file_name, 4);
+            Ensure_Array_Size((void**) &query_data_wo_stop_words, &query_data_wo_stop_words_size,
+                    query_length_wo_stop_words, sizeof (uint_fast32_t));
+            for (size_t i = 0; i < query_length_wo_stop_words; ++ i)
+            {
+                query_data_wo_stop_words [i] = (uint_fast32_t) Read_Little_Endian(binary_file, binary_file_name, 4);
+            }
+            ResultExport_BeginSet(result_export, query_id, query_data, query_data_length, query_data_wo_stop_words,
+                    query_length_wo_stop_words);
+            // A set record is only in the file, when the query had hits
+            Start_Set(result_export);
+            break;
+        }
+        case 'H':
+        {
+            ASSERT_FMSG(result_export->query_started, "Hit record without a set record in the file \"%s\" !",
+                    binary_file_name);
+            // The match type will be determined again in ResultExport_AddIntersection()
+            (void) Read_Little_Endian(binary_file, binary_file_name, 1);
+            Read_String(binary_file, binary_file_name, &str_buffer, &str_buffer_size);
+
+            const size_t hit_data_length = (size_t) Read_Little_Endian(binary_file, binary_file_name, 4);
+            Ensure_Array_Size((void**) &hit_data, &hit_data_size, hit_data_length, sizeof (uint_fast32_t));
+            Ensure_Array_Size((void**) &char_offsets, &char_offsets_size, hit_data_length, sizeof (CHAR_OFFSET_TYPE));
+            Ensure_Array_Size((void**) &sentence_offsets, &sentence_offsets_size, hit_data_length,
+                    sizeof (SENTENCE_OFFSET_TYPE));
+            Ensure_Array_Size((void**) &word_offsets, &word_offsets_size, hit_data_length, sizeof (WORD_OFFSET_TYPE));
+
+            for (size_t i = 0; i < hit_data_length; ++ i)
+            {
+                hit_data [i] = (uint_fast32_t) Read_Little_Endian(binary_file, binary_file_name, 4);
+            }
+            for (size_t i = 0; i < hit_data_length; ++ i)
+            {
+                char_offsets [i] = (CHAR_OFFSET_TYPE) Read_Little_Endian(binary_file, binary_file_name,
+                        char_offset_size);
+            }
+            if (SENTENCE_OFFSET_BIT(settings))
+            {
+                for (size_t i = 0; i < hit_data_length; ++ i)
+                {
+                    sentence_offsets [i] = (SENTENCE_OFFSET_TYPE) Read_Little_Endian(binary_file, binary_file_name,
+                            sentence_offset_size);
+                }
+            }
+            if (WORD_OFFSET_BIT(settings))
+            {
+                for (size_t i = 0; i < hit_data_length; ++ i)
+                {
+                    word_offsets [i] = (WORD_OFFSET_TYPE) Read_Little_Endian(binary_file, binary_file_name,
+                            word_offset_size);
+                }
+            }
+
+            ResultExport_AddIntersection(result_export, str_buffer, hit_data, char_offsets, sentence_offsets,
+                    word_offsets, hit_data_length);
+            break;
+        }
+        case 'E':
+            ResultExport_EndSet(result_export);
+            end_record_found = true;
+            break;
+        default:
+            ASSERT_FMSG(false, "Invalid record type (%d) in the binary result file \"%s\" !", record_type,
+                    binary_file_name);
+        }
+    }
+
+    ResultExport_WriteFooter(result_export);
+    ResultExport_DeleteObject(result_export);
+    result_export = NULL;
+    const int close_result = fclose(binary_file);
+    binary_file = NULL;
+    ASSERT_FMSG(close_result != EOF, "Cannot close the binary file \"%s\" ! EOF was returned !", binary_file_name);
+
+    FREE_AND_SET_TO_NULL(query_id);
+    FREE_AND_SET_TO_NULL(query_data);
+    FREE_AND_SET_TO_NULL(query_data_wo_stop_words);
+    FREE_AND_SET_TO_NULL(hit_data);
+    FREE_AND_SET_TO_NULL(char_offsets);
+    FREE_AND_SET_TO_NULL(sentence_offsets);
+    FREE_AND_SET_TO_NULL(word_offsets);
+    FREE_AND_SET_TO_NULL(str_buffer);
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(header_strings); ++ i)
+    {
+        FREE_AND_SET_TO_NULL(header_strings [i]);
+    }
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(too_long_tokens); ++ i)
+    {
+        TwoDimCStrArray_DeleteObject(too_long_tokens [i]);
+        too_long_tokens [i] = NULL;
+    }
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Write data to the result file.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] data Data
+ * @param[in] data_length Number of bytes
+ */
+static void
+Write_To_Result_File
+(
+        struct Result_Export* const restrict object,
+        const void* const restrict data,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+
+    // Write errors of the writer thread will be reported with ASSERT_FMSG in this call or at the deletion
+    AsyncFileWriter_Write(object->file_writer, data, data_length);
+    object->file_size += data_length;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add general information to the export cJSON object.
+ *
+ * General information are:
+ *      - Input file 1
+ *      - Input file 2
+ *      - Program version
+ *      - Creation time (ctime format)
+ *
+ * Creation modes:
+ *      - Partial match
+ *      - Full match
+ *      - Stop word list used
+ *      - Char offset
+ *
+ * Asserts:
+ *      export_results != NULL
+ *
+ * @param export_results The main cJSON pointer for the export JSON file
+ * @param export_settings Settings for the export (Which information will be occur in the general information ?)
+ * @param first_file Name of the first input file
+ * @param second_file Name of the second input file
+ * @param program_version Program version
+ * @param creation_time Creation time
+ * @param max_document_frequency Max. document frequency of a token, that is not a stop word
+ * @param auto_stop_words Tokens, that were removed because of their document frequency (NULL: Not used)
+ */
+static void
+Add_General_Information_To_Export_File
+(
+        cJSON* const export_results,
+        const unsigned int export_settings,
+        const char* const first_file,
+        const char* const second_file,
+        const char* const program_version,
+        const char* const creation_time,
+        const float max_document_frequency,
+        const struct Two_Dim_C_String_Array* const auto_stop_words
+)
+{
+    ASSERT_MSG(export_results != NULL, "Main cJSON result pointer is NULL !");
+
+    // Insert some general info to the export file
+    cJSON* general_infos    = cJSON_CreateObject();
+    cJSON_NOT_NULL(general_infos);
+    cJSON* first_file_str   = cJSON_CreateString(first_file);
+    cJSON_NOT_NULL(first_file_str);
+    cJSON* second_file_str  = cJSON_CreateString(second_file);
+    cJSON_NOT_NULL(second_file_str);
+    cJSON* program_version_str = cJSON_CreateString(program_version);
+    cJSON_NOT_NULL(program_version_str);
+
+    // Creation mode (Part match ? Full match ? Part and full match ?)
+    cJSON* creation_mode = cJSON_CreateObject();
+    cJSON_NOT_NULL(creation_mode);
+    cJSON* part_match = cJSON_CreateBool(PART_MATCH_BIT(export_settings));
+    cJSON_NOT_NULL(part_match);
+    cJSON* full_match = cJSON_CreateBool(FULL_MATCH_BIT(export_settings));
+    cJSON_NOT_NULL(full_match);
+    cJSON* stop_word_list = cJSON_CreateBool(STOP_WORD_LIST_BIT(export_settings));
+    cJSON_NOT_NULL(stop_word_list);
+
+    // Up to now there will be no switch or similar structure to alter this export behavior
+    cJSON* char_offset = cJSON_CreateBool(CHAR_OFFSET_BIT(export_settings));
+    cJSON_NOT_NULL(char_offset);
+    cJSON* sentence_offset = cJSON_CreateBool(SENTENCE_OFFSET_BIT(export_settings));
+    cJSON_NOT_NULL(sentence_offset);
+    cJSON* word_offset = cJSON_CreateBool(WORD_OFFSET_BIT(export_settings));
+    cJSON_NOT_NULL(sentence_offset);
+    cJSON* keep_single_tokens_result = cJSON_CreateBool(KEEP_SINGLE_TOKEN_RESULTS_BIT(export_settings));
+    cJSON_NOT_NULL(sentence_offset);
+
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(creation_mode, "Part match", part_match);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(creation_mode, "Full match", full_match);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(creation_mode, "Stop word list used", stop_word_list);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(creation_mode, "Char offset", char_offset);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(creation_mode, "Sentence offset", sentence_offset);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(creation_mode, "Word offset", word_offset);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(creation_mode, "Keep single tokens result", keep_single_tokens_result);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(general_infos, "Creation mode", creation_mode);
+
+    cJSON* creation_time_str = cJSON_CreateString(creation_time);
+    cJSON_NOT_NULL(creation_time_str);
+
+    if (!(export_settings & NO_FILENAMES))
+    {
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(general_infos, "First file", first_file_str);
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(general_infos, "Second file", second_file_str);
+    }
+    if (!(export_settings & NO_PROGRAM_VERSION))
+    {
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(general_infos, "Program version", program_version_str);
+    }
+    if (!(export_settings & NO_CREATION_TIME))
+    {
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(general_infos, "Creation time", creation_time_str);
+    }
+    if (auto_stop_words != NULL)
+    {
+        cJSON* auto_stop_words_obj = cJSON_CreateObject();
+        cJSON_NOT_NULL(auto_stop_words_obj);
+        // Without the rounding the float value would be printed with all its binary digits (0.2 -> 0.200000002980232)
+        cJSON* max_df = cJSON_CreateNumber(round((double) max_document_frequency * 1000000.0) / 1000000.0);
+        cJSON_NOT_NULL(max_df);
+        cJSON* auto_stop_words_array = cJSON_CreateArray();
+        cJSON_NOT_NULL(auto_stop_words_array);
+        for (size_t i = 0; i < auto_stop_words->next_free_c_str; ++ i)
+        {
+            cJSON* token = cJSON_CreateString(auto_stop_words->data [i]);
+            cJSON_NOT_NULL(token);
+            cJSON_ADD_ITEM_TO_ARRAY_CHECK(auto_stop_words_array, token);
+        }
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(auto_stop_words_obj, "Max. document frequency", max_df);
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(auto_stop_words_obj, "Tokens", auto_stop_words_array);
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(general_infos, "Auto stop words", auto_stop_words_obj);
+    }
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, "General infos", general_infos);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Include counter information to the "General information" block of a result file.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *
+ * @param export_results The main cJSON pointer for the export JSON file
+ * @param export_settings Settings for the export (Which information will be occur in the result file -> which counter
+ *      are relevant for the general information ?)
+ * @param number_of_partial_sets Number of sets with partial matches in the whole file
+ * @param number_of_full_sets Number of sets with full matches in the whole file
+ * @param number_of_token_in_partial_sets Sum of all tokens in all partial matches
+ * @param number_of_token_in_full_sets Sum of all tokens in all full matches
+ */
+static void
+Add_Counter_To_Export_File
+(
+        cJSON* const export_results,
+        const unsigned int export_settings,
+        const uint_fast64_t number_of_partial_sets,
+        const uint_fast64_t number_of_full_sets,
+        const uint_fast64_t number_of_token_in_partial_sets,
+        const uint_fast64_t number_of_token_in_full_sets
+)
+{
+    ASSERT_MSG(export_results != NULL, "Main cJSON result pointer is NULL !");
+
+    cJSON* counter = cJSON_CreateObject();
+    cJSON_NOT_NULL(counter);
+
+    // "cJSON_CreateNumber()" can only create double values !
+    const double d_number_of_partial_sets           = (double) number_of_partial_sets;
+    const double d_number_of_token_in_partial_sets  = (double) number_of_token_in_partial_sets;
+    const double d_number_of_full_sets              = (double) number_of_full_sets;
+    const double d_number_of_token_in_full_sets     = (double) number_of_token_in_full_sets;
+
+    if (export_settings & PART_MATCH)
+    {
+        cJSON* num_partial_sets = cJSON_CreateNumber(d_number_of_partial_sets);
+        cJSON_NOT_NULL(num_partial_sets);
+        cJSON* num_tokens_in_partial_sets = cJSON_CreateNumber(d_number_of_token_in_partial_sets);
+        cJSON_NOT_NULL(num_tokens_in_partial_sets);
+
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(counter, "Count partial matches", num_partial_sets);
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(counter, "Count tokens in partial matches", num_tokens_in_partial_sets);
+    }
+    if (export_settings & FULL_MATCH)
+    {
+        cJSON* num_full_sets = cJSON_CreateNumber(d_number_of_full_sets);
+        cJSON_NOT_NULL(num_full_sets);
+        cJSON* num_tokens_in_full_sets = cJSON_CreateNumber(d_number_of_token_in_full_sets);
+        cJSON_NOT_NULL(num_tokens_in_full_sets);
+
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(counter, "Count full matches", num_full_sets);
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(counter, "Count tokens in full matches", num_tokens_in_full_sets);
+    }
+
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, "Counter", counter);
+
+    if (! PART_MATCH_BIT(export_settings) && ! FULL_MATCH_BIT(export_settings))
+    {
+        cJSON* no_data_available = cJSON_CreateString("");
+        cJSON_NOT_NULL(no_data_available);
+
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, "No data available !", no_data_available);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add too long tokens from the two input file to a JSON block. (One array for each file)
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      too_long_tokens_1 != NULL
+ *      too_long_tokens_2 != NULL
+ *
+ * @param export_results Preallocated cJSON object as result for the operation
+ * @param too_long_tokens_1 Too long tokens of the first file
+ * @param too_long_tokens_2 Too long tokens of the second file
+ */
+static void
+Add_Too_Long_Tokens_To_Export_File
+(
+        cJSON* const export_results,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_1,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_2
+)
+{
+    ASSERT_MSG(export_results != NULL, "cJSON result pointer is NULL !");
+    ASSERT_MSG(too_long_tokens_1 != NULL, "Too long tokens of the first file are NULL !");
+    ASSERT_MSG(too_long_tokens_2 != NULL, "Too long tokens of the second file are NULL !");
+
+    cJSON* too_long_token_list = cJSON_CreateObject();
+    cJSON_NOT_NULL(too_long_token_list);
+    cJSON* list_first_file = cJSON_CreateArray();
+    cJSON_NOT_NULL(list_first_file);
+    cJSON* list_second_file = cJSON_CreateArray();
+    cJSON_NOT_NULL(list_second_file);
+
+    // Too long tokens from the first Token_Container_List
+    for (size_t i = 0; i < too_long_tokens_1->next_free_c_str; ++ i)
+    {
+        cJSON* cjson_str = cJSON_CreateString(too_long_tokens_1->data [i]);
+        cJSON_NOT_NULL(cjson_str);
+        cJSON_ADD_ITEM_TO_ARRAY_CHECK(list_first_file, cjson_str);
+    }
+
+    // Too long tokens from the second Token_Container_List
+    for (size_t i = 0; i < too_long_tokens_2->next_free_c_str; ++ i)
+    {
+        cJSON* cjson_str = cJSON_CreateString(too_long_tokens_2->data [i]);
+        cJSON_NOT_NULL(cjson_str);
+        cJSON_ADD_ITEM_TO_ARRAY_CHECK(list_first_file, cjson_str);
+    }
+
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(too_long_token_list, "In first file:", list_first_file);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(too_long_token_list, "In second file:", list_second_file);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, "Too long tokens", too_long_token_list);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Convert a cJSON object to a c string and append it to the result file.
+ *
+ * Asserts:
+ *      object != NULL,
+ *      cJSON_obj != NULL
+ *
+ * @param object Result_Export object
+ * @param cJSON_obj cJSON object
+ */
+static void
+Append_cJSON_Object_To_Result_File
+(
+        struct Result_Export* const restrict object,
+        const cJSON* const restrict cJSON_obj
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(cJSON_obj != NULL, "cJSON object is NULL !");
+
+    // Insert the general information to the result file
+    char* general_information_as_str = cJSON_PrintBuffered(cJSON_obj, CJSON_PRINT_BUFFER_SIZE,
+            ! SHORTEN_OUTPUT_BIT(object->settings)); // No shorten output => Using formatting
+
+    ASSERT_MSG(general_information_as_str != NULL, "JSON general information string is NULL !");
+    const size_t general_information_as_str_len = strlen (general_information_as_str);
+
+    // Remove the last char(s), to make the fragment compatible as JSON fragment
+    // "+ 1" to avoid the first char. It is in every case a '{'.
+    // In every situation this char will create a invalid JSON file (except the file is empty)
+    const size_t ignored_tail_bytes = (! SHORTEN_OUTPUT_BIT(object->settings)) ? 2 : 1;
+    Write_To_Result_File(object, general_information_as_str + 1,
+            general_information_as_str_len - 1 - ignored_tail_bytes);
+    Write_To_Result_File(object, ",", STATIC_STRLEN(","));
+
+    // Don't use the macro "FREE_AND_SET_TO_NULL" because it increases the free counter. But this memory was
+    // allocated from the JSON lib !
+    free(general_information_as_str);
+    general_information_as_str = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the pre-escaped JSON string (with the quotation marks) of a mapped token.
+ *
+ * The fragment will be created with the first request of the token: Reverse mapping (int -> token) and JSON escaping
+ * are done only once per token. The table grows, when the mapped integer is larger than the table.
+ *
+ * Asserts:
+ *      object != NULL
+ *      mapped_token != UINT_FAST32_MAX
+ *
+ * @param[in] object Result_Export object
+ * @param[in] mapped_token Mapped token
+ *
+ * @return Address of the fragment information (Only valid until the next call !)
+ */
+static const struct Token_Fragment*
+Get_Token_Fragment
+(
+        struct Result_Export* const object,
+        const uint_fast32_t mapped_token
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(mapped_token != UINT_FAST32_MAX, "Mapped token is UINT_FAST32_MAX ! This value indicates errors and "
+            "therefore cannot be a valid input !");
+
+    if (mapped_token >= object->token_fragment_table_size)
+    {
+        size_t new_size = object->token_fragment_table_size;
+        while (new_size <= mapped_token)
+        {
+            new_size *= 2;
+        }
+        struct Token_Fragment* tmp_ptr = (struct Token_Fragment*) REALLOC(object->token_fragment_table,
+                new_size * sizeof (struct Token_Fragment));
+        ASSERT_ALLOC(tmp_ptr, "Cannot increase the token fragment table !", new_size * sizeof (struct Token_Fragment));
+        memset (tmp_ptr + object->token_fragment_table_size, '\0',
+                (new_size - object->token_fragment_table_size) * sizeof (struct Token_Fragment));
+        object->token_fragment_table = tmp_ptr;
+        object->token_fragment_table_size = new_size;
+    }
+
+    struct Token_Fragment* const fragment = &(object->token_fragment_table [mapped_token]);
+    if (fragment->length == 0)
+    {
+        // Reverse the mapping to get the original token (int -> token)
+        const char* int_to_token_mem = TokenIntMapping_IntToTokenStaticMem(object->token_int_mapping, mapped_token);
+        const size_t int_to_token_mem_length = strlen (int_to_token_mem);
+
+        // The fragment buffer has no container; so the string will be written without a separator
+        fragment->offset = object->token_fragments->used_bytes;
+        JSONWriter_AddString(object->token_fragments, int_to_token_mem, int_to_token_mem_length);
+        fragment->length = object->token_fragments->used_bytes - fragment->offset;
+    }
+
+    return fragment;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Start the current set: The information about the query will be exported.
+ *
+ * This will be done lazy with the first hit of a query, because most queries have no hits.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+static void
+Start_Set
+(
+        struct Result_Export* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+
+    object->query_started = true;
+
+    switch (object->format)
+    {
+    case OUTPUT_FORMAT_JSON:
+        // Begin the result object for the current query with the source tokens
+        JSONWriter_BeginObject(object->set_data);
+        JSONWriter_AddKey(object->set_data, object->query_id);
+        JSONWriter_BeginObject(object->set_data);
+
+        Append_Source_Tokens_To_Export_Results(object);
+        break;
+    case OUTPUT_FORMAT_BINARY:
+        JSONWriter_AddRawData(object->set_data, "S", STATIC_STRLEN("S"));
+        Append_Binary_String(object->set_data, object->query_id);
+        Append_Little_Endian(object->set_data, object->query_data_length, 4);
+        for (size_t i = 0; i < object->query_data_length; ++ i)
+        {
+            Append_Little_Endian(object->set_data, object->query_data [i], 4);
+        }
+        Append_Little_Endian(object->set_data, object->query_tokens_wo_stop_words, 4);
+        for (size_t i = 0; i < object->query_tokens_wo_stop_words; ++ i)
+        {
+            Append_Little_Endian(object->set_data, object->query_data_wo_stop_words [i], 4);
+        }
+        break;
+    case OUTPUT_FORMAT_NDJSON:
+        // The first member of every hit line; the depth is the depth of the members in the hit object
+        JSONWriter_Reset(object->set_header, 1);
+        JSONWriter_AddKey(object->set_header, "query");
+        JSONWriter_AddString(object->set_header, object->query_id, strlen (object->query_id));
+        break;
+    case OUTPUT_FORMAT_TSV:
+        // The first column of every hit line
+        JSONWriter_Reset(object->set_header, 0);
+        Append_TSV_Escaped_String(object->set_header, object->query_id, strlen (object->query_id));
+        JSONWriter_AddRawData(object->set_header, "\t", STATIC_STRLEN("\t"));
+        break;
+    case OUTPUT_FORMAT_INVALID:
+    default:
+        ASSERT_MSG(false, "Invalid output format !");
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append the "tokens" and the "tokens w/o stop words" array of the current query to the set data.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+static void
+Append_Source_Tokens_To_Export_Results
+(
+        struct Result_Export* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+
+    struct JSON_Writer* const export_results = object->set_data;
+
+    JSONWriter_AddKey(export_results, "tokens");
+    JSONWriter_BeginArray(export_results);
+    for (size_t i = 0; i < object->query_data_length; ++ i)
+    {
+        const struct Token_Fragment* const fragment = Get_Token_Fragment(object, object->query_data [i]);
+        JSONWriter_AddEscapedString(export_results, object->token_fragments->data + fragment->offset,
+                fragment->length);
+    }
+    JSONWriter_EndArray(export_results);
+
+    JSONWriter_AddKey(export_results, "tokens w/o stop words");
+    JSONWriter_BeginArray(export_results);
+    for (size_t i = 0; i < object->query_tokens_wo_stop_words; ++ i)
+    {
+        const struct Token_Fragment* const fragment = Get_Token_Fragment(object, object->query_data_wo_stop_words [i]);
+        JSONWriter_AddEscapedString(export_results, object->token_fragments->data + fragment->offset,
+                fragment->length);
+    }
+    JSONWriter_EndArray(export_results);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append the members, that all hit formats have: "tokens" and the offset arrays.
+ *
+ * Asserts:
+ *      object != NULL
+ *      export_results != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object (Token fragments and the settings: Which offsets will be exported ?)
+ * @param[in] export_results JSON_Writer; the current container needs to be an object
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets
+ * @param[in] sentence_offsets Sentence offsets
+ * @param[in] word_offsets Word offsets
+ * @param[in] data_length Number of tokens
+ */
+static void
+Append_Tokens_And_Offsets_To_Export_Results
+(
+        struct Result_Export* const restrict object,
+        struct JSON_Writer* const restrict export_results,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(export_results != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(char_offsets != NULL, "Char offsets are NULL !");
+    ASSERT_MSG(sentence_offsets != NULL, "Sentence offsets are NULL !");
+    ASSERT_MSG(word_offsets != NULL, "Word offsets are NULL !");
+
+    const unsigned int intersection_settings = object->settings;
+
+    JSONWriter_AddKey(export_results, "tokens");
+    JSONWriter_BeginArray(export_results);
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        const struct Token_Fragment* const fragment = Get_Token_Fragment(object, data [i]);
+        JSONWriter_AddEscapedString(export_results, object->token_fragments->data + fragment->offset,
+                fragment->length);
+    }
+    JSONWriter_EndArray(export_results);
+
+    JSONWriter_AddKey(export_results, "char " OFFSET);
+    JSONWriter_BeginArray(export_results);
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        JSONWriter_AddUInt(export_results, char_offsets [i]);
+    }
+    JSONWriter_EndArray(export_results);
+
+    if (SENTENCE_OFFSET_BIT(intersection_settings))
+    {
+        JSONWriter_AddKey(export_results, "sentence " OFFSET);
+        JSONWriter_BeginArray(export_results);
+        for (size_t i = 0; i < data_length; ++ i)
+        {
+            JSONWriter_AddUInt(export_results, sentence_offsets [i]);
+        }
+        JSONWriter_EndArray(export_results);
+    }
+    if (WORD_OFFSET_BIT(intersection_settings))
+    {
+        JSONWriter_AddKey(export_results, "word " OFFSET);
+        JSONWriter_BeginArray(export_results);
+        for (size_t i = 0; i < data_length; ++ i)
+        {
+            JSONWriter_AddUInt(export_results, word_offsets [i]);
+        }
+        JSONWriter_EndArray(export_results);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append a TSV field with escaped data. ('\\', '\t', '\n', '\r' and '|' will be escaped with a backslash)
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      str != NULL
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] str String
+ * @param[in] str_length Length of the string
+ */
+static void
+Append_TSV_Escaped_String
+(
+        struct JSON_Writer* const restrict export_results,
+        const char* const restrict str,
+        const size_t str_length
+)
+{
+    ASSERT_MSG(export_results != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(str != NULL, "String is NULL !");
+
+    // Append the unproblematic parts in blocks
+    size_t block_begin = 0;
+    for (size_t i = 0; i < str_length; ++ i)
+    {
+        char escaped [2] = { '\\', '\0' };
+        switch (str [i])
+        {
+        case '\\':  escaped [1] = '\\'; break;
+        case '\t':  escaped [1] = 't';  break;
+        case '\n':  escaped [1] = 'n';  break;
+        case '\r':  escaped [1] = 'r';  break;
+        case '|':   escaped [1] = '|';  break;
+        default:    continue;
+        }
+
+        JSONWriter_AddRawData(export_results, str + block_begin, i - block_begin);
+        JSONWriter_AddRawData(export_results, escaped, COUNT_ARRAY_ELEMENTS(escaped));
+        block_begin = i + 1;
+    }
+    JSONWriter_AddRawData(export_results, str + block_begin, str_length - block_begin);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append a unsigned integer as decimal number.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] value Value
+ */
+static void
+Append_Decimal
+(
+        struct JSON_Writer* const export_results,
+        const uint_fast64_t value
+)
+{
+    ASSERT_MSG(export_results != NULL, "JSON_Writer is NULL !");
+
+    // The digits will be created in reverse order
+    char digits [20];
+    size_t number_of_digits = COUNT_ARRAY_ELEMENTS(digits);
+    uint_fast64_t remaining_value = value;
+    do
+    {
+        digits [-- number_of_digits] = (char) ('0' + (remaining_value % 10));
+        remaining_value /= 10;
+    } while (remaining_value != 0);
+
+    JSONWriter_AddRawData(export_results, digits + number_of_digits, COUNT_ARRAY_ELEMENTS(digits) - number_of_digits);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append one hit as TSV line.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_id != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] document_id ID of the document
+ * @param[in] full_match Is the hit a full match ?
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets
+ * @param[in] sentence_offsets Sentence offsets
+ * @param[in] word_offsets Word offsets
+ * @param[in] data_length Number of tokens
+ */
+static void
+Append_TSV_Line
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict document_id,
+        const _Bool full_match,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(document_id != NULL, "Document ID is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(char_offsets != NULL, "Char offsets are NULL !");
+    ASSERT_MSG(sentence_offsets != NULL, "Sentence offsets are NULL !");
+    ASSERT_MSG(word_offsets != NULL, "Word offsets are NULL !");
+
+    struct JSON_Writer* const line = object->set_data;
+
+    JSONWriter_AddRawData(line, object->set_header->data, object->set_header->used_bytes);
+    Append_TSV_Escaped_String(line, document_id, strlen (document_id));
+    if (full_match)
+    {
+        JSONWriter_AddRawData(line, "\tfull\t", STATIC_STRLEN("\tfull\t"));
+    }
+    else
+    {
+        JSONWriter_AddRawData(line, "\tpartial\t", STATIC_STRLEN("\tpartial\t"));
+    }
+
+    _Bool first_value = true;
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        if (! first_value) { JSONWriter_AddRawData(line, "|", STATIC_STRLEN("|")); }
+        first_value = false;
+
+        // Reverse the mapping to get the original token (int -> token)
+        const char* int_to_token_mem = TokenIntMapping_IntToTokenStaticMem(object->token_int_mapping, data [i]);
+        Append_TSV_Escaped_String(line, int_to_token_mem, strlen (int_to_token_mem));
+    }
+
+    // All offset columns have the same structure
+    for (uint_fast8_t offset_type = 0; offset_type < 3; ++ offset_type)
+    {
+        if (offset_type == 1 && ! SENTENCE_OFFSET_BIT(object->settings)) { continue; }
+        if (offset_type == 2 && ! WORD_OFFSET_BIT(object->settings)) { continue; }
+
+        JSONWriter_AddRawData(line, "\t", STATIC_STRLEN("\t"));
+        first_value = true;
+        for (size_t i = 0; i < data_length; ++ i)
+        {
+            if (! first_value) { JSONWriter_AddRawData(line, ",", STATIC_STRLEN(",")); }
+            first_value = false;
+
+            Append_Decimal(line, (offset_type == 0) ? (uint_fast64_t) char_offsets [i] :
+                    ((offset_type == 1) ? (uint_fast64_t) sentence_offsets [i] : (uint_fast64_t) word_offsets [i]));
+        }
+    }
+    JSONWriter_AddRawData(line, "\n", STATIC_STRLEN("\n"));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append a unsigned integer in little-endian byte order.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      value_size <= 8
+ *      value fits in value_size bytes
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] value Value
+ * @param[in] value_size Number of bytes
+ */
+static void
+Append_Little_Endian
+(
+        struct JSON_Writer* const export_results,
+        const uint_fast64_t value,
+        const size_t value_size
+)
+{
+    ASSERT_MSG(export_results != NULL, "JSON_Writer is NULL !");
+    ASSERT_FMSG(value_size <= 8, "Invalid value size: %zu ! Max. valid: 8", value_size);
+    ASSERT_FMSG(value_size == 8 || (value >> (value_size * 8)) == 0, "The value %" PRIuFAST64 " does not fit in %zu "
+            "byte !", value, value_size);
+
+    // Byte by byte; so the result does not depend on the byte order of the host system
+    unsigned char bytes [8];
+    for (size_t i = 0; i < value_size; ++ i)
+    {
+        bytes [i] = (unsigned char) ((value >> (i * 8)) & 0xFF);
+    }
+    JSONWriter_AddRawData(export_results, bytes, value_size);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append a string in the binary format: u32 length + bytes without terminator.
+ *
+ * Asserts:
+ *      export_results != NULL
+ *      str != NULL
+ *
+ * @param[in] export_results JSON_Writer (used as byte buffer)
+ * @param[in] str String
+ */
+static void
+Append_Binary_String
+(
+        struct JSON_Writer* const restrict export_results,
+        const char* const restrict str
+)
+{
+    ASSERT_MSG(export_results != NULL, "JSON_Writer is NULL !");
+    ASSERT_MSG(str != NULL, "String is NULL !");
+
+    const size_t str_length = strlen (str);
+    Append_Little_Endian(export_results, str_length, 4);
+    JSONWriter_AddRawData(export_results, str, str_length);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append one hit as binary record.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_id != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] document_id ID of the document
+ * @param[in] full_match Is the hit a full match ?
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets
+ * @param[in] sentence_offsets Sentence offsets
+ * @param[in] word_offsets Word offsets
+ * @param[in] data_length Number of tokens
+ */
+static void
+Append_Binary_Hit
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict document_id,
+        const _Bool full_match,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(document_id != NULL, "Document ID is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(char_offsets != NULL, "Char offsets are NULL !");
+    ASSERT_MSG(sentence_offsets != NULL, "Sentence offsets are NULL !");
+    ASSERT_MSG(word_offsets != NULL, "Word offsets are NULL !");
+
+    struct JSON_Writer* const record = object->set_data;
+
+    JSONWriter_AddRawData(record, "H", STATIC_STRLEN("H"));
+    Append_Little_Endian(record, (full_match) ? 1 : 0, 1);
+    Append_Binary_String(record, document_id);
+    Append_Little_Endian(record, data_length, 4);
+
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        Append_Little_Endian(record, data [i], 4);
+    }
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        Append_Little_Endian(record, char_offsets [i], sizeof (CHAR_OFFSET_TYPE));
+    }
+    if (SENTENCE_OFFSET_BIT(object->settings))
+    {
+        for (size_t i = 0; i < data_length; ++ i)
+        {
+            Append_Little_Endian(record, sentence_offsets [i], sizeof (SENTENCE_OFFSET_TYPE));
+        }
+    }
+    if (WORD_OFFSET_BIT(object->settings))
+    {
+        for (size_t i = 0; i < data_length; ++ i)
+        {
+            Append_Little_Endian(record, word_offsets [i], sizeof (WORD_OFFSET_TYPE));
+        }
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write the header and the vocabulary of the binary format to the result file.
+ *
+ * Asserts:
+ *      object != NULL
+ *      first_file != NULL
+ *      second_file != NULL
+ *      program_version != NULL
+ *      creation_time != NULL
+ *      too_long_tokens_1 != NULL
+ *      too_long_tokens_2 != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] first_file Name of the first input file
+ * @param[in] second_file Name of the second input file
+ * @param[in] program_version Program version
+ * @param[in] creation_time Creation time as string
+ * @param[in] too_long_tokens_1 Too long tokens of the first input file
+ * @param[in] too_long_tokens_2 Too long tokens of the second input file
+ */
+static void
+Write_Binary_Header
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict first_file,
+        const char* const restrict second_file,
+        const char* const restrict program_version,
+        const char* const restrict creation_time,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_1,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_2
+)
+{
+    ASSERT_MSG(object != NULL, "Result_Export is NULL !");
+    ASSERT_MSG(first_file != NULL, "Name of the first file is NULL !");
+    ASSERT_MSG(second_file != NULL, "Name of the second file is NULL !");
+    ASSERT_MSG(program_version != NULL, "Program version is NULL !");
+    ASSERT_MSG(creation_time != NULL, "Creation time is NULL !");
+    ASSERT_MSG(too_long_tokens_1 != NULL, "Too long tokens of the first file are NULL !");
+    ASSERT_MSG(too_long_tokens_2 != NULL, "Too long tokens of the second file are NULL !");
+
+    struct JSON_Writer* const header = object->set_data;
+    JSONWriter_Reset(header, 0);
+
+    JSONWriter_AddRawData(header, RESULT_EXPORT_BINARY_MAGIC, STATIC_STRLEN(RESULT_EXPORT_BINARY_MAGIC));
+    Append_Little_Endian(header, RESULT_EXPORT_BINARY_VERSION, 1);
+    Append_Little_Endian(header, sizeof (CHAR_OFFSET_TYPE), 1);
+    Append_Little_Endian(header, sizeof (SENTENCE_OFFSET_TYPE), 1);
+    Append_Little_Endian(header, sizeof (WORD_OFFSET_TYPE), 1);
+    Append_Little_Endian(header, object->settings, 4);
+
+    Append_Binary_String(header, first_file);
+    Append_Binary_String(header, second_file);
+    Append_Binary_String(header, program_version);
+    Append_Binary_String(header, creation_time);
+
+    Append_Little_Endian(header, too_long_tokens_1->next_free_c_str, 4);
+    for (size_t i = 0; i < too_long_tokens_1->next_free_c_str; ++ i)
+    {
+        Append_Binary_String(header, too_long_tokens_1->data [i]);
+    }
+    Append_Little_Endian(header, too_long_tokens_2->next_free_c_str, 4);
+    for (size_t i = 0; i < too_long_tokens_2->next_free_c_str; ++ i)
+    {
+        Append_Binary_String(header, too_long_tokens_2->data [i]);
+    }
+    Write_To_Result_File(object, header->data, header->used_bytes);
+    JSONWriter_Reset(header, 0);
+
+    // >>> Vocabulary <<<
+    const struct Token_Int_Mapping* const mapping = object->token_int_mapping;
+    uint_fast64_t vocabulary_size = 0;
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        vocabulary_size += mapping->c_str_array_lengths [i];
+    }
+    Append_Little_Endian(header, vocabulary_size, 4);
+
+    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
+    {
+        for (size_t i2 = 0; i2 < mapping->c_str_array_lengths [i]; ++ i2)
+        {
+            // The reverse mapping (TokenIntMapping_IntToTokenStaticMem()) returns max. MAX_TOKEN_LENGTH - 2 chars;
+            // only this part of the token can occur in the results
+            const char* const token = &(mapping->c_str_arrays [i][i2 * MAX_TOKEN_LENGTH]);
+            size_t token_length = 0;
+            while (token_length < MAX_TOKEN_LENGTH - 2 && token [token_length] != '\0') { ++ token_length; }
+
+            Append_Little_Endian(header, mapping->int_mapping [i][i2], 4);
+            Append_Little_Endian(header, token_length, 4);
+            JSONWriter_AddRawData(header, token, token_length);
+        }
+
+        // Avoid a large buffer
+        Write_To_Result_File(object, header->data, header->used_bytes);
+        JSONWriter_Reset(header, 0);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Update the "data found" flag.
+ *
+ * If not partial- and full matches should be appear in the result file, then the data found flag needs to be updated,
+ * because this flag only shows, that data was found. There is no differentiation, weather this are partial or full
+ * match data.
+ *
+ * @param[in] intersection_settings Settings for the intersection process
+ * @param[in] current_data_flag Status of the current data found flag
+ * @param[in] intersections_partial_match JSON_Writer with the partial match data, if available
+ * @param[in] intersections_full_match JSON_Writer with the full match data, if available
+ *
+ * @return The updated data found flag
+ */
+static inline _Bool
+Update_Data_Found_Flag
+(
+        const unsigned int intersection_settings,
+        const _Bool current_data_flag,
+        const struct JSON_Writer* const restrict intersections_partial_match,
+        const struct JSON_Writer* const restrict intersections_full_match
+)
+{
+    _Bool updated_data_found_flag = current_data_flag;
+
+    // An flag update can only cause a true to false
+    if (! current_data_flag)
+    {
+        return current_data_flag;
+    }
+
+    // The writer for the partial and full matches contain only members of the specific object. So a empty buffer
+    // means, that there are no members in this object
+    if ((PART_MATCH_BIT(intersection_settings)) && (FULL_MATCH_BIT(intersection_settings)))
+    {
+        // In normal situations this statement should be always true; but it is not guaranteed !
+        if (intersections_full_match != NULL && intersections_partial_match != NULL)
+        {
+            if (intersections_full_match->used_bytes == 0 && intersections_partial_match->used_bytes == 0)
+            {
+                updated_data_found_flag = false;
+            }
+        }
+    }
+    else if (FULL_MATCH_BIT(intersection_settings))
+    {
+        // In normal situations this statement should be always true; but it is not guaranteed !
+        if (intersections_full_match != NULL)
+        {
+            if (intersections_full_match->used_bytes == 0)
+            {
+                updated_data_found_flag = false;
+            }
+        }
+    }
+    else if (PART_MATCH_BIT(intersection_settings))
+    {
+        // In normal situations this statement should be always true; but it is not guaranteed !
+        if (intersections_partial_match != NULL)
+        {
+            if (intersections_partial_match->used_bytes == 0)
+            {
+                updated_data_found_flag = false;
+            }
+        }
+    }
+
+    return updated_data_found_flag;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a little-endian unsigned integer from a binary result file.
+ *
+ * Asserts:
+ *      file != NULL
+ *      file_name != NULL
+ *      value_size <= 8
+ *      value_size bytes are available
+ *
+ * @param[in] file Binary result file
+ * @param[in] file_name Name of the file (for error messages)
+ * @param[in] value_size Number of bytes
+ *
+ * @return The read value
+ */
+static uint_fast64_t
+Read_Little_Endian
+(
+        FILE* const restrict file,
+        const char* const restrict file_name,
+        const size_t value_size
+)
+{
+    ASSERT_MSG(file != NULL, "File is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_FMSG(value_size <= 8, "Invalid value size: %zu ! Max. valid: 8", value_size);
+
+    unsigned char bytes [8];
+    ASSERT_FMSG(fread(bytes, sizeof (unsigned char), value_size, file) == value_size,
+            "Unexpected end of the binary result file \"%s\" ! (The file is incomplete)", file_name);
+
+    uint_fast64_t value = 0;
+    for (size_t i = 0; i < value_size; ++ i)
+    {
+        value |= ((uint_fast64_t) bytes [i]) << (i * 8);
+    }
+
+    return value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a string (u32 length + bytes) from a binary result file in a dynamic buffer.
+ *
+ * The buffer will be increased, if necessary. The result is null terminated.
+ *
+ * Asserts:
+ *      file != NULL
+ *      file_name != NULL
+ *      buffer != NULL
+ *      *buffer != NULL
+ *      buffer_size != NULL
+ *      the string is complete available
+ *
+ * @param[in] file Binary result file
+ * @param[in] file_name Name of the file (for error messages)
+ * @param[in, out] buffer Address of the dynamic buffer
+ * @param[in, out] buffer_size Size of the dynamic buffer in bytes
+ *
+ * @return Length of the string
+ */
+static size_t
+Read_String
+(
+        FILE* const restrict file,
+        const char* const restrict file_name,
+        char** const restrict buffer,
+        size_t* const restrict buffer_size
+)
+{
+    ASSERT_MSG(file != NULL, "File is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(buffer != NULL, "Buffer is NULL !");
+    ASSERT_MSG(*buffer != NULL, "Buffer content is NULL !");
+    ASSERT_MSG(buffer_size != NULL, "Buffer size is NULL !");
+
+    const size_t str_length = (size_t) Read_Little_Endian(file, file_name, 4);
+    Ensure_Array_Size((void**) buffer, buffer_size, str_length + 1, sizeof (char));
+
+    ASSERT_FMSG(fread(*buffer, sizeof (char), str_length, file) == str_length,
+            "Unexpected end of the binary result file \"%s\" ! (The file is incomplete)", file_name);
+    (*buffer) [str_length] = '\0';
+
+    return str_length;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Increase a dynamic array, if it cannot hold the needed number of elements.
+ *
+ * Asserts:
+ *      array != NULL
+ *      *array != NULL
+ *      allocated_elements != NULL
+ *
+ * @param[in, out] array Address of the dynamic array
+ * @param[in, out] allocated_elements Number of allocated elements
+ * @param[in] needed_elements Number of needed elements
+ * @param[in] element_size Size of one element in bytes
+ */
+static void
+Ensure_Array_Size
+(
+        void** const restrict array,
+        size_t* const restrict allocated_elements,
+        const size_t needed_elements,
+        const size_t element_size
+)
+{
+    ASSERT_MSG(array != NULL, "Array is NULL !");
+    ASSERT_MSG(*array != NULL, "Array content is NULL !");
+    ASSERT_MSG(allocated_elements != NULL, "Number of allocated elements is NULL !");
+
+    if (needed_elements <= *allocated_elements)
+    {
+        return;
+    }
+
+    size_t new_size = *allocated_elements;
+    while (new_size < needed_elements)
+    {
+        new_size *= 2;
+    }
+
+    void* new_array = REALLOC(*array, new_size * element_size);
+    ASSERT_ALLOC(new_array, "Cannot increase a dynamic array !", new_size * element_size);
+    *array              = new_array;
+    *allocated_elements = new_size;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef cJSON_NOT_NULL
+#undef cJSON_NOT_NULL
+#endif /* cJSON_NOT_NULL */
+
+#ifdef cJSON_ADD_ITEM_TO_OBJECT_CHECK
+#undef cJSON_ADD_ITEM_TO_OBJECT_CHECK
+#endif /* cJSON_ADD_ITEM_TO_OBJECT_CHECK */
+
+#ifdef cJSON_ADD_ITEM_TO_ARRAY_CHECK
+#undef cJSON_ADD_ITEM_TO_ARRAY_CHECK
+#endif /* cJSON_ADD_ITEM_TO_ARRAY_CHECK */
+
+#ifdef cJSON_FULL_FREE_AND_SET_TO_NULL
+#undef cJSON_FULL_FREE_AND_SET_TO_NULL
+#endif /* cJSON_FULL_FREE_AND_SET_TO_NULL */
+
+#ifdef CJSON_PRINT_BUFFER_SIZE
+#undef CJSON_PRINT_BUFFER_SIZE
+#endif /* CJSON_PRINT_BUFFER_SIZE */
+
+
+#ifdef TOKEN_FRAGMENT_TABLE_INITIAL_SIZE
+#undef TOKEN_FRAGMENT_TABLE_INITIAL_SIZE
+#endif /* TOKEN_FRAGMENT_TABLE_INITIAL_SIZE */
+
+#ifdef READER_INITIAL_ARRAY_SIZE
+#undef READER_INITIAL_ARRAY_SIZE
+#endif /* READER_INITIAL_ARRAY_SIZE */
+
+#ifdef OFFSET
+#undef OFFSET
+#endif /* OFFSET */
+
+#ifdef INTERSECTIONS
+#undef INTERSECTIONS
+#endif /* INTERSECTIONS */
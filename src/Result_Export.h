@@ -0,0 +1,435 @@
+/**
+ * @file Result_Export.h
+ *
+ * @brief Export of the intersection results in different output formats.
+ *
+ * Supported formats:
+ *      - JSON:   One JSON object with all result sets (The original format of this program)
+ *      - NDJSON: One compact JSON object per line; every line represents one (query, document) hit
+ *      - TSV:    One line per (query, document) hit; tokens separated with '|', offsets separated with ','
+ *      - Binary: Little-endian records with the token IDs and the offsets plus a vocabulary section for the reverse
+ *                mapping. With ResultExport_ConvertBinaryToJSON() a binary file can be converted to the JSON format
+ *
+ * The queries are the token arrays of the second input file; the documents are the token arrays of the first input
+ * file.
+ *
+ * Layout of the binary format (all integers are unsigned and little-endian; strings are u32 length + bytes without a
+ * terminator):
+ *
+ *      Header:     "BTMR" | u8 version | u8 size char offset | u8 size sentence offset | u8 size word offset |
+ *                  u32 settings | str first file | str second file | str program version | str creation time |
+ *                  u32 count + str too long tokens (first file) | u32 count + str too long tokens (second file)
+ *      Vocabulary: u32 count | count x (u32 token ID | str token)
+ *      Set:        'S' | str query ID | u32 n | n x u32 token IDs (with stop words) |
+ *                  u32 m | m x u32 token IDs (w/o stop words)
+ *      Hit:        'H' | u8 full match | str document ID | u32 n | n x u32 token IDs (w/o stop words) |
+ *                  n x char offsets | [n x sentence offsets] | [n x word offsets]
+ *      End:        'E'
+ *
+ * The sentence and word offsets are only in the file, if the specific bit in the settings is set.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef RESULT_EXPORT_H
+#define RESULT_EXPORT_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+#include "Defines.h"
+#include "JSON_Writer.h"
+#include "Async_File_Writer.h"
+#include "Token_Int_Mapping.h"
+#include "Two_Dim_C_String_Array.h"
+
+
+
+/**
+ * @brief Magic bytes at the begin of a binary result file.
+ */
+#ifndef RESULT_EXPORT_BINARY_MAGIC
+#define RESULT_EXPORT_BINARY_MAGIC "BTMR"
+#else
+#error "The macro \"RESULT_EXPORT_BINARY_MAGIC\" is already defined !"
+#endif /* RESULT_EXPORT_BINARY_MAGIC */
+
+/**
+ * @brief Version of the binary result file format.
+ */
+#ifndef RESULT_EXPORT_BINARY_VERSION
+#define RESULT_EXPORT_BINARY_VERSION 2
+#else
+#error "The macro \"RESULT_EXPORT_BINARY_VERSION\" is already defined !"
+#endif /* RESULT_EXPORT_BINARY_VERSION */
+
+/**
+ * @brief Check, whether the macro values are valid.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(sizeof(RESULT_EXPORT_BINARY_MAGIC) == 4 + 1, "The macro \"RESULT_EXPORT_BINARY_MAGIC\" needs 4 chars !");
+_Static_assert(RESULT_EXPORT_BINARY_VERSION > 0 && RESULT_EXPORT_BINARY_VERSION <= 255,
+        "The macro \"RESULT_EXPORT_BINARY_VERSION\" needs to be in the range [1, 255] !");
+
+IS_CONST_STR(RESULT_EXPORT_BINARY_MAGIC)
+IS_TYPE(RESULT_EXPORT_BINARY_VERSION, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//=====================================================================================================================
+
+/**
+ * @brief The supported output formats.
+ */
+enum Output_Format
+{
+    OUTPUT_FORMAT_JSON = 0,     ///< One JSON object with all result sets
+    OUTPUT_FORMAT_NDJSON,       ///< One JSON object per (query, document) hit
+    OUTPUT_FORMAT_TSV,          ///< One tab separated line per (query, document) hit
+    OUTPUT_FORMAT_BINARY,       ///< Little-endian binary records plus vocabulary
+
+    OUTPUT_FORMAT_INVALID       ///< Marker for an unknown format name
+};
+
+/**
+ * @brief Position of a pre-escaped token in the fragment buffer.
+ *
+ * The JSON string of a token (escaped and with the quotation marks) will be created only once with the first usage of
+ * the token. Every further output of the token is only a memcpy of this fragment.
+ */
+struct Token_Fragment
+{
+    size_t offset;                                      ///< Offset of the fragment in the fragment buffer
+    size_t length;                                      ///< Length of the fragment (0: Fragment not created yet)
+};
+
+/**
+ * @brief The Result_Export object.
+ *
+ * The results of one query (-> one outer loop run of the intersection process) will be collected in "set_data". Only
+ * at the end of the query (ResultExport_EndSet()) the data will be written to the file. This makes it possible to
+ * skip sets without (exported) results and to discard an incomplete set, when the calculation was aborted.
+ */
+struct Result_Export
+{
+    struct Async_File_Writer* file_writer;              ///< Writer of the result file (own thread)
+    const char* file_name;                              ///< Name of the result file (for error messages)
+    size_t file_size;                                   ///< Number of bytes, that were written to the result file
+
+    enum Output_Format format;                          ///< Output format
+    unsigned int settings;                              ///< Settings of the intersection process (See Exec_Config.h)
+    const struct Token_Int_Mapping* token_int_mapping;  ///< Mapping for the reverse mapping (int -> token)
+
+    struct JSON_Writer* set_data;                       ///< Data of the current set (In every format !)
+    struct JSON_Writer* partial_matches;                ///< Members of the partial match object (only JSON format)
+    struct JSON_Writer* full_matches;                   ///< Members of the full match object (only JSON format)
+    struct JSON_Writer* set_header;                     ///< Query data, that every hit repeats (NDJSON, TSV format)
+
+    struct JSON_Writer* token_fragments;                ///< Pre-escaped JSON strings of the tokens (fragment buffer)
+    struct Token_Fragment* token_fragment_table;        ///< Fragment positions; index is the mapped token integer
+    size_t token_fragment_table_size;                   ///< Number of entries in the fragment table
+
+    /// Tokens, that were removed because of their document frequency (NULL: No dynamic stop words)
+    const struct Two_Dim_C_String_Array* auto_stop_words;
+    float max_document_frequency;                       ///< Document frequency limit of the dynamic stop words
+
+    const char* query_id;                               ///< ID of the current query
+    const uint_fast32_t* query_data;                    ///< Mapped tokens of the current query
+    size_t query_data_length;                           ///< Number of mapped tokens of the current query
+    const uint_fast32_t* query_data_wo_stop_words;      ///< Mapped tokens of the current query without stop words
+    size_t query_tokens_wo_stop_words;                  ///< Number of tokens of the current query without stop words
+    _Bool query_started;                                ///< Were the query information already exported ?
+    size_t exported_hits;                               ///< Number of exported hits in the current set
+
+    _Bool first_set_written;                            ///< Was the first set already written to the file ?
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Convert the name of an output format (e.g. from the CLI) to the enum value.
+ *
+ * Valid names: "json", "ndjson", "tsv", "binary"
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] format_name Name of the output format
+ *
+ * @return The output format or OUTPUT_FORMAT_INVALID, if the name is unknown (or NULL)
+ */
+extern enum Output_Format
+ResultExport_StringToOutputFormat
+(
+        const char* const format_name
+);
+
+/**
+ * @brief Create a new Result_Export object. The result file will be created (or truncated).
+ *
+ * The data will be written with an Async_File_Writer. So the intersection and the file I/O overlap.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      format != OUTPUT_FORMAT_INVALID
+ *      token_int_mapping != NULL
+ *
+ * @param[in] file_name Name of the result file
+ * @param[in] format Output format
+ * @param[in] settings Settings of the intersection process (See Exec_Config.h)
+ * @param[in] token_int_mapping Token_Int_Mapping (necessary for the reverse mapping int -> token)
+ * @param[in] preallocation_size Number of bytes, that will be preallocated for the result file (0: No preallocation)
+ *
+ * @return Address to the new dynamic Result_Export object
+ */
+extern struct Result_Export*
+ResultExport_CreateObject
+(
+        const char* const restrict file_name,
+        const enum Output_Format format,
+        const unsigned int settings,
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const uint_fast64_t preallocation_size
+);
+
+/**
+ * @brief Close the result file and delete the Result_Export object.
+ *
+ * The data of a set, that was not ended with ResultExport_EndSet(), will be discarded.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+extern void
+ResultExport_DeleteObject
+(
+        struct Result_Export* object
+);
+
+/**
+ * @brief Set the dynamic stop words, that will be written in the general information of the result file.
+ *
+ * Only the JSON format contains the dynamic stop words. The list will not be copied; it needs to be available until
+ * the header was written (See ResultExport_WriteHeader()).
+ *
+ * Asserts:
+ *      object != NULL
+ *      auto_stop_words != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] max_document_frequency Max. document frequency of a token, that is not a stop word
+ * @param[in] auto_stop_words Tokens, that were removed because of their document frequency
+ */
+extern void
+ResultExport_SetAutoStopWords
+(
+        struct Result_Export* const restrict object,
+        const float max_document_frequency,
+        const struct Two_Dim_C_String_Array* const restrict auto_stop_words
+);
+
+/**
+ * @brief Write the header of the result file.
+ *
+ * JSON: The general information and the too long tokens; TSV: The column names; Binary: The header and the vocabulary;
+ * NDJSON: Nothing.
+ *
+ * Asserts:
+ *      object != NULL
+ *      first_file != NULL
+ *      second_file != NULL
+ *      too_long_tokens_1 != NULL
+ *      too_long_tokens_2 != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] first_file Name of the first input file
+ * @param[in] second_file Name of the second input file
+ * @param[in] program_version Program version, that created the results (NULL: VERSION_STR will be used)
+ * @param[in] creation_time Creation time as string (NULL: The current time will be used)
+ * @param[in] too_long_tokens_1 Too long tokens of the first input file
+ * @param[in] too_long_tokens_2 Too long tokens of the second input file
+ */
+extern void
+ResultExport_WriteHeader
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict first_file,
+        const char* const restrict second_file,
+        const char* const restrict program_version,
+        const char* const restrict creation_time,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_1,
+        const struct Two_Dim_C_String_Array* const restrict too_long_tokens_2
+);
+
+/**
+ * @brief Write the footer of the result file. (JSON: The closing bracket; Binary: The end record; NDJSON, TSV: Nothing)
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+extern void
+ResultExport_WriteFooter
+(
+        struct Result_Export* const object
+);
+
+/**
+ * @brief Write the counter block of the intersection process to the result file.
+ *
+ * JSON: A "Counter" member after the last set; NDJSON: One line with a "Counter" object. The other formats have no
+ * place for the counters.
+ *
+ * Asserts:
+ *      object != NULL
+ *      object->format == OUTPUT_FORMAT_JSON || object->format == OUTPUT_FORMAT_NDJSON
+ *
+ * @param[in] object Result_Export object
+ * @param[in] number_of_partial_sets Number of sets with partial matches
+ * @param[in] number_of_full_sets Number of sets with full matches
+ * @param[in] number_of_token_in_partial_sets Sum of all tokens in all partial matches
+ * @param[in] number_of_token_in_full_sets Sum of all tokens in all full matches
+ */
+extern void
+ResultExport_WriteCounter
+(
+        struct Result_Export* const object,
+        const uint_fast64_t number_of_partial_sets,
+        const uint_fast64_t number_of_full_sets,
+        const uint_fast64_t number_of_token_in_partial_sets,
+        const uint_fast64_t number_of_token_in_full_sets
+);
+
+/**
+ * @brief Begin a new set. A set contains the results of one query.
+ *
+ * The data will not be copied ! The pointers need to be valid until the next ResultExport_EndSet() call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      query_id != NULL
+ *      query_data != NULL
+ *      query_data_wo_stop_words != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] query_id ID of the query
+ * @param[in] query_data Mapped tokens of the query (with stop words; only for the "tokens" output)
+ * @param[in] query_data_length Number of mapped tokens
+ * @param[in] query_data_wo_stop_words Mapped tokens of the query without stop words (The data of the intersection)
+ * @param[in] query_length_wo_stop_words Number of mapped tokens without stop words
+ */
+extern void
+ResultExport_BeginSet
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict query_id,
+        const uint_fast32_t* const restrict query_data,
+        const size_t query_data_length,
+        const uint_fast32_t* const restrict query_data_wo_stop_words,
+        const size_t query_length_wo_stop_words
+);
+
+/**
+ * @brief Add one intersection result (a hit of the current query in a document) to the current set.
+ *
+ * The stop words were already removed from both corpora before the intersection (See EncodedCorpus_CreateObject()).
+ * Whether the hit will be exported depends on the match type and the PART_MATCH / FULL_MATCH bits in the settings.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_id != NULL
+ *      data != NULL
+ *      char_offsets != NULL
+ *      sentence_offsets != NULL
+ *      word_offsets != NULL
+ *
+ * @param[in] object Result_Export object
+ * @param[in] document_id ID of the document
+ * @param[in] data Mapped tokens of the intersection
+ * @param[in] char_offsets Char offsets of the tokens
+ * @param[in] sentence_offsets Sentence offsets of the tokens
+ * @param[in] word_offsets Word offsets of the tokens
+ * @param[in] data_length Number of tokens
+ *
+ * @return true, if the hit is a full match (The tokens are equal with the query tokens without stop words), otherwise
+ *      false
+ */
+extern _Bool
+ResultExport_AddIntersection
+(
+        struct Result_Export* const restrict object,
+        const char* const restrict document_id,
+        const uint_fast32_t* const restrict data,
+        const CHAR_OFFSET_TYPE* const restrict char_offsets,
+        const SENTENCE_OFFSET_TYPE* const restrict sentence_offsets,
+        const WORD_OFFSET_TYPE* const restrict word_offsets,
+        const size_t data_length
+);
+
+/**
+ * @brief End the current set and write the collected data to the result file, if data was found.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ */
+extern void
+ResultExport_EndSet
+(
+        struct Result_Export* const object
+);
+
+/**
+ * @brief Determine the full memory usage in bytes.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Result_Export object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+ResultExport_GetAllocatedMemSize
+(
+        const struct Result_Export* const object
+);
+
+/**
+ * @brief Convert a binary result file to a JSON result file.
+ *
+ * The JSON file is equal to the file, that would be created directly with the JSON format.
+ *
+ * Asserts:
+ *      binary_file_name != NULL
+ *      json_file_name != NULL
+ *
+ * @param[in] binary_file_name Name of the binary result file
+ * @param[in] json_file_name Name of the JSON result file
+ * @param[in] format_output Format the JSON output ?
+ */
+extern void
+ResultExport_ConvertBinaryToJSON
+(
+        const char* const restrict binary_file_name,
+        const char* const restrict json_file_name,
+        const _Bool format_output
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RESULT_EXPORT_H */
@@ -0,0 +1,271 @@
+/**
+ * @file Create_Stop_Word_Table.c
+ *
+ * @brief Build tool: Create the perfect hash table of the English stop words and write it as C header.
+ *
+ * The Makefile compiles and executes this program, before Stop_Words.c will be compiled. The stop word list will be
+ * included like in Stop_Words.c; so both use always the same list. The generated header contains only constant arrays
+ * and a constant Stop_Word_Hash_Table object; Stop_Words.c needs no initialization at runtime.
+ *
+ * Usage: Create_Stop_Word_Table <header file>
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Stop_Word_Hash.h"
+#include "../Misc.h"
+#include "../Error_Handling/Assert_Msg.h"
+#include "../Error_Handling/Dynamic_Memory.h"
+
+
+
+/**
+ * @brief Number of values per line in the generated arrays.
+ */
+#ifndef VALUES_PER_LINE
+#define VALUES_PER_LINE 16
+#else
+#error "The macro \"VALUES_PER_LINE\" is already defined !"
+#endif /* VALUES_PER_LINE */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(VALUES_PER_LINE > 0, "The macro \"VALUES_PER_LINE\" is zero !");
+
+IS_TYPE(VALUES_PER_LINE, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+
+
+static const char* eng_stop_words [] =
+{
+#include "Stop_Words_English.txt"
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write the begin of an array definition.
+ *
+ * @param[in] file Header file
+ * @param[in] type Element type
+ * @param[in] name Name of the array
+ * @param[in] number_of_elements Number of elements
+ */
+static void
+Write_Array_Begin
+(
+        FILE* const restrict file,
+        const char* const restrict type,
+        const char* const restrict name,
+        const size_t number_of_elements
+);
+
+/**
+ * @brief Write one array element. A line break will be inserted after VALUES_PER_LINE elements.
+ *
+ * Chars will be written as char constants: Printable ASCII chars directly, all other chars as octal escape sequence.
+ * (A number above 127 would not fit in a signed char)
+ *
+ * @param[in] file Header file
+ * @param[in] value Value of the element
+ * @param[in] as_char Write the value as char constant ?
+ * @param[in] index Index of the element
+ * @param[in] number_of_elements Number of elements
+ */
+static void
+Write_Array_Element
+(
+        FILE* const file,
+        const unsigned long value,
+        const _Bool as_char,
+        const size_t index,
+        const size_t number_of_elements
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+int main (const int argc, const char* argv [])
+{
+    if (argc != 2)
+    {
+        fprintf (stderr, "Usage: %s <header file>\n", argv [0]);
+        return EXIT_FAILURE;
+    }
+
+    struct Stop_Word_Hash_Table* table = StopWordHash_CreateObject(eng_stop_words, COUNT_ARRAY_ELEMENTS(eng_stop_words));
+
+    // Every word of the list needs to be found; also in upper case
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(eng_stop_words); ++ i)
+    {
+        char upper_case_word [STOP_WORD_HASH_MAX_WORD_LENGTH];
+        char folded_word [STOP_WORD_HASH_MAX_WORD_LENGTH];
+        const size_t word_length = strlen(eng_stop_words [i]);
+        ASSERT_FMSG(word_length <= STOP_WORD_HASH_MAX_WORD_LENGTH, "The stop word \"%s\" is too long ! Max. length: %d",
+                eng_stop_words [i], STOP_WORD_HASH_MAX_WORD_LENGTH);
+        for (size_t i2 = 0; i2 < word_length; ++ i2)
+        {
+            const char c = eng_stop_words [i][i2];
+            upper_case_word [i2] = (c >= 'a' && c <= 'z') ? (char) (c - 'a' + 'A') : c;
+        }
+        StopWordHash_FoldCase(folded_word, upper_case_word, word_length);
+        ASSERT_FMSG(StopWordHash_Contains(table, folded_word, word_length), "The stop word \"%s\" is not in the "
+                "created table !", eng_stop_words [i]);
+    }
+
+    FILE* file = fopen(argv [1], "w");
+    ASSERT_FMSG(file != NULL, "Cannot create the file \"%s\" !", argv [1]);
+
+    fprintf (file, "/**\n"
+            " * @file Stop_Words_English_Table.h\n"
+            " *\n"
+            " * @brief Perfect hash table of the English stop words (%" PRIu32 " words, %" PRIu32 " slots).\n"
+            " *\n"
+            " * Generated by Create_Stop_Word_Table from Stop_Words_English.txt at build time. Do not edit !\n"
+            " */\n\n"
+            "#ifndef STOP_WORDS_ENGLISH_TABLE_H\n"
+            "#define STOP_WORDS_ENGLISH_TABLE_H ///< Include-Guard\n\n"
+            "#include <inttypes.h>\n"
+            "#include \"Stop_Word_Hash.h\"\n\n", table->number_of_words, table->number_of_slots);
+
+    Write_Array_Begin(file, "uint16_t", "ENG_STOP_WORD_DISPLACEMENTS", table->number_of_buckets);
+    for (uint32_t i = 0; i < table->number_of_buckets; ++ i)
+    {
+        Write_Array_Element(file, table->displacements [i], false, i, table->number_of_buckets);
+    }
+    Write_Array_Begin(file, "uint32_t", "ENG_STOP_WORD_SLOT_OFFSETS", table->number_of_slots);
+    for (uint32_t i = 0; i < table->number_of_slots; ++ i)
+    {
+        Write_Array_Element(file, table->slot_offsets [i], false, i, table->number_of_slots);
+    }
+    Write_Array_Begin(file, "uint8_t", "ENG_STOP_WORD_SLOT_LENGTHS", table->number_of_slots);
+    for (uint32_t i = 0; i < table->number_of_slots; ++ i)
+    {
+        Write_Array_Element(file, table->slot_lengths [i], false, i, table->number_of_slots);
+    }
+
+    // The pool as char constants: A string literal would be too long for some compilers
+    size_t word_pool_size = 0;
+    for (uint32_t i = 0; i < table->number_of_slots; ++ i)
+    {
+        if (table->slot_lengths [i] > 0)
+        {
+            word_pool_size += (size_t) table->slot_lengths [i] + 1;
+        }
+    }
+    ++ word_pool_size;
+    Write_Array_Begin(file, "char", "ENG_STOP_WORD_POOL", word_pool_size);
+    for (size_t i = 0; i < word_pool_size; ++ i)
+    {
+        Write_Array_Element(file, (unsigned char) table->word_pool [i], true, i, word_pool_size);
+    }
+
+    fprintf (file, "static const struct Stop_Word_Hash_Table ENG_STOP_WORD_TABLE =\n"
+            "{\n"
+            "        .displacements      = ENG_STOP_WORD_DISPLACEMENTS,\n"
+            "        .slot_offsets       = ENG_STOP_WORD_SLOT_OFFSETS,\n"
+            "        .slot_lengths       = ENG_STOP_WORD_SLOT_LENGTHS,\n"
+            "        .word_pool          = ENG_STOP_WORD_POOL,\n"
+            "        .number_of_buckets  = %" PRIu32 ",\n"
+            "        .number_of_slots    = %" PRIu32 ",\n"
+            "        .number_of_words    = %" PRIu32 ",\n"
+            "        .longest_word       = %" PRIu32 ",\n"
+            "        .memory             = NULL\n"
+            "};\n\n"
+            "#endif /* STOP_WORDS_ENGLISH_TABLE_H */\n", table->number_of_buckets, table->number_of_slots,
+            table->number_of_words, table->longest_word);
+
+    ASSERT_FMSG(! ferror(file), "Cannot write the file \"%s\" !", argv [1]);
+    const int close_result = fclose(file);
+    file = NULL;
+    ASSERT_FMSG(close_result != EOF, "Cannot close the file \"%s\" ! EOF was returned !", argv [1]);
+
+    StopWordHash_DeleteObject(table);
+    table = NULL;
+
+    return EXIT_SUCCESS;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Write the begin of an array definition.
+ *
+ * @param[in] file Header file
+ * @param[in] type Element type
+ * @param[in] name Name of the array
+ * @param[in] number_of_elements Number of elements
+ */
+static void
+Write_Array_Begin
+(
+        FILE* const restrict file,
+        const char* const restrict type,
+        const char* const restrict name,
+        const size_t number_of_elements
+)
+{
+    fprintf (file, "static const %s %s [%zu] =\n{", type, name, number_of_elements);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Write one array element. A line break will be inserted after VALUES_PER_LINE elements.
+ *
+ * Chars will be written as char constants: Printable ASCII chars directly, all other chars as octal escape sequence.
+ * (A number above 127 would not fit in a signed char)
+ *
+ * @param[in] file Header file
+ * @param[in] value Value of the element
+ * @param[in] as_char Write the value as char constant ?
+ * @param[in] index Index of the element
+ * @param[in] number_of_elements Number of elements
+ */
+static void
+Write_Array_Element
+(
+        FILE* const file,
+        const unsigned long value,
+        const _Bool as_char,
+        const size_t index,
+        const size_t number_of_elements
+)
+{
+    if (index > 0)
+    {
+        fputc (',', file);
+    }
+    fputs ((index % VALUES_PER_LINE == 0) ? "\n        " : " ", file);
+    if (! as_char)
+    {
+        fprintf (file, "%lu", value);
+    }
+    else if (value >= ' ' && value <= '~' && value != '\'' && value != '\\')
+    {
+        fprintf (file, "'%c'", (char) value);
+    }
+    else
+    {
+        fprintf (file, "'\\%03lo'", value);
+    }
+    if (index + 1 == number_of_elements)
+    {
+        fputs ("\n};\n\n", file);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef VALUES_PER_LINE
+#undef VALUES_PER_LINE
+#endif /* VALUES_PER_LINE */
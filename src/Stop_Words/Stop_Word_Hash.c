@@ -0,0 +1,501 @@
+/**
+ * @file Stop_Word_Hash.c
+ *
+ * @brief A perfect hash table for stop words. Every stop word has its own slot; a lookup needs two hash calculations
+ * and at most one string comparison.
+ *
+ * The search of the displacements processes the large buckets first, because they are the hardest to place, while
+ * most slots are free. If no displacement was found for a bucket, the search starts again with more slots.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Stop_Word_Hash.h"
+#include <string.h>
+#include <stdlib.h>
+#include "../Error_Handling/Assert_Msg.h"
+#include "../Error_Handling/Dynamic_Memory.h"
+
+
+
+/**
+ * @brief How often will the search of the displacements be repeated with more slots ?
+ */
+#ifndef MAX_NUMBER_OF_ATTEMPTS
+#define MAX_NUMBER_OF_ATTEMPTS 16
+#else
+#error "The macro \"MAX_NUMBER_OF_ATTEMPTS\" is already defined !"
+#endif /* MAX_NUMBER_OF_ATTEMPTS */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(MAX_NUMBER_OF_ATTEMPTS > 0, "The macro \"MAX_NUMBER_OF_ATTEMPTS\" is zero !");
+
+IS_TYPE(MAX_NUMBER_OF_ATTEMPTS, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compare two words for qsort(). (The arguments are addresses of C-String pointers)
+ *
+ * @param[in] word_1 Address of the first word
+ * @param[in] word_2 Address of the second word
+ *
+ * @return strcmp() result of the two words
+ */
+static int
+Compare_Words
+(
+        const void* const word_1,
+        const void* const word_2
+);
+
+/**
+ * @brief Search a displacement for every bucket, so that every word gets its own slot.
+ *
+ * Asserts:
+ *      words != NULL
+ *      word_lengths != NULL
+ *      displacements != NULL
+ *      slot_words != NULL
+ *      number_of_buckets > 0
+ *      number_of_slots >= number_of_words
+ *
+ * @param[in] words Folded and unique words
+ * @param[in] word_lengths Length of every word
+ * @param[in] number_of_words Number of words
+ * @param[in] number_of_buckets Number of buckets
+ * @param[in] number_of_slots Number of slots
+ * @param[out] displacements Displacement of every bucket
+ * @param[out] slot_words Word of every slot (index + 1; 0: empty slot)
+ *
+ * @return true, if a displacement was found for every bucket, otherwise false
+ */
+static _Bool
+Find_Displacements
+(
+        const char* const* const restrict words,
+        const size_t* const restrict word_lengths,
+        const uint32_t number_of_words,
+        const uint32_t number_of_buckets,
+        const uint32_t number_of_slots,
+        uint16_t* const restrict displacements,
+        uint32_t* const restrict slot_words
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Stop_Word_Hash_Table object with a list of words.
+ *
+ * The words will be folded to lowercase; duplicates (also after the folding) will be saved only once. Empty words
+ * will be ignored.
+ *
+ * Asserts:
+ *      words != NULL
+ *      Every word is not NULL and not longer than STOP_WORD_HASH_MAX_WORD_LENGTH
+ *      A perfect hash function was found
+ *
+ * @param[in] words Array with the words
+ * @param[in] number_of_words Number of words in the array
+ *
+ * @return Address to the new dynamic Stop_Word_Hash_Table object
+ */
+extern struct Stop_Word_Hash_Table*
+StopWordHash_CreateObject
+(
+        const char* const* const words,
+        const size_t number_of_words
+)
+{
+    ASSERT_MSG(words != NULL, "Word array is NULL !");
+
+    // >>> Fold the words and remove the duplicates <<<
+    size_t folded_words_size = 1;
+    for (size_t i = 0; i < number_of_words; ++ i)
+    {
+        ASSERT_FMSG(words [i] != NULL, "Word %zu is NULL !", i);
+        const size_t word_length = strlen(words [i]);
+        ASSERT_FMSG(word_length <= STOP_WORD_HASH_MAX_WORD_LENGTH, "The stop word \"%s\" is too long ! Max. length: %d",
+                words [i], STOP_WORD_HASH_MAX_WORD_LENGTH);
+        folded_words_size += word_length + 1;
+    }
+    char* folded_words = (char*) MALLOC(folded_words_size);
+    ASSERT_ALLOC(folded_words, "Cannot allocate memory for the folded stop words !", folded_words_size);
+    const char** sorted_words = (const char**) MALLOC((number_of_words + 1) * sizeof (const char*));
+    ASSERT_ALLOC(sorted_words, "Cannot allocate memory for the sorted stop words !",
+            (number_of_words + 1) * sizeof (const char*));
+
+    size_t folded_words_position = 0;
+    size_t number_of_sorted_words = 0;
+    for (size_t i = 0; i < number_of_words; ++ i)
+    {
+        const size_t word_length = strlen(words [i]);
+        if (word_length == 0) { continue; }
+
+        StopWordHash_FoldCase(folded_words + folded_words_position, words [i], word_length);
+        folded_words [folded_words_position + word_length] = '\0';
+        sorted_words [number_of_sorted_words] = folded_words + folded_words_position;
+        ++ number_of_sorted_words;
+        folded_words_position += word_length + 1;
+    }
+
+    // The sorting finds the duplicates and makes the table independent of the order in the list
+    qsort(sorted_words, number_of_sorted_words, sizeof (const char*), Compare_Words);
+    size_t number_of_unique_words = 0;
+    size_t word_pool_size = 1;
+    for (size_t i = 0; i < number_of_sorted_words; ++ i)
+    {
+        if (number_of_unique_words == 0 || strcmp(sorted_words [i], sorted_words [number_of_unique_words - 1]) != 0)
+        {
+            sorted_words [number_of_unique_words] = sorted_words [i];
+            ++ number_of_unique_words;
+            word_pool_size += strlen(sorted_words [i]) + 1;
+        }
+    }
+    ASSERT_FMSG(number_of_unique_words < UINT16_MAX * (size_t) STOP_WORD_HASH_WORDS_PER_BUCKET &&
+            word_pool_size <= UINT32_MAX, "Too many stop words: %zu !", number_of_unique_words);
+    const uint32_t unique_words = (uint32_t) number_of_unique_words;
+
+    size_t* word_lengths = (size_t*) MALLOC((number_of_unique_words + 1) * sizeof (size_t));
+    ASSERT_ALLOC(word_lengths, "Cannot allocate memory for the stop word lengths !",
+            (number_of_unique_words + 1) * sizeof (size_t));
+    uint32_t longest_word = 0;
+    for (size_t i = 0; i < number_of_unique_words; ++ i)
+    {
+        word_lengths [i] = strlen(sorted_words [i]);
+        longest_word = (word_lengths [i] > longest_word) ? (uint32_t) word_lengths [i] : longest_word;
+    }
+
+    // >>> Search the perfect hash function <<<
+    const uint32_t number_of_buckets = unique_words / STOP_WORD_HASH_WORDS_PER_BUCKET + 1;
+    uint32_t number_of_slots = unique_words + unique_words / 4 + 1;
+    uint16_t* displacements = (uint16_t*) MALLOC(number_of_buckets * sizeof (uint16_t));
+    ASSERT_ALLOC(displacements, "Cannot allocate memory for the displacements !",
+            number_of_buckets * sizeof (uint16_t));
+    uint32_t* slot_words = NULL;
+    _Bool perfect_hash_found = false;
+
+    for (size_t attempt = 0; attempt < MAX_NUMBER_OF_ATTEMPTS && ! perfect_hash_found; ++ attempt)
+    {
+        if (slot_words != NULL)
+        {
+            FREE_AND_SET_TO_NULL(slot_words);
+            number_of_slots += number_of_slots / 8 + 1;
+        }
+        slot_words = (uint32_t*) CALLOC(number_of_slots, sizeof (uint32_t));
+        ASSERT_ALLOC(slot_words, "Cannot allocate memory for the slots !", number_of_slots * sizeof (uint32_t));
+
+        perfect_hash_found = Find_Displacements(sorted_words, word_lengths, unique_words, number_of_buckets,
+                number_of_slots, displacements, slot_words);
+    }
+    ASSERT_FMSG(perfect_hash_found, "No perfect hash function found for %" PRIu32 " stop words !", unique_words);
+
+    // >>> All arrays of the table in one memory block <<<
+    const size_t slot_offsets_size = number_of_slots * sizeof (uint32_t);
+    const size_t displacements_size = number_of_buckets * sizeof (uint16_t);
+    const size_t slot_lengths_size = number_of_slots * sizeof (uint8_t);
+    const size_t memory_size = slot_offsets_size + displacements_size + slot_lengths_size + word_pool_size;
+
+    struct Stop_Word_Hash_Table* new_object =
+            (struct Stop_Word_Hash_Table*) MALLOC(sizeof (struct Stop_Word_Hash_Table));
+    ASSERT_ALLOC(new_object, "Cannot allocate memory for a Stop_Word_Hash_Table object !",
+            sizeof (struct Stop_Word_Hash_Table));
+    unsigned char* memory = (unsigned char*) MALLOC(memory_size);
+    ASSERT_ALLOC(memory, "Cannot allocate memory for the stop word table !", memory_size);
+
+    // The order of the arrays keeps the alignment: uint32_t, uint16_t, uint8_t, char
+    uint32_t* const slot_offsets = (uint32_t*) memory;
+    uint16_t* const table_displacements = (uint16_t*) (memory + slot_offsets_size);
+    uint8_t* const slot_lengths = (uint8_t*) (memory + slot_offsets_size + displacements_size);
+    char* const word_pool = (char*) (memory + slot_offsets_size + displacements_size + slot_lengths_size);
+
+    memcpy(table_displacements, displacements, displacements_size);
+    size_t word_pool_position = 0;
+    for (uint32_t i = 0; i < number_of_slots; ++ i)
+    {
+        if (slot_words [i] == 0)
+        {
+            slot_offsets [i] = 0;
+            slot_lengths [i] = 0;
+            continue;
+        }
+        const size_t word_index = slot_words [i] - 1;
+        slot_offsets [i] = (uint32_t) word_pool_position;
+        slot_lengths [i] = (uint8_t) word_lengths [word_index];
+        memcpy(word_pool + word_pool_position, sorted_words [word_index], word_lengths [word_index] + 1);
+        word_pool_position += word_lengths [word_index] + 1;
+    }
+    word_pool [word_pool_position] = '\0';
+
+    new_object->displacements       = table_displacements;
+    new_object->slot_offsets        = slot_offsets;
+    new_object->slot_lengths        = slot_lengths;
+    new_object->word_pool           = word_pool;
+    new_object->number_of_buckets   = number_of_buckets;
+    new_object->number_of_slots     = number_of_slots;
+    new_object->number_of_words     = unique_words;
+    new_object->longest_word        = longest_word;
+    new_object->memory              = memory;
+
+    FREE_AND_SET_TO_NULL(slot_words);
+    FREE_AND_SET_TO_NULL(displacements);
+    FREE_AND_SET_TO_NULL(word_lengths);
+    FREE_AND_SET_TO_NULL(sorted_words);
+    FREE_AND_SET_TO_NULL(folded_words);
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a Stop_Word_Hash_Table object, that was created with StopWordHash_CreateObject().
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Stop_Word_Hash_Table object
+ */
+extern void
+StopWordHash_DeleteObject
+(
+        struct Stop_Word_Hash_Table* object
+)
+{
+    ASSERT_MSG(object != NULL, "Stop_Word_Hash_Table is NULL !");
+    ASSERT_MSG(object->memory != NULL, "The Stop_Word_Hash_Table was not created at runtime !");
+
+    FREE_AND_SET_TO_NULL(object->memory);
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Is the word in the table ?
+ *
+ * Asserts:
+ *      table != NULL
+ *      lowercase_word != NULL
+ *
+ * @param[in] table Stop_Word_Hash_Table object
+ * @param[in] lowercase_word Word, that was folded with StopWordHash_FoldCase() (not necessarily null terminated)
+ * @param[in] word_length Length of the word
+ *
+ * @return true, if the table contains the word, otherwise false
+ */
+extern _Bool
+StopWordHash_Contains
+(
+        const struct Stop_Word_Hash_Table* const restrict table,
+        const char* const restrict lowercase_word,
+        const size_t word_length
+)
+{
+    ASSERT_MSG(table != NULL, "Stop_Word_Hash_Table is NULL !");
+    ASSERT_MSG(lowercase_word != NULL, "Word is NULL !");
+
+    if (word_length == 0 || word_length > table->longest_word) { return false; }
+
+    const uint32_t bucket = StopWordHash_Hash(lowercase_word, word_length, 0) % table->number_of_buckets;
+    const uint32_t slot = StopWordHash_Hash(lowercase_word, word_length, table->displacements [bucket]) %
+            table->number_of_slots;
+
+    return table->slot_lengths [slot] == word_length &&
+            memcmp(table->word_pool + table->slot_offsets [slot], lowercase_word, word_length) == 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Is the word in the table ? The word will be folded to lowercase before the lookup.
+ *
+ * A word, that is longer than the longest word in the table, will not be folded.
+ *
+ * Asserts:
+ *      table != NULL
+ *      word != NULL
+ *
+ * @param[in] table Stop_Word_Hash_Table object
+ * @param[in] word Word in any case (not necessarily null terminated)
+ * @param[in] word_length Length of the word
+ *
+ * @return true, if the table contains the word, otherwise false
+ */
+extern _Bool
+StopWordHash_ContainsAnyCase
+(
+        const struct Stop_Word_Hash_Table* const restrict table,
+        const char* const restrict word,
+        const size_t word_length
+)
+{
+    ASSERT_MSG(table != NULL, "Stop_Word_Hash_Table is NULL !");
+    ASSERT_MSG(word != NULL, "Word is NULL !");
+
+    if (word_length == 0 || word_length > table->longest_word) { return false; }
+
+    char lowercase_word [STOP_WORD_HASH_MAX_WORD_LENGTH];
+    StopWordHash_FoldCase(lowercase_word, word, word_length);
+
+    return StopWordHash_Contains(table, lowercase_word, word_length);
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Compare two words for qsort(). (The arguments are addresses of C-String pointers)
+ *
+ * @param[in] word_1 Address of the first word
+ * @param[in] word_2 Address of the second word
+ *
+ * @return strcmp() result of the two words
+ */
+static int
+Compare_Words
+(
+        const void* const word_1,
+        const void* const word_2
+)
+{
+    return strcmp(*(const char* const*) word_1, *(const char* const*) word_2);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Search a displacement for every bucket, so that every word gets its own slot.
+ *
+ * Asserts:
+ *      words != NULL
+ *      word_lengths != NULL
+ *      displacements != NULL
+ *      slot_words != NULL
+ *      number_of_buckets > 0
+ *      number_of_slots >= number_of_words
+ *
+ * @param[in] words Folded and unique words
+ * @param[in] word_lengths Length of every word
+ * @param[in] number_of_words Number of words
+ * @param[in] number_of_buckets Number of buckets
+ * @param[in] number_of_slots Number of slots
+ * @param[out] displacements Displacement of every bucket
+ * @param[out] slot_words Word of every slot (index + 1; 0: empty slot)
+ *
+ * @return true, if a displacement was found for every bucket, otherwise false
+ */
+static _Bool
+Find_Displacements
+(
+        const char* const* const restrict words,
+        const size_t* const restrict word_lengths,
+        const uint32_t number_of_words,
+        const uint32_t number_of_buckets,
+        const uint32_t number_of_slots,
+        uint16_t* const restrict displacements,
+        uint32_t* const restrict slot_words
+)
+{
+    ASSERT_MSG(words != NULL, "Word array is NULL !");
+    ASSERT_MSG(word_lengths != NULL, "Word length array is NULL !");
+    ASSERT_MSG(displacements != NULL, "Displacement array is NULL !");
+    ASSERT_MSG(slot_words != NULL, "Slot array is NULL !");
+    ASSERT_MSG(number_of_buckets > 0, "Number of buckets is 0 !");
+    ASSERT_MSG(number_of_slots >= number_of_words, "Less slots than words !");
+
+    // Group the words by their bucket (counting sort)
+    uint32_t* bucket_begins = (uint32_t*) CALLOC(number_of_buckets + 1, sizeof (uint32_t));
+    ASSERT_ALLOC(bucket_begins, "Cannot allocate memory for the bucket begins !",
+            (number_of_buckets + 1) * sizeof (uint32_t));
+    uint32_t* bucket_words = (uint32_t*) MALLOC((number_of_words + 1) * sizeof (uint32_t));
+    ASSERT_ALLOC(bucket_words, "Cannot allocate memory for the bucket words !",
+            (number_of_words + 1) * sizeof (uint32_t));
+    uint32_t* buckets = (uint32_t*) MALLOC((number_of_words + 1) * sizeof (uint32_t));
+    ASSERT_ALLOC(buckets, "Cannot allocate memory for the word buckets !", (number_of_words + 1) * sizeof (uint32_t));
+
+    uint32_t largest_bucket = 0;
+    for (uint32_t i = 0; i < number_of_words; ++ i)
+    {
+        buckets [i] = StopWordHash_Hash(words [i], word_lengths [i], 0) % number_of_buckets;
+        ++ bucket_begins [buckets [i] + 1];
+    }
+    for (uint32_t i = 0; i < number_of_buckets; ++ i)
+    {
+        largest_bucket = (bucket_begins [i + 1] > largest_bucket) ? bucket_begins [i + 1] : largest_bucket;
+        bucket_begins [i + 1] += bucket_begins [i];
+        displacements [i] = 0;
+    }
+    // The begins will be used as insert positions; after the loop every begin is the begin of the next bucket
+    for (uint32_t i = 0; i < number_of_words; ++ i)
+    {
+        bucket_words [bucket_begins [buckets [i]]] = i;
+        ++ bucket_begins [buckets [i]];
+    }
+    for (uint32_t i = number_of_buckets; i > 0; -- i)
+    {
+        bucket_begins [i] = bucket_begins [i - 1];
+    }
+    bucket_begins [0] = 0;
+
+    _Bool result = true;
+
+    // The large buckets first
+    for (uint32_t bucket_size = largest_bucket; bucket_size > 0 && result; -- bucket_size)
+    {
+        for (uint32_t bucket = 0; bucket < number_of_buckets && result; ++ bucket)
+        {
+            const uint32_t begin = bucket_begins [bucket];
+            const uint32_t end = bucket_begins [bucket + 1];
+            if (end - begin != bucket_size) { continue; }
+
+            _Bool bucket_placed = false;
+            for (uint32_t displacement = 0; displacement <= UINT16_MAX && ! bucket_placed; ++ displacement)
+            {
+                uint32_t placed_words = 0;
+                for (; placed_words < bucket_size; ++ placed_words)
+                {
+                    const uint32_t word = bucket_words [begin + placed_words];
+                    const uint32_t slot = StopWordHash_Hash(words [word], word_lengths [word], displacement) %
+                            number_of_slots;
+                    if (slot_words [slot] != 0) { break; }
+                    slot_words [slot] = word + 1;
+                }
+
+                if (placed_words == bucket_size)
+                {
+                    displacements [bucket] = (uint16_t) displacement;
+                    bucket_placed = true;
+                }
+                else
+                {
+                    // Free the slots of this attempt
+                    for (uint32_t i = 0; i < placed_words; ++ i)
+                    {
+                        const uint32_t word = bucket_words [begin + i];
+                        slot_words [StopWordHash_Hash(words [word], word_lengths [word], displacement) %
+                                number_of_slots] = 0;
+                    }
+                }
+            }
+            result = bucket_placed;
+        }
+    }
+
+    FREE_AND_SET_TO_NULL(buckets);
+    FREE_AND_SET_TO_NULL(bucket_words);
+    FREE_AND_SET_TO_NULL(bucket_begins);
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef MAX_NUMBER_OF_ATTEMPTS
+#undef MAX_NUMBER_OF_ATTEMPTS
+#endif /* MAX_NUMBER_OF_ATTEMPTS */
@@ -0,0 +1,243 @@
+/**
+ * @file Stop_Word_Hash.h
+ *
+ * @brief A perfect hash table for stop words. Every stop word has its own slot; a lookup needs two hash calculations
+ * and at most one string comparison.
+ *
+ * The table will be created with the "hash and displace" approach: A first hash distributes the words in buckets. For
+ * every bucket a displacement (seed of the second hash) will be searched, so that all words of the bucket get free
+ * slots. The lookup calculates the bucket, reads the displacement and compares the word only with the word in the one
+ * slot, that the second hash determines.
+ *
+ * The words in the table are lowercase. A query needs to be folded to lowercase once before the lookup (See
+ * StopWordHash_FoldCase()). Only ASCII chars will be folded; like tolower() in the "C" locale.
+ *
+ * The table of the compiled-in English stop words will be created at build time (Create_Stop_Word_Table.c) and is a
+ * constant table without initialization. Tables of other lists can be created at runtime with the same function.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef STOP_WORD_HASH_H
+#define STOP_WORD_HASH_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+#include <inttypes.h>
+#include "../Error_Handling/_Generics.h"
+
+
+
+/**
+ * @brief Max. length of a stop word. The lengths in the table are saved as uint8_t.
+ */
+#ifndef STOP_WORD_HASH_MAX_WORD_LENGTH
+#define STOP_WORD_HASH_MAX_WORD_LENGTH 255
+#else
+#error "The macro \"STOP_WORD_HASH_MAX_WORD_LENGTH\" is already defined !"
+#endif /* STOP_WORD_HASH_MAX_WORD_LENGTH */
+
+/**
+ * @brief Average number of words per bucket. Larger buckets need a smaller displacement table, but the search of the
+ * displacements takes longer.
+ */
+#ifndef STOP_WORD_HASH_WORDS_PER_BUCKET
+#define STOP_WORD_HASH_WORDS_PER_BUCKET 4
+#else
+#error "The macro \"STOP_WORD_HASH_WORDS_PER_BUCKET\" is already defined !"
+#endif /* STOP_WORD_HASH_WORDS_PER_BUCKET */
+
+/**
+ * @brief Check, whether the macro values are valid.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(STOP_WORD_HASH_MAX_WORD_LENGTH > 0 && STOP_WORD_HASH_MAX_WORD_LENGTH <= UINT8_MAX,
+        "The macro \"STOP_WORD_HASH_MAX_WORD_LENGTH\" needs to be in the range of uint8_t !");
+_Static_assert(STOP_WORD_HASH_WORDS_PER_BUCKET > 0, "The macro \"STOP_WORD_HASH_WORDS_PER_BUCKET\" is zero !");
+
+IS_TYPE(STOP_WORD_HASH_MAX_WORD_LENGTH, int)
+IS_TYPE(STOP_WORD_HASH_WORDS_PER_BUCKET, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//=====================================================================================================================
+
+/**
+ * @brief The Stop_Word_Hash_Table object.
+ *
+ * A table, that was created at build time, points in constant arrays (memory is NULL). A table, that was created at
+ * runtime, has all arrays in one dynamic memory block.
+ */
+struct Stop_Word_Hash_Table
+{
+    const uint16_t* displacements;          ///< Seed of the second hash per bucket
+    const uint32_t* slot_offsets;           ///< Position of the word of every slot in the word pool
+    const uint8_t* slot_lengths;            ///< Length of the word of every slot (0: empty slot)
+    const char* word_pool;                  ///< All words (lowercase and null terminated)
+
+    uint32_t number_of_buckets;             ///< Number of buckets (= Number of displacements)
+    uint32_t number_of_slots;               ///< Number of slots
+    uint32_t number_of_words;               ///< Number of words in the table
+    uint32_t longest_word;                  ///< Length of the longest word (Longer queries will not be hashed)
+
+    void* memory;                           ///< Dynamic memory of a table, that was created at runtime
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Hash function of the table (FNV-1a with a seed and a final mix of the bits).
+ *
+ * The function is inline, because it is part of every lookup. The seed 0 determines the bucket; the displacement of
+ * the bucket is the seed for the slot.
+ *
+ * @param[in] word Word (not necessarily null terminated)
+ * @param[in] word_length Length of the word
+ * @param[in] seed Seed
+ *
+ * @return Hash value
+ */
+static inline uint32_t
+StopWordHash_Hash
+(
+        const char* const word,
+        const size_t word_length,
+        const uint32_t seed
+)
+{
+    uint32_t result = 2166136261u ^ (seed * 2654435761u);
+
+    for (size_t i = 0; i < word_length; ++ i)
+    {
+        result ^= (uint32_t) (unsigned char) word [i];
+        result *= 16777619u;
+    }
+
+    // Mix the upper bits in the lower bits; the slot is the remainder of a small division
+    result ^= result >> 16;
+    result *= 2246822507u;
+    result ^= result >> 13;
+
+    return result;
+}
+
+/**
+ * @brief Fold a word to lowercase (Only the ASCII chars 'A' - 'Z').
+ *
+ * The function is inline, because it will be called once per query.
+ *
+ * @param[out] destination Memory for the folded word (at least word_length chars)
+ * @param[in] word Word (not necessarily null terminated)
+ * @param[in] word_length Length of the word
+ */
+static inline void
+StopWordHash_FoldCase
+(
+        char* const restrict destination,
+        const char* const restrict word,
+        const size_t word_length
+)
+{
+    for (size_t i = 0; i < word_length; ++ i)
+    {
+        const char c = word [i];
+        destination [i] = (c >= 'A' && c <= 'Z') ? (char) (c - 'A' + 'a') : c;
+    }
+
+    return;
+}
+
+/**
+ * @brief Create a new Stop_Word_Hash_Table object with a list of words.
+ *
+ * The words will be folded to lowercase; duplicates (also after the folding) will be saved only once. Empty words
+ * will be ignored.
+ *
+ * Asserts:
+ *      words != NULL
+ *      Every word is not NULL and not longer than STOP_WORD_HASH_MAX_WORD_LENGTH
+ *      A perfect hash function was found
+ *
+ * @param[in] words Array with the words
+ * @param[in] number_of_words Number of words in the array
+ *
+ * @return Address to the new dynamic Stop_Word_Hash_Table object
+ */
+extern struct Stop_Word_Hash_Table*
+StopWordHash_CreateObject
+(
+        const char* const* const words,
+        const size_t number_of_words
+);
+
+/**
+ * @brief Delete a Stop_Word_Hash_Table object, that was created with StopWordHash_CreateObject().
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Stop_Word_Hash_Table object
+ */
+extern void
+StopWordHash_DeleteObject
+(
+        struct Stop_Word_Hash_Table* object
+);
+
+/**
+ * @brief Is the word in the table ?
+ *
+ * Asserts:
+ *      table != NULL
+ *      lowercase_word != NULL
+ *
+ * @param[in] table Stop_Word_Hash_Table object
+ * @param[in] lowercase_word Word, that was folded with StopWordHash_FoldCase() (not necessarily null terminated)
+ * @param[in] word_length Length of the word
+ *
+ * @return true, if the table contains the word, otherwise false
+ */
+extern _Bool
+StopWordHash_Contains
+(
+        const struct Stop_Word_Hash_Table* const restrict table,
+        const char* const restrict lowercase_word,
+        const size_t word_length
+);
+
+/**
+ * @brief Is the word in the table ? The word will be folded to lowercase before the lookup.
+ *
+ * A word, that is longer than the longest word in the table, will not be folded.
+ *
+ * Asserts:
+ *      table != NULL
+ *      word != NULL
+ *
+ * @param[in] table Stop_Word_Hash_Table object
+ * @param[in] word Word in any case (not necessarily null terminated)
+ * @param[in] word_length Length of the word
+ *
+ * @return true, if the table contains the word, otherwise false
+ */
+extern _Bool
+StopWordHash_ContainsAnyCase
+(
+        const struct Stop_Word_Hash_Table* const restrict table,
+        const char* const restrict word,
+        const size_t word_length
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* STOP_WORD_HASH_H */
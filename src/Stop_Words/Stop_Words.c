@@ -6,50 +6,19 @@
  */
 
 #include "Stop_Words.h"
+#include <stdio.h>
 #include <string.h>
 #include <ctype.h>
 #include "../Error_Handling/Assert_Msg.h"
 #include "../Error_Handling/Dynamic_Memory.h"
 #include "../Error_Handling/_Generics.h"
 #include "../String_Tools.h"
-#include "../str2int.h"
 #include "../Misc.h"
-
-
-
-/**
- * @brief How many arrays contains the hash table, that reduces the string comparison calls ?
- */
-#ifndef HASH_TABLE_NUMBER_OF_ARRAYS
-#define HASH_TABLE_NUMBER_OF_ARRAYS 50
-#else
-#error "The macro \"HASH_TABLE_NUMBER_OF_ARRAYS\" is already defined !"
-#endif /* HASH_TABLE_NUMBER_OF_ARRAYS */
-
-#ifndef HASH_TABLE_ARRAY_LENGTH
-#define HASH_TABLE_ARRAY_LENGTH 1000    ///< How long are the arrays in the hash table ?
-#else
-#error "The macro \"HASH_TABLE_ARRAY_LENGTH\" is already defined !"
-#endif /* HASH_TABLE_ARRAY_LENGTH */
-
-#ifndef STOP_WORD_LIST_LENGTH
-#define STOP_WORD_LIST_LENGTH 1000      ///< Length of the stop word list buffer
-#else
-#error "The macro \"STOP_WORD_LIST_LENGTH\" is already defined !"
-#endif /* STOP_WORD_LIST_LENGTH */
-
-/**
- * @brief Check, whether the macro values are valid.
- */
-#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
-_Static_assert(HASH_TABLE_NUMBER_OF_ARRAYS > 1, "The marco \"HASH_TABLE_NUMBER_OF_ARRAYS\" needs to be larger than 1 !");
-_Static_assert(HASH_TABLE_ARRAY_LENGTH > 1, "The marco \"HASH_TABLE_ARRAY_LENGTH\" needs to be larger than 1 !");
-_Static_assert(STOP_WORD_LIST_LENGTH > 1, "The marco \"STOP_WORD_LIST_LENGTH\" needs to be larger than 1 !");
-
-IS_TYPE(HASH_TABLE_NUMBER_OF_ARRAYS, int)
-IS_TYPE(HASH_TABLE_ARRAY_LENGTH, int)
-IS_TYPE(STOP_WORD_LIST_LENGTH, int)
-#endif /* #defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+#include "Stop_Word_Hash.h"
+#include "../Mapped_File.h"
+#include "Token_Classifier.h"
+// Perfect hash table of GLOBAL_eng_stop_words; created at build time (See Create_Stop_Word_Table.c)
+#include "Stop_Words_English_Table.h"
 
 
 
@@ -61,40 +30,6 @@ const char* GLOBAL_eng_stop_words [] =
 
 
 
-/**
- * @brief Is the given C-String a Latin numeral?
- *
- * This information is useful, because in normal cases a Latin numeral is a stop word.
- *
- * @param[in] c_string          C-String, that will be checked
- * @param[in] c_string_length   Length of the C-String
- *
- * @return true, if the C-String a Latin numeral, false otherwise
- */
-static _Bool Is_String_A_Latin_Numeral
-(
-        const char* const c_string,
-        const size_t c_string_length
-);
-
-/**
- * @brief A very very simple hash function.
- *
- * It is not fair to call this mechanism "Hash", because it is too simple. But for this cases it is enough. It will be
- * used for the hash table. This table reduces the number of Compare_Strings_Case_Insensitive() calls, that determine
- * whether the string is a stop word or not.
- *
- * @param[in] c_string          C-String, that will be hashed
- * @param[in] c_string_length   Length of the C-String
- *
- * @return The hash value
- */
-static inline size_t Pseudo_Hash_Function
-(
-        const char* const c_string,
-        const size_t c_string_length
-);
-
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -113,59 +48,17 @@ extern _Bool Is_Word_In_Stop_Word_List
         const enum Stop_Word_Language language
 )
 {
-    static size_t eng_stop_word_lengths [STOP_WORD_LIST_LENGTH];
-    static size_t hash_table_stop_words [HASH_TABLE_NUMBER_OF_ARRAYS][HASH_TABLE_ARRAY_LENGTH];
-    static size_t hash_table_next_free_element [HASH_TABLE_NUMBER_OF_ARRAYS];
-    static size_t count_eng_stop_words = 0;
-
     ASSERT_MSG(c_string != NULL, "C string is NULL !");
     ASSERT_MSG(c_string_length > 0, "C string length is 0 !");
     ASSERT_MSG(language != NO_LANGUAGE, "No language selected !");
 
-    _Bool result = false;
-    size_t pseudo_hash = 0;
-
-    // Only used for the fist run to initialize the data
-    const char** selected_stop_word_list = NULL;
-    size_t current_stop_word_index = 0;
+    const struct Stop_Word_Hash_Table* selected_stop_word_table = NULL;
 
     switch(language)
     {
     case ENG:
-        selected_stop_word_list = GLOBAL_eng_stop_words;
-        if (count_eng_stop_words == 0)
-        {
-            memset (eng_stop_word_lengths, '\0', sizeof (eng_stop_word_lengths));
-            for (size_t i = 0; i < HASH_TABLE_NUMBER_OF_ARRAYS; ++ i)
-            {
-                memset (hash_table_stop_words [i], '\0', sizeof (hash_table_stop_words [i]));
-            }
-            memset (hash_table_next_free_element, '\0', sizeof (hash_table_next_free_element));
-
-            while (*selected_stop_word_list != NULL)
-            {
-                // Save the lengths of the stop words to avoid massive strlen calls
-                if (current_stop_word_index < STOP_WORD_LIST_LENGTH)
-                {
-                    eng_stop_word_lengths [current_stop_word_index] = strlen (*selected_stop_word_list);
-
-                    pseudo_hash = Pseudo_Hash_Function(*selected_stop_word_list, eng_stop_word_lengths [current_stop_word_index]);
-
-                    // Fill the hash table
-                    if (hash_table_next_free_element [pseudo_hash] < HASH_TABLE_ARRAY_LENGTH)
-                    {
-                        hash_table_stop_words [pseudo_hash][hash_table_next_free_element [pseudo_hash]] = current_stop_word_index;
-                        hash_table_next_free_element [pseudo_hash] ++;
-                    }
-
-                    ++ current_stop_word_index;
-                }
-
-                ++ selected_stop_word_list;
-                ++ count_eng_stop_words;
-            }
-            selected_stop_word_list = GLOBAL_eng_stop_words;
-        }
+        // A constant table; no initialization at runtime (and so no data race with several threads)
+        selected_stop_word_table = &ENG_STOP_WORD_TABLE;
         break;
         // This case statement is not necessary, because the assert at the begin of the function already did the check
         // Some compilers create a [-Wswitch-enum] warning, if not all enum values are used in a switch case statement
@@ -177,162 +70,112 @@ extern _Bool Is_Word_In_Stop_Word_List
         ASSERT_MSG(false, "switch case default path executed !");
     }
 
-    // If a token starts with a char, that is no alphabetic char, it cannot be a valid token -> So it will be in every
-    // case interpreted as stop word
-    // If the token only has the length 1, then it is also interpreted as stop word.
-    if (! isalpha(c_string [0]) || c_string [1] == '\0')
-    {
-        return true;
-    }
-    // A simple number is also a stop word
-    // To determine a number: try to run a str to int cast successfully
-    long int conversion_result_int = 0;
-    if (str2int(&conversion_result_int, c_string, 10) == STR2INT_SUCCESS)
-    {
-        return true;
-    }
-    // Try to run a str to double cast successfully
-    double conversion_result_double = 0.0;
-    if (str2double(&conversion_result_double, c_string) == STR2DOUBLE_SUCCESS)
+    // Tokens, that start with a non alphabetic char, tokens with only one char, numbers and Latin numerals are in every
+    // case interpreted as stop words. The classification needs only one pass over the token.
+    if (TokenClassifier_Classify(c_string, c_string_length) != TOKEN_CLASS_WORD)
     {
         return true;
     }
-    // Is the number a Latin numeral ?
-    if (Is_String_A_Latin_Numeral(c_string, c_string_length))
-    {
-        return true;
-    }
-
-    // With this construction you have the guarantee, that this value will be at least on the current stack frame.
-    // Maybe also in a register ...
-    register const size_t eng_stop_words_length = count_eng_stop_words;
-
-    if (eng_stop_words_length > HASH_TABLE_ARRAY_LENGTH)
-    {
-        // Search the string in the stop word list
-        for (register size_t i = 0; i < eng_stop_words_length; ++ i)
-        {
-            const int strings_case_insensitive_equal = Compare_Strings_Case_Insensitive
-            (
-                    c_string,
-                    c_string_length,
-                    selected_stop_word_list [i],
-                    (i < STOP_WORD_LIST_LENGTH) ? eng_stop_word_lengths [i] : strlen (selected_stop_word_list [i])
-            );
-
-            if (strings_case_insensitive_equal == 0)
-            {
-                return true;
-            }
-        }
-    }
-    else
-    {
-        pseudo_hash = Pseudo_Hash_Function(c_string, c_string_length);
-
-        for (register size_t i = 0; i < hash_table_next_free_element [pseudo_hash]; ++ i)
-        {
-            const size_t to_be_used_index = hash_table_stop_words [pseudo_hash][i];
-            const int strings_case_insensitive_equal = Compare_Strings_Case_Insensitive
-            (
-                    c_string,
-                    c_string_length,
-                    selected_stop_word_list [to_be_used_index],
-                    (to_be_used_index < STOP_WORD_LIST_LENGTH) ?
-                            eng_stop_word_lengths [to_be_used_index] : strlen (selected_stop_word_list [to_be_used_index])
-            );
-
-            if (strings_case_insensitive_equal == 0)
-            {
-                return true;
-            }
-        }
-    }
 
-    return result;
+    // The table contains only lowercase words; the token will be folded once
+    return StopWordHash_ContainsAnyCase(selected_stop_word_table, c_string, c_string_length);
 }
 
-//=====================================================================================================================
+//---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Is the given C-String a Latin numeral?
+ * @brief Load stop word lists from files in one Stop_Word_Hash_Table.
+ *
+ * Every line of a file contains one word. Empty lines and lines, that start with '#', will be ignored. The words of all
+ * files will be saved in one table; the comparison is case insensitive like with the compiled-in lists.
  *
- * This information is useful, because in normal cases a Latin numeral is a stop word.
+ * Asserts:
+ *      file_names != NULL
+ *      number_of_files > 0
+ *      Every file can be read and is not empty
+ *      Every line contains at most one word with at most STOP_WORD_HASH_MAX_WORD_LENGTH chars
  *
- * @param[in] c_string          C-String, that will be checked
- * @param[in] c_string_length   Length of the C-String
+ * @param[in] file_names Names of the stop word files
+ * @param[in] number_of_files Number of files
  *
- * @return true, if the C-String a Latin numeral, false otherwise
+ * @return Address to the new dynamic Stop_Word_Hash_Table object (Delete it with StopWordHash_DeleteObject())
  */
-static _Bool Is_String_A_Latin_Numeral
+extern struct Stop_Word_Hash_Table*
+Load_Stop_Word_Files
 (
-        const char* const c_string,
-        const size_t c_string_length
+        const char* const* const file_names,
+        const size_t number_of_files
 )
 {
-    _Bool result = true;
+    ASSERT_MSG(file_names != NULL, "File names are NULL !");
+    ASSERT_MSG(number_of_files > 0, "Number of files is 0 !");
 
-    for (size_t i = 0; i < c_string_length; ++ i)
+    // The words will be null terminated in copies of the file contents; the table copies the words in its own memory
+    char** contents = (char**) CALLOC(number_of_files, sizeof (char*));
+    ASSERT_ALLOC(contents, "Cannot allocate memory for the stop word file contents !", number_of_files * sizeof (char*));
+
+    // Not more words than lines
+    size_t max_number_of_words = 0;
+    for (size_t i = 0; i < number_of_files; ++ i)
     {
-        switch(c_string [i])
-        {
-        case 'I':
-        case 'V':
-        case 'X':
-        case 'L':
-        case 'C':
-        case 'D':
-        case 'M':
-            continue;
-        default:
-            result = false;
-            break;
-        }
+        struct Mapped_File* stop_word_file = MappedFile_CreateObject (file_names [i]);
+        contents [i] = (char*) MALLOC((size_t) stop_word_file->size + 1);
+        ASSERT_ALLOC(contents [i], "Cannot allocate memory for a stop word file !", (size_t) stop_word_file->size + 1);
+        memcpy(contents [i], stop_word_file->data, (size_t) stop_word_file->size);
+        contents [i][stop_word_file->size] = '\0';
+        max_number_of_words += (size_t) MappedFile_CountNewlines(stop_word_file, 0, stop_word_file->size) + 1;
+        MappedFile_DeleteObject(stop_word_file);
+        stop_word_file = NULL;
     }
 
-    return result;
-}
+    const char** words = (const char**) MALLOC(max_number_of_words * sizeof (const char*));
+    ASSERT_ALLOC(words, "Cannot allocate memory for the stop words !", max_number_of_words * sizeof (const char*));
+    size_t number_of_words = 0;
 
-//---------------------------------------------------------------------------------------------------------------------
+    for (size_t i = 0; i < number_of_files; ++ i)
+    {
+        size_t line_number = 0;
+        char* next_line = contents [i];
+        while (next_line != NULL)
+        {
+            char* cursor = next_line;
+            ++ line_number;
+            next_line = strchr(cursor, '\n');
+            if (next_line != NULL)
+            {
+                *next_line = '\0';
+                ++ next_line;
+            }
 
-/**
- * @brief A very very simple hash function.
- *
- * It is not fair to call this mechanism "Hash", because it is too simple. But for this cases it is enough. It will be
- * used for the hash table. This table reduces the number of Compare_Strings_Case_Insensitive() calls, that determine
- * whether the string is a stop word or not.
- *
- * @param[in] c_string          C-String, that will be hashed
- * @param[in] c_string_length   Length of the C-String
- *
- * @return The hash value
- */
-static inline size_t Pseudo_Hash_Function
-(
-        const char* const c_string,
-        const size_t c_string_length
-)
-{
-    size_t result = 0;
+            while (isspace((unsigned char) *cursor)) { ++ cursor; }
+            if (*cursor == '\0' || *cursor == '#') { continue; }
 
-    for (size_t i = 0; i < c_string_length; ++ i)
+            const char* const word = cursor;
+            while (*cursor != '\0' && ! isspace((unsigned char) *cursor)) { ++ cursor; }
+            const size_t word_length = (size_t) (cursor - word);
+            // Also "\r" of Windows line ends will be removed
+            while (isspace((unsigned char) *cursor)) { *cursor = '\0'; ++ cursor; }
+
+            ASSERT_FMSG(*cursor == '\0', "Line %zu of the stop word file \"%s\" contains more than one word !",
+                    line_number, file_names [i]);
+            ASSERT_FMSG(word_length <= STOP_WORD_HASH_MAX_WORD_LENGTH, "The word in line %zu of the stop word file "
+                    "\"%s\" is longer than %d chars !", line_number, file_names [i], STOP_WORD_HASH_MAX_WORD_LENGTH);
+            words [number_of_words ++] = word;
+        }
+    }
+
+    struct Stop_Word_Hash_Table* new_object = StopWordHash_CreateObject(words, number_of_words);
+    printf ("Stop word files: %" PRIu32 " words loaded from %zu file(s)\n", new_object->number_of_words,
+            number_of_files);
+
+    FREE_AND_SET_TO_NULL(words);
+    for (size_t i = 0; i < number_of_files; ++ i)
     {
-        result += (size_t) tolower (c_string [i]);
+        FREE_AND_SET_TO_NULL(contents [i]);
     }
+    FREE_AND_SET_TO_NULL(contents);
 
-    return result % HASH_TABLE_NUMBER_OF_ARRAYS;
+    return new_object;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-
-#ifdef HASH_TABLE_NUMBER_OF_ARRAYS
-#undef HASH_TABLE_NUMBER_OF_ARRAYS
-#endif /* HASH_TABLE_NUMBER_OF_ARRAYS */
-
-#ifdef HASH_TABLE_ARRAY_LENGTH
-#undef HASH_TABLE_ARRAY_LENGTH
-#endif /* HASH_TABLE_ARRAY_LENGTH */
-
-#ifdef STOP_WORD_LIST_LENGTH
-#undef STOP_WORD_LIST_LENGTH
-#endif /* STOP_WORD_LIST_LENGTH */
@@ -18,6 +18,7 @@ extern "C"
 
 #include <stdbool.h>    // _Bool
 #include <stddef.h>     // size_t
+#include "Stop_Word_Hash.h"
 
 
 
@@ -53,6 +54,30 @@ extern _Bool Is_Word_In_Stop_Word_List
         const enum Stop_Word_Language language
 );
 
+/**
+ * @brief Load stop word lists from files in one Stop_Word_Hash_Table.
+ *
+ * Every line of a file contains one word. Empty lines and lines, that start with '#', will be ignored. The words of all
+ * files will be saved in one table; the comparison is case insensitive like with the compiled-in lists.
+ *
+ * Asserts:
+ *      file_names != NULL
+ *      number_of_files > 0
+ *      Every file can be read and is not empty
+ *      Every line contains at most one word with at most STOP_WORD_HASH_MAX_WORD_LENGTH chars
+ *
+ * @param[in] file_names Names of the stop word files
+ * @param[in] number_of_files Number of files
+ *
+ * @return Address to the new dynamic Stop_Word_Hash_Table object (Delete it with StopWordHash_DeleteObject())
+ */
+extern struct Stop_Word_Hash_Table*
+Load_Stop_Word_Files
+(
+        const char* const* const file_names,
+        const size_t number_of_files
+);
+
 
 
 #ifdef __cplusplus
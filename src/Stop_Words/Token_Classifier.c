@@ -0,0 +1,300 @@
+/**
+ * @file Token_Classifier.c
+ *
+ * @brief Classify a token in one pass: number, Latin numeral, single char, token with a non alphabetic first char or
+ * normal word.
+ *
+ * Every char will be mapped to a char class and two flags (alphabetic, Latin numeral). The DFA recognizes only the
+ * numbers; the Latin numeral flags will be combined in the same loop. The loop ends early, if the DFA rejected the
+ * token and a char was no Latin numeral.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Token_Classifier.h"
+#include <inttypes.h>
+#include "../Error_Handling/Assert_Msg.h"
+
+
+
+/**
+ * @brief Char classes of the DFA. (Only the letters, that are part of "inf", "infinity" and "nan", need an own class)
+ */
+enum Char_Class
+{
+    CHAR_OTHER = 0,
+    CHAR_DIGIT,
+    CHAR_SIGN,
+    CHAR_DOT,
+    CHAR_E,
+    CHAR_I,
+    CHAR_N,
+    CHAR_F,
+    CHAR_T,
+    CHAR_Y,
+    CHAR_A,
+    CHAR_LETTER,
+    CHAR_UNDERSCORE,
+    CHAR_OPEN_PARENTHESIS,
+    CHAR_CLOSE_PARENTHESIS,
+
+    NUMBER_OF_CHAR_CLASSES
+};
+
+/**
+ * @brief Flags in the char table beside the char class.
+ */
+#ifndef CHAR_CLASS_MASK
+#define CHAR_CLASS_MASK 0x1F
+#else
+#error "The macro \"CHAR_CLASS_MASK\" is already defined !"
+#endif /* CHAR_CLASS_MASK */
+
+#ifndef ALPHA
+#define ALPHA 0x20
+#else
+#error "The macro \"ALPHA\" is already defined !"
+#endif /* ALPHA */
+
+#ifndef LATIN
+#define LATIN 0x40
+#else
+#error "The macro \"LATIN\" is already defined !"
+#endif /* LATIN */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(NUMBER_OF_CHAR_CLASSES <= CHAR_CLASS_MASK + 1, "The char classes do not fit in the mask !");
+_Static_assert((CHAR_CLASS_MASK & (ALPHA | LATIN)) == 0, "The flags overlap with the char classes !");
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+/**
+ * @brief States of the DFA. The reject state is 0; so all missing transitions in the table lead to this state.
+ */
+enum DFA_State
+{
+    STATE_REJECT = 0,
+    STATE_START,
+    STATE_SIGN,
+    STATE_INTEGER,
+    STATE_DOT,
+    STATE_FRACTION,
+    STATE_EXPONENT,
+    STATE_EXPONENT_SIGN,
+    STATE_EXPONENT_DIGITS,
+    STATE_I,
+    STATE_IN,
+    STATE_INF,
+    STATE_INFI,
+    STATE_INFIN,
+    STATE_INFINI,
+    STATE_INFINIT,
+    STATE_INFINITY,
+    STATE_N,
+    STATE_NA,
+    STATE_NAN,
+    STATE_NAN_CHARS,
+    STATE_NAN_CLOSE,
+
+    NUMBER_OF_STATES
+};
+
+/**
+ * @brief Char class and flags of every char. All chars, that are not listed, are CHAR_OTHER without flags.
+ */
+static const uint8_t char_classes [256] =
+{
+        ['0'] = CHAR_DIGIT, ['1'] = CHAR_DIGIT, ['2'] = CHAR_DIGIT, ['3'] = CHAR_DIGIT, ['4'] = CHAR_DIGIT,
+        ['5'] = CHAR_DIGIT, ['6'] = CHAR_DIGIT, ['7'] = CHAR_DIGIT, ['8'] = CHAR_DIGIT, ['9'] = CHAR_DIGIT,
+
+        ['+'] = CHAR_SIGN, ['-'] = CHAR_SIGN, ['.'] = CHAR_DOT, ['_'] = CHAR_UNDERSCORE,
+        ['('] = CHAR_OPEN_PARENTHESIS, [')'] = CHAR_CLOSE_PARENTHESIS,
+
+        ['a'] = CHAR_A | ALPHA,      ['b'] = CHAR_LETTER | ALPHA, ['c'] = CHAR_LETTER | ALPHA,
+        ['d'] = CHAR_LETTER | ALPHA, ['e'] = CHAR_E | ALPHA,      ['f'] = CHAR_F | ALPHA,
+        ['g'] = CHAR_LETTER | ALPHA, ['h'] = CHAR_LETTER | ALPHA, ['i'] = CHAR_I | ALPHA,
+        ['j'] = CHAR_LETTER | ALPHA, ['k'] = CHAR_LETTER | ALPHA, ['l'] = CHAR_LETTER | ALPHA,
+        ['m'] = CHAR_LETTER | ALPHA, ['n'] = CHAR_N | ALPHA,      ['o'] = CHAR_LETTER | ALPHA,
+        ['p'] = CHAR_LETTER | ALPHA, ['q'] = CHAR_LETTER | ALPHA, ['r'] = CHAR_LETTER | ALPHA,
+        ['s'] = CHAR_LETTER | ALPHA, ['t'] = CHAR_T | ALPHA,      ['u'] = CHAR_LETTER | ALPHA,
+        ['v'] = CHAR_LETTER | ALPHA, ['w'] = CHAR_LETTER | ALPHA, ['x'] = CHAR_LETTER | ALPHA,
+        ['y'] = CHAR_Y | ALPHA,      ['z'] = CHAR_LETTER | ALPHA,
+
+        ['A'] = CHAR_A | ALPHA,              ['B'] = CHAR_LETTER | ALPHA,         ['C'] = CHAR_LETTER | ALPHA | LATIN,
+        ['D'] = CHAR_LETTER | ALPHA | LATIN, ['E'] = CHAR_E | ALPHA,              ['F'] = CHAR_F | ALPHA,
+        ['G'] = CHAR_LETTER | ALPHA,         ['H'] = CHAR_LETTER | ALPHA,         ['I'] = CHAR_I | ALPHA | LATIN,
+        ['J'] = CHAR_LETTER | ALPHA,         ['K'] = CHAR_LETTER | ALPHA,         ['L'] = CHAR_LETTER | ALPHA | LATIN,
+        ['M'] = CHAR_LETTER | ALPHA | LATIN, ['N'] = CHAR_N | ALPHA,              ['O'] = CHAR_LETTER | ALPHA,
+        ['P'] = CHAR_LETTER | ALPHA,         ['Q'] = CHAR_LETTER | ALPHA,         ['R'] = CHAR_LETTER | ALPHA,
+        ['S'] = CHAR_LETTER | ALPHA,         ['T'] = CHAR_T | ALPHA,              ['U'] = CHAR_LETTER | ALPHA,
+        ['V'] = CHAR_LETTER | ALPHA | LATIN, ['W'] = CHAR_LETTER | ALPHA,         ['X'] = CHAR_LETTER | ALPHA | LATIN,
+        ['Y'] = CHAR_Y | ALPHA,              ['Z'] = CHAR_LETTER | ALPHA
+};
+
+/**
+ * @brief Transitions of the DFA: [current state][char class] -> next state
+ */
+static const uint8_t transitions [NUMBER_OF_STATES][NUMBER_OF_CHAR_CLASSES] =
+{
+        [STATE_START]           = { [CHAR_DIGIT] = STATE_INTEGER, [CHAR_SIGN] = STATE_SIGN, [CHAR_DOT] = STATE_DOT,
+                                    [CHAR_I] = STATE_I, [CHAR_N] = STATE_N },
+        [STATE_SIGN]            = { [CHAR_DIGIT] = STATE_INTEGER, [CHAR_DOT] = STATE_DOT, [CHAR_I] = STATE_I,
+                                    [CHAR_N] = STATE_N },
+        [STATE_INTEGER]         = { [CHAR_DIGIT] = STATE_INTEGER, [CHAR_DOT] = STATE_FRACTION,
+                                    [CHAR_E] = STATE_EXPONENT },
+        [STATE_DOT]             = { [CHAR_DIGIT] = STATE_FRACTION },
+        [STATE_FRACTION]        = { [CHAR_DIGIT] = STATE_FRACTION, [CHAR_E] = STATE_EXPONENT },
+        [STATE_EXPONENT]        = { [CHAR_DIGIT] = STATE_EXPONENT_DIGITS, [CHAR_SIGN] = STATE_EXPONENT_SIGN },
+        [STATE_EXPONENT_SIGN]   = { [CHAR_DIGIT] = STATE_EXPONENT_DIGITS },
+        [STATE_EXPONENT_DIGITS] = { [CHAR_DIGIT] = STATE_EXPONENT_DIGITS },
+
+        [STATE_I]               = { [CHAR_N] = STATE_IN },
+        [STATE_IN]              = { [CHAR_F] = STATE_INF },
+        [STATE_INF]             = { [CHAR_I] = STATE_INFI },
+        [STATE_INFI]            = { [CHAR_N] = STATE_INFIN },
+        [STATE_INFIN]           = { [CHAR_I] = STATE_INFINI },
+        [STATE_INFINI]          = { [CHAR_T] = STATE_INFINIT },
+        [STATE_INFINIT]         = { [CHAR_Y] = STATE_INFINITY },
+
+        [STATE_N]               = { [CHAR_A] = STATE_NA },
+        [STATE_NA]              = { [CHAR_N] = STATE_NAN },
+        [STATE_NAN]             = { [CHAR_OPEN_PARENTHESIS] = STATE_NAN_CHARS },
+        [STATE_NAN_CHARS]       = { [CHAR_DIGIT] = STATE_NAN_CHARS, [CHAR_E] = STATE_NAN_CHARS,
+                                    [CHAR_I] = STATE_NAN_CHARS, [CHAR_N] = STATE_NAN_CHARS,
+                                    [CHAR_F] = STATE_NAN_CHARS, [CHAR_T] = STATE_NAN_CHARS,
+                                    [CHAR_Y] = STATE_NAN_CHARS, [CHAR_A] = STATE_NAN_CHARS,
+                                    [CHAR_LETTER] = STATE_NAN_CHARS, [CHAR_UNDERSCORE] = STATE_NAN_CHARS,
+                                    [CHAR_CLOSE_PARENTHESIS] = STATE_NAN_CLOSE }
+};
+
+/**
+ * @brief Result of every final state. TOKEN_CLASS_WORD means: The token is no number.
+ */
+static const uint8_t state_results [NUMBER_OF_STATES] =
+{
+        [STATE_INTEGER]         = TOKEN_CLASS_INTEGER,
+        [STATE_FRACTION]        = TOKEN_CLASS_DECIMAL,
+        [STATE_EXPONENT_DIGITS] = TOKEN_CLASS_DECIMAL,
+        [STATE_INF]             = TOKEN_CLASS_DECIMAL,
+        [STATE_INFINITY]        = TOKEN_CLASS_DECIMAL,
+        [STATE_NAN]             = TOKEN_CLASS_DECIMAL,
+        [STATE_NAN_CLOSE]       = TOKEN_CLASS_DECIMAL
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Classify a token in one pass over its chars.
+ *
+ * The checks have this order: Single char, number, non alphabetic first char, Latin numeral, word. (The Latin numeral
+ * check does not validate the order of the numerals: "IIV" is also a Latin numeral)
+ *
+ * Alphabetic chars are the ASCII letters; like isalpha() in the "C" locale.
+ *
+ * Asserts:
+ *      token != NULL
+ *      token_length > 0
+ *
+ * @param[in] token Token (not necessarily null terminated)
+ * @param[in] token_length Length of the token
+ *
+ * @return Class of the token
+ */
+extern enum Token_Class
+TokenClassifier_Classify
+(
+        const char* const token,
+        const size_t token_length
+)
+{
+    ASSERT_MSG(token != NULL, "Token is NULL !");
+    ASSERT_MSG(token_length > 0, "Token length is 0 !");
+
+    if (token_length == 1)
+    {
+        return TOKEN_CLASS_SINGLE_CHAR;
+    }
+
+    const uint_fast8_t first_char = char_classes [(unsigned char) token [0]];
+    uint_fast8_t state = STATE_START;
+    uint_fast8_t latin_numeral = LATIN;
+
+    for (size_t i = 0; i < token_length; ++ i)
+    {
+        const uint_fast8_t current_char = char_classes [(unsigned char) token [i]];
+        state = transitions [state][current_char & CHAR_CLASS_MASK];
+        latin_numeral &= current_char;
+
+        // Neither a number nor a Latin numeral; the rest of the token does not change the result
+        if (state == STATE_REJECT && ! latin_numeral)
+        {
+            break;
+        }
+    }
+
+    if (state_results [state] != TOKEN_CLASS_WORD)
+    {
+        return (enum Token_Class) state_results [state];
+    }
+    if (! (first_char & ALPHA))
+    {
+        return TOKEN_CLASS_NON_ALPHA_LEADING;
+    }
+    if (latin_numeral)
+    {
+        return TOKEN_CLASS_LATIN_NUMERAL;
+    }
+
+    return TOKEN_CLASS_WORD;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the name of a token class. (For the output of the tests)
+ *
+ * @param[in] token_class Token class
+ *
+ * @return Name of the class as constant C-String
+ */
+extern const char*
+TokenClassifier_GetClassName
+(
+        const enum Token_Class token_class
+)
+{
+    switch (token_class)
+    {
+    case TOKEN_CLASS_WORD:
+        return "Word";
+    case TOKEN_CLASS_SINGLE_CHAR:
+        return "Single char";
+    case TOKEN_CLASS_INTEGER:
+        return "Integer";
+    case TOKEN_CLASS_DECIMAL:
+        return "Decimal";
+    case TOKEN_CLASS_LATIN_NUMERAL:
+        return "Latin numeral";
+    case TOKEN_CLASS_NON_ALPHA_LEADING:
+        return "Non alpha leading";
+
+    default:
+        ASSERT_MSG(false, "switch case default path executed !");
+    }
+
+    return "";
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef CHAR_CLASS_MASK
+#undef CHAR_CLASS_MASK
+#endif /* CHAR_CLASS_MASK */
+#ifdef ALPHA
+#undef ALPHA
+#endif /* ALPHA */
+#ifdef LATIN
+#undef LATIN
+#endif /* LATIN */
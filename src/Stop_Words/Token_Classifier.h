@@ -0,0 +1,93 @@
+/**
+ * @file Token_Classifier.h
+ *
+ * @brief Classify a token in one pass: number, Latin numeral, single char, token with a non alphabetic first char or
+ * normal word.
+ *
+ * The classification is a table driven DFA (deterministic finite automaton) over classes of chars. It replaces the
+ * chain str2int() -> str2double() -> Latin numeral check, that scanned the token up to three times and called strtol()
+ * and strtod() with the errno handling for every token.
+ *
+ * The number classes are lexical classes; there is no range check:
+ * - Integer: Optional sign and decimal digits ("42", "-7")
+ * - Decimal: Everything else strtod() accepts in decimal notation ("1.5", ".5", "2.", "1e-3", "+2.5E+10") and the
+ *   special values "inf", "infinity", "nan" and "nan(chars)" (case insensitive and with optional sign)
+ * The hexadecimal notation of strtod() is not a number here. Such a token has a non alphabetic first char anyway.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef TOKEN_CLASSIFIER_H
+#define TOKEN_CLASSIFIER_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <stddef.h>
+
+
+
+/**
+ * @brief Class of a token.
+ */
+enum Token_Class
+{
+    TOKEN_CLASS_WORD = 0,               ///< A token, that starts with an alphabetic char and is nothing of the rest
+    TOKEN_CLASS_SINGLE_CHAR,            ///< A token with only one char
+    TOKEN_CLASS_INTEGER,                ///< Integer number
+    TOKEN_CLASS_DECIMAL,                ///< Decimal number (also scientific notation, inf and nan)
+    TOKEN_CLASS_LATIN_NUMERAL,          ///< Only the chars 'I', 'V', 'X', 'L', 'C', 'D' and 'M'
+    TOKEN_CLASS_NON_ALPHA_LEADING       ///< A token, that is no number and that starts with a non alphabetic char
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Classify a token in one pass over its chars.
+ *
+ * The checks have this order: Single char, number, non alphabetic first char, Latin numeral, word. (The Latin numeral
+ * check does not validate the order of the numerals: "IIV" is also a Latin numeral)
+ *
+ * Alphabetic chars are the ASCII letters; like isalpha() in the "C" locale.
+ *
+ * Asserts:
+ *      token != NULL
+ *      token_length > 0
+ *
+ * @param[in] token Token (not necessarily null terminated)
+ * @param[in] token_length Length of the token
+ *
+ * @return Class of the token
+ */
+extern enum Token_Class
+TokenClassifier_Classify
+(
+        const char* const token,
+        const size_t token_length
+);
+
+/**
+ * @brief Get the name of a token class. (For the output of the tests)
+ *
+ * @param[in] token_class Token class
+ *
+ * @return Name of the class as constant C-String
+ */
+extern const char*
+TokenClassifier_GetClassName
+(
+        const enum Token_Class token_class
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* TOKEN_CLASSIFIER_H */
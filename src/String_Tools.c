@@ -11,9 +11,109 @@
 #include <string.h>
 #include <ctype.h>
 #include "Misc.h"
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
 
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif /* defined(__AVX2__) */
 
 
+
+/**
+ * @brief Number of bytes, that will be classified in one step. (One bit per byte in a uint32_t mask)
+ */
+#ifndef TOKENIZER_BLOCK_SIZE
+#define TOKENIZER_BLOCK_SIZE 32
+#else
+#error "The macro \"TOKENIZER_BLOCK_SIZE\" is already defined !"
+#endif /* TOKENIZER_BLOCK_SIZE */
+
+/**
+ * @brief Initial number of token positions in a Token_Position_Buffer.
+ */
+#ifndef TOKEN_POSITION_BUFFER_INITIAL_SIZE
+#define TOKEN_POSITION_BUFFER_INITIAL_SIZE 64
+#else
+#error "The macro \"TOKEN_POSITION_BUFFER_INITIAL_SIZE\" is already defined !"
+#endif /* TOKEN_POSITION_BUFFER_INITIAL_SIZE */
+
+
+
+/**
+ * @brief Classify a full block with SIMD instructions (or with the byte class table, if SIMD is not available).
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] block Begin of the block (TOKENIZER_BLOCK_SIZE readable bytes)
+ * @param[in] delimiter_set Delimiter_Set object
+ *
+ * @return Bit mask: bit i is set, if the byte i is a delimiter
+ */
+static inline uint32_t
+Classify_Full_Block
+(
+        const char* const restrict block,
+        const struct Delimiter_Set* const restrict delimiter_set
+);
+
+/**
+ * @brief Classify a block with the byte class table. The bits behind the block length will be set (like delimiters).
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] block Begin of the block
+ * @param[in] block_length Number of bytes in the block (max. TOKENIZER_BLOCK_SIZE)
+ * @param[in] delimiter_set Delimiter_Set object
+ *
+ * @return Bit mask: bit i is set, if the byte i is a delimiter or behind the block
+ */
+static inline uint32_t
+Classify_Block_With_Table
+(
+        const char* const restrict block,
+        const size_t block_length,
+        const struct Delimiter_Set* const restrict delimiter_set
+);
+
+/**
+ * @brief Determine the index of the lowest set bit.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] mask Bit mask (!= 0)
+ *
+ * @return Index of the lowest set bit
+ */
+static inline unsigned int
+Index_Of_Lowest_Set_Bit
+(
+        const uint32_t mask
+);
+
+/**
+ * @brief Append a token position to the buffer. The buffer will be doubled, if it is full.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in, out] buffer Token_Position_Buffer object
+ * @param[in] pos Position of the token
+ * @param[in] len Length of the token
+ */
+static inline void
+Append_Token_Position
+(
+        struct Token_Position_Buffer* const buffer,
+        const size_t pos,
+        const size_t len
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -533,3 +633,317 @@ Tokenize_String
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the byte class table and the SIMD delimiters of a break set.
+ *
+ * Asserts:
+ *      delimiter_set != NULL
+ *      breakset != NULL
+ *
+ * @param[out] delimiter_set Delimiter_Set object
+ * @param[in] breakset List of delimiters
+ */
+extern void
+Init_Delimiter_Set
+(
+        struct Delimiter_Set* const restrict delimiter_set,
+        const char* const restrict breakset
+)
+{
+    ASSERT_MSG(delimiter_set != NULL, "Delimiter_Set is NULL !");
+    ASSERT_MSG(breakset != NULL, "Break set is NULL !");
+
+    memset(delimiter_set, '\0', sizeof (struct Delimiter_Set));
+
+    for (const char* c = breakset; *c != '\0'; ++ c)
+    {
+        // Every delimiter only once in the SIMD comparison
+        if (delimiter_set->byte_class [(unsigned char) *c]) { continue; }
+        delimiter_set->byte_class [(unsigned char) *c] = true;
+
+        if (delimiter_set->number_of_simd_delimiters < MAX_SIMD_DELIMITERS)
+        {
+            delimiter_set->simd_delimiters [delimiter_set->number_of_simd_delimiters] = *c;
+        }
+        // Count also the delimiters, that do not fit in the array; so too large sets can be detected
+        ++ delimiter_set->number_of_simd_delimiters;
+    }
+
+    if (delimiter_set->number_of_simd_delimiters > MAX_SIMD_DELIMITERS)
+    {
+        delimiter_set->number_of_simd_delimiters = 0;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Tokenize a string and save the position and the length of every token in a buffer.
+ *
+ * Unlike Tokenize_String() the string needs no null terminator, the number of tokens is not limited and there are no
+ * empty tokens. The delimiters will be classified with SSE2 or AVX2 (32 bytes per step), if the compiler supports
+ * them; otherwise the byte class table will be used.
+ *
+ * Asserts:
+ *      input != NULL
+ *      delimiter_set != NULL
+ *      buffer != NULL
+ *
+ * @param[in] input Input string (not necessarily null terminated)
+ * @param[in] input_length Length of the input string
+ * @param[in] delimiter_set Delimiter_Set object
+ * @param[in, out] buffer Buffer for the token positions (The previous content will be overwritten)
+ *
+ * @return Number of tokens
+ */
+extern size_t
+Tokenize_String_Into_Buffer
+(
+        const char* const restrict input,
+        const size_t input_length,
+        const struct Delimiter_Set* const restrict delimiter_set,
+        struct Token_Position_Buffer* const restrict buffer
+)
+{
+    ASSERT_MSG(input != NULL, "Input string is NULL !");
+    ASSERT_MSG(delimiter_set != NULL, "Delimiter_Set is NULL !");
+    ASSERT_MSG(buffer != NULL, "Token_Position_Buffer is NULL !");
+
+    buffer->next_free_element = 0;
+
+    _Bool in_token              = false;
+    size_t token_begin          = 0;
+    // The byte before the string counts as delimiter; so a token can begin at the first byte
+    uint32_t previous_delimiter = 1;
+
+    for (size_t block_begin = 0; block_begin < input_length; block_begin += TOKENIZER_BLOCK_SIZE)
+    {
+        const size_t block_length = MIN(input_length - block_begin, (size_t) TOKENIZER_BLOCK_SIZE);
+        const uint32_t delimiters = (block_length == TOKENIZER_BLOCK_SIZE) ?
+                Classify_Full_Block(input + block_begin, delimiter_set) :
+                Classify_Block_With_Table(input + block_begin, block_length, delimiter_set);
+
+        // Every bit, where the class differs from the class of the previous byte, is a token begin or a token end
+        uint32_t boundaries = delimiters ^ ((delimiters << 1) | previous_delimiter);
+        while (boundaries != 0)
+        {
+            const size_t position = block_begin + Index_Of_Lowest_Set_Bit(boundaries);
+            if (in_token)
+            {
+                Append_Token_Position(buffer, token_begin, position - token_begin);
+            }
+            else
+            {
+                token_begin = position;
+            }
+            in_token = ! in_token;
+            boundaries &= boundaries - 1;
+        }
+
+        previous_delimiter = delimiters >> (TOKENIZER_BLOCK_SIZE - 1);
+    }
+
+    // The last token ends at the string end (Only possible, if the last block was full)
+    if (in_token)
+    {
+        Append_Token_Position(buffer, token_begin, input_length - token_begin);
+    }
+
+    return buffer->next_free_element;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Free the memory of a Token_Position_Buffer. The object can be used again afterwards.
+ *
+ * Asserts:
+ *      buffer != NULL
+ *
+ * @param[in] buffer Token_Position_Buffer object
+ */
+extern void
+Free_Token_Position_Buffer
+(
+        struct Token_Position_Buffer* const buffer
+)
+{
+    ASSERT_MSG(buffer != NULL, "Token_Position_Buffer is NULL !");
+
+    if (buffer->data != NULL)
+    {
+        FREE_AND_SET_TO_NULL(buffer->data);
+    }
+    buffer->next_free_element   = 0;
+    buffer->allocated_elements  = 0;
+
+    return;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Classify a full block with SIMD instructions (or with the byte class table, if SIMD is not available).
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] block Begin of the block (TOKENIZER_BLOCK_SIZE readable bytes)
+ * @param[in] delimiter_set Delimiter_Set object
+ *
+ * @return Bit mask: bit i is set, if the byte i is a delimiter
+ */
+static inline uint32_t
+Classify_Full_Block
+(
+        const char* const restrict block,
+        const struct Delimiter_Set* const restrict delimiter_set
+)
+{
+#if defined(__AVX2__)
+    if (delimiter_set->number_of_simd_delimiters > 0)
+    {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i*) block);
+        __m256i matches = _mm256_setzero_si256();
+        for (size_t i = 0; i < delimiter_set->number_of_simd_delimiters; ++ i)
+        {
+            matches = _mm256_or_si256(matches,
+                    _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(delimiter_set->simd_delimiters [i])));
+        }
+        return (uint32_t) _mm256_movemask_epi8(matches);
+    }
+#elif defined(__SSE2__)
+    if (delimiter_set->number_of_simd_delimiters > 0)
+    {
+        const __m128i bytes_low     = _mm_loadu_si128((const __m128i*) block);
+        const __m128i bytes_high    = _mm_loadu_si128((const __m128i*) (block + 16));
+        __m128i matches_low         = _mm_setzero_si128();
+        __m128i matches_high        = _mm_setzero_si128();
+        for (size_t i = 0; i < delimiter_set->number_of_simd_delimiters; ++ i)
+        {
+            const __m128i delimiter = _mm_set1_epi8(delimiter_set->simd_delimiters [i]);
+            matches_low     = _mm_or_si128(matches_low, _mm_cmpeq_epi8(bytes_low, delimiter));
+            matches_high    = _mm_or_si128(matches_high, _mm_cmpeq_epi8(bytes_high, delimiter));
+        }
+        return (uint32_t) _mm_movemask_epi8(matches_low) | ((uint32_t) _mm_movemask_epi8(matches_high) << 16);
+    }
+#endif /* defined(__AVX2__) */
+
+    return Classify_Block_With_Table(block, TOKENIZER_BLOCK_SIZE, delimiter_set);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Classify a block with the byte class table. The bits behind the block length will be set (like delimiters).
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] block Begin of the block
+ * @param[in] block_length Number of bytes in the block (max. TOKENIZER_BLOCK_SIZE)
+ * @param[in] delimiter_set Delimiter_Set object
+ *
+ * @return Bit mask: bit i is set, if the byte i is a delimiter or behind the block
+ */
+static inline uint32_t
+Classify_Block_With_Table
+(
+        const char* const restrict block,
+        const size_t block_length,
+        const struct Delimiter_Set* const restrict delimiter_set
+)
+{
+    uint32_t delimiters = (block_length < TOKENIZER_BLOCK_SIZE) ? (UINT32_MAX << block_length) : 0;
+
+    for (size_t i = 0; i < block_length; ++ i)
+    {
+        delimiters |= (uint32_t) delimiter_set->byte_class [(unsigned char) block [i]] << i;
+    }
+
+    return delimiters;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the index of the lowest set bit.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] mask Bit mask (!= 0)
+ *
+ * @return Index of the lowest set bit
+ */
+static inline unsigned int
+Index_Of_Lowest_Set_Bit
+(
+        const uint32_t mask
+)
+{
+#if defined(__GNUC__)
+    return (unsigned int) __builtin_ctz(mask);
+#else
+    unsigned int index = 0;
+    while ((mask & ((uint32_t) 1 << index)) == 0)
+    {
+        ++ index;
+    }
+    return index;
+#endif /* defined(__GNUC__) */
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append a token position to the buffer. The buffer will be doubled, if it is full.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in, out] buffer Token_Position_Buffer object
+ * @param[in] pos Position of the token
+ * @param[in] len Length of the token
+ */
+static inline void
+Append_Token_Position
+(
+        struct Token_Position_Buffer* const buffer,
+        const size_t pos,
+        const size_t len
+)
+{
+    if (buffer->next_free_element >= buffer->allocated_elements)
+    {
+        const size_t new_allocated_elements = (buffer->allocated_elements == 0) ?
+                TOKEN_POSITION_BUFFER_INITIAL_SIZE : (buffer->allocated_elements * 2);
+        struct Token_Position* tmp_data = (struct Token_Position*) REALLOC(buffer->data,
+                new_allocated_elements * sizeof (struct Token_Position));
+        ASSERT_ALLOC(tmp_data, "Cannot increase the memory for the token positions !",
+                new_allocated_elements * sizeof (struct Token_Position));
+        buffer->data                = tmp_data;
+        buffer->allocated_elements  = new_allocated_elements;
+    }
+
+    buffer->data [buffer->next_free_element].pos = pos;
+    buffer->data [buffer->next_free_element].len = len;
+    ++ buffer->next_free_element;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef TOKENIZER_BLOCK_SIZE
+#undef TOKENIZER_BLOCK_SIZE
+#endif /* TOKENIZER_BLOCK_SIZE */
+
+#ifdef TOKEN_POSITION_BUFFER_INITIAL_SIZE
+#undef TOKEN_POSITION_BUFFER_INITIAL_SIZE
+#endif /* TOKEN_POSITION_BUFFER_INITIAL_SIZE */
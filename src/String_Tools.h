@@ -44,6 +44,16 @@ extern "C"
 #error "The macro \"IS_STRING_LENGTH_NOT_ZERO\" is already defined !"
 #endif /* IS_STRING_LENGTH_NOT_ZERO */
 
+/**
+ * @brief Maximum number of delimiters, that will be compared with SIMD instructions. Delimiter sets with more chars will
+ * be classified only with the byte class table.
+ */
+#ifndef MAX_SIMD_DELIMITERS
+#define MAX_SIMD_DELIMITERS 8
+#else
+#error "The macro \"MAX_SIMD_DELIMITERS\" is already defined !"
+#endif /* MAX_SIMD_DELIMITERS */
+
 /**
  * @brief Simple check, if a C-String has the length one.
  *
@@ -358,6 +368,96 @@ Tokenize_String
         const char* restrict breakset
 );
 
+/**
+ * @brief The delimiters for Tokenize_String_Into_Buffer(). Create it once with Init_Delimiter_Set() and use it for all
+ * strings.
+ */
+struct Delimiter_Set
+{
+    _Bool byte_class [256];                         ///< Byte class table: true for every delimiter
+    char simd_delimiters [MAX_SIMD_DELIMITERS];     ///< Delimiters for the SIMD comparison
+    size_t number_of_simd_delimiters;               ///< 0: Too many delimiters for the SIMD comparison
+};
+
+/**
+ * @brief Position and length of one token.
+ */
+struct Token_Position
+{
+    size_t pos;                         ///< Position as offset
+    size_t len;                         ///< Length of the token (always > 0)
+};
+
+/**
+ * @brief Growable buffer for the token positions of a string. The buffer can be used for several strings; it grows with
+ * the string with the most tokens. Start with a zero initialized object and free it with Free_Token_Position_Buffer().
+ */
+struct Token_Position_Buffer
+{
+    struct Token_Position* data;        ///< Token positions
+    size_t next_free_element;           ///< Number of tokens in the current string
+    size_t allocated_elements;          ///< Allocated number of token positions
+};
+
+/**
+ * @brief Create the byte class table and the SIMD delimiters of a break set.
+ *
+ * Asserts:
+ *      delimiter_set != NULL
+ *      breakset != NULL
+ *
+ * @param[out] delimiter_set Delimiter_Set object
+ * @param[in] breakset List of delimiters
+ */
+extern void
+Init_Delimiter_Set
+(
+        struct Delimiter_Set* const restrict delimiter_set,
+        const char* const restrict breakset
+);
+
+/**
+ * @brief Tokenize a string and save the position and the length of every token in a buffer.
+ *
+ * Unlike Tokenize_String() the string needs no null terminator, the number of tokens is not limited and there are no
+ * empty tokens. The delimiters will be classified with SSE2 or AVX2 (32 bytes per step), if the compiler supports
+ * them; otherwise the byte class table will be used.
+ *
+ * Asserts:
+ *      input != NULL
+ *      delimiter_set != NULL
+ *      buffer != NULL
+ *
+ * @param[in] input Input string (not necessarily null terminated)
+ * @param[in] input_length Length of the input string
+ * @param[in] delimiter_set Delimiter_Set object
+ * @param[in, out] buffer Buffer for the token positions (The previous content will be overwritten)
+ *
+ * @return Number of tokens
+ */
+extern size_t
+Tokenize_String_Into_Buffer
+(
+        const char* const restrict input,
+        const size_t input_length,
+        const struct Delimiter_Set* const restrict delimiter_set,
+        struct Token_Position_Buffer* const restrict buffer
+);
+
+/**
+ * @brief Free the memory of a Token_Position_Buffer. The object can be used again afterwards.
+ *
+ * Asserts:
+ *      buffer != NULL
+ *
+ * @param[in] buffer Token_Position_Buffer object
+ */
+extern void
+Free_Token_Position_Buffer
+(
+        struct Token_Position_Buffer* const buffer
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 
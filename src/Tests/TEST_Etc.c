@@ -15,8 +15,20 @@
 #include "../CLI_Parameter.h"
 #include "../Exec_Intersection.h"
 #include "../Error_Handling/Dynamic_Memory.h"
+#include "../Error_Handling/Assert_Msg.h"
 #include "../ANSI_Esc_Seq.h"
 #include "../String_Tools.h"
+#include "../Misc.h"
+#include "../JSON_Writer.h"
+#include "../Async_File_Writer.h"
+#include "../Compressed_Input.h"
+#include "../Mapped_File.h"
+#include "../JSON_Parser/cJSON.h"
+#include "../Stop_Words/Stop_Words.h"
+#include "../Stop_Words/Stop_Word_Hash.h"
+#include "../Stop_Words/Token_Classifier.h"
+#include "../str2int.h"
+#include "../UTF8/utf8.h"
 
 
 
@@ -115,3 +127,544 @@ extern void TEST_Tokenize_String (void)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the Tokenize_String_Into_Buffer function finds all tokens - also behind the 250 tokens limit of
+ * Tokenize_String and at the borders of the 32 byte blocks.
+ */
+extern void TEST_Tokenize_String_Into_Buffer (void)
+{
+    // 300 tokens with a growing length ("a", "ab", "abc", ...) and a growing number of delimiters between them
+    const char* const delimiter_chars = " \t\r";
+    const size_t number_of_tokens = 300;
+    char test_str [20000];
+    size_t test_str_length = 0;
+    size_t expected_pos [300];
+    size_t expected_len [300];
+
+    for (size_t i = 0; i < number_of_tokens; ++ i)
+    {
+        for (size_t i2 = 0; i2 < (i % 4) + 1; ++ i2)
+        {
+            test_str [test_str_length ++] = delimiter_chars [(i + i2) % 3];
+        }
+        expected_pos [i] = test_str_length;
+        expected_len [i] = (i % 37) + 1;
+        for (size_t i2 = 0; i2 < expected_len [i]; ++ i2)
+        {
+            test_str [test_str_length ++] = (char) ('a' + (i2 % 26));
+        }
+    }
+
+    struct Delimiter_Set delimiter_set;
+    Init_Delimiter_Set(&delimiter_set, delimiter_chars);
+    struct Token_Position_Buffer buffer = { NULL, 0, 0 };
+
+    // Every prefix of the string: the last token ends at every possible position in a block
+    _Bool test_results = true;
+    for (size_t length = 0; length <= test_str_length && test_results; ++ length)
+    {
+        Tokenize_String_Into_Buffer(test_str, length, &delimiter_set, &buffer);
+
+        size_t expected_tokens = 0;
+        for (size_t i = 0; i < number_of_tokens && expected_pos [i] < length; ++ i)
+        {
+            const size_t expected_token_len = MIN(expected_len [i], length - expected_pos [i]);
+            if (buffer.next_free_element <= i || buffer.data [i].pos != expected_pos [i] ||
+                    buffer.data [i].len != expected_token_len)
+            {
+                printf ("Token %zu in the first %zu chars not equal !\n", i, length);
+                test_results = false;
+                break;
+            }
+            ++ expected_tokens;
+        }
+        if (test_results && buffer.next_free_element != expected_tokens)
+        {
+            printf ("Expected %zu tokens in the first %zu chars; Got: %zu\n", expected_tokens, length,
+                    buffer.next_free_element);
+            test_results = false;
+        }
+    }
+    ASSERT_EQUALS(true, test_results);
+    ASSERT_EQUALS(number_of_tokens, buffer.next_free_element);
+
+    Free_Token_Position_Buffer(&buffer);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the JSON_Writer creates the same output as cJSON_PrintBuffered (formatted and unformatted).
+ */
+extern void TEST_JSON_Writer_Equal_With_cJSON_Print (void)
+{
+    const char* const tokens [] = { "human", "\"quoted\"", "tab\tand\\", "ctrl\x01", "M\xc3\xa4rz" };
+    const unsigned int offsets [] = { 0, 17, 255, 65535, 4 };
+
+    _Bool test_results = true;
+
+    for (int format = 0; format <= 1; ++ format)
+    {
+        // Reference: cJSON structure
+        cJSON* root = cJSON_CreateObject();
+        cJSON* outer = cJSON_CreateObject();
+        cJSON* partial = cJSON_CreateObject();
+        cJSON* hit = cJSON_CreateObject();
+        cJSON* token_array = cJSON_CreateArray();
+        cJSON* offset_array = cJSON_CreateArray();
+        for (size_t i = 0; i < (sizeof (tokens) / sizeof (tokens [0])); ++ i)
+        {
+            cJSON_AddItemToArray(token_array, cJSON_CreateString(tokens [i]));
+            cJSON_AddItemToArray(offset_array, cJSON_CreateNumber(offsets [i]));
+        }
+        cJSON_AddItemToObject(hit, "tokens", token_array);
+        cJSON_AddItemToObject(hit, "char offs.", offset_array);
+        cJSON_AddItemToObject(partial, "12345", hit);
+        cJSON_AddItemToObject(outer, "tokens", cJSON_CreateArray());
+        cJSON_AddItemToObject(outer, "Inters. (partial)", partial);
+        cJSON_AddItemToObject(outer, "Inters. (full)", cJSON_CreateObject());
+        cJSON_AddItemToObject(root, "name_syn_0", outer);
+
+        char* cJSON_str = cJSON_PrintBuffered(root, 100, format);
+        cJSON_Delete(root);
+        root = NULL;
+
+        // Same structure with the JSON_Writer; the partial matches will be created in a separate writer
+        struct JSON_Writer* writer = JSONWriter_CreateObject((_Bool) format);
+        struct JSON_Writer* members = JSONWriter_CreateObject((_Bool) format);
+        JSONWriter_Reset(members, 3);
+        JSONWriter_AddKey(members, "12345");
+        JSONWriter_BeginObject(members);
+        JSONWriter_AddKey(members, "tokens");
+        JSONWriter_BeginArray(members);
+        for (size_t i = 0; i < (sizeof (tokens) / sizeof (tokens [0])); ++ i)
+        {
+            JSONWriter_AddString(members, tokens [i], strlen (tokens [i]));
+        }
+        JSONWriter_EndArray(members);
+        JSONWriter_AddKey(members, "char offs.");
+        JSONWriter_BeginArray(members);
+        for (size_t i = 0; i < (sizeof (offsets) / sizeof (offsets [0])); ++ i)
+        {
+            JSONWriter_AddUInt(members, offsets [i]);
+        }
+        JSONWriter_EndArray(members);
+        JSONWriter_EndObject(members);
+
+        JSONWriter_BeginObject(writer);
+        JSONWriter_AddKey(writer, "name_syn_0");
+        JSONWriter_BeginObject(writer);
+        JSONWriter_AddKey(writer, "tokens");
+        JSONWriter_BeginArray(writer);
+        JSONWriter_EndArray(writer);
+        JSONWriter_AddKey(writer, "Inters. (partial)");
+        JSONWriter_BeginObject(writer);
+        JSONWriter_AppendMembers(writer, members);
+        JSONWriter_EndObject(writer);
+        JSONWriter_AddKey(writer, "Inters. (full)");
+        JSONWriter_BeginObject(writer);
+        JSONWriter_EndObject(writer);
+        JSONWriter_EndObject(writer);
+        JSONWriter_EndObject(writer);
+
+        printf ("Expected: \"%s\"\nGot:      \"%.*s\"\n", cJSON_str, (int) writer->used_bytes, writer->data);
+        if (cJSON_str == NULL || strlen (cJSON_str) != writer->used_bytes ||
+                strncmp(cJSON_str, writer->data, writer->used_bytes) != 0)
+        {
+            test_results = false;
+        }
+
+        // Don't use the macro "FREE_AND_SET_TO_NULL" because it increases the free counter. But this memory was
+        // allocated from the JSON lib !
+        free(cJSON_str);
+        cJSON_str = NULL;
+        JSONWriter_DeleteObject(writer);
+        writer = NULL;
+        JSONWriter_DeleteObject(members);
+        members = NULL;
+    }
+    ASSERT_EQUALS(true, test_results);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether pre-escaped strings (fragments) create the same output as the direct escaping of the strings.
+ */
+extern void TEST_JSON_Writer_Escaped_String_Equal_With_String (void)
+{
+    const char* const tokens [] = { "human", "\"quoted\"", "tab\tand\\", "ctrl\x01", "M\xc3\xa4rz" };
+
+    _Bool test_results = true;
+
+    for (int format = 0; format <= 1; ++ format)
+    {
+        // The fragment buffer has no container -> The strings will be written without separators
+        struct JSON_Writer* fragments = JSONWriter_CreateObject(false);
+        size_t fragment_offsets [COUNT_ARRAY_ELEMENTS(tokens) + 1];
+        for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(tokens); ++ i)
+        {
+            fragment_offsets [i] = fragments->used_bytes;
+            JSONWriter_AddString(fragments, tokens [i], strlen (tokens [i]));
+        }
+        fragment_offsets [COUNT_ARRAY_ELEMENTS(tokens)] = fragments->used_bytes;
+
+        struct JSON_Writer* expected = JSONWriter_CreateObject((_Bool) format);
+        struct JSON_Writer* result = JSONWriter_CreateObject((_Bool) format);
+        JSONWriter_BeginObject(expected);
+        JSONWriter_AddKey(expected, "tokens");
+        JSONWriter_BeginArray(expected);
+        JSONWriter_BeginObject(result);
+        JSONWriter_AddKey(result, "tokens");
+        JSONWriter_BeginArray(result);
+        for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(tokens); ++ i)
+        {
+            JSONWriter_AddString(expected, tokens [i], strlen (tokens [i]));
+            JSONWriter_AddEscapedString(result, fragments->data + fragment_offsets [i],
+                    fragment_offsets [i + 1] - fragment_offsets [i]);
+        }
+        JSONWriter_EndArray(expected);
+        JSONWriter_EndObject(expected);
+        JSONWriter_EndArray(result);
+        JSONWriter_EndObject(result);
+
+        printf ("Expected: \"%.*s\"\nGot:      \"%.*s\"\n", (int) expected->used_bytes, expected->data,
+                (int) result->used_bytes, result->data);
+        if (expected->used_bytes != result->used_bytes ||
+                strncmp(expected->data, result->data, expected->used_bytes) != 0)
+        {
+            test_results = false;
+        }
+
+        JSONWriter_DeleteObject(fragments);
+        fragments = NULL;
+        JSONWriter_DeleteObject(expected);
+        expected = NULL;
+        JSONWriter_DeleteObject(result);
+        result = NULL;
+    }
+    ASSERT_EQUALS(true, test_results);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the Async_File_Writer writes the data (more data than the ring of buffers can hold) in the
+ * correct order and whether the preallocated file will be truncated to the written size.
+ */
+extern void TEST_Async_File_Writer (void)
+{
+    const char* const file_name = "./out_async.bin";
+    // Odd chunk size -> The chunks overlap the buffer borders
+    const size_t chunk_size = 4099;
+    const size_t number_of_chunks = ((ASYNC_FILE_WRITER_NUMBER_OF_BUFFERS + 2) * ASYNC_FILE_WRITER_BUFFER_SIZE) /
+            chunk_size;
+    unsigned char chunk [4099];
+
+    struct Async_File_Writer* writer = AsyncFileWriter_CreateObject(file_name,
+            (uint_fast64_t) (2 * number_of_chunks * chunk_size), false);
+    for (size_t i = 0; i < number_of_chunks; ++ i)
+    {
+        for (size_t i2 = 0; i2 < chunk_size; ++ i2)
+        {
+            chunk [i2] = (unsigned char) ((i + i2) & 0xFF);
+        }
+        AsyncFileWriter_Write(writer, chunk, chunk_size);
+    }
+    AsyncFileWriter_DeleteObject(writer);
+    writer = NULL;
+
+    // Read the file and compare the content with the written pattern
+    _Bool test_results = true;
+    size_t read_bytes = 0;
+    FILE* file = fopen(file_name, "rb");
+    ASSERT_FMSG(file != NULL, "Cannot open the file \"%s\" !", file_name);
+    for (size_t i = 0; i < number_of_chunks && test_results; ++ i)
+    {
+        const size_t chunk_bytes = fread(chunk, sizeof (unsigned char), chunk_size, file);
+        read_bytes += chunk_bytes;
+        for (size_t i2 = 0; i2 < chunk_bytes; ++ i2)
+        {
+            if (chunk [i2] != (unsigned char) ((i + i2) & 0xFF))
+            {
+                test_results = false;
+                break;
+            }
+        }
+    }
+    // No additional bytes (e.g. from the preallocation) in the file ?
+    read_bytes += fread(chunk, sizeof (unsigned char), chunk_size, file);
+    FCLOSE_AND_SET_TO_NULL(file);
+    remove(file_name);
+
+    printf ("Written bytes: %zu; Read bytes: %zu\n", number_of_chunks * chunk_size, read_bytes);
+    ASSERT_EQUALS(true, test_results);
+    ASSERT_EQUALS(number_of_chunks * chunk_size, read_bytes);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the lines of a gzip compressed Async_File_Writer file can be read with Compressed_Input. (Also a
+ * line, that is longer than a block of the decompression)
+ */
+extern void TEST_Compressed_Output_Read_Line_By_Line (void)
+{
+#ifdef HAVE_ZLIB
+    const char* const file_name = "./out_async.gz";
+    const size_t number_of_lines = 200000;
+    // Line in the middle of the file, that is longer than a block -> The block needs to grow
+    const size_t long_line_index = number_of_lines / 2;
+    const size_t long_line_length = 3 * COMPRESSED_INPUT_BLOCK_SIZE + 17;
+    char line_buffer [64];
+
+    char* long_line = (char*) MALLOC(long_line_length + 1);
+    ASSERT_ALLOC(long_line, "Cannot allocate memory for the long line !", long_line_length + 1);
+    for (size_t i = 0; i < long_line_length; ++ i)
+    {
+        long_line [i] = (char) ('a' + (i % 26));
+    }
+    long_line [long_line_length] = '\n';
+
+    struct Async_File_Writer* writer = AsyncFileWriter_CreateObject(file_name, 0, true);
+    for (size_t i = 0; i < number_of_lines; ++ i)
+    {
+        if (i == long_line_index)
+        {
+            AsyncFileWriter_Write(writer, long_line, long_line_length + 1);
+        }
+        else
+        {
+            // The last line without a newline char
+            const int line_length = snprintf(line_buffer, sizeof (line_buffer), "Line %zu%s", i,
+                    (i + 1 < number_of_lines) ? "\n" : "");
+            AsyncFileWriter_Write(writer, line_buffer, (size_t) line_length);
+        }
+    }
+    AsyncFileWriter_DeleteObject(writer);
+    writer = NULL;
+
+    struct Mapped_File* compressed_file = MappedFile_CreateObject(file_name);
+    const enum Compression_Format format = CompressedInput_DetectFormat(compressed_file->data, compressed_file->size);
+    ASSERT_EQUALS(COMPRESSION_GZIP, format);
+    struct Compressed_Input* input = CompressedInput_CreateObject(compressed_file, format, file_name);
+
+    _Bool test_results = true;
+    size_t read_lines = 0;
+    struct Line_View line;
+    while (CompressedInput_NextLine(input, &line))
+    {
+        if (read_lines == long_line_index)
+        {
+            test_results = line.length == long_line_length && memcmp(line.data, long_line, long_line_length) == 0;
+        }
+        else
+        {
+            const int line_length = snprintf(line_buffer, sizeof (line_buffer), "Line %zu", read_lines);
+            test_results = line.length == (size_t) line_length && memcmp(line.data, line_buffer, line.length) == 0;
+        }
+        if (! test_results) { break; }
+        ++ read_lines;
+    }
+
+    CompressedInput_DeleteObject(input);
+    input = NULL;
+    MappedFile_DeleteObject(compressed_file);
+    compressed_file = NULL;
+    remove(file_name);
+    FREE_AND_SET_TO_NULL(long_line);
+
+    printf ("Written lines: %zu; Read lines: %zu\n", number_of_lines, read_lines);
+    ASSERT_EQUALS(true, test_results);
+    ASSERT_EQUALS(number_of_lines, read_lines);
+#else
+    puts("Skipped: The program was built without zlib.");
+#endif /* HAVE_ZLIB */
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the stop word table finds every stop word (also in upper case) and no other words. The same
+ * checks with a table, that was created at runtime.
+ */
+extern void TEST_Stop_Word_Table (void)
+{
+    const char* const no_stop_words [] = { "protein", "gene", "ABOUTT", "abou", "THEM2", "receptor", "x-ray" };
+    const char* const runtime_words [] = { "Alpha", "beta", "GAMMA", "alpha", "" };
+
+    _Bool test_results = true;
+    size_t number_of_stop_words = 0;
+    char upper_case_word [STOP_WORD_HASH_MAX_WORD_LENGTH];
+
+    for (const char** stop_word = GLOBAL_eng_stop_words; *stop_word != NULL; ++ stop_word)
+    {
+        const size_t word_length = strlen(*stop_word);
+        for (size_t i = 0; i < word_length; ++ i)
+        {
+            const char c = (*stop_word) [i];
+            upper_case_word [i] = (c >= 'a' && c <= 'z') ? (char) (c - 'a' + 'A') : c;
+        }
+        test_results &= Is_Word_In_Stop_Word_List(*stop_word, word_length, ENG);
+        test_results &= Is_Word_In_Stop_Word_List(upper_case_word, word_length, ENG);
+        if (! test_results)
+        {
+            printf ("Stop word \"%s\" not found !\n", *stop_word);
+            break;
+        }
+        ++ number_of_stop_words;
+    }
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(no_stop_words) && test_results; ++ i)
+    {
+        test_results = ! Is_Word_In_Stop_Word_List(no_stop_words [i], strlen(no_stop_words [i]), ENG);
+    }
+
+    // Duplicates (after the case folding) and empty words will not be saved
+    struct Stop_Word_Hash_Table* table = StopWordHash_CreateObject(runtime_words, COUNT_ARRAY_ELEMENTS(runtime_words));
+    ASSERT_EQUALS(3, table->number_of_words);
+    test_results &= StopWordHash_Contains(table, "alpha", strlen("alpha"));
+    test_results &= StopWordHash_Contains(table, "gamma", strlen("gamma"));
+    test_results &= ! StopWordHash_Contains(table, "delta", strlen("delta"));
+    test_results &= ! StopWordHash_Contains(table, "alph", strlen("alph"));
+    StopWordHash_DeleteObject(table);
+    table = NULL;
+
+    printf ("Checked stop words: %zu\n", number_of_stop_words);
+    ASSERT_EQUALS(true, test_results);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the token classifier determines the expected classes and whether its number classes agree with
+ * str2int() and str2double().
+ */
+extern void TEST_Token_Classifier (void)
+{
+    const struct
+    {
+        const char* token;
+        const enum Token_Class expected_class;
+    } test_cases [] =
+    {
+            { "protein",        TOKEN_CLASS_WORD },
+            { "infinite",       TOKEN_CLASS_WORD },
+            { "nano",           TOKEN_CLASS_WORD },
+            { "e5",             TOKEN_CLASS_WORD },
+            { "MIXED",          TOKEN_CLASS_WORD },
+            { "x",              TOKEN_CLASS_SINGLE_CHAR },
+            { "7",              TOKEN_CLASS_SINGLE_CHAR },
+            { "42",             TOKEN_CLASS_INTEGER },
+            { "-7",             TOKEN_CLASS_INTEGER },
+            { "1.5",            TOKEN_CLASS_DECIMAL },
+            { ".5",             TOKEN_CLASS_DECIMAL },
+            { "2.",             TOKEN_CLASS_DECIMAL },
+            { "+2.5E+10",       TOKEN_CLASS_DECIMAL },
+            { "1e-3",           TOKEN_CLASS_DECIMAL },
+            { "inf",            TOKEN_CLASS_DECIMAL },
+            { "-Infinity",      TOKEN_CLASS_DECIMAL },
+            { "NaN",            TOKEN_CLASS_DECIMAL },
+            { "nan(abc_1)",     TOKEN_CLASS_DECIMAL },
+            { "MIX",            TOKEN_CLASS_LATIN_NUMERAL },
+            { "XIV",            TOKEN_CLASS_LATIN_NUMERAL },
+            { "1e",             TOKEN_CLASS_NON_ALPHA_LEADING },
+            { "1.2.3",          TOKEN_CLASS_NON_ALPHA_LEADING },
+            { "-",              TOKEN_CLASS_SINGLE_CHAR },
+            { "--",             TOKEN_CLASS_NON_ALPHA_LEADING },
+            { "(nan)",          TOKEN_CLASS_NON_ALPHA_LEADING }
+    };
+
+    _Bool test_results = true;
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(test_cases); ++ i)
+    {
+        const char* const token = test_cases [i].token;
+        const enum Token_Class token_class = TokenClassifier_Classify(token, strlen(token));
+
+        // The number classes need to agree with the conversion functions
+        long int conversion_result_int = 0;
+        double conversion_result_double = 0.0;
+        const _Bool is_number = str2int(&conversion_result_int, token, 10) == STR2INT_SUCCESS ||
+                str2double(&conversion_result_double, token) == STR2DOUBLE_SUCCESS;
+
+        if (token_class != test_cases [i].expected_class || (strlen(token) > 1 &&
+                (token_class == TOKEN_CLASS_INTEGER || token_class == TOKEN_CLASS_DECIMAL) != is_number))
+        {
+            printf ("Token \"%s\": Class \"%s\"; expected \"%s\" !\n", token,
+                    TokenClassifier_GetClassName(token_class),
+                    TokenClassifier_GetClassName(test_cases [i].expected_class));
+            test_results = false;
+        }
+    }
+
+    ASSERT_EQUALS(true, test_results);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether u8_strnlen() counts the same chars as u8_strlen() - also with multi byte chars at the borders
+ * of the SIMD blocks and with cut chars at the end.
+ */
+extern void TEST_UTF8_Length_Equal_With_u8_strlen (void)
+{
+    const char* const parts [] =
+    {
+            "a", "protein", " ", "\xC3\xA4", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xCE\xB1-helix", "\xE2\x80\x93"
+    };
+    char text [256];
+    _Bool test_results = true;
+
+    // Texts of all lengths up to 200 bytes with a changing mix of ASCII and multi byte chars
+    for (size_t variant = 0; variant < 16; ++ variant)
+    {
+        size_t text_length = 0;
+        memset(text, '\0', sizeof (text));
+        for (size_t i = 0; text_length < 200; ++ i)
+        {
+            const char* const part = parts [(i * (variant + 1) + (i >> variant)) % COUNT_ARRAY_ELEMENTS(parts)];
+            memcpy(text + text_length, part, strlen(part));
+            text_length += strlen(part);
+        }
+
+        for (size_t length = 0; length <= text_length; ++ length)
+        {
+            // u8_strlen() reads behind the terminator, if it follows a char; the token memory is filled with zeros, too
+            char prefix [sizeof (text)];
+            memset(prefix, '\0', sizeof (prefix));
+            memcpy(prefix, text, length);
+
+            const size_t expected = (size_t) u8_strlen(prefix);
+            const size_t result = u8_strnlen(prefix, length);
+            if (result != expected)
+            {
+                printf ("Variant %zu, length %zu: %zu chars; expected %zu !\n", variant, length, result, expected);
+                test_results = false;
+            }
+        }
+    }
+
+    // A continuation byte at the begin is one char - like in u8_strlen()
+    test_results = test_results && u8_strnlen("\x82\xAC", 2) == (size_t) u8_strlen((char*) "\x82\xAC");
+
+    ASSERT_EQUALS(true, test_results);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
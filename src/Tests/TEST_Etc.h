@@ -38,6 +38,52 @@ extern void TEST_ANSI_Esc_Seq (void);
  */
 extern void TEST_Tokenize_String (void);
 
+/**
+ * @brief Test, whether the Tokenize_String_Into_Buffer function finds all tokens - also behind the 250 tokens limit of
+ * Tokenize_String and at the borders of the 32 byte blocks.
+ */
+extern void TEST_Tokenize_String_Into_Buffer (void);
+
+/**
+ * @brief Test, whether the JSON_Writer creates the same output as cJSON_PrintBuffered (formatted and unformatted).
+ */
+extern void TEST_JSON_Writer_Equal_With_cJSON_Print (void);
+
+/**
+ * @brief Test, whether pre-escaped strings (fragments) create the same output as the direct escaping of the strings.
+ */
+extern void TEST_JSON_Writer_Escaped_String_Equal_With_String (void);
+
+/**
+ * @brief Test, whether the Async_File_Writer writes the data (more data than the ring of buffers can hold) in the
+ * correct order and whether the preallocated file will be truncated to the written size.
+ */
+extern void TEST_Async_File_Writer (void);
+
+/**
+ * @brief Test, whether the lines of a gzip compressed Async_File_Writer file can be read with Compressed_Input. (Also a
+ * line, that is longer than a block of the decompression)
+ */
+extern void TEST_Compressed_Output_Read_Line_By_Line (void);
+
+/**
+ * @brief Test, whether the stop word table finds every stop word (also in upper case) and no other words. The same
+ * checks with a table, that was created at runtime.
+ */
+extern void TEST_Stop_Word_Table (void);
+
+/**
+ * @brief Test, whether the token classifier determines the expected classes and whether its number classes agree with
+ * str2int() and str2double().
+ */
+extern void TEST_Token_Classifier (void);
+
+/**
+ * @brief Test, whether u8_strnlen() counts the same chars as u8_strlen() - also with multi byte chars at the borders
+ * of the SIMD blocks and with cut chars at the end.
+ */
+extern void TEST_UTF8_Length_Equal_With_u8_strlen (void);
+
 
 
 #ifdef __cplusplus
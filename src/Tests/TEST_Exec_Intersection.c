@@ -19,10 +19,16 @@
 #include <math.h>
 #include "../Error_Handling/_Generics.h"
 #include "../Error_Handling/Assert_Msg.h"
+#include "../Error_Handling/Dynamic_Memory.h"
 #include "../Exec_Intersection.h"
 #include "tinytest.h"
 #include "../CLI_Parameter.h"
+#include "../Result_Export.h"
+#include "../Corpus_File.h"
+#include "../Misc.h"
+#include "../Stop_Words/Stop_Words.h"
 #include "md5.h"
+#include <string.h>
 
 
 
@@ -50,6 +56,54 @@
 #error "The macro \"OUT_FILE\" is already defined !"
 #endif /* OUT_FILE */
 
+#ifndef OUT_FILE_BINARY
+#define OUT_FILE_BINARY "./out.bin"
+#else
+#error "The macro \"OUT_FILE_BINARY\" is already defined !"
+#endif /* OUT_FILE_BINARY */
+
+#ifndef OUT_FILE_CONVERTED
+#define OUT_FILE_CONVERTED "./out_converted.json"
+#else
+#error "The macro \"OUT_FILE_CONVERTED\" is already defined !"
+#endif /* OUT_FILE_CONVERTED */
+
+#ifndef BATCH_FILE
+#define BATCH_FILE "./batch_jobs.txt" ///< Job list for the batch mode test
+#else
+#error "The macro \"BATCH_FILE\" is already defined !"
+#endif /* BATCH_FILE */
+
+#ifndef OUT_FILE_BATCH_1
+#define OUT_FILE_BATCH_1 "./out_batch_1.json"
+#else
+#error "The macro \"OUT_FILE_BATCH_1\" is already defined !"
+#endif /* OUT_FILE_BATCH_1 */
+
+#ifndef OUT_FILE_BATCH_2
+#define OUT_FILE_BATCH_2 "./out_batch_2.json"
+#else
+#error "The macro \"OUT_FILE_BATCH_2\" is already defined !"
+#endif /* OUT_FILE_BATCH_2 */
+
+#ifndef CORPUS_FILE
+#define CORPUS_FILE "./test_corpus.bin" ///< Compiled corpus file of FILE_1
+#else
+#error "The macro \"CORPUS_FILE\" is already defined !"
+#endif /* CORPUS_FILE */
+
+#ifndef STOP_WORD_FILE
+#define STOP_WORD_FILE "./test_stop_words.txt" ///< Own stop word list for the Load_Stop_Word_Files() test
+#else
+#error "The macro \"STOP_WORD_FILE\" is already defined !"
+#endif /* STOP_WORD_FILE */
+
+#ifndef OUT_FILE_CORPUS
+#define OUT_FILE_CORPUS "./out_corpus.json"
+#else
+#error "The macro \"OUT_FILE_CORPUS\" is already defined !"
+#endif /* OUT_FILE_CORPUS */
+
 #ifndef TEST_EBM_FILE_MD5
 #define TEST_EBM_FILE_MD5 "d1205477fc08c6e278d905edfdd537fb"
 #else
@@ -85,6 +139,8 @@ _Static_assert(sizeof(FILE_1) > 0 + 1, "The macro \"FILE_1\" needs at least one
 _Static_assert(sizeof(FILE_2) > 0 + 1, "The macro \"FILE_2\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(FILE_CSV) > 0 + 1, "The macro \"FILE_CSV\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(OUT_FILE) > 0 + 1, "The macro \"OUT_FILE\" needs at least one char (plus '\0') !");
+_Static_assert(sizeof(OUT_FILE_BINARY) > 0 + 1, "The macro \"OUT_FILE_BINARY\" needs at least one char (plus '\0') !");
+_Static_assert(sizeof(OUT_FILE_CONVERTED) > 0 + 1, "The macro \"OUT_FILE_CONVERTED\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(TEST_EBM_FILE_MD5) > 0 + 1, "The macro \"TEST_EBM_FILE_MD5\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(INTERVENTION_10MB_FILE_MD5) > 0 + 1, "The macro \"INTERVENTION_10MB_FILE_MD5\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(GENE_OR_GENOME_FILE_MD5) > 0 + 1, "The macro \"GENE_OR_GENOME_FILE_MD5\" needs at least one char (plus '\0') !");
@@ -95,6 +151,13 @@ IS_CONST_STR(FILE_1)
 IS_CONST_STR(FILE_2)
 IS_CONST_STR(FILE_CSV)
 IS_CONST_STR(OUT_FILE)
+IS_CONST_STR(OUT_FILE_BINARY)
+IS_CONST_STR(OUT_FILE_CONVERTED)
+IS_CONST_STR(BATCH_FILE)
+IS_CONST_STR(OUT_FILE_BATCH_1)
+IS_CONST_STR(OUT_FILE_BATCH_2)
+IS_CONST_STR(CORPUS_FILE)
+IS_CONST_STR(OUT_FILE_CORPUS)
 IS_CONST_STR(TEST_EBM_FILE_MD5)
 IS_CONST_STR(INTERVENTION_10MB_FILE_MD5)
 IS_CONST_STR(GENE_OR_GENOME_FILE_MD5)
@@ -104,6 +167,64 @@ IS_TYPE(EXPECTED_COUNT_INTERSECTIONS_SETS, int)
 
 
 
+/**
+ * @brief Compare two result files line by line. The creation time will be ignored, because the two calculations were
+ * done at different times.
+ *
+ * Asserts:
+ *      file_name_1 != NULL
+ *      file_name_2 != NULL
+ *      Both files can be opened
+ *
+ * @param[in] file_name_1 Name of the first result file
+ * @param[in] file_name_2 Name of the second result file
+ *
+ * @return true, if the files are equal (except the creation time), otherwise false
+ */
+static _Bool
+Result_Files_Equal
+(
+        const char* const file_name_1,
+        const char* const file_name_2
+);
+
+/**
+ * @brief Search a string line by line in a (formatted) result file.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      search_string != NULL
+ *      The file can be opened
+ *
+ * @param[in] file_name Name of the result file
+ * @param[in] search_string String, that will be searched
+ *
+ * @return true, if a line contains the string, otherwise false
+ */
+static _Bool
+Result_File_Contains_String
+(
+        const char* const file_name,
+        const char* const search_string
+);
+
+/**
+ * @brief Compare a compiled corpus file, that contains FILE_1 and FILE_CSV, with the encoding of the two input files
+ * with one mapping. (The same order of the data sets and the same mapping integers are expected)
+ *
+ * Asserts:
+ *      corpus_file != NULL
+ *
+ * @param[in] corpus_file Name of the corpus file
+ *
+ * @return true, if vocabulary, mapped tokens, offsets and data set IDs are equal, otherwise false
+ */
+static _Bool
+Corpus_Equal_With_Input_Files
+(
+        const char* const corpus_file
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -293,6 +414,36 @@ extern void TEST_Number_Of_Tokens_Equal_With_Switched_Input_Files_JSON_And_CSV (
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Test, whether the count only mode finds the same number of tokens and sets as the normal mode.
+ */
+extern void TEST_Number_Of_Tokens_And_Sets_Found_In_Count_Only_Mode (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    uint_fast64_t number_of_intersection_tokens = 0;
+    uint_fast64_t number_of_intersection_sets = 0;
+
+    // Adjust the CLI parameter to make the test runnable
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_2;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+    // Keep results with one token, because the expected value shows all results !
+    GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN = true;
+    GLOBAL_CLI_COUNTS_ONLY = true;
+
+    Exec_Intersection(NAN, &number_of_intersection_tokens, &number_of_intersection_sets);
+
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(number_of_intersection_tokens, EXPECTED_COUNT_INTERSECTIONS_TOKENS);
+    ASSERT_EQUALS(number_of_intersection_sets, EXPECTED_COUNT_INTERSECTIONS_SETS);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Check, whether the number of sets is equal with switched input files.
  *
@@ -327,6 +478,820 @@ extern void TEST_Number_Of_Sets_Equal_With_Switched_Input_Files_JSON_And_CSV (vo
     return;
 }
 
+/**
+ * @brief Check, whether a binary result file, that was converted to JSON, is equal with the direct JSON result file.
+ *
+ * The creation time will be ignored, because the two calculations were done at different times.
+ */
+extern void TEST_Binary_Result_File_Equal_With_JSON_Result_File (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    // Adjust the CLI parameter to make the test runnable
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_2;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+    GLOBAL_CLI_FORMAT_OUTPUT = true;
+    GLOBAL_CLI_SENTENCE_OFFSET = true;
+    GLOBAL_CLI_WORD_OFFSET = true;
+
+    // Only a part of the calculation is necessary to compare the formats
+    Exec_Intersection(10.0f, NULL, NULL);
+
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE_BINARY;
+    GLOBAL_CLI_OUTPUT_FORMAT = "binary";
+    Exec_Intersection(10.0f, NULL, NULL);
+
+    ResultExport_ConvertBinaryToJSON(OUT_FILE_BINARY, OUT_FILE_CONVERTED, true);
+    Set_CLI_Parameter_To_Default_Values();
+
+    const _Bool files_equal = Result_Files_Equal(OUT_FILE, OUT_FILE_CONVERTED);
+
+    remove(OUT_FILE_BINARY);
+    remove(OUT_FILE_CONVERTED);
+
+    ASSERT_EQUALS(true, files_equal);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the batch mode creates the same result files as single calculations with the same files.
+ *
+ * The first input file will be read only once in the batch mode; the mapping of the second job contains also the
+ * tokens of the first job. This must not change the results.
+ */
+extern void TEST_Batch_Mode_Equal_With_Single_Runs (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    uint_fast64_t number_of_intersection_tokens_single = 0;
+    uint_fast64_t number_of_intersection_tokens_batch = 0;
+
+    FILE* batch_file = fopen(BATCH_FILE, "w");
+    ASSERT_FMSG(batch_file != NULL, "Cannot create the file \"%s\" !", BATCH_FILE);
+    fprintf(batch_file, "# Query file   Output file\n%s %s\n\n%s\t%s\n", FILE_CSV, OUT_FILE_BATCH_1, FILE_2,
+            OUT_FILE_BATCH_2);
+    FCLOSE_AND_SET_TO_NULL(batch_file);
+
+    // Adjust the CLI parameter to make the test runnable
+    // Only a part of the calculation is necessary to compare the result files
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_BATCH_FILE = BATCH_FILE;
+    Exec_Intersection(10.0f, &number_of_intersection_tokens_batch, NULL);
+    GLOBAL_CLI_BATCH_FILE = NULL;
+
+    const char* query_files [] = { FILE_CSV, FILE_2 };
+    const char* batch_output_files [] = { OUT_FILE_BATCH_1, OUT_FILE_BATCH_2 };
+    _Bool files_equal = true;
+    for (size_t i = 0; i < sizeof (query_files) / sizeof (query_files [0]); ++ i)
+    {
+        uint_fast64_t number_of_intersection_tokens = 0;
+        GLOBAL_CLI_INPUT_FILE2 = query_files [i];
+        GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+        Exec_Intersection(10.0f, &number_of_intersection_tokens, NULL);
+        number_of_intersection_tokens_single += number_of_intersection_tokens;
+
+        files_equal = files_equal && Result_Files_Equal(OUT_FILE, batch_output_files [i]);
+        remove(batch_output_files [i]);
+    }
+    remove(BATCH_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(true, files_equal);
+    ASSERT_EQUALS(number_of_intersection_tokens_single, number_of_intersection_tokens_batch);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether a compiled corpus file as first input file creates the same result file as the original file.
+ *
+ * The first file name in the header is on the line with the creation time; so this difference will be ignored.
+ */
+extern void TEST_Compiled_Corpus_Equal_With_Input_File (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    uint_fast64_t number_of_intersection_tokens_input_file = 0;
+    uint_fast64_t number_of_intersection_tokens_corpus_file = 0;
+
+    CorpusFile_Compile(FILE_1, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS, true);
+
+    // Adjust the CLI parameter to make the test runnable
+    // Only a part of the calculation is necessary to compare the result files
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_CSV;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+    Exec_Intersection(10.0f, &number_of_intersection_tokens_input_file, NULL);
+
+    GLOBAL_CLI_INPUT_FILE = CORPUS_FILE;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE_CORPUS;
+    Exec_Intersection(10.0f, &number_of_intersection_tokens_corpus_file, NULL);
+
+    const _Bool files_equal = Result_Files_Equal(OUT_FILE, OUT_FILE_CORPUS);
+    remove(OUT_FILE_CORPUS);
+    remove(CORPUS_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(true, files_equal);
+    ASSERT_EQUALS(number_of_intersection_tokens_input_file, number_of_intersection_tokens_corpus_file);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether a compiled corpus file with an appended input file contains the same data as the encoding of
+ * both input files. The same check after the compaction of the corpus file.
+ */
+extern void TEST_Appended_Corpus_Equal_With_Input_Files (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    CorpusFile_Compile(FILE_1, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS, false);
+    CorpusFile_Append(FILE_CSV, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS);
+    const _Bool appended_corpus_equal = Corpus_Equal_With_Input_Files(CORPUS_FILE);
+
+    CorpusFile_Compact(CORPUS_FILE, JSON_TOKEN_ARRAY_TOKENS);
+    const _Bool compacted_corpus_equal = Corpus_Equal_With_Input_Files(CORPUS_FILE);
+
+    remove(CORPUS_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(true, appended_corpus_equal);
+    ASSERT_EQUALS(true, compacted_corpus_equal);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether a compiled corpus file saves the encoded JSON array in the header: A file with lemmas keeps the
+ * setting after an append and a compaction and contains the same data (also the surface forms) as the encoding of
+ * the lemmas.
+ */
+extern void TEST_Corpus_File_Saves_The_Token_Array (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    CorpusFile_Compile(FILE_1, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS, false);
+    struct Token_Int_Mapping* corpus_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* corpus = CorpusFile_Load(CORPUS_FILE, corpus_mapping, JSON_TOKEN_ARRAY_TOKENS);
+    const uint64_t token_array_tokens =
+            ((const struct Corpus_File_Header*) corpus->corpus_file->data)->token_array;
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(corpus_mapping);
+    corpus_mapping = NULL;
+
+    // FILE_2 contains lemmas
+    CorpusFile_Compile(FILE_2, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_LEMMA, false);
+    CorpusFile_Append(FILE_2, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_LEMMA);
+    CorpusFile_Compact(CORPUS_FILE, JSON_TOKEN_ARRAY_LEMMA);
+    corpus_mapping = TokenIntMapping_CreateObject();
+    corpus = EncodedCorpus_CreateObject(CORPUS_FILE, corpus_mapping, 1, JSON_PARSER_STREAMING, NULL,
+            ENCODING_MATCH_ON_LEMMA);
+    const uint64_t token_array_lemma = ((const struct Corpus_File_Header*) corpus->corpus_file->data)->token_array;
+
+    struct Token_Int_Mapping* lemma_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* lemma_corpus = EncodedCorpus_CreateObject(FILE_2, lemma_mapping, 1, JSON_PARSER_STREAMING,
+            NULL, ENCODING_MATCH_ON_LEMMA);
+
+    // The appended file adds the same data sets again, but no new token
+    const _Bool lemma_corpus_equal = corpus->number_of_tokens == 2 * lemma_corpus->number_of_tokens &&
+            corpus->token_ints->next_free_array == 2 * lemma_corpus->token_ints->next_free_array &&
+            corpus->tokens_added_to_mapping == lemma_corpus->tokens_added_to_mapping;
+    // The file contains also the surface forms for the output; both mappings were built in the same order
+    _Bool surface_tokens_equal = lemma_corpus_equal && corpus->surface_token_ints != NULL &&
+            lemma_corpus->surface_token_ints != NULL;
+    for (uint_fast32_t i = 0; surface_tokens_equal && i < corpus->surface_token_ints->next_free_array; ++ i)
+    {
+        const uint_fast32_t lemma_data_set = i % lemma_corpus->surface_token_ints->next_free_array;
+        surface_tokens_equal = corpus->surface_token_ints->arrays_lengths [i] ==
+                lemma_corpus->surface_token_ints->arrays_lengths [lemma_data_set] &&
+                memcmp(corpus->surface_token_ints->data_struct.data [i],
+                lemma_corpus->surface_token_ints->data_struct.data [lemma_data_set],
+                corpus->surface_token_ints->arrays_lengths [i] * sizeof (uint_fast32_t)) == 0;
+    }
+
+    EncodedCorpus_DeleteObject(lemma_corpus);
+    lemma_corpus = NULL;
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(lemma_mapping);
+    lemma_mapping = NULL;
+    TokenIntMapping_DeleteObject(corpus_mapping);
+    corpus_mapping = NULL;
+    remove(CORPUS_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(JSON_TOKEN_ARRAY_TOKENS, token_array_tokens);
+    ASSERT_EQUALS(JSON_TOKEN_ARRAY_LEMMA, token_array_lemma);
+    ASSERT_EQUALS(true, lemma_corpus_equal);
+    ASSERT_EQUALS(true, surface_tokens_equal);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the dynamic stop words: After the removal no data set contains a too frequent token and no token was
+ * lost. A max. document frequency of 1.0 removes nothing; a lower value finds less intersection tokens.
+ */
+extern void TEST_Dynamic_Stop_Words_Removed_From_Corpus (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    struct Token_Int_Mapping* mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* corpus = EncodedCorpus_CreateObject(FILE_1, mapping, 1, JSON_PARSER_STREAMING, NULL,
+            ENCODING_DEFAULT);
+    const uint_fast64_t tokens_before_removal = corpus->number_of_tokens;
+
+    size_t table_size = 0;
+    uint_fast32_t number_of_frequent_tokens = 0;
+    _Bool* frequent_tokens = EncodedCorpus_DetermineFrequentTokens(corpus, 0.2f, &table_size,
+            &number_of_frequent_tokens);
+    const uint_fast64_t removed_tokens = EncodedCorpus_RemoveTokens(corpus, frequent_tokens, table_size);
+
+    _Bool frequent_token_left = false;
+    for (uint_fast32_t i = 0; i < corpus->token_ints->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < corpus->token_ints->arrays_lengths [i]; ++ i2)
+        {
+            frequent_token_left |= frequent_tokens [corpus->token_ints->data_struct.data [i][i2]];
+        }
+    }
+    const uint_fast64_t tokens_after_removal = corpus->number_of_tokens;
+
+    FREE_AND_SET_TO_NULL(frequent_tokens);
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(mapping);
+    mapping = NULL;
+
+    uint_fast64_t intersection_tokens_without_max_df = 0;
+    uint_fast64_t intersection_tokens_max_df_1 = 0;
+    uint_fast64_t intersection_tokens_max_df_0_2 = 0;
+
+    // Only a part of the calculation is necessary to compare the number of tokens
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_CSV;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+    Exec_Intersection(10.0f, &intersection_tokens_without_max_df, NULL);
+    GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY = true;
+    GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY = 1.0f;
+    Exec_Intersection(10.0f, &intersection_tokens_max_df_1, NULL);
+    GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY = 0.2f;
+    Exec_Intersection(10.0f, &intersection_tokens_max_df_0_2, NULL);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(true, number_of_frequent_tokens > 0);
+    ASSERT_EQUALS(false, frequent_token_left);
+    ASSERT_EQUALS(tokens_before_removal, tokens_after_removal + removed_tokens);
+    ASSERT_EQUALS(intersection_tokens_without_max_df, intersection_tokens_max_df_1);
+    ASSERT_EQUALS(true, intersection_tokens_without_max_df > intersection_tokens_max_df_0_2);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the default calculation (without --max_df) uses no dynamic stop words and writes no "Auto stop
+ * words" object in the result file.
+ *
+ * The release build uses -ffast-math; so the default must not depend on NaN checks. With --max_df the object needs to
+ * be in the result file.
+ */
+extern void TEST_No_Auto_Stop_Words_Without_Max_DF (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    // A formatted output file can be searched line by line
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_CSV;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+    GLOBAL_CLI_FORMAT_OUTPUT = true;
+    Exec_Intersection(10.0f, NULL, NULL);
+    const _Bool auto_stop_words_without_max_df = Result_File_Contains_String(OUT_FILE, "\"Auto stop words\"");
+
+    GLOBAL_CLI_USE_MAX_DOCUMENT_FREQUENCY = true;
+    GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY = 0.2f;
+    Exec_Intersection(10.0f, NULL, NULL);
+    const _Bool auto_stop_words_with_max_df = Result_File_Contains_String(OUT_FILE, "\"Auto stop words\"");
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(false, auto_stop_words_without_max_df);
+    ASSERT_EQUALS(true, auto_stop_words_with_max_df);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the stop word removal while the encoding: The encoded data contains no stop word and no other token was
+ * lost. The raw tokens belong to the same data sets. A compiled corpus will be filtered in the same way.
+ */
+extern void TEST_Stop_Words_Removed_While_Encoding (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    CorpusFile_Compile(FILE_1, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS, false);
+
+    // A compiled corpus can only be the first file of a mapping
+    struct Token_Int_Mapping* mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* filtered_compiled = EncodedCorpus_CreateObject(CORPUS_FILE, mapping, 1,
+            JSON_PARSER_STREAMING, NULL, ENCODING_REMOVE_STOP_WORDS | ENCODING_KEEP_RAW_TOKENS);
+    struct Encoded_Corpus* all_tokens = EncodedCorpus_CreateObject(FILE_1, mapping, 1, JSON_PARSER_STREAMING, NULL,
+            ENCODING_DEFAULT);
+    struct Encoded_Corpus* filtered = EncodedCorpus_CreateObject(FILE_1, mapping, 1, JSON_PARSER_STREAMING, NULL,
+            ENCODING_REMOVE_STOP_WORDS | ENCODING_KEEP_RAW_TOKENS);
+
+    _Bool stop_word_left = false;
+    _Bool raw_tokens_aligned = filtered->raw_token_ints != NULL &&
+            filtered->raw_token_ints->next_free_array == filtered->token_ints->next_free_array;
+    for (uint_fast32_t i = 0; i < filtered->token_ints->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < filtered->token_ints->arrays_lengths [i]; ++ i2)
+        {
+            const char* token = TokenIntMapping_IntToTokenStaticMem(mapping,
+                    filtered->token_ints->data_struct.data [i][i2]);
+            stop_word_left |= Is_Word_In_Stop_Word_List(token, strlen(token), ENG);
+        }
+        if (raw_tokens_aligned)
+        {
+            raw_tokens_aligned = filtered->raw_token_ints->arrays_lengths [i] >=
+                    filtered->token_ints->arrays_lengths [i];
+        }
+    }
+
+    // The stream encoding and the compiled corpus need to be equal after the removal (also the original offsets)
+    _Bool compiled_corpus_equal = filtered->token_ints->next_free_array ==
+            filtered_compiled->token_ints->next_free_array && filtered->number_of_tokens ==
+            filtered_compiled->number_of_tokens && filtered_compiled->raw_token_ints != NULL;
+    for (uint_fast32_t i = 0; compiled_corpus_equal && i < filtered->token_ints->next_free_array; ++ i)
+    {
+        const size_t length = filtered->token_ints->arrays_lengths [i];
+        compiled_corpus_equal = length == filtered_compiled->token_ints->arrays_lengths [i] &&
+                memcmp(filtered->token_ints->data_struct.char_offsets [i],
+                        filtered_compiled->token_ints->data_struct.char_offsets [i],
+                        length * sizeof (CHAR_OFFSET_TYPE)) == 0 &&
+                memcmp(filtered->token_ints->data_struct.word_offsets [i],
+                        filtered_compiled->token_ints->data_struct.word_offsets [i],
+                        length * sizeof (WORD_OFFSET_TYPE)) == 0 &&
+                filtered->raw_token_ints->arrays_lengths [i] == filtered_compiled->raw_token_ints->arrays_lengths [i];
+    }
+
+    const uint_fast64_t tokens_without_removal = all_tokens->number_of_tokens;
+    const uint_fast64_t tokens_after_removal = filtered->number_of_tokens;
+    const uint_fast64_t removed_tokens = filtered->removed_stop_words;
+
+    EncodedCorpus_DeleteObject(filtered_compiled);
+    filtered_compiled = NULL;
+    EncodedCorpus_DeleteObject(filtered);
+    filtered = NULL;
+    EncodedCorpus_DeleteObject(all_tokens);
+    all_tokens = NULL;
+    TokenIntMapping_DeleteObject(mapping);
+    mapping = NULL;
+    remove(CORPUS_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(true, removed_tokens > 0);
+    ASSERT_EQUALS(false, stop_word_left);
+    ASSERT_EQUALS(true, raw_tokens_aligned);
+    ASSERT_EQUALS(true, compiled_corpus_equal);
+    ASSERT_EQUALS(tokens_without_removal, tokens_after_removal + removed_tokens);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the default loading of a corpus file, that was compiled without the built-in stop words: The tokens stay
+ * in the mapped file (no copy while the loading) and the corpus contains the same data sets as the encoding of the
+ * input file with the stop word removal.
+ */
+extern void TEST_Compiled_Corpus_Without_Stop_Words_Stays_Mapped (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    CorpusFile_Compile(FILE_1, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS, true);
+
+    // A compiled corpus can only be the first file of a mapping
+    struct Token_Int_Mapping* corpus_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* corpus = EncodedCorpus_CreateObject(CORPUS_FILE, corpus_mapping, 1,
+            JSON_PARSER_STREAMING, NULL, ENCODING_REMOVE_STOP_WORDS);
+    struct Token_Int_Mapping* mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* filtered = EncodedCorpus_CreateObject(FILE_1, mapping, 1, JSON_PARSER_STREAMING, NULL,
+            ENCODING_REMOVE_STOP_WORDS);
+
+    const char* const mapping_begin = corpus->corpus_file->data;
+    const char* const mapping_end = mapping_begin + corpus->corpus_file->size;
+    const _Bool stop_words_removed_in_header =
+            ((const struct Corpus_File_Header*) mapping_begin)->stop_words_removed == 1;
+
+    _Bool data_in_mapping = true;
+    _Bool corpus_equal = corpus->token_ints->next_free_array == filtered->token_ints->next_free_array &&
+            corpus->number_of_tokens == filtered->number_of_tokens &&
+            corpus->removed_stop_words == filtered->removed_stop_words;
+    for (uint_fast32_t i = 0; corpus_equal && i < corpus->token_ints->next_free_array; ++ i)
+    {
+        const char* const data = (const char*) corpus->token_ints->data_struct.data [i];
+        if (corpus->token_ints->arrays_lengths [i] > 0)
+        {
+            data_in_mapping &= data >= mapping_begin && data < mapping_end;
+        }
+        corpus_equal = corpus->token_ints->arrays_lengths [i] == filtered->token_ints->arrays_lengths [i];
+    }
+
+    EncodedCorpus_DeleteObject(filtered);
+    filtered = NULL;
+    TokenIntMapping_DeleteObject(mapping);
+    mapping = NULL;
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(corpus_mapping);
+    corpus_mapping = NULL;
+    remove(CORPUS_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(true, stop_words_removed_in_header);
+    ASSERT_EQUALS(true, data_in_mapping);
+    ASSERT_EQUALS(true, corpus_equal);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the loading of an own stop word file: Empty lines, comments, Windows line ends and the case of the words
+ * will be handled. The loaded words are neither in the encoded data nor in the mapping; their offsets were removed with
+ * them and the offsets of all other tokens are unchanged.
+ */
+extern void TEST_Stop_Word_File_Removed_While_Encoding (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    // Words of the first data set in FILE_1 in a different case; also the line ends of the file are unusual
+    const char* const stop_word_file_content =
+            "# Own stop words\r\n"
+            "\r\n"
+            "THERAPY\r\n"
+            "   \r\n"
+            "  # Comment with leading whitespace\n"
+            "Children\r\n"
+            "\n"
+            "aUtIsM\r\n";
+    const char* const search_words [] = { "therapy", "THERAPY", "Therapy", "children", "Children", "autism", "Autism" };
+
+    FILE* stop_word_file = fopen(STOP_WORD_FILE, "wb");
+    ASSERT_FMSG(stop_word_file != NULL, "Cannot create the file \"%s\" !", STOP_WORD_FILE);
+    fputs(stop_word_file_content, stop_word_file);
+    FCLOSE_AND_SET_TO_NULL(stop_word_file);
+
+    const char* const file_names [] = { STOP_WORD_FILE };
+    struct Stop_Word_Hash_Table* stop_words = Load_Stop_Word_Files(file_names, COUNT_ARRAY_ELEMENTS(file_names));
+    const uint32_t number_of_loaded_words = stop_words->number_of_words;
+
+    // Separate mappings; otherwise the words would be in the mapping of the filtered corpus anyway
+    struct Token_Int_Mapping* mapping_all = TokenIntMapping_CreateObject();
+    struct Token_Int_Mapping* mapping_filtered = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* all_tokens = EncodedCorpus_CreateObject(FILE_1, mapping_all, 1, JSON_PARSER_STREAMING,
+            NULL, ENCODING_DEFAULT);
+    struct Encoded_Corpus* filtered = EncodedCorpus_CreateObject(FILE_1, mapping_filtered, 1, JSON_PARSER_STREAMING,
+            stop_words, ENCODING_DEFAULT);
+
+    _Bool words_in_original_mapping = false;
+    _Bool words_in_filtered_mapping = false;
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(search_words); ++ i)
+    {
+        const size_t word_length = strlen(search_words [i]);
+        words_in_original_mapping |=
+                TokenIntMapping_TokenToInt(mapping_all, search_words [i], word_length) != UINT_FAST32_MAX;
+        words_in_filtered_mapping |=
+                TokenIntMapping_TokenToInt(mapping_filtered, search_words [i], word_length) != UINT_FAST32_MAX;
+    }
+
+    // Walk through both corpora: Every not removed token needs to be in the filtered corpus with the same offsets
+    uint_fast64_t removed_tokens = 0;
+    _Bool offsets_equal = all_tokens->token_ints->next_free_array == filtered->token_ints->next_free_array;
+    for (uint_fast32_t i = 0; offsets_equal && i < all_tokens->token_ints->next_free_array; ++ i)
+    {
+        const struct Document_Word_List* const all = all_tokens->token_ints;
+        const struct Document_Word_List* const rest = filtered->token_ints;
+        size_t next_rest_token = 0;
+
+        for (size_t i2 = 0; offsets_equal && i2 < all->arrays_lengths [i]; ++ i2)
+        {
+            const char* token = TokenIntMapping_IntToTokenStaticMem(mapping_all, all->data_struct.data [i][i2]);
+            if (StopWordHash_ContainsAnyCase(stop_words, token, strlen(token)))
+            {
+                ++ removed_tokens;
+                continue;
+            }
+            offsets_equal = next_rest_token < rest->arrays_lengths [i] &&
+                    all->data_struct.char_offsets [i][i2] == rest->data_struct.char_offsets [i][next_rest_token] &&
+                    all->data_struct.word_offsets [i][i2] == rest->data_struct.word_offsets [i][next_rest_token];
+            if (offsets_equal)
+            {
+                const char* rest_token = TokenIntMapping_IntToTokenStaticMem(mapping_filtered,
+                        rest->data_struct.data [i][next_rest_token]);
+                offsets_equal = strcmp(token, rest_token) == 0;
+            }
+            ++ next_rest_token;
+        }
+        offsets_equal &= next_rest_token == rest->arrays_lengths [i];
+    }
+
+    const uint_fast64_t counted_removed_tokens = filtered->removed_stop_words;
+    const uint_fast64_t tokens_without_removal = all_tokens->number_of_tokens;
+    const uint_fast64_t tokens_after_removal = filtered->number_of_tokens;
+
+    EncodedCorpus_DeleteObject(filtered);
+    filtered = NULL;
+    EncodedCorpus_DeleteObject(all_tokens);
+    all_tokens = NULL;
+    TokenIntMapping_DeleteObject(mapping_filtered);
+    mapping_filtered = NULL;
+    TokenIntMapping_DeleteObject(mapping_all);
+    mapping_all = NULL;
+    StopWordHash_DeleteObject(stop_words);
+    stop_words = NULL;
+    remove(STOP_WORD_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(3, number_of_loaded_words);
+    ASSERT_EQUALS(true, words_in_original_mapping);
+    ASSERT_EQUALS(false, words_in_filtered_mapping);
+    ASSERT_EQUALS(true, offsets_equal);
+    ASSERT_EQUALS(true, removed_tokens > 0);
+    ASSERT_EQUALS(removed_tokens, counted_removed_tokens);
+    ASSERT_EQUALS(tokens_without_removal, tokens_after_removal + removed_tokens);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the own stop words with a compiled corpus: The loaded corpus contains no word of the stop word file and
+ * the same data sets and offsets as the encoding of the input file with the same stop words.
+ */
+extern void TEST_Stop_Word_File_Removed_From_Compiled_Corpus (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    FILE* stop_word_file = fopen(STOP_WORD_FILE, "wb");
+    ASSERT_FMSG(stop_word_file != NULL, "Cannot create the file \"%s\" !", STOP_WORD_FILE);
+    fputs("THERAPY\nChildren\naUtIsM\n", stop_word_file);
+    FCLOSE_AND_SET_TO_NULL(stop_word_file);
+
+    const char* const file_names [] = { STOP_WORD_FILE };
+    struct Stop_Word_Hash_Table* stop_words = Load_Stop_Word_Files(file_names, COUNT_ARRAY_ELEMENTS(file_names));
+
+    CorpusFile_Compile(FILE_1, CORPUS_FILE, 1, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS, true);
+
+    // A compiled corpus can only be the first file of a mapping
+    struct Token_Int_Mapping* corpus_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* corpus = EncodedCorpus_CreateObject(CORPUS_FILE, corpus_mapping, 1,
+            JSON_PARSER_STREAMING, stop_words, ENCODING_REMOVE_STOP_WORDS);
+    struct Token_Int_Mapping* mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* filtered = EncodedCorpus_CreateObject(FILE_1, mapping, 1, JSON_PARSER_STREAMING,
+            stop_words, ENCODING_REMOVE_STOP_WORDS);
+
+    _Bool stop_word_left = false;
+    _Bool corpus_equal = corpus->token_ints->next_free_array == filtered->token_ints->next_free_array &&
+            corpus->number_of_tokens == filtered->number_of_tokens &&
+            corpus->removed_stop_words == filtered->removed_stop_words;
+    for (uint_fast32_t i = 0; corpus_equal && i < corpus->token_ints->next_free_array; ++ i)
+    {
+        const size_t length = corpus->token_ints->arrays_lengths [i];
+        for (size_t i2 = 0; i2 < length; ++ i2)
+        {
+            const char* token = TokenIntMapping_IntToTokenStaticMem(corpus_mapping,
+                    corpus->token_ints->data_struct.data [i][i2]);
+            stop_word_left |= StopWordHash_ContainsAnyCase(stop_words, token, strlen(token));
+        }
+        corpus_equal = length == filtered->token_ints->arrays_lengths [i] &&
+                memcmp(corpus->token_ints->data_struct.char_offsets [i],
+                        filtered->token_ints->data_struct.char_offsets [i], length * sizeof (CHAR_OFFSET_TYPE)) == 0;
+    }
+
+    EncodedCorpus_DeleteObject(filtered);
+    filtered = NULL;
+    TokenIntMapping_DeleteObject(mapping);
+    mapping = NULL;
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(corpus_mapping);
+    corpus_mapping = NULL;
+    StopWordHash_DeleteObject(stop_words);
+    stop_words = NULL;
+    remove(CORPUS_FILE);
+    remove(STOP_WORD_FILE);
+    Set_CLI_Parameter_To_Default_Values();
+
+    ASSERT_EQUALS(false, stop_word_left);
+    ASSERT_EQUALS(true, corpus_equal);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compare two result files line by line. The creation time will be ignored, because the two calculations were
+ * done at different times.
+ *
+ * Asserts:
+ *      file_name_1 != NULL
+ *      file_name_2 != NULL
+ *      Both files can be opened
+ *
+ * @param[in] file_name_1 Name of the first result file
+ * @param[in] file_name_2 Name of the second result file
+ *
+ * @return true, if the files are equal (except the creation time), otherwise false
+ */
+static _Bool
+Result_Files_Equal
+(
+        const char* const file_name_1,
+        const char* const file_name_2
+)
+{
+    ASSERT_MSG(file_name_1 != NULL, "First file name is NULL !");
+    ASSERT_MSG(file_name_2 != NULL, "Second file name is NULL !");
+
+    FILE* file_1 = fopen(file_name_1, "r");
+    ASSERT_FMSG(file_1 != NULL, "Cannot open the file \"%s\" !", file_name_1);
+    FILE* file_2 = fopen(file_name_2, "r");
+    ASSERT_FMSG(file_2 != NULL, "Cannot open the file \"%s\" !", file_name_2);
+
+    char line_1 [4096];
+    char line_2 [4096];
+    _Bool files_equal = true;
+    while (files_equal)
+    {
+        const char* const ret_1 = fgets(line_1, sizeof (line_1), file_1);
+        const char* const ret_2 = fgets(line_2, sizeof (line_2), file_2);
+
+        if (ret_1 == NULL || ret_2 == NULL)
+        {
+            // Both files needs to end at the same time
+            files_equal = (ret_1 == ret_2);
+            break;
+        }
+        if (strstr(line_1, "\"Creation time\"") != NULL && strstr(line_2, "\"Creation time\"") != NULL)
+        {
+            continue;
+        }
+        files_equal = (strcmp(line_1, line_2) == 0);
+    }
+
+    FCLOSE_AND_SET_TO_NULL(file_1);
+    FCLOSE_AND_SET_TO_NULL(file_2);
+
+    return files_equal;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Search a string line by line in a (formatted) result file.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      search_string != NULL
+ *      The file can be opened
+ *
+ * @param[in] file_name Name of the result file
+ * @param[in] search_string String, that will be searched
+ *
+ * @return true, if a line contains the string, otherwise false
+ */
+static _Bool
+Result_File_Contains_String
+(
+        const char* const file_name,
+        const char* const search_string
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(search_string != NULL, "Search string is NULL !");
+
+    FILE* file = fopen(file_name, "r");
+    ASSERT_FMSG(file != NULL, "Cannot open the file \"%s\" !", file_name);
+
+    char line [4096];
+    _Bool string_found = false;
+    while (! string_found && fgets(line, sizeof (line), file) != NULL)
+    {
+        string_found = (strstr(line, search_string) != NULL);
+    }
+
+    FCLOSE_AND_SET_TO_NULL(file);
+
+    return string_found;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compare a compiled corpus file, that contains FILE_1 and FILE_CSV, with the encoding of the two input files
+ * with one mapping. (The same order of the data sets and the same mapping integers are expected)
+ *
+ * Asserts:
+ *      corpus_file != NULL
+ *
+ * @param[in] corpus_file Name of the corpus file
+ *
+ * @return true, if vocabulary, mapped tokens, offsets and data set IDs are equal, otherwise false
+ */
+static _Bool
+Corpus_Equal_With_Input_Files
+(
+        const char* const corpus_file
+)
+{
+    ASSERT_MSG(corpus_file != NULL, "Corpus file name is NULL !");
+
+    struct Token_Int_Mapping* corpus_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* corpus = CorpusFile_Load(corpus_file, corpus_mapping, JSON_TOKEN_ARRAY_TOKENS);
+    struct Token_Int_Mapping* input_mapping = TokenIntMapping_CreateObject();
+    struct Encoded_Corpus* input_files [2] =
+    {
+            EncodedCorpus_CreateObject(FILE_1, input_mapping, 1, JSON_PARSER_STREAMING, NULL, ENCODING_DEFAULT),
+            EncodedCorpus_CreateObject(FILE_CSV, input_mapping, 1, JSON_PARSER_STREAMING, NULL, ENCODING_DEFAULT)
+    };
+
+    _Bool corpus_equal = corpus->token_ints->next_free_array ==
+            input_files [0]->token_ints->next_free_array + input_files [1]->token_ints->next_free_array;
+
+    // >>> Vocabulary <<<
+    for (size_t i = 0; corpus_equal && i < C_STR_ARRAYS; ++ i)
+    {
+        const size_t length = corpus_mapping->c_str_array_lengths [i];
+        corpus_equal = length == input_mapping->c_str_array_lengths [i] &&
+                memcmp(corpus_mapping->c_str_arrays [i], input_mapping->c_str_arrays [i],
+                        length * MAX_TOKEN_LENGTH) == 0 &&
+                memcmp(corpus_mapping->int_mapping [i], input_mapping->int_mapping [i], length *
+                        sizeof (uint_fast32_t)) == 0;
+    }
+
+    // >>> Data sets: First the data sets of FILE_1, then the data sets of FILE_CSV <<<
+    const struct Document_Word_List* const corpus_list = corpus->token_ints;
+    uint_fast32_t corpus_index = 0;
+    for (size_t file = 0; file < COUNT_ARRAY_ELEMENTS(input_files); ++ file)
+    {
+        const struct Document_Word_List* const input_list = input_files [file]->token_ints;
+        for (uint_fast32_t i = 0; corpus_equal && i < input_list->next_free_array; ++ i, ++ corpus_index)
+        {
+            const size_t length = input_list->arrays_lengths [i];
+            corpus_equal = length == corpus_list->arrays_lengths [corpus_index] &&
+                    memcmp(input_list->data_struct.data [i], corpus_list->data_struct.data [corpus_index],
+                            length * sizeof (uint_fast32_t)) == 0 &&
+                    memcmp(input_list->data_struct.char_offsets [i],
+                            corpus_list->data_struct.char_offsets [corpus_index],
+                            length * sizeof (CHAR_OFFSET_TYPE)) == 0 &&
+                    memcmp(input_list->data_struct.sentence_offsets [i],
+                            corpus_list->data_struct.sentence_offsets [corpus_index],
+                            length * sizeof (SENTENCE_OFFSET_TYPE)) == 0 &&
+                    memcmp(input_list->data_struct.word_offsets [i],
+                            corpus_list->data_struct.word_offsets [corpus_index],
+                            length * sizeof (WORD_OFFSET_TYPE)) == 0 &&
+                    memcmp(input_files [file]->dataset_ids + (i * DATASET_ID_LENGTH),
+                            corpus->dataset_ids + (corpus_index * DATASET_ID_LENGTH), DATASET_ID_LENGTH) == 0;
+        }
+    }
+
+    EncodedCorpus_DeleteObject(input_files [1]);
+    input_files [1] = NULL;
+    EncodedCorpus_DeleteObject(input_files [0]);
+    input_files [0] = NULL;
+    TokenIntMapping_DeleteObject(input_mapping);
+    input_mapping = NULL;
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(corpus_mapping);
+    corpus_mapping = NULL;
+
+    return corpus_equal;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 
 
@@ -347,6 +1312,34 @@ extern void TEST_Number_Of_Sets_Equal_With_Switched_Input_Files_JSON_And_CSV (vo
 #undef OUT_FILE
 #endif /* OUT_FILE */
 
+#ifdef OUT_FILE_BINARY
+#undef OUT_FILE_BINARY
+#endif /* OUT_FILE_BINARY */
+
+#ifdef OUT_FILE_CONVERTED
+#undef OUT_FILE_CONVERTED
+#endif /* OUT_FILE_CONVERTED */
+
+#ifdef BATCH_FILE
+#undef BATCH_FILE
+#endif /* BATCH_FILE */
+
+#ifdef OUT_FILE_BATCH_1
+#undef OUT_FILE_BATCH_1
+#endif /* OUT_FILE_BATCH_1 */
+
+#ifdef OUT_FILE_BATCH_2
+#undef OUT_FILE_BATCH_2
+#endif /* OUT_FILE_BATCH_2 */
+
+#ifdef CORPUS_FILE
+#undef CORPUS_FILE
+#endif /* CORPUS_FILE */
+
+#ifdef OUT_FILE_CORPUS
+#undef OUT_FILE_CORPUS
+#endif /* OUT_FILE_CORPUS */
+
 #ifdef TEST_EBM_FILE_MD5
 #undef TEST_EBM_FILE_MD5
 #endif /* TEST_EBM_FILE_MD5 */
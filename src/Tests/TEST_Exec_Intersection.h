@@ -78,6 +78,79 @@ extern void TEST_Number_Of_Tokens_Equal_With_Switched_Input_Files_JSON_And_CSV (
  */
 extern void TEST_Number_Of_Sets_Equal_With_Switched_Input_Files_JSON_And_CSV (void);
 
+/**
+ * @brief Test, whether the count only mode finds the same number of tokens and sets as the normal mode.
+ */
+extern void TEST_Number_Of_Tokens_And_Sets_Found_In_Count_Only_Mode (void);
+
+/**
+ * @brief Check, whether a binary result file, that was converted to JSON, is equal with the direct JSON result file.
+ *
+ * The creation time will be ignored, because the two calculations were done at different times.
+ */
+extern void TEST_Binary_Result_File_Equal_With_JSON_Result_File (void);
+
+/**
+ * @brief Check, whether the batch mode creates the same result files as single calculations with the same files.
+ */
+extern void TEST_Batch_Mode_Equal_With_Single_Runs (void);
+
+/**
+ * @brief Check, whether a compiled corpus file as first input file creates the same result file as the original file.
+ */
+extern void TEST_Compiled_Corpus_Equal_With_Input_File (void);
+
+/**
+ * @brief Check, whether a compiled corpus file with an appended input file contains the same data as the encoding of
+ * both input files. The same check after the compaction of the corpus file.
+ */
+extern void TEST_Appended_Corpus_Equal_With_Input_Files (void);
+
+/**
+ * @brief Check, whether a compiled corpus file saves the encoded JSON array in the header: A file with lemmas keeps the
+ * setting after an append and a compaction and contains the same data (also the surface forms) as the encoding of
+ * the lemmas.
+ */
+extern void TEST_Corpus_File_Saves_The_Token_Array (void);
+
+/**
+ * @brief Check the dynamic stop words: After the removal no data set contains a too frequent token and no token was
+ * lost. A max. document frequency of 1.0 removes nothing; a lower value finds less intersection tokens.
+ */
+extern void TEST_Dynamic_Stop_Words_Removed_From_Corpus (void);
+
+/**
+ * @brief Check, whether the default calculation (without --max_df) uses no dynamic stop words and writes no "Auto stop
+ * words" object in the result file.
+ */
+extern void TEST_No_Auto_Stop_Words_Without_Max_DF (void);
+
+/**
+ * @brief Check the stop word removal while the encoding: The encoded data contains no stop word and no other token was
+ * lost. The raw tokens belong to the same data sets. A compiled corpus will be filtered in the same way.
+ */
+extern void TEST_Stop_Words_Removed_While_Encoding (void);
+
+/**
+ * @brief Check the default loading of a corpus file, that was compiled without the built-in stop words: The tokens stay
+ * in the mapped file (no copy while the loading) and the corpus contains the same data sets as the encoding of the
+ * input file with the stop word removal.
+ */
+extern void TEST_Compiled_Corpus_Without_Stop_Words_Stays_Mapped (void);
+
+/**
+ * @brief Check the loading of an own stop word file: Empty lines, comments, Windows line ends and the case of the words
+ * will be handled. The loaded words are neither in the encoded data nor in the mapping; their offsets were removed with
+ * them and the offsets of all other tokens are unchanged.
+ */
+extern void TEST_Stop_Word_File_Removed_While_Encoding (void);
+
+/**
+ * @brief Check the own stop words with a compiled corpus: The loaded corpus contains no word of the stop word file and
+ * the same data sets and offsets as the encoding of the input file with the same stop words.
+ */
+extern void TEST_Stop_Word_File_Removed_From_Compiled_Corpus (void);
+
 
 
 #ifdef __cplusplus
@@ -11,8 +11,13 @@
 
 #include <stdbool.h>
 #include <ctype.h>
+#include <string.h>
 #include "../Misc.h"
 #include "../File_Reader.h"
+#include "../Encoded_Corpus.h"
+#include "../Token_Int_Mapping.h"
+#include "../Async_File_Writer.h"
+#include "../Mapped_File.h"
 #include "md5.h"
 #include "../Error_Handling/Dynamic_Memory.h"
 #include "../Error_Handling/Assert_Msg.h"
@@ -36,6 +41,30 @@
 #error "The macro \"TEST_FILE_READER_TEST_FILE_MD5\" is already defined !"
 #endif /* TEST_FILE_READER_TEST_FILE_MD5 */
 
+#ifndef TEST_FILE_READER_JSONL_TEST_FILE
+#define TEST_FILE_READER_JSONL_TEST_FILE "./src/Tests/Test_Data/intervention_10MB.txt" ///< JSON file with one object per line
+#else
+#error "The macro \"TEST_FILE_READER_JSONL_TEST_FILE\" is already defined !"
+#endif /* TEST_FILE_READER_JSONL_TEST_FILE */
+
+#ifndef TEST_FILE_READER_TXT_TEST_FILE
+#define TEST_FILE_READER_TXT_TEST_FILE "./src/Tests/Test_Data/Gene_or_Genome.csv" ///< Text file (whitespace delimiter)
+#else
+#error "The macro \"TEST_FILE_READER_TXT_TEST_FILE\" is already defined !"
+#endif /* TEST_FILE_READER_TXT_TEST_FILE */
+
+#ifndef TEST_FILE_READER_NUMBER_OF_THREADS
+#define TEST_FILE_READER_NUMBER_OF_THREADS 4 ///< Number of reader threads for the parallel read tests
+#else
+#error "The macro \"TEST_FILE_READER_NUMBER_OF_THREADS\" is already defined !"
+#endif /* TEST_FILE_READER_NUMBER_OF_THREADS */
+
+#ifndef TEST_FILE_READER_GZIP_FILE
+#define TEST_FILE_READER_GZIP_FILE "./test_file_reader.gz" ///< Temporary gzip compressed copy of a test file
+#else
+#error "The macro \"TEST_FILE_READER_GZIP_FILE\" is already defined !"
+#endif /* TEST_FILE_READER_GZIP_FILE */
+
 #ifndef NUMBER_OF_TOKENARRAYS
 #define NUMBER_OF_TOKENARRAYS 191 ///< Expected number of token arrays
 #else
@@ -68,8 +97,158 @@ IS_CONST_STR(TEST_FILE_READER_TEST_FILE_MD5)
 IS_TYPE(NUMBER_OF_TOKENARRAYS, int)
 IS_TYPE(MAX_DATASET_ID_LENGTH, int)
 IS_TYPE(MAX_TOKENARRAY_LENGTH, int)
+IS_CONST_STR(TEST_FILE_READER_JSONL_TEST_FILE)
+IS_CONST_STR(TEST_FILE_READER_TXT_TEST_FILE)
+IS_TYPE(TEST_FILE_READER_NUMBER_OF_THREADS, int)
+IS_CONST_STR(TEST_FILE_READER_GZIP_FILE)
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
 
+
+
+/**
+ * @brief Check, whether both containers hold the same data sets (IDs, tokens and offsets) in the same order.
+ *
+ * Asserts:
+ *      container_1 != NULL
+ *      container_2 != NULL
+ *
+ * @param[in] container_1 First Token_List_Container
+ * @param[in] container_2 Second Token_List_Container
+ *
+ * @return true, if both containers are equal, otherwise false
+ */
+static _Bool
+Token_List_Containers_Equal
+(
+        const struct Token_List_Container* const container_1,
+        const struct Token_List_Container* const container_2
+);
+
+/**
+ * @brief Read a file with two configurations and check, whether both containers are equal.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the input file
+ * @param[in] number_of_threads Number of reader threads for the second read
+ * @param[in] json_parser_mode Parser for the second read (The first read uses TokenListContainer_CreateObject())
+ *
+ * @return true, if both containers are equal, otherwise false
+ */
+static _Bool
+Read_Equal_With_Default_Read
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode
+);
+
+/**
+ * @brief Read a file as Encoded_Corpus and check, whether the data sets are equal with the former encoding: first the
+ * whole file in a Token_List_Container, then all tokens in the mapping and at the end the mapped tokens.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the input file
+ * @param[in] number_of_threads Number of reader threads for the Encoded_Corpus
+ *
+ * @return true, if the IDs, the mapped tokens and the offsets are equal, otherwise false
+ */
+static _Bool
+Encoded_Corpus_Equal_With_Container_Encoding
+(
+        const char* const file_name,
+        const size_t number_of_threads
+);
+
+/**
+ * @brief Read a file with the surface tokens and with the lemmas and check, whether both containers hold the same data
+ * sets with the same number of tokens and the same offsets. (Only the tokens itself can be different; the surface
+ * forms of the lemma read need to be the tokens of the first read)
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      different_tokens != NULL
+ *
+ * @param[in] file_name Name of the input file
+ * @param[in] json_parser_mode Parser for both reads
+ * @param[out] different_tokens Number of lemmas, that are not equal with their surface token
+ *
+ * @return true, if the IDs, the number of tokens, the offsets and the surface forms are equal, otherwise false
+ */
+static _Bool
+Lemma_Read_Keeps_The_Surface_Offsets
+(
+        const char* const restrict file_name,
+        const enum JSON_Parser_Mode json_parser_mode,
+        size_t* const restrict different_tokens
+);
+
+/**
+ * @brief Check, whether the surface forms of a lemma corpus are the tokens of a corpus with the surface tokens. Both
+ * corpora need to be encoded from the same file.
+ *
+ * Asserts:
+ *      token_corpus != NULL
+ *      token_mapping != NULL
+ *      lemma_corpus != NULL
+ *      lemma_mapping != NULL
+ *
+ * @param[in] token_corpus Encoded_Corpus with the surface tokens
+ * @param[in] token_mapping Token_Int_Mapping of the token corpus
+ * @param[in] lemma_corpus Encoded_Corpus with the lemmas (ENCODING_MATCH_ON_LEMMA)
+ * @param[in] lemma_mapping Token_Int_Mapping of the lemma corpus
+ *
+ * @return true, if every surface form is equal with the token at the same position, otherwise false
+ */
+static _Bool
+Surface_Tokens_Equal_With_Tokens
+(
+        const struct Encoded_Corpus* const restrict token_corpus,
+        const struct Token_Int_Mapping* const restrict token_mapping,
+        const struct Encoded_Corpus* const restrict lemma_corpus,
+        const struct Token_Int_Mapping* const restrict lemma_mapping
+);
+
+/**
+ * @brief Count the different mapping integers in a Document_Word_List.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Document_Word_List object
+ *
+ * @return Number of different mapping integers
+ */
+static size_t
+Count_Different_Token_Ints
+(
+        const struct Document_Word_List* const object
+);
+
+#ifdef HAVE_ZLIB
+/**
+ * @brief Compress a file with gzip (Async_File_Writer), read the compressed copy and check, whether the container is
+ * equal with the container of the uncompressed file.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the uncompressed input file
+ * @param[in] number_of_threads Number of reader threads for the compressed file
+ *
+ * @return true, if both containers are equal, otherwise false
+ */
+static _Bool
+Compressed_Read_Equal_With_Default_Read
+(
+        const char* const file_name,
+        const size_t number_of_threads
+);
+#endif /* HAVE_ZLIB */
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -160,6 +339,585 @@ extern void TEST_Length_Of_The_First_25_Tokenarrays (void)
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Check, whether the parallel reading creates the same data sets (IDs, tokens and order) as the serial reading.
+ *
+ * Used files: a single line JSON file (all threads except one get an empty chunk), a JSON file with one object per line
+ * and a text file (the data set IDs are the line numbers).
+ */
+extern void TEST_Parallel_Read_Equal_With_Serial_Read (void)
+{
+    _Bool err_occurred = true;
+    const _Bool md5_sum_check_result = Check_Test_File_MD5_Sum(TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_TEST_FILE_MD5,
+            &err_occurred);
+    ASSERT_MSG(err_occurred == false, "Error occurred while checking a MD5 sum of a file !");
+    ASSERT_FMSG(md5_sum_check_result == true, "MD5 sum of the file (%s) is not equal with the expected sum (%s) !",
+            TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_TEST_FILE_MD5);
+
+    ASSERT_EQUALS(true, Read_Equal_With_Default_Read(TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_NUMBER_OF_THREADS,
+            JSON_PARSER_STREAMING));
+    ASSERT_EQUALS(true, Read_Equal_With_Default_Read(TEST_FILE_READER_JSONL_TEST_FILE,
+            TEST_FILE_READER_NUMBER_OF_THREADS, JSON_PARSER_STREAMING));
+    ASSERT_EQUALS(true, Read_Equal_With_Default_Read(TEST_FILE_READER_TXT_TEST_FILE, TEST_FILE_READER_NUMBER_OF_THREADS,
+            JSON_PARSER_STREAMING));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the streaming scanner creates the same data sets (IDs, tokens, offsets and order) as the cJSON
+ * parser.
+ *
+ * Both JSON files contain escape sequences; test_ebm.json contains also char offset arrays.
+ */
+extern void TEST_Streaming_Scanner_Equal_With_cJSON_Parser (void)
+{
+    _Bool err_occurred = true;
+    const _Bool md5_sum_check_result = Check_Test_File_MD5_Sum(TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_TEST_FILE_MD5,
+            &err_occurred);
+    ASSERT_MSG(err_occurred == false, "Error occurred while checking a MD5 sum of a file !");
+    ASSERT_FMSG(md5_sum_check_result == true, "MD5 sum of the file (%s) is not equal with the expected sum (%s) !",
+            TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_TEST_FILE_MD5);
+
+    ASSERT_EQUALS(true, Read_Equal_With_Default_Read(TEST_FILE_READER_TEST_FILE, 1, JSON_PARSER_CJSON));
+    ASSERT_EQUALS(true, Read_Equal_With_Default_Read(TEST_FILE_READER_JSONL_TEST_FILE, 1, JSON_PARSER_CJSON));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the single pass encoding (Encoded_Corpus) creates the same mapped data sets (IDs, integers and
+ * offsets) as the encoding over a Token_List_Container.
+ */
+extern void TEST_Encoded_Corpus_Equal_With_Token_List_Container (void)
+{
+    ASSERT_EQUALS(true, Encoded_Corpus_Equal_With_Container_Encoding(TEST_FILE_READER_JSONL_TEST_FILE, 1));
+    ASSERT_EQUALS(true, Encoded_Corpus_Equal_With_Container_Encoding(TEST_FILE_READER_JSONL_TEST_FILE,
+            TEST_FILE_READER_NUMBER_OF_THREADS));
+    ASSERT_EQUALS(true, Encoded_Corpus_Equal_With_Container_Encoding(TEST_FILE_READER_TXT_TEST_FILE, 1));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether a gzip compressed file creates the same data sets (IDs, tokens, offsets and order) as the
+ * uncompressed file.
+ *
+ * The JSON file with one object per line is larger than the blocks of the decompression; so the lines cross the block
+ * borders. The parallel reading of a compressed file falls back to one thread.
+ */
+extern void TEST_Compressed_Read_Equal_With_Uncompressed_Read (void)
+{
+#ifdef HAVE_ZLIB
+    ASSERT_EQUALS(true, Compressed_Read_Equal_With_Default_Read(TEST_FILE_READER_TEST_FILE, 1));
+    ASSERT_EQUALS(true, Compressed_Read_Equal_With_Default_Read(TEST_FILE_READER_JSONL_TEST_FILE, 1));
+    ASSERT_EQUALS(true, Compressed_Read_Equal_With_Default_Read(TEST_FILE_READER_TXT_TEST_FILE,
+            TEST_FILE_READER_NUMBER_OF_THREADS));
+#else
+    puts("Skipped: The program was built without zlib.");
+#endif /* HAVE_ZLIB */
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the lemma mode maps the lemmas instead of the surface tokens, while the offsets still belong to
+ * the surface tokens.
+ *
+ * intervention_10MB.txt contains lemma arrays; test_ebm.json contains no lemma arrays, so all surface tokens will be
+ * kept. With the lemmas the encoded tokens need less different mapping integers. The surface forms for the output need
+ * to be the tokens of the surface token encoding.
+ */
+extern void TEST_Lemma_Read_Keeps_The_Surface_Offsets (void)
+{
+    _Bool err_occurred = true;
+    const _Bool md5_sum_check_result = Check_Test_File_MD5_Sum(TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_TEST_FILE_MD5,
+            &err_occurred);
+    ASSERT_MSG(err_occurred == false, "Error occurred while checking a MD5 sum of a file !");
+    ASSERT_FMSG(md5_sum_check_result == true, "MD5 sum of the file (%s) is not equal with the expected sum (%s) !",
+            TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_TEST_FILE_MD5);
+
+    size_t different_tokens = 0;
+    ASSERT_EQUALS(true, Lemma_Read_Keeps_The_Surface_Offsets(TEST_FILE_READER_JSONL_TEST_FILE, JSON_PARSER_STREAMING,
+            &different_tokens));
+    ASSERT_EQUALS(true, different_tokens > 0);
+    ASSERT_EQUALS(true, Lemma_Read_Keeps_The_Surface_Offsets(TEST_FILE_READER_JSONL_TEST_FILE, JSON_PARSER_CJSON,
+            &different_tokens));
+    ASSERT_EQUALS(true, different_tokens > 0);
+    ASSERT_EQUALS(true, Lemma_Read_Keeps_The_Surface_Offsets(TEST_FILE_READER_TEST_FILE, JSON_PARSER_STREAMING,
+            &different_tokens));
+    ASSERT_EQUALS(0, different_tokens);
+
+    // The inflected forms of a word get the same mapping integer
+    struct Token_Int_Mapping* token_mapping = TokenIntMapping_CreateObject ();
+    struct Token_Int_Mapping* lemma_mapping = TokenIntMapping_CreateObject ();
+    struct Encoded_Corpus* token_corpus = EncodedCorpus_CreateObject (TEST_FILE_READER_JSONL_TEST_FILE, token_mapping,
+            1, JSON_PARSER_STREAMING, NULL, ENCODING_DEFAULT);
+    struct Encoded_Corpus* lemma_corpus = EncodedCorpus_CreateObject (TEST_FILE_READER_JSONL_TEST_FILE, lemma_mapping,
+            1, JSON_PARSER_STREAMING, NULL, ENCODING_MATCH_ON_LEMMA);
+
+    ASSERT_EQUALS(token_corpus->number_of_tokens, lemma_corpus->number_of_tokens);
+    ASSERT_EQUALS(true, Count_Different_Token_Ints(lemma_corpus->token_ints) <
+            Count_Different_Token_Ints(token_corpus->token_ints));
+    ASSERT_EQUALS(true, Surface_Tokens_Equal_With_Tokens(token_corpus, token_mapping, lemma_corpus, lemma_mapping));
+
+    EncodedCorpus_DeleteObject(lemma_corpus);
+    lemma_corpus = NULL;
+    EncodedCorpus_DeleteObject(token_corpus);
+    token_corpus = NULL;
+    TokenIntMapping_DeleteObject(lemma_mapping);
+    lemma_mapping = NULL;
+    TokenIntMapping_DeleteObject(token_mapping);
+    token_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether both containers hold the same data sets (IDs, tokens and offsets) in the same order.
+ *
+ * Asserts:
+ *      container_1 != NULL
+ *      container_2 != NULL
+ *
+ * @param[in] container_1 First Token_List_Container
+ * @param[in] container_2 Second Token_List_Container
+ *
+ * @return true, if both containers are equal, otherwise false
+ */
+static _Bool
+Token_List_Containers_Equal
+(
+        const struct Token_List_Container* const container_1,
+        const struct Token_List_Container* const container_2
+)
+{
+    ASSERT_MSG(container_1 != NULL, "First Token_List_Container is NULL !");
+    ASSERT_MSG(container_2 != NULL, "Second Token_List_Container is NULL !");
+
+    if (container_1->next_free_element != container_2->next_free_element)
+    {
+        printf ("Number of token lists not equal: %" PRIuFAST32 " vs. %" PRIuFAST32 "\n",
+                container_1->next_free_element, container_2->next_free_element);
+        return false;
+    }
+
+    for (uint_fast32_t i = 0; i < container_1->next_free_element; ++ i)
+    {
+        const struct Token_List* list_1 = &(container_1->token_lists [i]);
+        const struct Token_List* list_2 = &(container_2->token_lists [i]);
+
+        if (strncmp (list_1->dataset_id, list_2->dataset_id, DATASET_ID_LENGTH) != 0 ||
+                list_1->next_free_element != list_2->next_free_element)
+        {
+            printf ("Token list %" PRIuFAST32 " not equal: ID \"%.*s\" vs. \"%.*s\"\n", i,
+                    DATASET_ID_LENGTH, list_1->dataset_id, DATASET_ID_LENGTH, list_2->dataset_id);
+            return false;
+        }
+        for (uint_fast32_t i2 = 0; i2 < list_1->next_free_element; ++ i2)
+        {
+            if (strcmp (TokenListContainer_GetToken(container_1, i, i2),
+                    TokenListContainer_GetToken(container_2, i, i2)) != 0 ||
+                    list_1->char_offsets [i2] != list_2->char_offsets [i2] ||
+                    list_1->sentence_offsets [i2] != list_2->sentence_offsets [i2] ||
+                    list_1->word_offsets [i2] != list_2->word_offsets [i2])
+            {
+                printf ("Token %" PRIuFAST32 " in the token list %" PRIuFAST32 " not equal !\n", i2, i);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a file with two configurations and check, whether both containers are equal.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the input file
+ * @param[in] number_of_threads Number of reader threads for the second read
+ * @param[in] json_parser_mode Parser for the second read (The first read uses TokenListContainer_CreateObject())
+ *
+ * @return true, if both containers are equal, otherwise false
+ */
+static _Bool
+Read_Equal_With_Default_Read
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        const enum JSON_Parser_Mode json_parser_mode
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    struct Token_List_Container* default_container = TokenListContainer_CreateObject (file_name);
+    struct Token_List_Container* other_container = TokenListContainer_CreateObjectParallel (file_name,
+            number_of_threads, json_parser_mode, JSON_TOKEN_ARRAY_TOKENS);
+
+    const _Bool result = Token_List_Containers_Equal (default_container, other_container);
+
+    TokenListContainer_DeleteObject(default_container);
+    default_container = NULL;
+    TokenListContainer_DeleteObject(other_container);
+    other_container = NULL;
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a file as Encoded_Corpus and check, whether the data sets are equal with the former encoding: first the
+ * whole file in a Token_List_Container, then all tokens in the mapping and at the end the mapped tokens.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the input file
+ * @param[in] number_of_threads Number of reader threads for the Encoded_Corpus
+ *
+ * @return true, if the IDs, the mapped tokens and the offsets are equal, otherwise false
+ */
+static _Bool
+Encoded_Corpus_Equal_With_Container_Encoding
+(
+        const char* const file_name,
+        const size_t number_of_threads
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    struct Token_List_Container* container = TokenListContainer_CreateObject (file_name);
+    struct Token_Int_Mapping* container_mapping = TokenIntMapping_CreateObject ();
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        for (uint_fast32_t i2 = 0; i2 < container->token_lists [i].next_free_element; ++ i2)
+        {
+            const char* token = TokenListContainer_GetToken (container, i, i2);
+            TokenIntMapping_AddToken (container_mapping, token, strlen (token));
+        }
+    }
+
+    struct Token_Int_Mapping* corpus_mapping = TokenIntMapping_CreateObject ();
+    struct Encoded_Corpus* corpus = EncodedCorpus_CreateObject (file_name, corpus_mapping, number_of_threads,
+            JSON_PARSER_STREAMING, NULL, ENCODING_DEFAULT);
+
+    _Bool result = (corpus->list_of_too_long_token->next_free_c_str ==
+            container->list_of_too_long_token->next_free_c_str);
+    uint_fast32_t next_data_set = 0;
+
+    // Token lists without tokens are not part of the Encoded_Corpus
+    for (uint_fast32_t i = 0; i < container->next_free_element && result; ++ i)
+    {
+        const struct Token_List* list = &(container->token_lists [i]);
+        if (list->next_free_element == 0) { continue; }
+
+        if (next_data_set >= corpus->token_ints->next_free_array ||
+                strncmp (list->dataset_id, EncodedCorpus_GetDatasetID(corpus, next_data_set), DATASET_ID_LENGTH) != 0 ||
+                (size_t) list->next_free_element != corpus->token_ints->arrays_lengths [next_data_set])
+        {
+            printf ("Data set %" PRIuFAST32 " (ID \"%.*s\") not equal !\n", next_data_set, DATASET_ID_LENGTH,
+                    list->dataset_id);
+            result = false;
+            break;
+        }
+        for (uint_fast32_t i2 = 0; i2 < list->next_free_element; ++ i2)
+        {
+            const char* token = TokenListContainer_GetToken (container, i, i2);
+            if (TokenIntMapping_TokenToInt (container_mapping, token, strlen (token)) !=
+                    corpus->token_ints->data_struct.data [next_data_set][i2] ||
+                    list->char_offsets [i2] != corpus->token_ints->data_struct.char_offsets [next_data_set][i2] ||
+                    list->sentence_offsets [i2] != corpus->token_ints->data_struct.sentence_offsets [next_data_set][i2] ||
+                    list->word_offsets [i2] != corpus->token_ints->data_struct.word_offsets [next_data_set][i2])
+            {
+                printf ("Token %" PRIuFAST32 " in the data set %" PRIuFAST32 " not equal !\n", i2, next_data_set);
+                result = false;
+                break;
+            }
+        }
+        ++ next_data_set;
+    }
+    if (result && next_data_set != corpus->token_ints->next_free_array)
+    {
+        printf ("Number of data sets not equal: %" PRIuFAST32 " vs. %" PRIuFAST32 "\n", next_data_set,
+                corpus->token_ints->next_free_array);
+        result = false;
+    }
+
+    EncodedCorpus_DeleteObject(corpus);
+    corpus = NULL;
+    TokenIntMapping_DeleteObject(corpus_mapping);
+    corpus_mapping = NULL;
+    TokenIntMapping_DeleteObject(container_mapping);
+    container_mapping = NULL;
+    TokenListContainer_DeleteObject(container);
+    container = NULL;
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a file with the surface tokens and with the lemmas and check, whether both containers hold the same data
+ * sets with the same number of tokens and the same offsets. (Only the tokens itself can be different; the surface
+ * forms of the lemma read need to be the tokens of the first read)
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      different_tokens != NULL
+ *
+ * @param[in] file_name Name of the input file
+ * @param[in] json_parser_mode Parser for both reads
+ * @param[out] different_tokens Number of lemmas, that are not equal with their surface token
+ *
+ * @return true, if the IDs, the number of tokens, the offsets and the surface forms are equal, otherwise false
+ */
+static _Bool
+Lemma_Read_Keeps_The_Surface_Offsets
+(
+        const char* const restrict file_name,
+        const enum JSON_Parser_Mode json_parser_mode,
+        size_t* const restrict different_tokens
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(different_tokens != NULL, "Pointer to the number of different tokens is NULL !");
+
+    struct Token_List_Container* token_container = TokenListContainer_CreateObjectParallel (file_name, 1,
+            json_parser_mode, JSON_TOKEN_ARRAY_TOKENS);
+    struct Token_List_Container* lemma_container = TokenListContainer_CreateObjectParallel (file_name, 1,
+            json_parser_mode, JSON_TOKEN_ARRAY_LEMMA);
+
+    _Bool result = token_container->next_free_element == lemma_container->next_free_element;
+    *different_tokens = 0;
+
+    for (uint_fast32_t i = 0; i < token_container->next_free_element && result; ++ i)
+    {
+        const struct Token_List* token_list = &(token_container->token_lists [i]);
+        const struct Token_List* lemma_list = &(lemma_container->token_lists [i]);
+
+        if (strncmp (token_list->dataset_id, lemma_list->dataset_id, DATASET_ID_LENGTH) != 0 ||
+                token_list->next_free_element != lemma_list->next_free_element)
+        {
+            printf ("Data set %" PRIuFAST32 " (ID \"%.*s\") not equal !\n", i, DATASET_ID_LENGTH,
+                    token_list->dataset_id);
+            result = false;
+            break;
+        }
+        for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
+        {
+            if (token_list->char_offsets [i2] != lemma_list->char_offsets [i2] ||
+                    token_list->sentence_offsets [i2] != lemma_list->sentence_offsets [i2] ||
+                    token_list->word_offsets [i2] != lemma_list->word_offsets [i2])
+            {
+                printf ("Offsets of the token %" PRIuFAST32 " in the data set %" PRIuFAST32 " not equal !\n", i2, i);
+                result = false;
+                break;
+            }
+            if (strcmp (TokenListContainer_GetToken (token_container, i, i2),
+                    TokenListContainer_GetToken (lemma_container, i, i2)) != 0)
+            {
+                ++ (*different_tokens);
+            }
+            if (strcmp (TokenList_GetToken (token_list, i2), TokenList_GetSurfaceToken (lemma_list, i2)) != 0)
+            {
+                printf ("Surface form of the token %" PRIuFAST32 " in the data set %" PRIuFAST32 " not equal !\n", i2,
+                        i);
+                result = false;
+                break;
+            }
+        }
+    }
+
+    TokenListContainer_DeleteObject(lemma_container);
+    lemma_container = NULL;
+    TokenListContainer_DeleteObject(token_container);
+    token_container = NULL;
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the surface forms of a lemma corpus are the tokens of a corpus with the surface tokens. Both
+ * corpora need to be encoded from the same file.
+ *
+ * Asserts:
+ *      token_corpus != NULL
+ *      token_mapping != NULL
+ *      lemma_corpus != NULL
+ *      lemma_mapping != NULL
+ *
+ * @param[in] token_corpus Encoded_Corpus with the surface tokens
+ * @param[in] token_mapping Token_Int_Mapping of the token corpus
+ * @param[in] lemma_corpus Encoded_Corpus with the lemmas (ENCODING_MATCH_ON_LEMMA)
+ * @param[in] lemma_mapping Token_Int_Mapping of the lemma corpus
+ *
+ * @return true, if every surface form is equal with the token at the same position, otherwise false
+ */
+static _Bool
+Surface_Tokens_Equal_With_Tokens
+(
+        const struct Encoded_Corpus* const restrict token_corpus,
+        const struct Token_Int_Mapping* const restrict token_mapping,
+        const struct Encoded_Corpus* const restrict lemma_corpus,
+        const struct Token_Int_Mapping* const restrict lemma_mapping
+)
+{
+    ASSERT_MSG(token_corpus != NULL, "Token corpus is NULL !");
+    ASSERT_MSG(token_mapping != NULL, "Token mapping is NULL !");
+    ASSERT_MSG(lemma_corpus != NULL, "Lemma corpus is NULL !");
+    ASSERT_MSG(lemma_mapping != NULL, "Lemma mapping is NULL !");
+
+    const struct Document_Word_List* const token_ints = token_corpus->token_ints;
+    const struct Document_Word_List* const surface_ints = lemma_corpus->surface_token_ints;
+    if (surface_ints == NULL || surface_ints->next_free_array != token_ints->next_free_array)
+    {
+        puts ("Surface forms of the lemma corpus are missing !");
+        return false;
+    }
+
+    // The result of TokenIntMapping_IntToTokenStaticMem() will be overwritten by the next call
+    char token [MAX_TOKEN_LENGTH];
+    for (uint_fast32_t i = 0; i < token_ints->next_free_array; ++ i)
+    {
+        if (surface_ints->arrays_lengths [i] != token_ints->arrays_lengths [i])
+        {
+            printf ("Number of surface forms in the data set %" PRIuFAST32 " not equal !\n", i);
+            return false;
+        }
+        for (size_t i2 = 0; i2 < token_ints->arrays_lengths [i]; ++ i2)
+        {
+            TokenIntMapping_IntToToken (token_mapping, token_ints->data_struct.data [i][i2], token, sizeof (token));
+            if (strcmp (token, TokenIntMapping_IntToTokenStaticMem (lemma_mapping,
+                    surface_ints->data_struct.data [i][i2])) != 0)
+            {
+                printf ("Surface form of the token %zu in the data set %" PRIuFAST32 " not equal !\n", i2, i);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Count the different mapping integers in a Document_Word_List.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Document_Word_List object
+ *
+ * @return Number of different mapping integers
+ */
+static size_t
+Count_Different_Token_Ints
+(
+        const struct Document_Word_List* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Document_Word_List is NULL !");
+
+    uint_fast32_t max_token_int = 0;
+    for (uint_fast32_t i = 0; i < object->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < object->arrays_lengths [i]; ++ i2)
+        {
+            max_token_int = MAX(max_token_int, object->data_struct.data [i][i2]);
+        }
+    }
+
+    _Bool* found_token_ints = (_Bool*) CALLOC((size_t) max_token_int + 1, sizeof (_Bool));
+    ASSERT_ALLOC(found_token_ints, "Cannot allocate memory for the found token ints !",
+            ((size_t) max_token_int + 1) * sizeof (_Bool));
+    size_t different_token_ints = 0;
+    for (uint_fast32_t i = 0; i < object->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < object->arrays_lengths [i]; ++ i2)
+        {
+            if (! found_token_ints [object->data_struct.data [i][i2]])
+            {
+                found_token_ints [object->data_struct.data [i][i2]] = true;
+                ++ different_token_ints;
+            }
+        }
+    }
+    FREE_AND_SET_TO_NULL(found_token_ints);
+
+    return different_token_ints;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+#ifdef HAVE_ZLIB
+/**
+ * @brief Compress a file with gzip (Async_File_Writer), read the compressed copy and check, whether the container is
+ * equal with the container of the uncompressed file.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *
+ * @param[in] file_name Name of the uncompressed input file
+ * @param[in] number_of_threads Number of reader threads for the compressed file
+ *
+ * @return true, if both containers are equal, otherwise false
+ */
+static _Bool
+Compressed_Read_Equal_With_Default_Read
+(
+        const char* const file_name,
+        const size_t number_of_threads
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    struct Mapped_File* input_file = MappedFile_CreateObject(file_name);
+    struct Async_File_Writer* writer = AsyncFileWriter_CreateObject(TEST_FILE_READER_GZIP_FILE, 0, true);
+    AsyncFileWriter_Write(writer, input_file->data, (size_t) input_file->size);
+    AsyncFileWriter_DeleteObject(writer);
+    writer = NULL;
+    MappedFile_DeleteObject(input_file);
+    input_file = NULL;
+
+    struct Token_List_Container* container = TokenListContainer_CreateObject(file_name);
+    struct Token_List_Container* container_compressed = TokenListContainer_CreateObjectParallel
+            (TEST_FILE_READER_GZIP_FILE, number_of_threads, JSON_PARSER_STREAMING, JSON_TOKEN_ARRAY_TOKENS);
+    remove(TEST_FILE_READER_GZIP_FILE);
+
+    const _Bool result = Token_List_Containers_Equal(container, container_compressed);
+
+    TokenListContainer_DeleteObject(container_compressed);
+    container_compressed = NULL;
+    TokenListContainer_DeleteObject(container);
+    container = NULL;
+
+    return result;
+}
+#endif /* HAVE_ZLIB */
+
+//---------------------------------------------------------------------------------------------------------------------
+
 #ifdef TEST_FILE_READER_TEST_FILE
 #undef TEST_FILE_READER_TEST_FILE
 #endif /* TEST_FILE_READER_TEST_FILE */
@@ -168,6 +926,22 @@ extern void TEST_Length_Of_The_First_25_Tokenarrays (void)
 #undef TEST_FILE_READER_TEST_FILE_MD5
 #endif /* TEST_FILE_READER_TEST_FILE_MD5 */
 
+#ifdef TEST_FILE_READER_JSONL_TEST_FILE
+#undef TEST_FILE_READER_JSONL_TEST_FILE
+#endif /* TEST_FILE_READER_JSONL_TEST_FILE */
+
+#ifdef TEST_FILE_READER_TXT_TEST_FILE
+#undef TEST_FILE_READER_TXT_TEST_FILE
+#endif /* TEST_FILE_READER_TXT_TEST_FILE */
+
+#ifdef TEST_FILE_READER_NUMBER_OF_THREADS
+#undef TEST_FILE_READER_NUMBER_OF_THREADS
+#endif /* TEST_FILE_READER_NUMBER_OF_THREADS */
+
+#ifdef TEST_FILE_READER_GZIP_FILE
+#undef TEST_FILE_READER_GZIP_FILE
+#endif /* TEST_FILE_READER_GZIP_FILE */
+
 #ifdef NUMBER_OF_TOKENARRAYS
 #undef NUMBER_OF_TOKENARRAYS
 #endif /* NUMBER_OF_TOKENARRAYS */
@@ -37,6 +37,35 @@ extern void TEST_Max_Tokenarray_Length (void);
  */
 extern void TEST_Length_Of_The_First_25_Tokenarrays (void);
 
+/**
+ * @brief Check, whether the parallel reading creates the same data sets (IDs, tokens and order) as the serial reading.
+ */
+extern void TEST_Parallel_Read_Equal_With_Serial_Read (void);
+
+/**
+ * @brief Check, whether the streaming scanner creates the same data sets (IDs, tokens, offsets and order) as the cJSON
+ * parser.
+ */
+extern void TEST_Streaming_Scanner_Equal_With_cJSON_Parser (void);
+
+/**
+ * @brief Check, whether the single pass encoding (Encoded_Corpus) creates the same mapped data sets (IDs, integers and
+ * offsets) as the encoding over a Token_List_Container.
+ */
+extern void TEST_Encoded_Corpus_Equal_With_Token_List_Container (void);
+
+/**
+ * @brief Check, whether a gzip compressed file creates the same data sets (IDs, tokens, offsets and order) as the
+ * uncompressed file.
+ */
+extern void TEST_Compressed_Read_Equal_With_Uncompressed_Read (void);
+
+/**
+ * @brief Check, whether the lemma mode maps the lemmas instead of the surface tokens, while the offsets still belong to
+ * the surface tokens.
+ */
+extern void TEST_Lemma_Read_Keeps_The_Surface_Offsets (void);
+
 
 
 #ifdef __cplusplus
@@ -37,6 +37,17 @@ Add_Newline
     const size_t parsing_result_length
 );
 
+/**
+ * @brief Parse the test fragments in situ (optional in an arena) and compare the trees with the default parsing.
+ *
+ * @param[in] arena cJSON arena (NULL: the in-situ parse without arena will be used)
+ */
+static void
+Compare_In_Situ_Parse_With_Default_Parse
+(
+    cJSON_Arena* const arena
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 extern void TEST_cJSON_Parse_JSON_Fragment (void)
@@ -232,6 +243,31 @@ extern void TEST_cJSON_Get_Token_Array_From_JSON_Fragment (void)
 
 //---------------------------------------------------------------------------------------------------------------------
 
+extern void TEST_cJSON_In_Situ_Parse_Equal_With_Default_Parse (void)
+{
+    Compare_In_Situ_Parse_With_Default_Parse (NULL);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+extern void TEST_cJSON_Arena_Parse_Equal_With_Default_Parse (void)
+{
+    // Small blocks: the trees need several blocks and the blocks will be reused after every reset
+    cJSON_Arena* arena = cJSON_CreateArena(256);
+    ASSERT_ALLOC(arena, "Cannot allocate memory for the cJSON arena !", (size_t) 256);
+
+    Compare_In_Situ_Parse_With_Default_Parse (arena);
+
+    cJSON_DeleteArena(arena);
+    arena = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 extern void TEST_cJSON_Parse_Full_JSON_File (void)
 {
     const char input_file_name [] = "./src/Tests/Test_Data/test_ebm.json";
@@ -478,3 +514,89 @@ Add_Newline
     return parsing_result;
 }
 //---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Parse the test fragments in situ (optional in an arena) and compare the trees with the default parsing.
+ *
+ * @param[in] arena cJSON arena (NULL: the in-situ parse without arena will be used)
+ */
+static void
+Compare_In_Situ_Parse_With_Default_Parse
+(
+    cJSON_Arena* const arena
+)
+{
+    const char test_file_content [] =
+    {
+            #include "./Test_Data/JSON_Fragment_1.json"
+    };
+    // Escape sequences, that shorten the strings in different ways (inkl. a surrogate pair and escaped names), and a
+    // broken fragment at the end
+    const char escaped_content [] =
+            "{\"na\\u006De\": {\"tokens\": [\"a\\\"b\", \"\\u00e9t\\u00E9\", \"\\ud83d\\ude00\", \"x\\\\/\\/y\", "
+            "\"\\t\\n\"]}, \"id\": 42}\n"
+            "[\"\\u20AC\", {\"k\\\"\": \"v\"}, null, true, 1.5]\n"
+            "{\"broken\": [\"a\", \"b\\u00";
+    const char* const test_data [] = { test_file_content, escaped_content };
+
+    size_t fragments = 0;
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(test_data); ++ i)
+    {
+        const size_t length = strlen (test_data [i]);
+        char* in_situ_buffer = (char*) MALLOC (length * sizeof (char));
+        ASSERT_ALLOC(in_situ_buffer, "Cannot allocate memory for the in-situ buffer !", length * sizeof (char));
+        memcpy (in_situ_buffer, test_data [i], length);
+
+        const char* default_position = test_data [i];
+        const char* in_situ_position = in_situ_buffer;
+        while (*default_position != '\0')
+        {
+            cJSON* default_json = cJSON_ParseWithOpts(default_position, &default_position, false);
+            char* const fragment_begin = in_situ_buffer + (in_situ_position - in_situ_buffer);
+            const size_t fragment_length = length - (size_t) (in_situ_position - in_situ_buffer);
+            cJSON* in_situ_json = (arena == NULL) ?
+                    cJSON_ParseInSituWithLengthOpts(fragment_begin, fragment_length, &in_situ_position, false) :
+                    cJSON_ParseInSituWithArena(fragment_begin, fragment_length, &in_situ_position, false, arena);
+
+            // Both parser stop at the same position
+            ASSERT_EQUALS(default_position - test_data [i], in_situ_position - in_situ_buffer);
+            ASSERT_EQUALS(default_json == NULL, in_situ_json == NULL);
+            if (default_json == NULL)
+            {
+                break;
+            }
+
+            char* default_result = cJSON_PrintUnformatted(default_json);
+            char* in_situ_result = cJSON_PrintUnformatted(in_situ_json);
+            ASSERT_STRING_EQUALS(default_result, in_situ_result);
+            ++ fragments;
+
+            free (default_result);
+            default_result = NULL;
+            free (in_situ_result);
+            in_situ_result = NULL;
+            cJSON_Delete(default_json);
+            default_json = NULL;
+            if (arena == NULL)
+            {
+                cJSON_Delete(in_situ_json);
+            }
+            else
+            {
+                cJSON_ResetArena(arena);
+            }
+            in_situ_json = NULL;
+
+            while (*default_position == '\n' || *default_position == ' ')
+            {
+                ++ default_position;
+                ++ in_situ_position;
+            }
+        }
+
+        FREE_AND_SET_TO_NULL(in_situ_buffer);
+    }
+    PRINTF_FFLUSH("Compared %zu fragments\n", fragments);
+
+    return;
+}
@@ -24,6 +24,10 @@ extern void TEST_cJSON_Get_Token_Array_From_JSON_Fragment (void);
 
 extern void TEST_cJSON_Parse_Full_JSON_File (void);
 
+extern void TEST_cJSON_In_Situ_Parse_Equal_With_Default_Parse (void);
+
+extern void TEST_cJSON_Arena_Parse_Equal_With_Default_Parse (void);
+
 
 
 #ifdef __cplusplus
@@ -66,6 +66,27 @@ Pseudo_Hash_Function
         const size_t input_str_length
 );
 
+/**
+ * @brief Increase the memory of the chosen C-String array (and the corresponding int mapping array) by
+ * increase_number_of_tokens tokens. (Normally C_STR_ALLOCATION_STEP_SIZE)
+ *
+ * Asserts:
+ *      object != NULL
+ *      chosen_c_string_array < C_STR_ARRAYS
+ *      increase_number_of_tokens > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] chosen_c_string_array Index of the C-String array
+ * @param[in] increase_number_of_tokens Number of new tokens, that can be saved in the array after the call
+ */
+static void
+Increase_C_String_Array_Size
+(
+        struct Token_Int_Mapping* const object,
+        const uint_fast32_t chosen_c_string_array,
+        const size_t increase_number_of_tokens
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -178,6 +199,41 @@ TokenIntMapping_AddToken
         const char* const restrict new_token,
         const size_t new_token_length
 )
+{
+    _Bool token_added = false;
+    TokenIntMapping_AddTokenAndGetInt(object, new_token, new_token_length, &token_added);
+
+    return token_added;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add a token to the mapping (if it is not already in the mapping) and return the mapping integer of the token.
+ *
+ * This combines TokenIntMapping_AddToken() and TokenIntMapping_TokenToInt() with only one search in the chosen
+ * C-String array. The mapping integers are equal with the integers of TokenIntMapping_AddToken().
+ *
+ * Asserts:
+ *      object != NULL
+ *      new_token != NULL
+ *      new_token_length > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] new_token_length Length of the new token
+ * @param[out] token_added If pointer given, it "returns", whether the token was added to the mapping
+ *
+ * @return The mapping integer of the token
+ */
+extern uint_fast32_t
+TokenIntMapping_AddTokenAndGetInt
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const size_t new_token_length,
+        _Bool* const restrict token_added
+)
 {
     ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
     ASSERT_MSG(new_token != NULL, "New token is NULL !");
@@ -188,31 +244,7 @@ TokenIntMapping_AddToken
     // Is more memory necessary to hold the new token ? Yes: Realloc the memory
     if (object->c_str_array_lengths [chosen_c_string_array] >= object->allocated_c_strings_in_array [chosen_c_string_array])
     {
-        static size_t token_to_int_realloc_counter = 0;
-        ++ token_to_int_realloc_counter;
-
-        const size_t old_size = object->allocated_c_strings_in_array [chosen_c_string_array];
-        const size_t new_size = old_size + C_STR_ALLOCATION_STEP_SIZE;
-        const size_t new_c_string_array_size    = new_size * MAX_TOKEN_LENGTH * sizeof (char);
-        const size_t new_int_mapping_array_size = new_size * 1 * sizeof (uint_fast32_t); // NO MAX_TOKEN_LENGTH !
-
-        // Reallocate the c strings and the int mapping memory
-        char* tmp_ptr = (char*) REALLOC(object->c_str_arrays [chosen_c_string_array], new_c_string_array_size);
-        ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for token to int mapping data !", new_c_string_array_size);
-        memset(tmp_ptr + (old_size * MAX_TOKEN_LENGTH), '\0', C_STR_ALLOCATION_STEP_SIZE * MAX_TOKEN_LENGTH *
-                sizeof (char));
-
-        uint_fast32_t* tmp_ptr_2 = (uint_fast32_t*) REALLOC(object->int_mapping [chosen_c_string_array], new_int_mapping_array_size);
-        ASSERT_ALLOC(tmp_ptr_2, "Cannot reallocate memory for token to int mapping data !", new_int_mapping_array_size);
-        memset(tmp_ptr_2 + (old_size), '\0', C_STR_ALLOCATION_STEP_SIZE * 1 * sizeof (uint_fast32_t)); // NO MAX_TOKEN_LENGTH !
-
-        object->c_str_arrays [chosen_c_string_array]    = tmp_ptr;
-        object->int_mapping [chosen_c_string_array]     = tmp_ptr_2;
-
-        object->allocated_c_strings_in_array [chosen_c_string_array] = new_size;
-
-        //PRINTF_FFLUSH("Token to int realloc. From %zu to %zu objects (%zu times)\n", old_size, new_size,
-        //        token_to_int_realloc_counter);
+        Increase_C_String_Array_Size(object, chosen_c_string_array, C_STR_ALLOCATION_STEP_SIZE);
     }
 
     char* start_to_str = object->c_str_arrays [chosen_c_string_array];
@@ -222,6 +254,7 @@ TokenIntMapping_AddToken
 
     // Is the new token already in the list ?
     _Bool token_already_in_list = false;
+    uint_fast32_t mapping_int = UINT_FAST32_MAX;
     for (uint_fast32_t i = 0; i < c_str_array_length; ++ i)
     {
         // Pre check the first char to avoid strncmp calls
@@ -233,6 +266,7 @@ TokenIntMapping_AddToken
                 if (strncmp (new_token, to_str, new_token_length) == 0)
                 {
                     token_already_in_list = true;
+                    mapping_int = int_mapping_array [i];
                     break;
                 }
             }
@@ -271,9 +305,126 @@ TokenIntMapping_AddToken
 
         int_mapping_array [object->c_str_array_lengths [chosen_c_string_array]] = max_mapping_int_in_chosen_array;
         object->c_str_array_lengths [chosen_c_string_array] ++;
+        mapping_int = max_mapping_int_in_chosen_array;
+    }
+
+    if (token_added != NULL)
+    {
+        *token_added = ! token_already_in_list;
+    }
+
+    return mapping_int;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add a token with an already known mapping integer.
+ *
+ * This is the counterpart of the export of a mapping (e.g. the vocabulary in a binary result file): the mapping
+ * integer encodes the C-String array, so the token will be placed in exactly this array; the pseudo hash function
+ * will not be used. There is NO check, whether the token or the integer is already in the mapping !
+ *
+ * Asserts:
+ *      object != NULL
+ *      new_token != NULL
+ *      new_token_length > 0
+ *      mapping_int != UINT_FAST32_MAX
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] new_token_length Length of the new token
+ * @param[in] mapping_int Mapping integer of the new token
+ */
+extern void
+TokenIntMapping_AddTokenWithMappedInt
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const size_t new_token_length,
+        const uint_fast32_t mapping_int
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(new_token != NULL, "New token is NULL !");
+    ASSERT_MSG(new_token_length > 0, "New token has the length 0 !");
+    ASSERT_MSG(mapping_int != UINT_FAST32_MAX, "Mapping integer is UINT_FAST32_MAX ! This value indicates errors and "
+            "therefore cannot be a valid input !");
+
+    // The encoding in the first two digits (in decimal system) is the chosen C-String array
+    const uint_fast32_t chosen_c_string_array = mapping_int % C_STR_ARRAYS;
+
+    if (object->c_str_array_lengths [chosen_c_string_array] >= object->allocated_c_strings_in_array [chosen_c_string_array])
+    {
+        Increase_C_String_Array_Size(object, chosen_c_string_array, C_STR_ALLOCATION_STEP_SIZE);
     }
 
-    return ! token_already_in_list;
+    char* to_str = &(object->c_str_arrays [chosen_c_string_array][object->c_str_array_lengths [chosen_c_string_array] *
+            MAX_TOKEN_LENGTH]);
+    const size_t copy_length = (new_token_length >= MAX_TOKEN_LENGTH) ? MAX_TOKEN_LENGTH - 1 : new_token_length;
+    memcpy (to_str, new_token, copy_length);
+    to_str [copy_length] = '\0';
+
+    object->int_mapping [chosen_c_string_array][object->c_str_array_lengths [chosen_c_string_array]] = mapping_int;
+    object->c_str_array_lengths [chosen_c_string_array] ++;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append a whole block of tokens with their mapping integers to one C-String array.
+ *
+ * This is the counterpart of the flat export of the C-String arrays (e.g. the vocabulary in a compiled corpus file):
+ * the tokens are already in the layout of the C-String arrays (MAX_TOKEN_LENGTH chars per token), so the block will
+ * be copied without any search. There is NO check, whether the tokens or the integers are already in the mapping !
+ *
+ * Asserts:
+ *      object != NULL
+ *      chosen_c_string_array < C_STR_ARRAYS
+ *      tokens != NULL
+ *      mapping_ints != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] chosen_c_string_array Index of the C-String array
+ * @param[in] tokens Tokens (number_of_tokens * MAX_TOKEN_LENGTH chars; every token is null terminated)
+ * @param[in] mapping_ints Mapping integers of the tokens
+ * @param[in] number_of_tokens Number of tokens in the block
+ */
+extern void
+TokenIntMapping_AppendCStringArray
+(
+        struct Token_Int_Mapping* const restrict object,
+        const uint_fast32_t chosen_c_string_array,
+        const char* const restrict tokens,
+        const uint_fast32_t* const restrict mapping_ints,
+        const size_t number_of_tokens
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_FMSG(chosen_c_string_array < C_STR_ARRAYS, "Invalid C-String array index: %" PRIuFAST32 " !",
+            chosen_c_string_array);
+    ASSERT_MSG(tokens != NULL, "Tokens are NULL !");
+    ASSERT_MSG(mapping_ints != NULL, "Mapping integers are NULL !");
+
+    if (number_of_tokens == 0) { return; }
+
+    const size_t used_tokens = (size_t) object->c_str_array_lengths [chosen_c_string_array];
+    if (used_tokens + number_of_tokens > object->allocated_c_strings_in_array [chosen_c_string_array])
+    {
+        // One reallocation for the whole block
+        Increase_C_String_Array_Size(object, chosen_c_string_array, used_tokens + number_of_tokens -
+                object->allocated_c_strings_in_array [chosen_c_string_array]);
+    }
+
+    memcpy (&(object->c_str_arrays [chosen_c_string_array][used_tokens * MAX_TOKEN_LENGTH]), tokens,
+            number_of_tokens * MAX_TOKEN_LENGTH * sizeof (char));
+    memcpy (&(object->int_mapping [chosen_c_string_array][used_tokens]), mapping_ints,
+            number_of_tokens * sizeof (uint_fast32_t));
+    object->c_str_array_lengths [chosen_c_string_array] += (uint_fast32_t) number_of_tokens;
+
+    return;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -530,6 +681,63 @@ TokenIntMapping_IntToTokenStaticMem
 
 //=====================================================================================================================
 
+/**
+ * @brief Increase the memory of the chosen C-String array (and the corresponding int mapping array) by
+ * increase_number_of_tokens tokens. (Normally C_STR_ALLOCATION_STEP_SIZE)
+ *
+ * Asserts:
+ *      object != NULL
+ *      chosen_c_string_array < C_STR_ARRAYS
+ *      increase_number_of_tokens > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] chosen_c_string_array Index of the C-String array
+ * @param[in] increase_number_of_tokens Number of new tokens, that can be saved in the array after the call
+ */
+static void
+Increase_C_String_Array_Size
+(
+        struct Token_Int_Mapping* const object,
+        const uint_fast32_t chosen_c_string_array,
+        const size_t increase_number_of_tokens
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_FMSG(chosen_c_string_array < C_STR_ARRAYS, "Invalid C-String array index: %" PRIuFAST32 " !",
+            chosen_c_string_array);
+    ASSERT_MSG(increase_number_of_tokens > 0, "Number of new tokens is 0 !");
+
+    static size_t token_to_int_realloc_counter = 0;
+    ++ token_to_int_realloc_counter;
+
+    const size_t old_size = object->allocated_c_strings_in_array [chosen_c_string_array];
+    const size_t new_size = old_size + increase_number_of_tokens;
+    const size_t new_c_string_array_size    = new_size * MAX_TOKEN_LENGTH * sizeof (char);
+    const size_t new_int_mapping_array_size = new_size * 1 * sizeof (uint_fast32_t); // NO MAX_TOKEN_LENGTH !
+
+    // Reallocate the c strings and the int mapping memory
+    char* tmp_ptr = (char*) REALLOC(object->c_str_arrays [chosen_c_string_array], new_c_string_array_size);
+    ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for token to int mapping data !", new_c_string_array_size);
+    memset(tmp_ptr + (old_size * MAX_TOKEN_LENGTH), '\0', increase_number_of_tokens * MAX_TOKEN_LENGTH *
+            sizeof (char));
+
+    uint_fast32_t* tmp_ptr_2 = (uint_fast32_t*) REALLOC(object->int_mapping [chosen_c_string_array], new_int_mapping_array_size);
+    ASSERT_ALLOC(tmp_ptr_2, "Cannot reallocate memory for token to int mapping data !", new_int_mapping_array_size);
+    memset(tmp_ptr_2 + (old_size), '\0', increase_number_of_tokens * 1 * sizeof (uint_fast32_t)); // NO MAX_TOKEN_LENGTH !
+
+    object->c_str_arrays [chosen_c_string_array]    = tmp_ptr;
+    object->int_mapping [chosen_c_string_array]     = tmp_ptr_2;
+
+    object->allocated_c_strings_in_array [chosen_c_string_array] = new_size;
+
+    //PRINTF_FFLUSH("Token to int realloc. From %zu to %zu objects (%zu times)\n", old_size, new_size,
+    //        token_to_int_realloc_counter);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief A very very very simple "hash function".
  *
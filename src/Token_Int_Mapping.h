@@ -164,6 +164,89 @@ TokenIntMapping_AddToken
         const size_t new_token_length
 );
 
+/**
+ * @brief Add a token to the mapping (if it is not already in the mapping) and return the mapping integer of the token.
+ *
+ * This combines TokenIntMapping_AddToken() and TokenIntMapping_TokenToInt() with only one search in the chosen
+ * C-String array. The mapping integers are equal with the integers of TokenIntMapping_AddToken().
+ *
+ * Asserts:
+ *      object != NULL
+ *      new_token != NULL
+ *      new_token_length > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] new_token_length Length of the new token
+ * @param[out] token_added If pointer given, it "returns", whether the token was added to the mapping
+ *
+ * @return The mapping integer of the token
+ */
+extern uint_fast32_t
+TokenIntMapping_AddTokenAndGetInt
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const size_t new_token_length,
+        _Bool* const restrict token_added
+);
+
+/**
+ * @brief Add a token with an already known mapping integer.
+ *
+ * This is the counterpart of the export of a mapping (e.g. the vocabulary in a binary result file): the mapping
+ * integer encodes the C-String array, so the token will be placed in exactly this array; the pseudo hash function
+ * will not be used. There is NO check, whether the token or the integer is already in the mapping !
+ *
+ * Asserts:
+ *      object != NULL
+ *      new_token != NULL
+ *      new_token_length > 0
+ *      mapping_int != UINT_FAST32_MAX
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] new_token_length Length of the new token
+ * @param[in] mapping_int Mapping integer of the new token
+ */
+extern void
+TokenIntMapping_AddTokenWithMappedInt
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const size_t new_token_length,
+        const uint_fast32_t mapping_int
+);
+
+/**
+ * @brief Append a whole block of tokens with their mapping integers to one C-String array.
+ *
+ * This is the counterpart of the flat export of the C-String arrays (e.g. the vocabulary in a compiled corpus file):
+ * the tokens are already in the layout of the C-String arrays (MAX_TOKEN_LENGTH chars per token), so the block will
+ * be copied without any search. There is NO check, whether the tokens or the integers are already in the mapping !
+ *
+ * Asserts:
+ *      object != NULL
+ *      chosen_c_string_array < C_STR_ARRAYS
+ *      tokens != NULL
+ *      mapping_ints != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] chosen_c_string_array Index of the C-String array
+ * @param[in] tokens Tokens (number_of_tokens * MAX_TOKEN_LENGTH chars; every token is null terminated)
+ * @param[in] mapping_ints Mapping integers of the tokens
+ * @param[in] number_of_tokens Number of tokens in the block
+ */
+extern void
+TokenIntMapping_AppendCStringArray
+(
+        struct Token_Int_Mapping* const restrict object,
+        const uint_fast32_t chosen_c_string_array,
+        const char* const restrict tokens,
+        const uint_fast32_t* const restrict mapping_ints,
+        const size_t number_of_tokens
+);
+
 /**
  * @brief Print the number of tokens in all C-Strings.
  *
@@ -17,6 +17,12 @@
 #include <stdarg.h>
 #include "utf8.h"
 
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif /* defined(__AVX2__) */
+
 static const u_int32_t offsetsFromUTF8[6] = {
     0x00000000UL, 0x00003080UL, 0x000E2080UL,
     0x03C82080UL, 0xFA082080UL, 0x82082080UL
@@ -208,6 +214,65 @@ int u8_strlen(char *s)
     return count;
 }
 
+/* number of characters in the first sz bytes of a string (no terminator needed).
+   every byte, that is not a continuation byte, starts a character. blocks
+   without a high bit (only ASCII) will be counted without a look at the single
+   bytes. the result is equal with u8_strlen(), if the bytes contain no '\0'. */
+size_t u8_strnlen(const char *s, const size_t sz)
+{
+    const unsigned char *bytes = (const unsigned char *)s;
+    size_t count = 0;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 32 <= sz; i += 32) {
+        const __m256i block = _mm256_loadu_si256((const __m256i *)(bytes + i));
+        if (_mm256_movemask_epi8(block) == 0) {
+            count += 32;
+        }
+        else {
+            /* continuation bytes (0x80 - 0xBF) are less than -64 as signed char */
+            const __m256i cont = _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), block);
+            count += 32 - (size_t)__builtin_popcount((unsigned int)_mm256_movemask_epi8(cont));
+        }
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= sz; i += 16) {
+        const __m128i block = _mm_loadu_si128((const __m128i *)(bytes + i));
+        if (_mm_movemask_epi8(block) == 0) {
+            count += 16;
+        }
+        else {
+            /* continuation bytes (0x80 - 0xBF) are less than -64 as signed char */
+            const __m128i cont = _mm_cmplt_epi8(block, _mm_set1_epi8(-64));
+            count += 16 - (size_t)__builtin_popcount((unsigned int)_mm_movemask_epi8(cont));
+        }
+    }
+#endif /* defined(__AVX2__) */
+
+    /* 8 bytes at once without SIMD instructions */
+    for (; i + sizeof(uint64_t) <= sz; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        if ((word & 0x8080808080808080ULL) == 0) {
+            count += sizeof(uint64_t);
+        }
+        else {
+            size_t j;
+            for (j = 0; j < sizeof(uint64_t); j++)
+                count += isutf(bytes[i + j]) ? 1 : 0;
+        }
+    }
+    for (; i < sz; i++)
+        count += isutf(bytes[i]) ? 1 : 0;
+
+    /* like u8_nextchar(): the first byte is always a character */
+    if (sz > 0 && !isutf(bytes[0]))
+        count++;
+
+    return count;
+}
+
 /* reads the next utf-8 sequence out of a string, updating an index */
 u_int32_t u8_nextchar(char *s, int *i)
 {
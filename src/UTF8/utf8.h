@@ -1,4 +1,5 @@
 #include <stdarg.h>
+#include <stddef.h>
 #include <inttypes.h>
 // C99 check
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
@@ -73,6 +74,10 @@ char *u8_memchr(char *s, const u_int32_t ch, const size_t sz, int *charn);
 /* count the number of characters in a UTF-8 string */
 int u8_strlen(char *s);
 
+/* count the number of characters in the first sz bytes of a UTF-8 string
+   (fast path for ASCII blocks; the bytes need no terminator) */
+size_t u8_strnlen(const char *s, const size_t sz);
+
 int u8_is_locale_utf8(char *locale);
 
 /* printf where the format string and arguments may be in UTF-8.
@@ -56,13 +56,12 @@ argparse_getvalue(struct argparse *self, const struct argparse_option *opt,
         goto skipped;
     switch (opt->type) {
     case ARGPARSE_OPT_BOOLEAN:
+        // All boolean CLI parameter in this project are _Bool variables. An int access would override the memory
+        // behind the _Bool variable !
         if (flags & OPT_UNSET) {
-            *(int *)opt->value = *(int *)opt->value - 1;
+            *(_Bool *)opt->value = 0;
         } else {
-            *(int *)opt->value = *(int *)opt->value + 1;
-        }
-        if (*(int *)opt->value < 0) {
-            *(int *)opt->value = 0;
+            *(_Bool *)opt->value = 1;
         }
         break;
     case ARGPARSE_OPT_BIT:
@@ -161,6 +161,9 @@ IS_CONST_STR(N_A)
 #include "Intersection_Approaches.h"
 #include "Misc.h"
 #include "Exec_Intersection.h"
+#include "Corpus_File.h"
+#include "Exec_Config.h"
+#include "Result_Export.h"
 
 #include "Tests/tinytest.h"
 #include "Tests/TEST_cJSON_Parser.h"
@@ -239,6 +242,10 @@ int main (const int argc, const char* argv [])
             OPT_STRING('i', "input", &GLOBAL_CLI_INPUT_FILE, "First input file", NULL, 0, 0),
             OPT_STRING('j', "input2", &GLOBAL_CLI_INPUT_FILE2, "Second input file", NULL, 0, 0),
             OPT_STRING('o', "output", &GLOBAL_CLI_OUTPUT_FILE, "Output file", NULL, 0, 0),
+            OPT_STRING('b', "batch", &GLOBAL_CLI_BATCH_FILE, "Job list file: Every line contains a second input file and an output file (replaces -j and -o)", NULL, 0, 0),
+            OPT_STRING('\0', "compile_corpus", &GLOBAL_CLI_COMPILE_CORPUS, "Encode the first input file and write it as compiled corpus file (can be used later as first input file)", NULL, 0, 0),
+            OPT_STRING('\0', "append_corpus", &GLOBAL_CLI_APPEND_CORPUS, "Encode the first input file and append it to an existing compiled corpus file", NULL, 0, 0),
+            OPT_STRING('\0', "compact_corpus", &GLOBAL_CLI_COMPACT_CORPUS, "Rewrite a compiled corpus file with only one segment", NULL, 0, 0),
 
             OPT_GROUP("Additional functions"),
             OPT_BOOLEAN('f', "format", &GLOBAL_CLI_FORMAT_OUTPUT, "Format the output for better readability in a normal editor ?", NULL, 0, 0),
@@ -248,6 +255,16 @@ int main (const int argc, const char* argv [])
             OPT_BOOLEAN('\0', "no_part_matches", &GLOBAL_CLI_NO_PART_MATCHES, "Don't show partitial matches in the output file", NULL, 0, 0),
             OPT_BOOLEAN('\0', "no_full_matches", &GLOBAL_CLI_NO_FULL_MATCHES, "Don't show full matches in the output file", NULL, 0, 0),
             OPT_BOOLEAN('k', "keep_single_token_results", &GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN, "Keep results with only one token", NULL, 0, 0),
+            OPT_STRING('\0', "output_format", &GLOBAL_CLI_OUTPUT_FORMAT, "Output format: json (default), ndjson, tsv or binary", NULL, 0, 0),
+            OPT_BOOLEAN('\0', "counts_only", &GLOBAL_CLI_COUNTS_ONLY, "Determine and export only the match counters (no intersection results)", NULL, 0, 0),
+            OPT_STRING('\0', "match_on", &GLOBAL_CLI_MATCH_ON, "JSON array, that will be matched: tokens (default) or lemma (the inflected forms of a word get the same mapping integer; the char offsets belong still to the tokens)", NULL, 0, 0),
+            OPT_BOOLEAN('\0', "cjson_parser", &GLOBAL_CLI_CJSON_PARSER, "Parse JSON files with the validating cJSON parser (slower than the default streaming scanner)", NULL, 0, 0),
+            OPT_INTEGER('\0', "reader_threads", &GLOBAL_CLI_READER_THREADS, "Number of threads, that parse one input file (default: 1)", NULL, 0, 0),
+            OPT_INTEGER('\0', "preallocate_output", &GLOBAL_CLI_PREALLOCATE_OUTPUT, "Preallocate the output file with the given size in MiB", NULL, 0, 0),
+            OPT_BOOLEAN('z', "compress_output", &GLOBAL_CLI_COMPRESS_OUTPUT, "Write a gzip compressed output file (gzip/zstd input files will be detected automatically)", NULL, 0, 0),
+            OPT_STRING('\0', "stop_words", &GLOBAL_CLI_STOP_WORD_FILE, "File with additional stop words (one word per line; can be used several times). These tokens will be removed, when the input files will be read", Add_CLI_Parameter_CLI_STOP_WORD_FILE, 0, 0),
+            OPT_FLOAT('\0', "max_df", &GLOBAL_CLI_MAX_DOCUMENT_FREQUENCY, "Tokens in more than this fraction of the data sets of the first input file (e.g. 0.2) are stop words. They will be removed from both input files", Set_CLI_Parameter_CLI_MAX_DOCUMENT_FREQUENCY, 0, 0),
+            OPT_STRING('\0', "binary_to_json", &GLOBAL_CLI_BINARY_TO_JSON, "Convert a binary result file to a JSON result file (-o)", NULL, 0, 0),
 
             OPT_GROUP("Debug / test functions"),
             OPT_BOOLEAN('T', "run_all_test_functions", &GLOBAL_RUN_ALL_TEST_FUNCTIONS,
@@ -279,6 +296,40 @@ int main (const int argc, const char* argv [])
         Check_CLI_Parameter_GLOBAL_ABORT_PROCESS_PERCENT();
         printf ("Abort percent value: %f\n", GLOBAL_ABORT_PROCESS_PERCENT);
     }
+    if (GLOBAL_CLI_BINARY_TO_JSON != NULL)
+    {
+        // The conversion of a binary result file needs no input files
+        printf ("Binary file:  \"%s\"\n", GLOBAL_CLI_BINARY_TO_JSON);
+        Check_CLI_Parameter_CLI_BINARY_TO_JSON();
+        if (GLOBAL_CLI_OUTPUT_FILE == NULL)
+        {
+            PUTS_FFLUSH ("Missing output file. Option: [-o / --output]");
+            EXIT(EXIT_FAILURE);
+        }
+        if (strcmp(GLOBAL_CLI_BINARY_TO_JSON, GLOBAL_CLI_OUTPUT_FILE) == 0)
+        {
+            FPRINTF_FFLUSH(stderr, "\nThe binary file and the output file are the same files (%s) !\n",
+                    GLOBAL_CLI_OUTPUT_FILE);
+            EXIT(EXIT_FAILURE);
+        }
+        printf ("Output file:  \"%s\"\n", GLOBAL_CLI_OUTPUT_FILE);
+        Check_CLI_Parameter_CLI_OUTPUT_FILE();
+
+        ResultExport_ConvertBinaryToJSON(GLOBAL_CLI_BINARY_TO_JSON, GLOBAL_CLI_OUTPUT_FILE, GLOBAL_CLI_FORMAT_OUTPUT);
+
+        return EXIT_SUCCESS;
+    }
+    if (GLOBAL_CLI_COMPACT_CORPUS != NULL)
+    {
+        // The compaction needs no input files
+        printf ("Corpus file:  \"%s\"\n", GLOBAL_CLI_COMPACT_CORPUS);
+        Check_CLI_Parameter_CLI_COMPACT_CORPUS();
+        Check_CLI_Parameter_CLI_MATCH_ON();
+
+        CorpusFile_Compact(GLOBAL_CLI_COMPACT_CORPUS, Get_CLI_Parameter_CLI_MATCH_ON());
+
+        return EXIT_SUCCESS;
+    }
     if (GLOBAL_CLI_INPUT_FILE != NULL)
     {
         printf ("Input file 1: \"%s\"\n", GLOBAL_CLI_INPUT_FILE);
@@ -289,27 +340,73 @@ int main (const int argc, const char* argv [])
         PUTS_FFLUSH ("Missing first input file. Option: [-i / --input]");
         EXIT(EXIT_FAILURE);
     }
-    if (GLOBAL_CLI_INPUT_FILE2 != NULL)
+    if (GLOBAL_CLI_COMPILE_CORPUS != NULL)
     {
-        printf ("Input file 2: \"%s\"\n", GLOBAL_CLI_INPUT_FILE2);
-        Check_CLI_Parameter_CLI_INPUT_FILE2();
+        // The compilation needs only the first input file
+        printf ("Corpus file:  \"%s\"\n", GLOBAL_CLI_COMPILE_CORPUS);
+        Check_CLI_Parameter_CLI_COMPILE_CORPUS();
+        Check_CLI_Parameter_CLI_READER_THREADS();
+        Check_CLI_Parameter_CLI_MATCH_ON();
+
+        CorpusFile_Compile(GLOBAL_CLI_INPUT_FILE, GLOBAL_CLI_COMPILE_CORPUS, (size_t) GLOBAL_CLI_READER_THREADS,
+                (GLOBAL_CLI_CJSON_PARSER) ? JSON_PARSER_CJSON : JSON_PARSER_STREAMING,
+                Get_CLI_Parameter_CLI_MATCH_ON(),
+                STOP_WORD_LIST_BIT(Exec_Config_Default_Settings()) != 0);
+
+        return EXIT_SUCCESS;
     }
-    else
+    if (GLOBAL_CLI_APPEND_CORPUS != NULL)
     {
-        PUTS_FFLUSH ("Missing second input file. Option: [-j / --input2]");
-        EXIT(EXIT_FAILURE);
+        // The append needs only the first input file
+        printf ("Corpus file:  \"%s\"\n", GLOBAL_CLI_APPEND_CORPUS);
+        Check_CLI_Parameter_CLI_APPEND_CORPUS();
+        Check_CLI_Parameter_CLI_READER_THREADS();
+        Check_CLI_Parameter_CLI_MATCH_ON();
+
+        CorpusFile_Append(GLOBAL_CLI_INPUT_FILE, GLOBAL_CLI_APPEND_CORPUS, (size_t) GLOBAL_CLI_READER_THREADS,
+                (GLOBAL_CLI_CJSON_PARSER) ? JSON_PARSER_CJSON : JSON_PARSER_STREAMING,
+                Get_CLI_Parameter_CLI_MATCH_ON());
+
+        return EXIT_SUCCESS;
     }
-    if (GLOBAL_CLI_OUTPUT_FILE != NULL)
+    if (GLOBAL_CLI_BATCH_FILE != NULL)
     {
-        printf ("Output file:  \"%s\"\n", GLOBAL_CLI_OUTPUT_FILE);
-        Check_CLI_Parameter_CLI_OUTPUT_FILE();
+        // The job list contains the second input files and the output files
+        printf ("Job list:     \"%s\"\n", GLOBAL_CLI_BATCH_FILE);
+        Check_CLI_Parameter_CLI_BATCH_FILE();
     }
     else
     {
-        PUTS_FFLUSH ("Missing output file. Option: [-o / --output]");
-        EXIT(EXIT_FAILURE);
+        if (GLOBAL_CLI_INPUT_FILE2 != NULL)
+        {
+            printf ("Input file 2: \"%s\"\n", GLOBAL_CLI_INPUT_FILE2);
+            Check_CLI_Parameter_CLI_INPUT_FILE2();
+        }
+        else
+        {
+            PUTS_FFLUSH ("Missing second input file. Option: [-j / --input2]");
+            EXIT(EXIT_FAILURE);
+        }
+        if (GLOBAL_CLI_OUTPUT_FILE != NULL)
+        {
+            printf ("Output file:  \"%s\"\n", GLOBAL_CLI_OUTPUT_FILE);
+            Check_CLI_Parameter_CLI_OUTPUT_FILE();
+        }
+        else
+        {
+            PUTS_FFLUSH ("Missing output file. Option: [-o / --output]");
+            EXIT(EXIT_FAILURE);
+        }
     }
 
+    Check_CLI_Parameter_CLI_OUTPUT_FORMAT();
+    Check_CLI_Parameter_CLI_PREALLOCATE_OUTPUT();
+    Check_CLI_Parameter_CLI_COMPRESS_OUTPUT();
+    Check_CLI_Parameter_CLI_COUNTS_ONLY();
+    Check_CLI_Parameter_CLI_READER_THREADS();
+    Check_CLI_Parameter_CLI_STOP_WORD_FILES();
+    Check_CLI_Parameter_CLI_MAX_DOCUMENT_FREQUENCY();
+    Check_CLI_Parameter_CLI_MATCH_ON();
     Check_CLI_Parameter_Logical_Consistency();
     puts("");
 
@@ -332,15 +429,30 @@ Run_All_Test_Functions
 {
     RUN(TEST_Intersection);
     RUN(TEST_Tokenize_String);
+    RUN(TEST_Tokenize_String_Into_Buffer);
+    RUN(TEST_JSON_Writer_Equal_With_cJSON_Print);
+    RUN(TEST_JSON_Writer_Escaped_String_Equal_With_String);
+    RUN(TEST_Async_File_Writer);
+    RUN(TEST_Compressed_Output_Read_Line_By_Line);
+    RUN(TEST_Stop_Word_Table);
+    RUN(TEST_Token_Classifier);
+    RUN(TEST_UTF8_Length_Equal_With_u8_strlen);
 
     RUN(TEST_cJSON_Parse_JSON_Fragment);
     RUN(TEST_cJSON_Get_Token_Array_From_JSON_Fragment);
     RUN(TEST_cJSON_Parse_Full_JSON_File);
+    RUN(TEST_cJSON_In_Situ_Parse_Equal_With_Default_Parse);
+    RUN(TEST_cJSON_Arena_Parse_Equal_With_Default_Parse);
 
     RUN(TEST_Number_Of_Tokenarrays);
     RUN(TEST_Max_Dataset_ID_Length);
     RUN(TEST_Max_Tokenarray_Length);
     RUN(TEST_Length_Of_The_First_25_Tokenarrays);
+    RUN(TEST_Parallel_Read_Equal_With_Serial_Read);
+    RUN(TEST_Streaming_Scanner_Equal_With_cJSON_Parser);
+    RUN(TEST_Encoded_Corpus_Equal_With_Token_List_Container);
+    RUN(TEST_Compressed_Read_Equal_With_Uncompressed_Read);
+    RUN(TEST_Lemma_Read_Keeps_The_Surface_Offsets);
 
     RUN(TEST_MD5_Of_Test_Files);
 
@@ -350,6 +462,18 @@ Run_All_Test_Functions
     RUN(TEST_Number_Of_Sets_Equal_With_Switched_Input_Files);
     RUN(TEST_Number_Of_Tokens_Equal_With_Switched_Input_Files_JSON_And_CSV);
     RUN(TEST_Number_Of_Sets_Equal_With_Switched_Input_Files_JSON_And_CSV);
+    RUN(TEST_Number_Of_Tokens_And_Sets_Found_In_Count_Only_Mode);
+    RUN(TEST_Binary_Result_File_Equal_With_JSON_Result_File);
+    RUN(TEST_Batch_Mode_Equal_With_Single_Runs);
+    RUN(TEST_Compiled_Corpus_Equal_With_Input_File);
+    RUN(TEST_Appended_Corpus_Equal_With_Input_Files);
+    RUN(TEST_Corpus_File_Saves_The_Token_Array);
+    RUN(TEST_Dynamic_Stop_Words_Removed_From_Corpus);
+    RUN(TEST_No_Auto_Stop_Words_Without_Max_DF);
+    RUN(TEST_Stop_Words_Removed_While_Encoding);
+    RUN(TEST_Compiled_Corpus_Without_Stop_Words_Stays_Mapped);
+    RUN(TEST_Stop_Word_File_Removed_While_Encoding);
+    RUN(TEST_Stop_Word_File_Removed_From_Compiled_Corpus);
 
     RUN(TEST_Number_Of_Free_Calls);
     RUN(TEST_ANSI_Esc_Seq);